@@ -0,0 +1,210 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : alloc_guard.cpp
+*   Purpose : Replaces malloc() and friends (and so operator new) with
+*             versions that count allocations and abort on one made
+*             while the guard is armed.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdlib>
+#include <cerrno>
+#include <atomic>
+#include <unistd.h>
+#include <execinfo.h>
+
+#include "alloc_guard.h"
+
+/* glibc's own allocator, under the names it exports for this */
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *p, size_t size);
+    void *__libc_memalign(size_t alignment, size_t size);
+}
+
+static std::atomic<bool> armed(false);
+static std::atomic<unsigned long> allocations(0);
+static std::atomic<unsigned long> pausedAllocations(0);
+
+/* static TLS in the program itself, using it never allocates */
+static thread_local bool paused = false;
+
+void AllocGuardArm(void)
+{
+    void *frames[4];
+
+    /* the first backtrace() loads the unwinder, which allocates */
+    backtrace(frames, 4);
+    armed.store(true);
+}
+
+
+void AllocGuardDisarm(void)
+{
+    armed.store(false);
+}
+
+
+void AllocGuardPause(void)
+{
+    paused = true;
+}
+
+
+void AllocGuardResume(void)
+{
+    paused = false;
+}
+
+
+unsigned long AllocGuardCount(void)
+{
+    return allocations.load();
+}
+
+
+unsigned long AllocGuardPausedCount(void)
+{
+    return pausedAllocations.load();
+}
+
+
+/* no stdio, it could allocate */
+static void Fail(size_t size)
+{
+    void *frames[32];
+    char message[64];
+    char digits[20];
+    int length;
+    int count;
+
+    armed.store(false);
+    length = 0;
+
+    for (const char *p = "\r\nalloc guard: "; '\0' != *p; p++)
+    {
+        message[length++] = *p;
+    }
+
+    count = 0;
+
+    do
+    {
+        digits[count++] = '0' + size % 10;
+        size /= 10;
+    } while (size > 0);
+
+    while (count > 0)
+    {
+        message[length++] = digits[--count];
+    }
+
+    for (const char *p = " byte allocation\r\n"; '\0' != *p; p++)
+    {
+        message[length++] = *p;
+    }
+
+    write(STDERR_FILENO, message, length);
+
+    /* addr2line -e <program> turns the addresses into lines */
+    backtrace_symbols_fd(frames, backtrace(frames, 32), STDERR_FILENO);
+    abort();
+}
+
+
+static inline void Count(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (!armed.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if (paused)
+    {
+        pausedAllocations.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Fail(size);
+}
+
+
+extern "C" void *malloc(size_t size)
+{
+    Count(size);
+    return __libc_malloc(size);
+}
+
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    Count(count * size);
+    return __libc_calloc(count, size);
+}
+
+
+extern "C" void *realloc(void *p, size_t size)
+{
+    Count(size);
+    return __libc_realloc(p, size);
+}
+
+
+extern "C" void *memalign(size_t alignment, size_t size)
+{
+    Count(size);
+    return __libc_memalign(alignment, size);
+}
+
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size)
+{
+    Count(size);
+    return __libc_memalign(alignment, size);
+}
+
+
+extern "C" int posix_memalign(void **p, size_t alignment, size_t size)
+{
+    void *result;
+
+    Count(size);
+    result = __libc_memalign(alignment, size);
+
+    if (nullptr == result)
+    {
+        return ENOMEM;
+    }
+
+    *p = result;
+    return 0;
+}
@@ -0,0 +1,59 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : alloc_guard.h
+*   Purpose : Header for the allocation guard, which fails a test build
+*             of the game that allocates memory once it's running.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __ALLOC_GUARD_H
+#define  __ALLOC_GUARD_H
+
+/*
+ * Linking alloc_guard.o into a program replaces malloc(), calloc(),
+ * realloc() and the aligned allocators, which operator new uses too, for
+ * every thread and library in the program.  Each allocation is counted.
+ * Once armed, the first allocation writes its size and a backtrace to
+ * stderr and calls abort().
+ */
+void AllocGuardArm(void);
+void AllocGuardDisarm(void);
+
+/*
+ * Allow the calling thread's allocations, other threads are still checked.
+ * The one exception is a terminal resize: ncurses reallocates its screens
+ * in resizeterm() and has no way to do it in place.
+ */
+void AllocGuardPause(void);
+void AllocGuardResume(void);
+
+/* allocations made so far, and how many of them were while paused */
+unsigned long AllocGuardCount(void);
+unsigned long AllocGuardPausedCount(void);
+
+#endif /* ndef  __ALLOC_GUARD_H */
@@ -0,0 +1,982 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : ansi_output.cpp
+*   Purpose : Bandwidth minimizing terminal output.  Sends the changes in
+*             the ncurses virtual screen using the cheapest ANSI cursor
+*             motions and merged attribute changes.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <cwchar>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <term.h>
+
+#include "ansi_output.h"
+
+/*
+ * ncurses keeps the virtual screen (newscr) up to date with wnoutrefresh(),
+ * but its own doupdate() always positions with full CUP sequences and
+ * resets the attributes at the end of every update.  This class replaces
+ * doupdate() for ANSI terminals.  For every cell that differs from what was
+ * last sent it picks the cheapest of:
+ *      CUP, VPA/CHA (absolute row or column)
+ *      CUU/CUD/CUF/CUB (relative moves), CR and backspace
+ *      rewriting the characters that are already on the screen
+ * and only sends the SGR parameters that changed from the previous cell.
+ *
+ * Writes never block.  An update is built in the output queue and written
+ * as far as the terminal will take it, the rest is written by Drain() when
+ * the terminal is writable again.  If the previous update is still in the
+ * queue, the next update is dropped.  Its changes stay marked in the
+ * virtual screen, so they are coalesced into the first update that goes
+ * out after the queue drains.
+ */
+
+static const char CSI[] = "\033[";
+static const int MAX_REPRINT = 8;   /* longer runs never beat CUF */
+static const int MAX_CELL_BYTES = 48;   /* worst case move + SGR + char */
+
+/* VT100 alternate character set to Unicode (box() uses these) */
+wchar_t AnsiOutput::AcsToUnicode(wchar_t ch)
+{
+    switch (ch)
+    {
+        case 'j': return L'┘';
+        case 'k': return L'┐';
+        case 'l': return L'┌';
+        case 'm': return L'└';
+        case 'n': return L'┼';
+        case 'q': return L'─';
+        case 't': return L'├';
+        case 'u': return L'┤';
+        case 'v': return L'┴';
+        case 'w': return L'┬';
+        case 'x': return L'│';
+        case 'a': return L'▒';
+        case '0': return L'█';
+        case '~': return L'·';
+        default: return ch;
+    }
+}
+
+
+/* number of characters in the decimal representation of n (n >= 0) */
+static int NumLen(int n)
+{
+    int len;
+
+    for (len = 1; n >= 10; n /= 10)
+    {
+        len++;
+    }
+
+    return len;
+}
+
+
+/* UTF-8 encoding of the character in a cell, returns the byte count */
+static int EncodeCell(const term_cell_t *cell, char *out)
+{
+    wchar_t ch;
+    mbstate_t state;
+    size_t len;
+
+    ch = cell->ch;
+
+    if (cell->attr & A_ALTCHARSET)
+    {
+        ch = AnsiOutput::AcsToUnicode(ch);
+    }
+
+    if ((0 == ch) || (ch < L' '))
+    {
+        ch = L' ';
+    }
+
+    memset(&state, 0, sizeof(state));
+    len = wcrtomb(out, ch, &state);
+
+    if ((size_t)-1 == len)
+    {
+        /* not representable in this locale */
+        out[0] = '?';
+        len = 1;
+    }
+
+    return (int)len;
+}
+
+
+static bool SameCell(const term_cell_t *a, const term_cell_t *b)
+{
+    return (a->ch == b->ch) && (a->attr == b->attr) && (a->pair == b->pair);
+}
+
+
+static double Elapsed(const struct timespec *since)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - since->tv_sec) +
+        (now.tv_nsec - since->tv_nsec) / 1.0e9;
+}
+
+
+AnsiOutput::AnsiOutput(int fd)
+{
+    char *name;
+
+    /*
+     * use a separate open of the terminal for non-blocking writes, setting
+     * O_NONBLOCK on fd would change the file shared with stdin and the shell
+     */
+    name = ttyname(fd);
+    outFd = (nullptr == name) ? -1 : open(name, O_WRONLY | O_NOCTTY);
+    ownFd = (outFd >= 0);
+
+    if (!ownFd)
+    {
+        outFd = fd;
+    }
+
+    fcntl(outFd, F_SETFL, fcntl(outFd, F_GETFL) | O_NONBLOCK);
+
+    rows = 0;
+    cols = 0;
+    sent = nullptr;
+    line = nullptr;
+    valid = false;
+    useColor = has_colors();
+    useBce = (tigetflag((char *)"bce") > 0);
+    cursorY = -1;
+    cursorX = -1;
+    curAttr = A_NORMAL;
+    curPair = -2;
+    buffer = nullptr;
+    bufferSize = 0;
+    length = 0;
+    sentLength = 0;
+    overflow = false;
+    framesSent = 0;
+    framesDropped = 0;
+    bytesWritten = 0;
+    blockedSince.tv_sec = 0;
+    blockedSince.tv_nsec = 0;
+    blockedTime = 0.0;
+}
+
+
+AnsiOutput::~AnsiOutput(void)
+{
+    if (ownFd)
+    {
+        close(outFd);
+    }
+    else
+    {
+        fcntl(outFd, F_SETFL, fcntl(outFd, F_GETFL) & ~O_NONBLOCK);
+    }
+
+    free(sent);
+    free(line);
+    free(buffer);
+}
+
+
+/* true if the current terminal positions the cursor with ANSI sequences */
+bool AnsiOutput::IsSupported(void)
+{
+    static const char ANSI_CUP[] = "\033[%i%p1%d;%p2%dH";
+    char *cup;
+
+    cup = tigetstr((char *)"cup");
+
+    if ((nullptr == cup) || ((char *)-1 == cup))
+    {
+        return false;
+    }
+
+    return (strncmp(cup, ANSI_CUP, strlen(ANSI_CUP)) == 0);
+}
+
+
+/*
+ * The buffers for the new size are allocated before the old ones are
+ * freed, so a failed resize keeps the old size and buffers and the next
+ * Update() tries again.  Output still waiting for the terminal is kept,
+ * the terminal would see half an escape sequence otherwise.
+ */
+bool AnsiOutput::Resize(int newRows, int newCols)
+{
+    term_cell_t *newSent;
+    cchar_t *newLine;
+    char *newBuffer;
+    size_t newBufferSize;
+    size_t pending;
+
+    pending = length - sentLength;
+    newSent = (term_cell_t *)calloc((size_t)newRows * newCols,
+        sizeof(term_cell_t));
+    newLine = (cchar_t *)calloc(newCols + 1, sizeof(cchar_t));
+    newBufferSize = (size_t)newRows * newCols * MAX_CELL_BYTES + 64;
+
+    if (newBufferSize < pending)
+    {
+        newBufferSize = pending;
+    }
+
+    newBuffer = (char *)malloc(newBufferSize);
+
+    if ((nullptr == newSent) || (nullptr == newLine) ||
+        (nullptr == newBuffer))
+    {
+        free(newSent);
+        free(newLine);
+        free(newBuffer);
+        return false;
+    }
+
+    if (pending > 0)
+    {
+        memcpy(newBuffer, buffer + sentLength, pending);
+    }
+
+    free(sent);
+    free(line);
+    free(buffer);
+
+    rows = newRows;
+    cols = newCols;
+    sent = newSent;
+    line = newLine;
+    buffer = newBuffer;
+    bufferSize = newBufferSize;
+    length = pending;
+    sentLength = 0;
+
+    Invalidate();
+    return true;
+}
+
+
+/* the terminal contents are unknown, the next update redraws everything */
+void AnsiOutput::Invalidate(void)
+{
+    valid = false;
+    cursorY = -1;
+    cursorX = -1;
+    curPair = -2;
+}
+
+
+void AnsiOutput::Put(const char *str, size_t len)
+{
+    if (length + len > bufferSize)
+    {
+        /* shouldn't happen, the queue holds a full screen redraw */
+        overflow = true;
+        return;
+    }
+
+    memcpy(buffer + length, str, len);
+    length += len;
+}
+
+
+void AnsiOutput::PutNumber(int n)
+{
+    char digits[16];
+    int len;
+
+    len = NumLen(n);
+
+    for (int i = len - 1; i >= 0; i--)
+    {
+        digits[i] = '0' + (n % 10);
+        n /= 10;
+    }
+
+    Put(digits, len);
+}
+
+
+/*
+ * Cost in bytes of rewriting the cells [fromX, toX) of row y with what the
+ * terminal already shows there.  It's only possible if the cells are known
+ * and use the current attributes.  Returns INT_MAX if it isn't possible.
+ */
+int AnsiOutput::ReprintCost(int y, int fromX, int toX, bool emit)
+{
+    char utf8[MB_LEN_MAX];
+    int cost;
+
+    if ((toX - fromX > MAX_REPRINT) || (toX <= fromX))
+    {
+        return INT_MAX;
+    }
+
+    cost = 0;
+
+    for (int x = fromX; x < toX; x++)
+    {
+        const term_cell_t *cell = &sent[y * cols + x];
+        int len;
+
+        if ((0 == cell->ch) || (cell->attr != curAttr) ||
+            (cell->pair != curPair) || (wcwidth(cell->ch) != 1))
+        {
+            return INT_MAX;
+        }
+
+        len = EncodeCell(cell, utf8);
+        cost += len;
+
+        if (emit)
+        {
+            Put(utf8, len);
+        }
+    }
+
+    return cost;
+}
+
+
+/*
+ * Cost in bytes of moving the cursor to (y, x).  If emit is true the
+ * cheapest move is added to the output and the cursor position updated.
+ */
+int AnsiOutput::MoveCost(int y, int x, bool emit)
+{
+    enum { V_NONE, V_DOWN, V_UP, V_ABS } vMove;
+    enum { H_NONE, H_RIGHT, H_REPRINT, H_BACK, H_LEFT, H_ABS, H_CR_RIGHT,
+        H_CR_REPRINT, H_CR } hMove;
+    int cupCost;
+    int vCost, hCost;
+    int dy, dx;
+    int cost;
+
+    if ((y == cursorY) && (x == cursorX))
+    {
+        return 0;
+    }
+
+    /* absolute position is always possible */
+    if (0 == x)
+    {
+        cupCost = (0 == y) ? 3 : 3 + NumLen(y + 1);
+    }
+    else
+    {
+        cupCost = 4 + NumLen(y + 1) + NumLen(x + 1);
+    }
+
+    vMove = V_NONE;
+    hMove = H_NONE;
+    vCost = INT_MAX;
+    hCost = INT_MAX;
+
+    if (cursorY >= 0 && cursorX >= 0)
+    {
+        /* vertical component, the column doesn't change */
+        dy = y - cursorY;
+
+        if (0 == dy)
+        {
+            vCost = 0;
+        }
+        else
+        {
+            vMove = (dy > 0) ? V_DOWN : V_UP;
+            vCost = (1 == abs(dy)) ? 3 : 3 + NumLen(abs(dy));
+
+            if (3 + NumLen(y + 1) < vCost)
+            {
+                vMove = V_ABS;
+                vCost = 3 + NumLen(y + 1);
+            }
+        }
+
+        /* horizontal component on the destination row */
+        dx = x - cursorX;
+        hCost = 3 + NumLen(x + 1);      /* CHA */
+        hMove = H_ABS;
+
+        if (0 == dx)
+        {
+            hCost = 0;
+            hMove = H_NONE;
+        }
+        else if (dx > 0)
+        {
+            cost = (1 == dx) ? 3 : 3 + NumLen(dx);
+
+            if (cost < hCost)
+            {
+                hCost = cost;
+                hMove = H_RIGHT;
+            }
+
+            cost = ReprintCost(y, cursorX, x, false);
+
+            if (cost < hCost)
+            {
+                hCost = cost;
+                hMove = H_REPRINT;
+            }
+        }
+        else
+        {
+            if (-dx < hCost)
+            {
+                hCost = -dx;
+                hMove = H_BACK;
+            }
+
+            cost = (-1 == dx) ? 3 : 3 + NumLen(-dx);
+
+            if (cost < hCost)
+            {
+                hCost = cost;
+                hMove = H_LEFT;
+            }
+        }
+
+        /* carriage return, then right */
+        if (0 == x)
+        {
+            if (1 < hCost)
+            {
+                hCost = 1;
+                hMove = H_CR;
+            }
+        }
+        else
+        {
+            cost = 1 + ((1 == x) ? 3 : 3 + NumLen(x));
+
+            if (cost < hCost)
+            {
+                hCost = cost;
+                hMove = H_CR_RIGHT;
+            }
+
+            cost = ReprintCost(y, 0, x, false);
+
+            if ((INT_MAX != cost) && (1 + cost < hCost))
+            {
+                hCost = 1 + cost;
+                hMove = H_CR_REPRINT;
+            }
+        }
+    }
+
+    if ((INT_MAX == vCost) || (INT_MAX == hCost) ||
+        (cupCost <= vCost + hCost))
+    {
+        /* absolute move */
+        if (emit)
+        {
+            Put(CSI, 2);
+
+            if ((0 != y) || (0 != x))
+            {
+                PutNumber(y + 1);
+
+                if (0 != x)
+                {
+                    Put(";", 1);
+                    PutNumber(x + 1);
+                }
+            }
+
+            Put("H", 1);
+            cursorY = y;
+            cursorX = x;
+        }
+
+        return cupCost;
+    }
+
+    if (!emit)
+    {
+        return vCost + hCost;
+    }
+
+    /* relative move, vertical first so a reprint uses the right row */
+    dy = abs(y - cursorY);
+
+    switch (vMove)
+    {
+        case V_DOWN:
+        case V_UP:
+            Put(CSI, 2);
+
+            if (dy > 1)
+            {
+                PutNumber(dy);
+            }
+
+            Put((V_DOWN == vMove) ? "B" : "A", 1);
+            break;
+
+        case V_ABS:
+            Put(CSI, 2);
+            PutNumber(y + 1);
+            Put("d", 1);
+            break;
+
+        default:
+            break;
+    }
+
+    cursorY = y;
+    dx = abs(x - cursorX);
+
+    switch (hMove)
+    {
+        case H_RIGHT:
+        case H_LEFT:
+            Put(CSI, 2);
+
+            if (dx > 1)
+            {
+                PutNumber(dx);
+            }
+
+            Put((H_RIGHT == hMove) ? "C" : "D", 1);
+            break;
+
+        case H_REPRINT:
+            ReprintCost(y, cursorX, x, true);
+            break;
+
+        case H_BACK:
+            for (int i = 0; i < dx; i++)
+            {
+                Put("\b", 1);
+            }
+            break;
+
+        case H_ABS:
+            Put(CSI, 2);
+            PutNumber(x + 1);
+            Put("G", 1);
+            break;
+
+        case H_CR:
+            Put("\r", 1);
+            break;
+
+        case H_CR_RIGHT:
+            Put("\r", 1);
+            Put(CSI, 2);
+
+            if (x > 1)
+            {
+                PutNumber(x);
+            }
+
+            Put("C", 1);
+            break;
+
+        case H_CR_REPRINT:
+            Put("\r", 1);
+            ReprintCost(y, 0, x, true);
+            break;
+
+        default:
+            break;
+    }
+
+    cursorX = x;
+    return vCost + hCost;
+}
+
+
+/* send the SGR parameters needed to get from the current attributes */
+void AnsiOutput::SetAttributes(attr_t attr, short pair)
+{
+    static const struct
+    {
+        attr_t attr;
+        const char *on;
+        const char *off;
+    } SGR[] =
+    {
+        {A_BOLD, "1", "22"},
+        {A_DIM, "2", "22"},
+        {A_ITALIC, "3", "23"},
+        {A_UNDERLINE, "4", "24"},
+        {A_BLINK, "5", "25"},
+        {A_REVERSE, "7", "27"},
+        {A_INVIS, "8", "28"}
+    };
+    static const int SGR_COUNT = sizeof(SGR) / sizeof(SGR[0]);
+
+    char reset[64], delta[64];
+    size_t resetLen, deltaLen;
+    short fg, bg, curFg, curBg;
+    bool known;
+
+    attr &= ~A_ALTCHARSET;      /* handled when the character is encoded */
+
+    if ((attr == curAttr) && (pair == curPair))
+    {
+        return;
+    }
+
+    fg = -1;
+    bg = -1;
+
+    if (useColor && (pair >= 0))
+    {
+        pair_content(pair, &fg, &bg);
+    }
+
+    curFg = -1;
+    curBg = -1;
+    known = (curPair >= -1);
+
+    if (useColor && (curPair >= 0))
+    {
+        pair_content(curPair, &curFg, &curBg);
+    }
+
+    /* option 1: reset everything, then set what's needed */
+    resetLen = 0;
+
+    for (int i = 0; i < SGR_COUNT; i++)
+    {
+        if (attr & SGR[i].attr)
+        {
+            resetLen += sprintf(reset + resetLen, ";%s", SGR[i].on);
+        }
+    }
+
+    if (fg >= 0)
+    {
+        resetLen += sprintf(reset + resetLen, ";%d", 30 + fg);
+    }
+
+    if (bg >= 0)
+    {
+        resetLen += sprintf(reset + resetLen, ";%d", 40 + bg);
+    }
+
+    /* option 2: only change what's different */
+    deltaLen = INT_MAX;
+
+    if (known)
+    {
+        attr_t turnedOff = curAttr & ~attr;
+        attr_t turnOn = attr & ~curAttr;
+
+        deltaLen = 0;
+
+        if (turnedOff & (A_BOLD | A_DIM))
+        {
+            /* 22 turns off both, put back the one that stays on */
+            turnOn |= attr & (A_BOLD | A_DIM);
+        }
+
+        for (int i = 0; i < SGR_COUNT; i++)
+        {
+            if ((turnedOff & SGR[i].attr) &&
+                !((A_DIM == SGR[i].attr) && (turnedOff & A_BOLD)))
+            {
+                deltaLen += sprintf(delta + deltaLen, ";%s", SGR[i].off);
+            }
+        }
+
+        for (int i = 0; i < SGR_COUNT; i++)
+        {
+            if (turnOn & SGR[i].attr)
+            {
+                deltaLen += sprintf(delta + deltaLen, ";%s", SGR[i].on);
+            }
+        }
+
+        if (fg != curFg)
+        {
+            deltaLen += sprintf(delta + deltaLen, ";%d",
+                (fg >= 0) ? 30 + fg : 39);
+        }
+
+        if (bg != curBg)
+        {
+            deltaLen += sprintf(delta + deltaLen, ";%d",
+                (bg >= 0) ? 40 + bg : 49);
+        }
+
+        if (0 == deltaLen)
+        {
+            /* different pair, but it looks the same */
+            curAttr = attr;
+            curPair = pair;
+            return;
+        }
+    }
+
+    Put(CSI, 2);
+
+    if (deltaLen <= resetLen + 1)
+    {
+        /* skip the leading ';' */
+        if (deltaLen > 0)
+        {
+            Put(delta + 1, deltaLen - 1);
+        }
+    }
+    else if (resetLen > 0)
+    {
+        /* "0" is implied by an empty first parameter */
+        Put(reset, resetLen);
+    }
+
+    Put("m", 1);
+    curAttr = attr;
+    curPair = pair;
+}
+
+
+void AnsiOutput::PutCell(int y, int x, const term_cell_t *cell)
+{
+    char utf8[MB_LEN_MAX];
+    int len;
+
+    MoveCost(y, x, true);
+    SetAttributes(cell->attr, cell->pair);
+    len = EncodeCell(cell, utf8);
+    Put(utf8, len);
+    sent[y * cols + x] = *cell;
+
+    /* the cursor doesn't advance past the last column (pending wrap) */
+    cursorX = (x + 1 < cols) ? x + 1 : -1;
+}
+
+
+/* clear the terminal using the background of pair (if it's honored) */
+void AnsiOutput::Clear(short pair)
+{
+    term_cell_t blank;
+
+    if (!useBce)
+    {
+        /* cleared cells get the terminal default colors */
+        pair = -1;
+    }
+
+    SetAttributes(A_NORMAL, pair);
+    Put("\033[H\033[2J", 7);
+    cursorY = 0;
+    cursorX = 0;
+
+    blank.ch = L' ';
+    blank.attr = A_NORMAL;
+    blank.pair = pair;
+
+    for (int i = 0; i < rows * cols; i++)
+    {
+        sent[i] = blank;
+    }
+}
+
+
+/* write as much of the queue as the terminal will take without blocking */
+bool AnsiOutput::Drain(void)
+{
+    while (sentLength < length)
+    {
+        ssize_t result;
+
+        result = write(outFd, buffer + sentLength, length - sentLength);
+
+        if (result > 0)
+        {
+            sentLength += result;
+            bytesWritten += result;
+        }
+        else if ((result < 0) && (EINTR == errno))
+        {
+            continue;
+        }
+        else
+        {
+            /* EAGAIN, the terminal isn't keeping up */
+            if ((0 == blockedSince.tv_sec) && (0 == blockedSince.tv_nsec))
+            {
+                clock_gettime(CLOCK_MONOTONIC, &blockedSince);
+            }
+
+            if ((result < 0) && (EAGAIN != errno) && (EWOULDBLOCK != errno))
+            {
+                /* the terminal is gone, throw the output away */
+                sentLength = length;
+            }
+
+            return false;
+        }
+    }
+
+    if ((0 != blockedSince.tv_sec) || (0 != blockedSince.tv_nsec))
+    {
+        blockedTime += Elapsed(&blockedSince);
+        blockedSince.tv_sec = 0;
+        blockedSince.tv_nsec = 0;
+    }
+
+    return true;
+}
+
+
+/* drain the queue, waiting up to timeoutMs for the terminal (shutdown) */
+void AnsiOutput::Finish(int timeoutMs)
+{
+    struct pollfd fdPoll;
+
+    fdPoll.fd = outFd;
+    fdPoll.events = POLLOUT;
+
+    while (!Drain())
+    {
+        if (poll(&fdPoll, 1, timeoutMs) <= 0)
+        {
+            break;
+        }
+    }
+}
+
+
+void AnsiOutput::GetStats(output_stats_t *stats) const
+{
+    stats->framesSent = framesSent;
+    stats->framesDropped = framesDropped;
+    stats->bytesWritten = bytesWritten;
+    stats->blockedTime = blockedTime;
+
+    if ((0 != blockedSince.tv_sec) || (0 != blockedSince.tv_nsec))
+    {
+        /* still blocked */
+        stats->blockedTime += Elapsed(&blockedSince);
+    }
+}
+
+
+size_t AnsiOutput::Update(WINDOW *scr)
+{
+    int scrRows, scrCols;
+
+    if (IsPending() && !Drain())
+    {
+        /* the last update is still queued, leave the changes for later */
+        framesDropped++;
+        return 0;
+    }
+
+    getmaxyx(scr, scrRows, scrCols);
+
+    if ((scrRows != rows) || (scrCols != cols))
+    {
+        if (!Resize(scrRows, scrCols))
+        {
+            return 0;
+        }
+    }
+
+    length = 0;
+    sentLength = 0;
+    overflow = false;
+
+    if (!valid)
+    {
+        cchar_t corner;
+        attr_t attrs;
+        short pair;
+        wchar_t wch[CCHARW_MAX + 1];
+
+        /* start over with the background of the top left corner */
+        mvwin_wch(scr, 0, 0, &corner);
+        getcchar(&corner, wch, &attrs, &pair, nullptr);
+        Clear(pair);
+    }
+
+    for (int y = 0; y < rows; y++)
+    {
+        if (valid && !is_linetouched(scr, y))
+        {
+            continue;
+        }
+
+        mvwin_wchnstr(scr, y, 0, line, cols);
+
+        for (int x = 0; x < cols; x++)
+        {
+            term_cell_t cell;
+            attr_t attrs;
+            short pair;
+            wchar_t wch[CCHARW_MAX + 1];
+
+            if (getcchar(&line[x], wch, &attrs, &pair, nullptr) == ERR)
+            {
+                continue;
+            }
+
+            cell.ch = (0 == wch[0]) ? L' ' : wch[0];
+            cell.attr = attrs & ~A_COLOR;
+            cell.pair = pair;
+
+            if (SameCell(&cell, &sent[y * cols + x]))
+            {
+                continue;
+            }
+
+            if ((rows - 1 == y) && (cols - 1 == x))
+            {
+                /* writing the last cell could scroll the screen */
+                continue;
+            }
+
+            PutCell(y, x, &cell);
+        }
+    }
+
+    /* everything in the virtual screen has been queued */
+    wtouchln(scr, 0, rows, 0);
+    valid = !overflow;
+    framesSent++;
+
+    Drain();
+    return length;
+}
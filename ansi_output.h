@@ -0,0 +1,118 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : ansi_output.h
+*   Purpose : Bandwidth minimizing terminal output.  Sends the changes in
+*             the ncurses virtual screen using the cheapest ANSI cursor
+*             motions and merged attribute changes.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __ANSI_OUTPUT_H
+#define  __ANSI_OUTPUT_H
+
+#include <ncurses.h>
+#include <cstddef>
+#include <ctime>
+
+/* a terminal cell the way it was sent */
+typedef struct
+{
+    wchar_t ch;         /* character (0 if unknown) */
+    attr_t attr;        /* video attributes without the color pair */
+    short pair;         /* color pair, -1 for the terminal's default */
+} term_cell_t;
+
+/* output queue statistics */
+typedef struct
+{
+    unsigned long framesSent;       /* updates queued for the terminal */
+    unsigned long framesDropped;    /* updates skipped, queue not drained */
+    size_t bytesWritten;            /* bytes the terminal has accepted */
+    double blockedTime;             /* seconds the terminal wasn't keeping up */
+} output_stats_t;
+
+class AnsiOutput
+{
+    public:
+        AnsiOutput(int fd);
+        ~AnsiOutput(void);
+
+        static bool IsSupported(void);
+        static wchar_t AcsToUnicode(wchar_t ch);
+
+        bool Resize(int rows, int cols);
+        void Invalidate(void);
+
+        /* queue the changed lines of scr (normally newscr) for output */
+        size_t Update(WINDOW *scr);
+
+        /* non-blocking output queue */
+        int GetFd(void) const { return outFd; }
+        bool IsPending(void) const { return sentLength < length; }
+        bool Drain(void);
+        void Finish(int timeoutMs);
+        void GetStats(output_stats_t *stats) const;
+
+    private:
+        int outFd;              /* non-blocking terminal file descriptor */
+        bool ownFd;             /* outFd was opened here and must be closed */
+        int rows;               /* terminal rows */
+        int cols;               /* terminal columns */
+        term_cell_t *sent;      /* what the terminal is showing */
+        cchar_t *line;          /* line read from the virtual screen */
+        bool valid;             /* false if the terminal contents are unknown */
+        bool useColor;          /* terminal supports ANSI colors */
+        bool useBce;            /* clearing uses the current background */
+
+        int cursorY;            /* cursor position, -1 if unknown */
+        int cursorX;
+        attr_t curAttr;         /* current attributes, curPair < -1 unknown */
+        short curPair;
+
+        char *buffer;           /* output queue, holds one update */
+        size_t bufferSize;
+        size_t length;          /* bytes in the queue */
+        size_t sentLength;      /* bytes of the queue already written */
+        bool overflow;          /* an update didn't fit in the queue */
+
+        unsigned long framesSent;
+        unsigned long framesDropped;
+        size_t bytesWritten;    /* total bytes sent to the terminal */
+        struct timespec blockedSince;   /* when writing started to block */
+        double blockedTime;     /* seconds spent with a backed up queue */
+
+        void Put(const char *str, size_t len);
+        void PutNumber(int n);
+        int MoveCost(int y, int x, bool emit);
+        int ReprintCost(int y, int fromX, int toX, bool emit);
+        void SetAttributes(attr_t attr, short pair);
+        void PutCell(int y, int x, const term_cell_t *cell);
+        void Clear(short pair);
+};
+
+#endif /* ndef  __ANSI_OUTPUT_H */
@@ -0,0 +1,114 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : arena.h
+*   Purpose : Arena for the objects that last as long as the game, all
+*             of them allocated at once when it starts.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __ARENA_H
+#define  __ARENA_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <utility>
+
+/*
+ * The memory is allocated (and touched) once by the constructor, New()
+ * hands it out in order and Delete() only runs destructors, so nothing
+ * made in an arena goes back to the heap until the arena does.  New()
+ * returns nullptr when the arena is full.  Not thread safe, objects are
+ * made and destroyed by whoever owns the arena.
+ */
+class Arena
+{
+    public:
+        static const size_t ALIGNMENT = 64;     /* a cache line */
+
+        Arena(size_t size)
+        {
+            memory = new (std::align_val_t(ALIGNMENT)) unsigned char[size];
+            memset(memory, 0, size);
+            this->size = size;
+            used = 0;
+        }
+
+        ~Arena(void)
+        {
+            operator delete[](memory, std::align_val_t(ALIGNMENT));
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        template <typename T, typename... Args>
+        T *New(Args&&... args)
+        {
+            size_t start;
+
+            static_assert(alignof(T) <= ALIGNMENT, "over aligned for arena");
+
+            /* each object starts on a cache line of its own */
+            start = (used + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+            if (start + sizeof(T) > size)
+            {
+                return nullptr;
+            }
+
+            used = start + sizeof(T);
+            return new (memory + start) T(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        void Delete(T *object)
+        {
+            if (nullptr != object)
+            {
+                object->~T();
+            }
+        }
+
+        /* the size of an arena that holds one of each of Ts */
+        template <typename... Ts>
+        static constexpr size_t SizeFor(void)
+        {
+            return (0 + ... + ((sizeof(Ts) + ALIGNMENT - 1) &
+                ~(ALIGNMENT - 1)));
+        }
+
+        size_t Used(void) const { return used; }
+
+    private:
+        unsigned char *memory;
+        size_t size;
+        size_t used;
+};
+
+#endif /* ndef  __ARENA_H */
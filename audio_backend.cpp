@@ -0,0 +1,348 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : audio_backend.cpp
+*   Purpose : Null and WAV file audio backends.  The null backend renders
+*             in real time and throws the sound away, the WAV backend
+*             renders when it's told to and writes the sound to a file.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <ctime>
+
+#include "audio_backend.h"
+
+/* frames rendered at a time, the size of a typical PortAudio buffer */
+static const unsigned long BLOCK_FRAMES = 256;
+
+static const int CHANNELS = 2;
+static const uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+
+/* RIFF, fmt (with an empty extension), fact and data chunk headers */
+static const long WAV_HEADER_SIZE = 12 + 26 + 12 + 8;
+
+NullBackend::NullBackend(void)
+{
+    sampleRate = 0;
+    callback.render = nullptr;
+    callback.userData = nullptr;
+    callback.sampleRate = 0;
+    running.store(false);
+}
+
+
+NullBackend::~NullBackend(void)
+{
+    Close();
+}
+
+
+bool NullBackend::Open(int sampleRate, audio_render_t render, void *userData)
+{
+    this->sampleRate = sampleRate;
+    callback.render = render;
+    callback.userData = userData;
+    callback.sampleRate = sampleRate;
+    return true;
+}
+
+
+bool NullBackend::Start(void)
+{
+    running.store(true);
+    thread = std::thread(&NullBackend::Run, this);
+    return true;
+}
+
+
+void NullBackend::Close(void)
+{
+    running.store(false);
+
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+}
+
+
+static long long TimespecNs(const struct timespec *t)
+{
+    return t->tv_sec * 1000000000LL + t->tv_nsec;
+}
+
+
+/*
+ * Render a block every block's worth of time, like a sound card would.  A
+ * block that's rendered after the one before it would have finished
+ * playing is reported as an underflow, and the clock starts over.
+ */
+void NullBackend::Run(void)
+{
+    float out[BLOCK_FRAMES * CHANNELS];
+    audio_status_t status;
+    struct timespec next, now;
+    long period;
+
+    period = (long)(BLOCK_FRAMES * 1000000000ULL / sampleRate);
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    status.flags = 0;
+    status.latency = 0.0;
+    status.leadNs = period;
+
+    while (running.load())
+    {
+        /* "heard" when it was due, without the wake up jitter */
+        status.timeNs = TimespecNs(&next);
+        callback.render(out, BLOCK_FRAMES, &status, callback.userData);
+        status.flags = 0;
+
+        next.tv_nsec += period;
+
+        if (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, nullptr);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        if (TimespecNs(&now) - TimespecNs(&next) > period)
+        {
+            status.flags = AUDIO_OUTPUT_UNDERFLOW;
+            next = now;
+        }
+    }
+}
+
+
+WavBackend::WavBackend(const char *fileName)
+{
+    this->fileName = fileName;
+    fp = nullptr;
+    lastError = 0;
+    sampleRate = 0;
+    framesWritten = 0;
+    framesRendered = 0;
+    callback.render = nullptr;
+    callback.userData = nullptr;
+    callback.sampleRate = 0;
+}
+
+
+WavBackend::~WavBackend(void)
+{
+    Close();
+}
+
+
+static void Put16(unsigned char *p, uint16_t value)
+{
+    p[0] = value & 0xFF;
+    p[1] = value >> 8;
+}
+
+
+static void Put32(unsigned char *p, uint32_t value)
+{
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = value >> 24;
+}
+
+
+/* the header at the start of the file, sized for what's been written */
+bool WavBackend::WriteHeader(void)
+{
+    unsigned char header[WAV_HEADER_SIZE];
+    uint32_t dataSize;
+
+    dataSize = (uint32_t)(framesWritten * CHANNELS * sizeof(float));
+
+    memcpy(header, "RIFF", 4);
+    Put32(header + 4, WAV_HEADER_SIZE - 8 + dataSize);
+    memcpy(header + 8, "WAVE", 4);
+
+    memcpy(header + 12, "fmt ", 4);
+    Put32(header + 16, 18);
+    Put16(header + 20, WAVE_FORMAT_IEEE_FLOAT);
+    Put16(header + 22, CHANNELS);
+    Put32(header + 24, sampleRate);
+    Put32(header + 28, sampleRate * CHANNELS * sizeof(float));
+    Put16(header + 32, CHANNELS * sizeof(float));
+    Put16(header + 34, 8 * sizeof(float));
+    Put16(header + 36, 0);
+
+    /* non-PCM formats also give the number of frames */
+    memcpy(header + 38, "fact", 4);
+    Put32(header + 42, 4);
+    Put32(header + 46, (uint32_t)framesWritten);
+
+    memcpy(header + 50, "data", 4);
+    Put32(header + 54, dataSize);
+
+    if (fwrite(header, sizeof(header), 1, fp) != 1)
+    {
+        lastError = errno;
+        return false;
+    }
+
+    return true;
+}
+
+
+bool WavBackend::Open(int sampleRate, audio_render_t render, void *userData)
+{
+    this->sampleRate = sampleRate;
+    callback.render = render;
+    callback.userData = userData;
+    callback.sampleRate = sampleRate;
+    framesWritten = 0;
+    framesRendered = 0;
+
+    fp = fopen(fileName, "wb");
+
+    if (nullptr == fp)
+    {
+        lastError = errno;
+        return false;
+    }
+
+    /* rewritten with the real sizes by Finish() */
+    return WriteHeader();
+}
+
+
+void WavBackend::Close(void)
+{
+    if (nullptr != fp)
+    {
+        Finish();
+    }
+}
+
+
+const char *WavBackend::ErrorText(void) const
+{
+    return strerror(lastError);
+}
+
+
+/* the game clock starts with the sound, each frame is heard in its turn */
+void WavBackend::RenderBlock(float *out, unsigned long frames)
+{
+    audio_status_t status;
+
+    status.flags = 0;
+    status.latency = 0.0;
+    status.timeNs = (long long)(framesRendered * 1000000000ULL / sampleRate);
+    status.leadNs = 0;
+    callback.render(out, frames, &status, callback.userData);
+    framesRendered += frames;
+}
+
+
+bool WavBackend::Render(unsigned long frames)
+{
+    float out[BLOCK_FRAMES * CHANNELS];
+
+    if (nullptr == fp)
+    {
+        return false;
+    }
+
+    while (frames > 0)
+    {
+        unsigned long n;
+
+        n = (frames < BLOCK_FRAMES) ? frames : BLOCK_FRAMES;
+        RenderBlock(out, n);
+
+        if (fwrite(out, sizeof(float) * CHANNELS, n, fp) != n)
+        {
+            lastError = errno;
+            return false;
+        }
+
+        framesWritten += n;
+        frames -= n;
+    }
+
+    return true;
+}
+
+
+void WavBackend::Discard(unsigned long frames)
+{
+    float out[BLOCK_FRAMES * CHANNELS];
+
+    while (frames > 0)
+    {
+        unsigned long n;
+
+        n = (frames < BLOCK_FRAMES) ? frames : BLOCK_FRAMES;
+        RenderBlock(out, n);
+        frames -= n;
+    }
+}
+
+
+bool WavBackend::Finish(void)
+{
+    bool ok;
+
+    if (nullptr == fp)
+    {
+        return 0 == lastError;
+    }
+
+    ok = (0 == lastError);
+
+    if (0 != fseek(fp, 0, SEEK_SET))
+    {
+        lastError = errno;
+        ok = false;
+    }
+    else if (!WriteHeader())
+    {
+        ok = false;
+    }
+
+    if (0 != fclose(fp))
+    {
+        lastError = errno;
+        ok = false;
+    }
+
+    fp = nullptr;
+    return ok;
+}
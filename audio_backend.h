@@ -0,0 +1,191 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : audio_backend.h
+*   Purpose : Where the mixed sound goes.  The sound code renders frames
+*             when a backend asks for them: PortAudio plays them, the null
+*             backend throws them away in real time and the WAV backend
+*             writes them to a file as fast as it's told to.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __AUDIO_BACKEND_H
+#define  __AUDIO_BACKEND_H
+
+#include <cstdio>
+#include <atomic>
+#include <thread>
+
+/* audio_status_t flags, what went wrong since the last render */
+static const unsigned int AUDIO_OUTPUT_UNDERFLOW = 0x01;   /* gap played */
+static const unsigned int AUDIO_OUTPUT_OVERFLOW = 0x02;    /* frames dropped */
+
+/*
+ * timeNs is on the game's clock: CLOCK_MONOTONIC for the backends that
+ * play in real time, and the sound's own position (frames rendered so far)
+ * for the WAV backend, whose ticks are simulated.  leadNs is how long a
+ * sound requested now takes to be heard at the earliest, the output
+ * latency plus the wait for the next buffer.
+ */
+typedef struct
+{
+    unsigned int flags;     /* AUDIO_OUTPUT_UNDERFLOW, AUDIO_OUTPUT_OVERFLOW */
+    double latency;         /* seconds until out is heard, 0 if unknown */
+    long long timeNs;       /* when out[0] is heard */
+    long long leadNs;       /* request to earliest sound, 0 if offline */
+} audio_status_t;
+
+/* fill out with frames of interleaved stereo float samples */
+typedef void (*audio_render_t)(float *out, unsigned long frames,
+    const audio_status_t *status, void *userData);
+
+typedef struct
+{
+    audio_render_t render;
+    void *userData;
+    int sampleRate;         /* frames per second render is asked for */
+} audio_callback_t;
+
+/*
+ * Open() and Start() return false if the backend can't be used, ErrorText()
+ * says why.  Once started, render may be called from another thread (and
+ * from a real-time one for PortAudio), so it must not block.
+ */
+class AudioBackend
+{
+    public:
+        virtual ~AudioBackend(void) {}
+
+        /* the device's own sample rate, 0 if any rate is as good */
+        virtual int NativeRate(void) { return 0; }
+
+        virtual bool Open(int sampleRate, audio_render_t render,
+            void *userData) = 0;
+        virtual bool Start(void) = 0;
+
+        /* stop calling render, safe to call when not open */
+        virtual void Close(void) = 0;
+
+        virtual const char *Name(void) const = 0;
+        virtual const char *ErrorText(void) const = 0;
+
+        /* seconds from rendering a frame until it's heard, 0 if unknown */
+        virtual double OutputLatency(void) const { return 0.0; }
+};
+
+
+/* the default output device */
+class PortAudioBackend : public AudioBackend
+{
+    public:
+        PortAudioBackend(void);
+        ~PortAudioBackend(void);
+
+        int NativeRate(void);
+        bool Open(int sampleRate, audio_render_t render, void *userData);
+        bool Start(void);
+        void Close(void);
+
+        const char *Name(void) const { return "portaudio"; }
+        const char *ErrorText(void) const;
+        double OutputLatency(void) const;
+
+    private:
+        int lastError;          /* PaError */
+        bool initialized;       /* Pa_Initialize() succeeded */
+        void *stream;           /* PaStream */
+        audio_callback_t callback;
+
+        bool Initialize(void);
+};
+
+
+/* renders in real time, for machines without a sound device */
+class NullBackend : public AudioBackend
+{
+    public:
+        NullBackend(void);
+        ~NullBackend(void);
+
+        bool Open(int sampleRate, audio_render_t render, void *userData);
+        bool Start(void);
+        void Close(void);
+
+        const char *Name(void) const { return "null"; }
+        const char *ErrorText(void) const { return "no error"; }
+
+    private:
+        int sampleRate;
+        audio_callback_t callback;
+        std::thread thread;
+        std::atomic<bool> running;
+
+        void Run(void);
+};
+
+
+/*
+ * Writes a 32 bit float stereo WAV file.  Nothing is rendered until
+ * Render() is called, so an offline run decides how much audio goes with
+ * each step and the file is the same every time.
+ */
+class WavBackend : public AudioBackend
+{
+    public:
+        WavBackend(const char *fileName);
+        ~WavBackend(void);
+
+        bool Open(int sampleRate, audio_render_t render, void *userData);
+        bool Start(void) { return nullptr != fp; }
+        void Close(void);
+
+        const char *Name(void) const { return "wav"; }
+        const char *ErrorText(void) const;
+
+        /* render and write frames, false if the write failed */
+        bool Render(unsigned long frames);
+
+        /* render frames without writing them (to skip ahead) */
+        void Discard(unsigned long frames);
+
+        /* write the final header and close, false if the file is bad */
+        bool Finish(void);
+
+    private:
+        const char *fileName;
+        FILE *fp;
+        int lastError;          /* errno */
+        int sampleRate;
+        unsigned long long framesWritten;
+        unsigned long long framesRendered;  /* including those discarded */
+        audio_callback_t callback;
+
+        bool WriteHeader(void);
+        void RenderBlock(float *out, unsigned long frames);
+};
+
+#endif /* ndef  __AUDIO_BACKEND_H */
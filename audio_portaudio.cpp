@@ -0,0 +1,235 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : audio_portaudio.cpp
+*   Purpose : PortAudio audio backend, plays the sound on the default
+*             output device.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <portaudio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <ctime>
+
+#include "audio_backend.h"
+
+/* This routine will be called by the PortAudio engine when audio is needed.
+** It may called at interrupt level on some machines so don't do anything
+** that could mess up the system like calling malloc() or free().
+*/
+static int PaCallback(const void *inputBuffer,
+    void *outputBuffer,
+    unsigned long framesPerBuffer,
+    const PaStreamCallbackTimeInfo* timeInfo,
+    PaStreamCallbackFlags statusFlags,
+    void *userData)
+{
+    audio_callback_t *callback = (audio_callback_t *)userData;
+    audio_status_t status;
+    struct timespec now;
+
+    /* Prevent unused variable warnings. */
+    (void)inputBuffer;
+
+    status.flags = 0;
+
+    if (statusFlags & paOutputUnderflow)
+    {
+        status.flags |= AUDIO_OUTPUT_UNDERFLOW;
+    }
+
+    if (statusFlags & paOutputOverflow)
+    {
+        status.flags |= AUDIO_OUTPUT_OVERFLOW;
+    }
+
+    /* the times are all 0 with PulseAudio */
+    status.latency = 0.0;
+
+    if ((nullptr != timeInfo) &&
+        (timeInfo->outputBufferDacTime > timeInfo->currentTime))
+    {
+        status.latency = timeInfo->outputBufferDacTime - timeInfo->currentTime;
+    }
+
+    /* the DAC time is on the stream's clock (Pa_GetStreamTime()), so move
+     * it to the game's by way of how far ahead of now it is */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    status.timeNs = now.tv_sec * 1000000000LL + now.tv_nsec +
+        (long long)(status.latency * 1e9);
+
+    /* a request can just miss this callback and wait for the next one */
+    status.leadNs = (long long)(status.latency * 1e9) +
+        (long long)(framesPerBuffer * 1e9 / callback->sampleRate);
+
+    callback->render((float *)outputBuffer, framesPerBuffer, &status,
+        callback->userData);
+
+    /* the stream keeps running (with silence) when every voice is idle */
+    return paContinue;
+}
+
+
+PortAudioBackend::PortAudioBackend(void)
+{
+    lastError = paNoError;
+    initialized = false;
+    stream = nullptr;
+    callback.render = nullptr;
+    callback.userData = nullptr;
+    callback.sampleRate = 0;
+}
+
+
+PortAudioBackend::~PortAudioBackend(void)
+{
+    Close();
+}
+
+
+/* Pa_Initialize() once, for either NativeRate() or Open() */
+bool PortAudioBackend::Initialize(void)
+{
+    int newStdErr;
+    int oldStdErr;
+
+    if (initialized)
+    {
+        return true;
+    }
+
+    /* hide ALSA error during initialization (stderr -> /dev/null) */
+    fflush(stderr);
+    oldStdErr = dup(2);
+    newStdErr = open("/dev/null", O_WRONLY);
+    dup2(newStdErr, 2);
+    close(newStdErr);
+
+    lastError = Pa_Initialize();
+
+    /* restore stderr */
+    fflush(stderr);
+    dup2(oldStdErr, 2);
+    close(oldStdErr);
+
+    initialized = (paNoError == lastError);
+    return initialized;
+}
+
+
+/* the default output device's rate, anything else is converted by the
+ * host API (PulseAudio, ALSA's plug device) with its own latency */
+int PortAudioBackend::NativeRate(void)
+{
+    const PaDeviceInfo *info;
+    PaDeviceIndex device;
+
+    if (!Initialize())
+    {
+        return 0;
+    }
+
+    device = Pa_GetDefaultOutputDevice();
+
+    if (paNoDevice == device)
+    {
+        return 0;
+    }
+
+    info = Pa_GetDeviceInfo(device);
+    return (nullptr == info) ? 0 : (int)info->defaultSampleRate;
+}
+
+
+bool PortAudioBackend::Open(int sampleRate, audio_render_t render,
+    void *userData)
+{
+    callback.render = render;
+    callback.userData = userData;
+    callback.sampleRate = sampleRate;
+
+    if (!Initialize())
+    {
+        return false;
+    }
+
+    lastError = Pa_OpenDefaultStream(&stream, 0, 2, paFloat32, sampleRate,
+        paFramesPerBufferUnspecified, PaCallback, &callback);
+
+    if (paNoError != lastError)
+    {
+        stream = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+
+/* the stream runs until it's closed, sounds only change the voices */
+bool PortAudioBackend::Start(void)
+{
+    lastError = Pa_StartStream(stream);
+    return paNoError == lastError;
+}
+
+
+void PortAudioBackend::Close(void)
+{
+    if (nullptr != stream)
+    {
+        Pa_CloseStream(stream);
+        stream = nullptr;
+    }
+
+    if (initialized)
+    {
+        Pa_Terminate();
+        initialized = false;
+    }
+}
+
+
+const char *PortAudioBackend::ErrorText(void) const
+{
+    return Pa_GetErrorText(lastError);
+}
+
+
+double PortAudioBackend::OutputLatency(void) const
+{
+    const PaStreamInfo *info;
+
+    if (nullptr == stream)
+    {
+        return 0.0;
+    }
+
+    info = Pa_GetStreamInfo(stream);
+    return (nullptr == info) ? 0.0 : info->outputLatency;
+}
@@ -0,0 +1,787 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : engine_bench.cpp
+*   Purpose : Microbenchmarks of the game loop's parts: ufo and tank
+*             moves, the hit tests, the sound callback and a whole tick.
+*             Needs no terminal or sound device, and writes its results as
+*             JSON so runs from different commits can be compared.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <ncurses.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+#include <new>
+#include <unistd.h>
+
+#include "../tankvufo.h"
+#include "../tank.h"
+#include "../ufo.h"
+#include "../sounds.h"
+#include "../audio_backend.h"
+
+/*
+ * Each case times one operation of the game loop over and over.  A case
+ * is warmed up (doubling its operations until a batch takes WARM_UP_NS),
+ * which also sizes its runs to about run time, then the run is repeated
+ * and the median ns/op is the result.  Min and max show the spread.
+ *      ufo move      Ufo::Move() from each Direction
+ *      tank shot     Tank::MoveShot() over whole flights, refired as each
+ *                    one ends
+ *      ufo shot hit  Tank::IsHitBy() (CheckUfoShot()'s test) at shots
+ *                    around the tank
+ *      tank shot     Tank::UpdateShotHit() missing, hitting and clearing
+ *                    the explosion
+ *      callback      the audio callback rendering a 256 frame buffer with
+ *                    each sound playing, restarted every RESTART_BUFFERS
+ *      tick          a whole game tick (keys, moves, hit tests, score and
+ *                    publishing the frame) with nothing rendering it
+ * The vehicles only have their own state, so a case that changes it copies
+ * a saved one back before each operation, and the copy is part of the op.
+ * Their sounds are tracked without a stream, the callback has its own
+ * Sounds rendering to a WAV backend that's never written.
+ */
+
+static const int DEFAULT_RUNS = 15;
+static const int MAX_RUNS = 101;
+static const int DEFAULT_RUN_MS = 10;
+static const long long WARM_UP_NS = 20000000LL;
+static const int MAX_CASES = 32;
+
+/* audio callback buffer, and how often a one-shot sound is restarted
+ * (64 buffers is shorter than the explosion) */
+static const unsigned long BUFFER_FRAMES = 256;
+static const unsigned long RESTART_BUFFERS = 64;
+
+static const unsigned int SYNTHETIC_SEED = 2020;
+static const int NUM_DIRECTIONS = Tvu::DIR_LANDED + 1;
+
+/* Tank::UpdateShotHit() cases */
+typedef enum
+{
+    SHOT_MISS,          /* the ufo is on another row */
+    SHOT_HIT,           /* the shot is under the ufo */
+    SHOT_CLEAR,         /* the explosion is cleared */
+    NUM_SHOT_CASES
+} shot_case_t;
+
+typedef struct
+{
+    WINDOW *pad;                    /* the vehicles' game field */
+    WINDOW *flightPad;              /* ... and the free flying shot's */
+    Sounds *quiet;                  /* no stream */
+    Sounds *mixer;                  /* rendering to wav */
+    WavBackend *wav;                /* owned by mixer, nullptr if no pack */
+    TankVUfo *game;                 /* headless, nullptr if it failed */
+    Ufo *ufo;                       /* restored before each move */
+    Ufo *ufoStart[NUM_DIRECTIONS];
+    Tank *flight;                   /* shot flies freely */
+    Tank *tank;                     /* restored before each hit test */
+    Tank *shotStart[NUM_SHOT_CASES];
+    Tvu::Pos shotUfo[NUM_SHOT_CASES];
+    unsigned int keyState;          /* xorshift for the tick's keys */
+    long long tickNs;               /* simulated game clock */
+} bench_context_t;
+
+typedef struct
+{
+    const char *name;
+    void (*run)(bench_context_t *ctx, int arg, unsigned long ops);
+    int arg;
+} bench_case_t;
+
+typedef struct
+{
+    unsigned long ops;              /* per run */
+    double medianNs;                /* per op */
+    double minNs;
+    double meanNs;
+    double maxNs;
+    double baselineNs;              /* median from -c, 0 if none */
+} bench_result_t;
+
+/* results go here so the work isn't optimized away */
+static volatile long sink;
+
+static long long MonotonicNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+static int CompareDouble(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return (da > db) - (da < db);
+}
+
+
+/* the vehicles hold a reference to their sounds, so copy instead of assign */
+template<typename T>
+static inline void Restore(T *object, const T *saved)
+{
+    object->~T();
+    new (object) T(*saved);
+}
+
+
+static void RunUfoMove(bench_context_t *ctx, int arg, unsigned long ops)
+{
+    for (unsigned long i = 0; i < ops; i++)
+    {
+        Restore(ctx->ufo, ctx->ufoStart[arg]);
+        ctx->ufo->Move();
+        sink += ctx->ufo->GetPos().x;
+    }
+}
+
+
+static void RunTankShot(bench_context_t *ctx, int arg, unsigned long ops)
+{
+    (void)arg;
+
+    for (unsigned long i = 0; i < ops; i++)
+    {
+        if (!ctx->flight->WasShotFired())
+        {
+            ctx->flight->Shoot();
+        }
+
+        ctx->flight->MoveShot();
+        sink += ctx->flight->GetShotPos().y;
+    }
+}
+
+
+static void RunUfoShotHit(bench_context_t *ctx, int arg, unsigned long ops)
+{
+    /* above the tank, then around each of its rows (the tank is at 0) */
+    static const Tvu::Pos SHOTS[16] =
+    {
+        {3, Tvu::UFO_BOTTOM}, {3, Tvu::TANK_SHOT_START_ROW},
+        {2, Tvu::TANK_GUN_ROW}, {3, Tvu::TANK_GUN_ROW},
+        {4, Tvu::TANK_GUN_ROW}, {1, Tvu::TANK_TURRET_ROW},
+        {2, Tvu::TANK_TURRET_ROW}, {3, Tvu::TANK_TURRET_ROW},
+        {4, Tvu::TANK_TURRET_ROW}, {0, Tvu::TANK_TREAD_ROW},
+        {1, Tvu::TANK_TREAD_ROW}, {2, Tvu::TANK_TREAD_ROW},
+        {4, Tvu::TANK_TREAD_ROW}, {5, Tvu::TANK_TREAD_ROW},
+        {9, Tvu::TANK_TREAD_ROW}, {12, Tvu::TANK_TURRET_ROW}
+    };
+    long hits;
+
+    (void)arg;
+    hits = 0;
+
+    for (unsigned long i = 0; i < ops; i++)
+    {
+        hits += ctx->tank->IsHitBy(SHOTS[i & 15]);
+    }
+
+    sink += hits;
+}
+
+
+static void RunTankShotHit(bench_context_t *ctx, int arg, unsigned long ops)
+{
+    for (unsigned long i = 0; i < ops; i++)
+    {
+        Restore(ctx->tank, ctx->shotStart[arg]);
+        sink += ctx->tank->UpdateShotHit(ctx->shotUfo[arg]);
+    }
+}
+
+
+static void RunCallback(bench_context_t *ctx, int arg, unsigned long ops)
+{
+    for (unsigned long i = 0; i < ops; i++)
+    {
+        if (0 == i % RESTART_BUFFERS)
+        {
+            /* nothing else playing, and one-shots from the start */
+            ctx->mixer->SelectSound(SOUND_OFF);
+
+            if (SOUND_OFF != arg)
+            {
+                ctx->mixer->SelectSound((sound_t)arg);
+            }
+        }
+
+        ctx->wav->Discard(BUFFER_FRAMES);
+    }
+}
+
+
+/* keys for a tick of a made up session that moves and shoots */
+static int SyntheticKeys(unsigned int *state, char *keys)
+{
+    int count;
+
+    /* xorshift so the game's rand() sequence isn't disturbed */
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    count = 0;
+
+    switch (*state % 8)
+    {
+        case 0:
+        case 1:
+            keys[count++] = 'z';
+            break;
+
+        case 2:
+        case 3:
+            keys[count++] = 'c';
+            break;
+
+        case 4:
+            keys[count++] = 'b';
+            break;
+
+        default:
+            break;
+    }
+
+    return count;
+}
+
+
+/* the sim stage of main()'s game loop */
+static void RunTick(bench_context_t *ctx, int arg, unsigned long ops)
+{
+    TankVUfo *game = ctx->game;
+
+    (void)arg;
+
+    for (unsigned long i = 0; i < ops; i++)
+    {
+        char keys[2];
+        int count;
+
+        count = SyntheticKeys(&ctx->keyState, keys);
+        game->StartTick(ctx->tickNs);
+        game->ReplayKeys(keys, count);
+        game->MoveTank();
+        game->MoveUfo();
+        game->UpdateTankShot();
+        game->UpdateUfoShot();
+        game->PrintScore();
+        game->FinishTick();
+        ctx->tickNs += Tvu::TICK_MS * 1000000LL;
+    }
+}
+
+
+/* a ufo that has just made its first move in direction */
+static Ufo *MakeFlyingUfo(bench_context_t *ctx, Tvu::Direction direction)
+{
+    Ufo *ufo;
+
+    ufo = new Ufo(ctx->pad, Tvu::UFO_TOP, Tvu::UFO_BOTTOM, *ctx->quiet);
+
+    while (ufo->GetDirection() != direction)
+    {
+        /* a new ufo starts on a random side */
+        delete ufo;
+        ufo = new Ufo(ctx->pad, Tvu::UFO_TOP, Tvu::UFO_BOTTOM, *ctx->quiet);
+        ufo->Move();
+    }
+
+    return ufo;
+}
+
+
+static void MakeVehicles(bench_context_t *ctx)
+{
+    Ufo *falling;
+
+    srand(SYNTHETIC_SEED);
+    ctx->ufoStart[Tvu::DIR_NONE] = new Ufo(ctx->pad, Tvu::UFO_TOP,
+        Tvu::UFO_BOTTOM, *ctx->quiet);
+    ctx->ufoStart[Tvu::DIR_LEFT] = MakeFlyingUfo(ctx, Tvu::DIR_LEFT);
+    ctx->ufoStart[Tvu::DIR_RIGHT] = MakeFlyingUfo(ctx, Tvu::DIR_RIGHT);
+    ctx->ufoStart[Tvu::DIR_FALLING_LEFT] =
+        new Ufo(*ctx->ufoStart[Tvu::DIR_LEFT]);
+    ctx->ufoStart[Tvu::DIR_FALLING_LEFT]->SetFalling();
+    ctx->ufoStart[Tvu::DIR_FALLING_RIGHT] =
+        new Ufo(*ctx->ufoStart[Tvu::DIR_RIGHT]);
+    ctx->ufoStart[Tvu::DIR_FALLING_RIGHT]->SetFalling();
+
+    /* fall until it lands, the flames start on the next move */
+    falling = new Ufo(*ctx->ufoStart[Tvu::DIR_FALLING_RIGHT]);
+
+    while (Tvu::DIR_LANDED != falling->GetDirection())
+    {
+        falling->Move();
+    }
+
+    ctx->ufoStart[Tvu::DIR_LANDED] = falling;
+    ctx->ufo = new Ufo(*ctx->ufoStart[Tvu::DIR_NONE]);
+
+    /* nothing else draws where this shot flies */
+    ctx->flight = new Tank(ctx->flightPad, Tvu::SCORE_ROW + 1, *ctx->quiet);
+    ctx->flight->SetDirection(Tvu::DIR_NONE);
+    ctx->flight->Move();
+
+    /* a shot risen to the ufo's row, under the ufo or not */
+    ctx->tank = new Tank(ctx->pad, Tvu::SCORE_ROW + 1, *ctx->quiet);
+    ctx->tank->SetDirection(Tvu::DIR_NONE);
+    ctx->tank->Move();
+    ctx->tank->Shoot();
+
+    while (ctx->tank->GetShotPos().y > Tvu::UFO_BOTTOM)
+    {
+        ctx->tank->MoveShot();
+    }
+
+    ctx->shotStart[SHOT_MISS] = new Tank(*ctx->tank);
+    ctx->shotUfo[SHOT_MISS].x = ctx->tank->GetShotPos().x - 1;
+    ctx->shotUfo[SHOT_MISS].y = Tvu::UFO_TOP;
+    ctx->shotStart[SHOT_HIT] = new Tank(*ctx->tank);
+    ctx->shotUfo[SHOT_HIT].x = ctx->tank->GetShotPos().x - 1;
+    ctx->shotUfo[SHOT_HIT].y = Tvu::UFO_BOTTOM;
+    ctx->tank->UpdateShotHit(ctx->shotUfo[SHOT_HIT]);
+    ctx->shotStart[SHOT_CLEAR] = new Tank(*ctx->tank);
+    ctx->shotUfo[SHOT_CLEAR] = ctx->shotUfo[SHOT_HIT];
+}
+
+
+/* the sound pack rendered by a WAV backend that's never written */
+static bool MakeMixer(bench_context_t *ctx, const char *packName)
+{
+    ctx->mixer = new Sounds();
+    ctx->wav = nullptr;
+
+    if (!ctx->mixer->LoadSounds(packName))
+    {
+        fprintf(stderr, "sound pack %s: %s\n", ctx->mixer->PackName(),
+            strerror(errno));
+        return false;
+    }
+
+    ctx->wav = new WavBackend("/dev/null");
+
+    if (!ctx->mixer->CreateSoundStream(ctx->wav, TankVUfo::VOLUME) ||
+        !ctx->mixer->StartSoundStream())
+    {
+        ctx->mixer->HandleError();
+        ctx->wav = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+
+/* the headless game laid out like main() does */
+static bool MakeGame(bench_context_t *ctx, SCREEN *screen)
+{
+    int winX, winY;
+
+    ctx->game = new TankVUfo(screen);
+    winX = (COLS - Tvu::V20_COLS) / 2;
+    winY = (LINES - Tvu::V20_ROWS) / 2;
+
+    if (!ctx->game->MakeV20Win(Tvu::V20_ROWS, Tvu::V20_COLS, winY, winX))
+    {
+        return false;
+    }
+
+    winY = (LINES - Tvu::VOL_ROWS) / 2;
+    winX += Tvu::V20_COLS + Tvu::VOL_COLS;
+
+    if (!ctx->game->MakeVolWin(Tvu::VOL_ROWS, Tvu::VOL_COLS, winY, winX))
+    {
+        return false;
+    }
+
+    ctx->game->InitializeV20Win();
+    ctx->game->DrawVolumeLevelBox();
+    ctx->game->ShowVolumeLevel(TankVUfo::VOLUME);
+
+    if (!ctx->game->InitializeVehicles())
+    {
+        return false;
+    }
+
+    ctx->game->PrintScore();
+    ctx->keyState = SYNTHETIC_SEED;
+    ctx->tickNs = 0;
+    return true;
+}
+
+
+static void FreeContext(bench_context_t *ctx)
+{
+    for (int d = 0; d < NUM_DIRECTIONS; d++)
+    {
+        delete ctx->ufoStart[d];
+    }
+
+    for (int s = 0; s < NUM_SHOT_CASES; s++)
+    {
+        delete ctx->shotStart[s];
+    }
+
+    delete ctx->ufo;
+    delete ctx->flight;
+    delete ctx->tank;
+    delete ctx->game;       /* before its screen goes */
+    delete ctx->mixer;      /* closes wav */
+    delete ctx->quiet;
+    delwin(ctx->pad);
+    delwin(ctx->flightPad);
+}
+
+
+static long long TimeRun(bench_context_t *ctx, const bench_case_t *bc,
+    unsigned long ops)
+{
+    long long start;
+
+    start = MonotonicNs();
+    bc->run(ctx, bc->arg, ops);
+    return MonotonicNs() - start;
+}
+
+
+static void Measure(bench_context_t *ctx, const bench_case_t *bc, int runs,
+    long long runNs, bench_result_t *result)
+{
+    double perOp[MAX_RUNS];
+    unsigned long ops;
+    long long ns;
+
+    /* warm up and find how many operations fill a run */
+    ops = 1;
+
+    while ((ns = TimeRun(ctx, bc, ops)) < WARM_UP_NS)
+    {
+        ops *= 2;
+    }
+
+    ops = (unsigned long)((double)ops * runNs / ns);
+    result->ops = (ops > 0) ? ops : 1;
+    result->meanNs = 0.0;
+
+    for (int r = 0; r < runs; r++)
+    {
+        perOp[r] = (double)TimeRun(ctx, bc, result->ops) / result->ops;
+        result->meanNs += perOp[r] / runs;
+    }
+
+    qsort(perOp, runs, sizeof(double), CompareDouble);
+    result->medianNs = perOp[runs / 2];
+    result->minNs = perOp[0];
+    result->maxNs = perOp[runs - 1];
+}
+
+
+/* medians from a JSON file written with -j, 0 for cases it doesn't have */
+static bool LoadBaseline(const char *fileName, const bench_case_t *cases,
+    int caseCount, bench_result_t *results)
+{
+    FILE *fp;
+    char line[256];
+
+    fp = fopen(fileName, "r");
+
+    if (nullptr == fp)
+    {
+        return false;
+    }
+
+    /* every case is on a line of its own */
+    while (nullptr != fgets(line, sizeof(line), fp))
+    {
+        char name[64];
+        const char *p;
+        double ns;
+
+        p = strstr(line, "\"name\": \"");
+
+        if ((nullptr == p) || (1 != sscanf(p + 9, "%63[^\"]", name)))
+        {
+            continue;
+        }
+
+        p = strstr(line, "\"median_ns\": ");
+
+        if ((nullptr == p) || (1 != sscanf(p + 13, "%lf", &ns)))
+        {
+            continue;
+        }
+
+        for (int c = 0; c < caseCount; c++)
+        {
+            if (0 == strcmp(name, cases[c].name))
+            {
+                results[c].baselineNs = ns;
+            }
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+
+static bool WriteJson(const char *fileName, const char *label, int runs,
+    int runMs, const bench_case_t *cases, const bench_result_t *results,
+    const bool *ran, int caseCount)
+{
+    FILE *fp;
+    bool first;
+
+    fp = fopen(fileName, "w");
+
+    if (nullptr == fp)
+    {
+        return false;
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"benchmark\": \"engine_bench\",\n");
+    fprintf(fp, "  \"label\": \"%s\",\n", (nullptr != label) ? label : "");
+    fprintf(fp, "  \"runs\": %d,\n", runs);
+    fprintf(fp, "  \"run_ms\": %d,\n", runMs);
+    fprintf(fp, "  \"cases\": [\n");
+    first = true;
+
+    for (int c = 0; c < caseCount; c++)
+    {
+        if (!ran[c])
+        {
+            continue;
+        }
+
+        fprintf(fp, "%s    {\"name\": \"%s\", \"ops\": %lu, "
+            "\"median_ns\": %.3f, \"min_ns\": %.3f, \"mean_ns\": %.3f, "
+            "\"max_ns\": %.3f}", first ? "" : ",\n", cases[c].name,
+            results[c].ops, results[c].medianNs, results[c].minNs,
+            results[c].meanNs, results[c].maxNs);
+        first = false;
+    }
+
+    fprintf(fp, "\n  ]\n}\n");
+    return 0 == fclose(fp);
+}
+
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-r runs] [-m ms] [-p pack] [-j file] "
+        "[-l label] [-c file]\n", progName);
+    fprintf(stderr, "  -r runs   timed runs per case, up to %d (default %d)\n",
+        MAX_RUNS, DEFAULT_RUNS);
+    fprintf(stderr, "  -m ms     length of a run (default %d)\n",
+        DEFAULT_RUN_MS);
+    fprintf(stderr, "  -p pack   sound pack for the callback cases\n");
+    fprintf(stderr, "  -j file   write the results as JSON\n");
+    fprintf(stderr, "  -l label  label for the JSON (a commit)\n");
+    fprintf(stderr, "  -c file   compare with JSON from an earlier run\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    static const bench_case_t CASES[] =
+    {
+        {"ufo move none", RunUfoMove, Tvu::DIR_NONE},
+        {"ufo move left", RunUfoMove, Tvu::DIR_LEFT},
+        {"ufo move right", RunUfoMove, Tvu::DIR_RIGHT},
+        {"ufo move falling left", RunUfoMove, Tvu::DIR_FALLING_LEFT},
+        {"ufo move falling right", RunUfoMove, Tvu::DIR_FALLING_RIGHT},
+        {"ufo move landed", RunUfoMove, Tvu::DIR_LANDED},
+        {"tank shot move", RunTankShot, 0},
+        {"ufo shot hit test", RunUfoShotHit, 0},
+        {"tank shot miss", RunTankShotHit, SHOT_MISS},
+        {"tank shot hit", RunTankShotHit, SHOT_HIT},
+        {"tank shot clear", RunTankShotHit, SHOT_CLEAR},
+        {"callback off", RunCallback, SOUND_OFF},
+        {"callback low freq", RunCallback, SOUND_LOW_FREQ},
+        {"callback high freq", RunCallback, SOUND_HIGH_FREQ},
+        {"callback tank shot", RunCallback, SOUND_TANK_SHOT},
+        {"callback on fire", RunCallback, SOUND_ON_FIRE},
+        {"callback explode", RunCallback, SOUND_EXPLODE},
+        {"tick", RunTick, 0}
+    };
+    const int caseCount = sizeof(CASES) / sizeof(CASES[0]);
+    int opt;
+    int runs, runMs;
+    const char *packName, *jsonName, *label, *baselineName;
+    FILE *nullFile;
+    SCREEN *screen;
+    bench_context_t ctx;
+    bench_result_t results[MAX_CASES];
+    bool ran[MAX_CASES];
+    bool haveMixer, haveGame;
+
+    runs = DEFAULT_RUNS;
+    runMs = DEFAULT_RUN_MS;
+    packName = nullptr;
+    jsonName = nullptr;
+    label = nullptr;
+    baselineName = nullptr;
+
+    while ((opt = getopt(argc, argv, "r:m:p:j:l:c:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r':
+                runs = atoi(optarg);
+                break;
+
+            case 'm':
+                runMs = atoi(optarg);
+                break;
+
+            case 'p':
+                packName = optarg;
+                break;
+
+            case 'j':
+                jsonName = optarg;
+                break;
+
+            case 'l':
+                label = optarg;
+                break;
+
+            case 'c':
+                baselineName = optarg;
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((runs <= 0) || (runs > MAX_RUNS) || (runMs <= 0) || (optind < argc))
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    memset(results, 0, sizeof(results));
+    memset(ran, 0, sizeof(ran));
+
+    if ((nullptr != baselineName) &&
+        !LoadBaseline(baselineName, CASES, caseCount, results))
+    {
+        perror(baselineName);
+        return 1;
+    }
+
+    /* the game draws into ncurses pads, the screen is never updated */
+    setlocale(LC_ALL, "C.UTF-8");
+    nullFile = fopen("/dev/null", "r+");
+
+    if (nullptr == nullFile)
+    {
+        perror("/dev/null");
+        return 1;
+    }
+
+    screen = newterm("xterm-256color", nullFile, nullFile);
+
+    if (nullptr == screen)
+    {
+        fprintf(stderr, "xterm-256color: unknown terminal type\n");
+        fclose(nullFile);
+        return 1;
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.pad = newpad(Tvu::V20_ROWS, Tvu::V20_COLS);
+    ctx.flightPad = newpad(Tvu::V20_ROWS, Tvu::V20_COLS);
+    ctx.quiet = new Sounds();
+    MakeVehicles(&ctx);
+    haveMixer = MakeMixer(&ctx, packName);
+    haveGame = MakeGame(&ctx, screen);
+
+    printf("%d runs of %d ms per case\n", runs, runMs);
+    printf("%-24s %10s %10s %10s %10s", "case", "ops/run", "median ns",
+        "min ns", "max ns");
+    printf((nullptr != baselineName) ? " %10s %8s\n" : "\n", "baseline",
+        "change");
+
+    for (int c = 0; c < caseCount; c++)
+    {
+        const bench_case_t *bc = &CASES[c];
+        bench_result_t *result = &results[c];
+
+        if (((RunCallback == bc->run) && !haveMixer) ||
+            ((RunTick == bc->run) && !haveGame))
+        {
+            printf("%-24s not run\n", bc->name);
+            continue;
+        }
+
+        Measure(&ctx, bc, runs, runMs * 1000000LL, result);
+        ran[c] = true;
+        printf("%-24s %10lu %10.1f %10.1f %10.1f", bc->name, result->ops,
+            result->medianNs, result->minNs, result->maxNs);
+
+        if (result->baselineNs > 0.0)
+        {
+            printf(" %10.1f %+7.1f%%\n", result->baselineNs,
+                100.0 * (result->medianNs - result->baselineNs) /
+                result->baselineNs);
+        }
+        else
+        {
+            printf("\n");
+        }
+    }
+
+    FreeContext(&ctx);
+    endwin();
+    delscreen(screen);
+    fclose(nullFile);
+
+    if ((nullptr != jsonName) &&
+        !WriteJson(jsonName, label, runs, runMs, CASES, results, ran,
+        caseCount))
+    {
+        perror(jsonName);
+        return 1;
+    }
+
+    return 0;
+}
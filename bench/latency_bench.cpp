@@ -0,0 +1,1421 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : latency_bench.cpp
+*   Purpose : End to end input to screen latency.  Runs the game in a
+*             pseudo-terminal, presses keys and times how long each one
+*             takes to change what a terminal would show.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pty.h>
+#include <sys/wait.h>
+
+#include "../tvu_defs.h"
+
+/*
+ * The game is started in a pseudo-terminal and sent one key at a time,
+ * each a random part of a tick after the last one's change showed up, so
+ * the presses land evenly over the game's tick.  Everything the game
+ * writes goes through a small VT parser into a copy of the screen, and a
+ * press is timed from writing the key to reading the output that makes
+ * its change on that screen:
+ *      z, c  the tank's treads move left or right
+ *      b     the muzzle flash over the tank's gun
+ *      +, -  the volume bar grows or shrinks
+ * So the time covers the input stage, the wait for the tick, the game
+ * logic and the terminal output, the way a player sees it.  Keys are only
+ * pressed when they can make a change (the tank isn't on fire, there
+ * isn't a shot already).  A press that changes nothing within
+ * PRESS_TIMEOUT_MS, or whose tank is hit first, is counted as lost.
+ */
+
+static const int SCREEN_LINES = 40;
+static const int SCREEN_COLS = 100;
+static const int DEFAULT_PRESSES = 1000;
+static const unsigned int DEFAULT_SEED = 2020;
+static const int STARTUP_MS = 5000;
+static const int PRESS_TIMEOUT_MS = 1000;
+static const int QUIT_MS = 2000;
+static const int MAX_PARAMS = 16;
+
+/* latency histogram, HISTOGRAM_MS wide buckets with the last open ended */
+static const int HISTOGRAM_MS = 20;
+static const int HISTOGRAM_BUCKETS = 16;
+static const int HISTOGRAM_WIDTH = 50;
+
+/* the keys measured, in the order they're reported */
+static const char KEYS[] = "zcb+-";
+static const int NUM_KEYS = sizeof(KEYS) - 1;
+
+/* glyphs the game draws */
+static const wchar_t GROUND_WCH = L'▔';
+static const wchar_t TREAD_WCH = L'▕';
+static const wchar_t GUN_WCH = L'▖';
+static const wchar_t BOX_WCH = L'█';
+static const wchar_t TANK_SHOT_WCH = L'▪';
+static const wchar_t FIRE_WCH[] = L"◣◢";
+
+typedef enum
+{
+    VT_GROUND,
+    VT_ESCAPE,
+    VT_CSI,
+    VT_STRING,          /* OSC or DCS, up to BEL or ST */
+    VT_STRING_ESCAPE,
+    VT_CHARSET          /* the designator after ESC ( or ESC ) */
+} vt_state_t;
+
+/* the characters on the screen, colors and modes aren't kept */
+typedef struct
+{
+    int lines;
+    int cols;
+    wchar_t *cells;
+    int y;
+    int x;
+    int savedY;
+    int savedX;
+    int top;            /* scrolling region */
+    int bottom;
+    wchar_t last;       /* last character printed, for REP */
+    vt_state_t state;
+    int params[MAX_PARAMS];
+    int paramCount;
+    bool privateMode;   /* CSI ? ... */
+    uint32_t utf8;      /* code point being decoded */
+    int utf8Left;       /* continuation bytes still expected */
+} vt_t;
+
+/* where the game's windows were found on the screen */
+typedef struct
+{
+    int groundRow;      /* bottom row of the game field */
+    int fieldLeft;
+    int volumeRow;      /* " VOLUME " label */
+    int barCol;         /* left column of the volume bar */
+} layout_t;
+
+/* what the keys change, as seen on the screen */
+typedef struct
+{
+    int tankX;          /* from the field's left, -1 if not found */
+    bool onFire;
+    bool muzzleFlash;
+    bool shotActive;    /* a shot, muzzle flash or explosion is showing */
+    int bars;           /* volume bar height */
+} view_t;
+
+typedef struct
+{
+    char key;
+    long long sentNs;   /* from the first press */
+    long long latencyNs;    /* < 0 if the press was lost */
+} press_t;
+
+typedef struct
+{
+    int master;
+    pid_t pid;
+    bool exited;        /* the game has closed the terminal */
+    long long readNs;   /* when the last output was read */
+    vt_t vt;
+    layout_t layout;
+} harness_t;
+
+static long long MonotonicNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+static int CompareLongLong(const void *a, const void *b)
+{
+    long long la = *(const long long *)a;
+    long long lb = *(const long long *)b;
+
+    return (la > lb) - (la < lb);
+}
+
+
+static bool VtInit(vt_t *vt, int lines, int cols)
+{
+    memset(vt, 0, sizeof(*vt));
+    vt->cells = (wchar_t *)malloc(sizeof(wchar_t) * lines * cols);
+
+    if (nullptr == vt->cells)
+    {
+        return false;
+    }
+
+    vt->lines = lines;
+    vt->cols = cols;
+    vt->bottom = lines - 1;
+    vt->last = L' ';
+    vt->state = VT_GROUND;
+
+    for (int i = 0; i < lines * cols; i++)
+    {
+        vt->cells[i] = L' ';
+    }
+
+    return true;
+}
+
+
+static wchar_t VtCell(const vt_t *vt, int y, int x)
+{
+    if ((y < 0) || (y >= vt->lines) || (x < 0) || (x >= vt->cols))
+    {
+        return L' ';
+    }
+
+    return vt->cells[y * vt->cols + x];
+}
+
+
+/* blank count cells from (y, x) on, wrapping to the following lines */
+static void VtErase(vt_t *vt, int y, int x, int count)
+{
+    int start;
+
+    start = y * vt->cols + x;
+
+    for (int i = start; (i < start + count) && (i < vt->lines * vt->cols);
+        i++)
+    {
+        vt->cells[i] = L' ';
+    }
+}
+
+
+/* scroll lines top to bottom up (count > 0) or down (count < 0) */
+static void VtScroll(vt_t *vt, int top, int bottom, int count)
+{
+    int height;
+
+    height = bottom - top + 1;
+
+    if ((count == 0) || (height <= 0))
+    {
+        return;
+    }
+
+    if (abs(count) > height)
+    {
+        count = (count > 0) ? height : -height;
+    }
+
+    if (count > 0)
+    {
+        memmove(&vt->cells[top * vt->cols],
+            &vt->cells[(top + count) * vt->cols],
+            sizeof(wchar_t) * (height - count) * vt->cols);
+        VtErase(vt, bottom - count + 1, 0, count * vt->cols);
+    }
+    else
+    {
+        count = -count;
+        memmove(&vt->cells[(top + count) * vt->cols],
+            &vt->cells[top * vt->cols],
+            sizeof(wchar_t) * (height - count) * vt->cols);
+        VtErase(vt, top, 0, count * vt->cols);
+    }
+}
+
+
+static void VtLineFeed(vt_t *vt)
+{
+    if (vt->y == vt->bottom)
+    {
+        VtScroll(vt, vt->top, vt->bottom, 1);
+    }
+    else if (vt->y < vt->lines - 1)
+    {
+        vt->y++;
+    }
+}
+
+
+static void VtPrint(vt_t *vt, wchar_t ch)
+{
+    if (vt->x >= vt->cols)
+    {
+        /* auto wrap */
+        vt->x = 0;
+        VtLineFeed(vt);
+    }
+
+    vt->cells[vt->y * vt->cols + vt->x] = ch;
+    vt->x++;
+    vt->last = ch;
+}
+
+
+static void VtClampCursor(vt_t *vt)
+{
+    if (vt->y < 0)
+    {
+        vt->y = 0;
+    }
+    else if (vt->y >= vt->lines)
+    {
+        vt->y = vt->lines - 1;
+    }
+
+    if (vt->x < 0)
+    {
+        vt->x = 0;
+    }
+    else if (vt->x >= vt->cols)
+    {
+        vt->x = vt->cols - 1;
+    }
+}
+
+
+/* parameter n, or def if it's missing or 0 */
+static int VtParam(const vt_t *vt, int n, int def)
+{
+    if ((n >= vt->paramCount) || (0 == vt->params[n]))
+    {
+        return def;
+    }
+
+    return vt->params[n];
+}
+
+
+static void VtCsi(vt_t *vt, char final)
+{
+    int n;
+
+    n = VtParam(vt, 0, 1);
+
+    if (vt->privateMode)
+    {
+        if ((('h' == final) || ('l' == final)) &&
+            ((1049 == vt->params[0]) || (47 == vt->params[0])))
+        {
+            /* switching screens, the other one starts blank */
+            VtErase(vt, 0, 0, vt->lines * vt->cols);
+        }
+
+        return;
+    }
+
+    switch (final)
+    {
+        case 'H':
+        case 'f':
+            vt->y = VtParam(vt, 0, 1) - 1;
+            vt->x = VtParam(vt, 1, 1) - 1;
+            break;
+
+        case 'A':
+            vt->y -= n;
+            break;
+
+        case 'B':
+        case 'e':
+            vt->y += n;
+            break;
+
+        case 'C':
+        case 'a':
+            vt->x += n;
+            break;
+
+        case 'D':
+            vt->x -= n;
+            break;
+
+        case 'E':
+            vt->y += n;
+            vt->x = 0;
+            break;
+
+        case 'F':
+            vt->y -= n;
+            vt->x = 0;
+            break;
+
+        case 'G':
+        case '`':
+            vt->x = n - 1;
+            break;
+
+        case 'd':
+            vt->y = n - 1;
+            break;
+
+        case 'J':
+            VtClampCursor(vt);
+
+            if (0 == VtParam(vt, 0, 0))
+            {
+                VtErase(vt, vt->y, vt->x,
+                    (vt->lines - vt->y) * vt->cols - vt->x);
+            }
+            else if (1 == vt->params[0])
+            {
+                VtErase(vt, 0, 0, vt->y * vt->cols + vt->x + 1);
+            }
+            else
+            {
+                VtErase(vt, 0, 0, vt->lines * vt->cols);
+            }
+            return;
+
+        case 'K':
+            VtClampCursor(vt);
+
+            if (0 == VtParam(vt, 0, 0))
+            {
+                VtErase(vt, vt->y, vt->x, vt->cols - vt->x);
+            }
+            else if (1 == vt->params[0])
+            {
+                VtErase(vt, vt->y, 0, vt->x + 1);
+            }
+            else
+            {
+                VtErase(vt, vt->y, 0, vt->cols);
+            }
+            return;
+
+        case 'X':
+            VtClampCursor(vt);
+            VtErase(vt, vt->y, vt->x,
+                (n < vt->cols - vt->x) ? n : vt->cols - vt->x);
+            return;
+
+        case '@':
+        case 'P':
+            {
+                wchar_t *line;
+                int right;
+
+                VtClampCursor(vt);
+                line = &vt->cells[vt->y * vt->cols];
+                right = vt->cols - vt->x;
+                n = (n < right) ? n : right;
+
+                if ('@' == final)
+                {
+                    /* insert blanks, the end of the line falls off */
+                    memmove(&line[vt->x + n], &line[vt->x],
+                        sizeof(wchar_t) * (right - n));
+                    VtErase(vt, vt->y, vt->x, n);
+                }
+                else
+                {
+                    /* delete characters, blanks come in at the end */
+                    memmove(&line[vt->x], &line[vt->x + n],
+                        sizeof(wchar_t) * (right - n));
+                    VtErase(vt, vt->y, vt->cols - n, n);
+                }
+            }
+            return;
+
+        case 'L':
+            VtScroll(vt, vt->y, vt->bottom, -n);
+            return;
+
+        case 'M':
+            VtScroll(vt, vt->y, vt->bottom, n);
+            return;
+
+        case 'S':
+            VtScroll(vt, vt->top, vt->bottom, n);
+            return;
+
+        case 'T':
+            VtScroll(vt, vt->top, vt->bottom, -n);
+            return;
+
+        case 'b':
+            /* repeat the last character */
+            for (int i = 0; i < n; i++)
+            {
+                VtPrint(vt, vt->last);
+            }
+            return;
+
+        case 'r':
+            vt->top = VtParam(vt, 0, 1) - 1;
+            vt->bottom = VtParam(vt, 1, vt->lines) - 1;
+
+            if ((vt->top < 0) || (vt->bottom >= vt->lines) ||
+                (vt->top >= vt->bottom))
+            {
+                vt->top = 0;
+                vt->bottom = vt->lines - 1;
+            }
+
+            vt->y = 0;
+            vt->x = 0;
+            return;
+
+        default:
+            /* colors, modes and reports don't change the characters */
+            return;
+    }
+
+    VtClampCursor(vt);
+}
+
+
+static void VtEscape(vt_t *vt, char ch)
+{
+    vt->state = VT_GROUND;
+
+    switch (ch)
+    {
+        case '[':
+            vt->state = VT_CSI;
+            vt->paramCount = 0;
+            vt->params[0] = 0;
+            vt->privateMode = false;
+            break;
+
+        case ']':
+        case 'P':
+            vt->state = VT_STRING;
+            break;
+
+        case '(':
+        case ')':
+            vt->state = VT_CHARSET;
+            break;
+
+        case '7':
+            vt->savedY = vt->y;
+            vt->savedX = vt->x;
+            break;
+
+        case '8':
+            vt->y = vt->savedY;
+            vt->x = vt->savedX;
+            break;
+
+        case 'D':
+            VtLineFeed(vt);
+            break;
+
+        case 'E':
+            vt->x = 0;
+            VtLineFeed(vt);
+            break;
+
+        case 'M':
+            if (vt->y == vt->top)
+            {
+                VtScroll(vt, vt->top, vt->bottom, -1);
+            }
+            else if (vt->y > 0)
+            {
+                vt->y--;
+            }
+            break;
+
+        case 'c':
+            VtErase(vt, 0, 0, vt->lines * vt->cols);
+            vt->y = 0;
+            vt->x = 0;
+            vt->top = 0;
+            vt->bottom = vt->lines - 1;
+            break;
+
+        default:
+            /* keypad modes and the like */
+            break;
+    }
+}
+
+
+static void VtControl(vt_t *vt, char ch)
+{
+    switch (ch)
+    {
+        case '\r':
+            vt->x = 0;
+            break;
+
+        case '\n':
+        case '\v':
+        case '\f':
+            VtLineFeed(vt);
+            break;
+
+        case '\b':
+            if (vt->x >= vt->cols)
+            {
+                vt->x = vt->cols - 1;
+            }
+
+            if (vt->x > 0)
+            {
+                vt->x--;
+            }
+            break;
+
+        case '\t':
+            vt->x = (vt->x + 8) & ~7;
+
+            if (vt->x >= vt->cols)
+            {
+                vt->x = vt->cols - 1;
+            }
+            break;
+
+        default:
+            /* bell and character set shifts */
+            break;
+    }
+}
+
+
+/* update the screen with terminal output */
+static void VtWrite(vt_t *vt, const char *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char ch = (unsigned char)data[i];
+
+        switch (vt->state)
+        {
+            case VT_GROUND:
+                if (0x1b == ch)
+                {
+                    vt->state = VT_ESCAPE;
+                    vt->utf8Left = 0;
+                }
+                else if (ch < 0x20)
+                {
+                    VtControl(vt, (char)ch);
+                }
+                else if (ch < 0x80)
+                {
+                    if (0x7f != ch)
+                    {
+                        VtPrint(vt, ch);
+                    }
+                }
+                else if (0x80 == (ch & 0xc0))
+                {
+                    /* continuation byte */
+                    if (vt->utf8Left > 0)
+                    {
+                        vt->utf8 = (vt->utf8 << 6) | (ch & 0x3f);
+                        vt->utf8Left--;
+
+                        if (0 == vt->utf8Left)
+                        {
+                            VtPrint(vt, (wchar_t)vt->utf8);
+                        }
+                    }
+                }
+                else if (0xc0 == (ch & 0xe0))
+                {
+                    vt->utf8 = ch & 0x1f;
+                    vt->utf8Left = 1;
+                }
+                else if (0xe0 == (ch & 0xf0))
+                {
+                    vt->utf8 = ch & 0x0f;
+                    vt->utf8Left = 2;
+                }
+                else
+                {
+                    vt->utf8 = ch & 0x07;
+                    vt->utf8Left = 3;
+                }
+                break;
+
+            case VT_ESCAPE:
+                VtEscape(vt, (char)ch);
+                break;
+
+            case VT_CSI:
+                if ((ch >= '0') && (ch <= '9'))
+                {
+                    if (0 == vt->paramCount)
+                    {
+                        vt->paramCount = 1;
+                    }
+
+                    vt->params[vt->paramCount - 1] =
+                        vt->params[vt->paramCount - 1] * 10 + (ch - '0');
+                }
+                else if (';' == ch)
+                {
+                    if (0 == vt->paramCount)
+                    {
+                        vt->paramCount = 1;
+                    }
+
+                    if (vt->paramCount < MAX_PARAMS)
+                    {
+                        vt->params[vt->paramCount++] = 0;
+                    }
+                }
+                else if (('?' == ch) || ('>' == ch) || ('=' == ch))
+                {
+                    vt->privateMode = true;
+                }
+                else if ((ch >= 0x40) && (ch <= 0x7e))
+                {
+                    VtCsi(vt, (char)ch);
+                    vt->state = VT_GROUND;
+                }
+                else if (ch < 0x20)
+                {
+                    /* controls work in the middle of a sequence */
+                    VtControl(vt, (char)ch);
+                }
+                break;
+
+            case VT_STRING:
+                if (0x07 == ch)
+                {
+                    vt->state = VT_GROUND;
+                }
+                else if (0x1b == ch)
+                {
+                    vt->state = VT_STRING_ESCAPE;
+                }
+                break;
+
+            case VT_STRING_ESCAPE:
+                /* ESC \ ends the string */
+                vt->state = ('\\' == ch) ? VT_GROUND : VT_STRING;
+                break;
+
+            case VT_CHARSET:
+                vt->state = VT_GROUND;
+                break;
+        }
+    }
+}
+
+
+/*
+ * Read and parse whatever the game has written, waiting up to timeoutMs
+ * for it.  Returns false once the game has closed the terminal.
+ */
+static bool Pump(harness_t *h, int timeoutMs)
+{
+    struct pollfd pfd;
+    char buffer[4096];
+    ssize_t got;
+
+    if (h->exited)
+    {
+        return false;
+    }
+
+    pfd.fd = h->master;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    if (poll(&pfd, 1, timeoutMs) <= 0)
+    {
+        return true;
+    }
+
+    h->readNs = MonotonicNs();
+
+    while ((got = read(h->master, buffer, sizeof(buffer))) > 0)
+    {
+        VtWrite(&h->vt, buffer, got);
+    }
+
+    if ((0 == got) || ((got < 0) && (EAGAIN != errno) && (EINTR != errno)))
+    {
+        /* EIO once the game is gone */
+        h->exited = true;
+        return false;
+    }
+
+    return true;
+}
+
+
+/* read for ms, keeping up with the game's output */
+static bool PumpFor(harness_t *h, int ms)
+{
+    long long end;
+    long long now;
+
+    end = MonotonicNs() + ms * 1000000LL;
+
+    while ((now = MonotonicNs()) < end)
+    {
+        if (!Pump(h, (int)((end - now + 999999) / 1000000)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/* true if the screen shows text starting at (y, x) */
+static bool VtHasText(const vt_t *vt, int y, int x, const wchar_t *text)
+{
+    for (int i = 0; L'\0' != text[i]; i++)
+    {
+        if (text[i] != VtCell(vt, y, x + i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/* find the game field by its ground and the volume window by its label */
+static bool FindLayout(const vt_t *vt, layout_t *layout)
+{
+    static const wchar_t LABEL[] = L"VOLUME";
+    bool ground, volume;
+
+    ground = false;
+    volume = false;
+
+    for (int y = 0; y < vt->lines; y++)
+    {
+        int count, first;
+
+        count = 0;
+        first = -1;
+
+        for (int x = 0; x < vt->cols; x++)
+        {
+            if (GROUND_WCH == VtCell(vt, y, x))
+            {
+                first = (first < 0) ? x : first;
+                count++;
+            }
+
+            if (VtHasText(vt, y, x, LABEL))
+            {
+                /* " VOLUME " starts in column 1, the bar is in 4 */
+                layout->volumeRow = y;
+                layout->barCol = x + 2;
+                volume = true;
+            }
+        }
+
+        if (Tvu::V20_COLS == count)
+        {
+            layout->groundRow = y;
+            layout->fieldLeft = first;
+            ground = true;
+        }
+    }
+
+    return ground && volume;
+}
+
+
+static void GetView(const harness_t *h, view_t *view)
+{
+    const vt_t *vt = &h->vt;
+    const layout_t *layout = &h->layout;
+    int treadRow, left;
+
+    treadRow = layout->groundRow - 1;
+    left = layout->fieldLeft;
+    view->tankX = -1;
+
+    for (int x = 0; x < Tvu::V20_COLS; x++)
+    {
+        if (TREAD_WCH == VtCell(vt, treadRow, left + x))
+        {
+            view->tankX = x;
+            break;
+        }
+    }
+
+    /* a ufo shot exploding next to the tank covers its treads, not its gun */
+    for (int x = 3; (view->tankX < 0) && (x < Tvu::V20_COLS); x++)
+    {
+        if (GUN_WCH == VtCell(vt, treadRow - 2, left + x))
+        {
+            view->tankX = x - 3;
+        }
+    }
+
+    view->onFire = false;
+    view->muzzleFlash = false;
+
+    if (view->tankX >= 0)
+    {
+        for (int x = 1; x < 5; x++)
+        {
+            wchar_t ch;
+
+            ch = VtCell(vt, treadRow - 1, left + view->tankX + x);
+            view->onFire |= ((FIRE_WCH[0] == ch) || (FIRE_WCH[1] == ch));
+        }
+
+        view->muzzleFlash = (BOX_WCH ==
+            VtCell(vt, treadRow - 3, left + view->tankX + 3));
+    }
+
+    /* shots are above the gun, the turret has blocks of its own */
+    view->shotActive = false;
+
+    for (int y = layout->groundRow - Tvu::V20_ROWS + 1; y <= treadRow - 3;
+        y++)
+    {
+        for (int x = 0; x < Tvu::V20_COLS; x++)
+        {
+            wchar_t ch;
+
+            ch = VtCell(vt, y, left + x);
+            view->shotActive |= ((TANK_SHOT_WCH == ch) || (BOX_WCH == ch));
+        }
+    }
+
+    view->bars = 0;
+
+    for (int y = layout->volumeRow - 10; y < layout->volumeRow; y++)
+    {
+        view->bars += (BOX_WCH == VtCell(vt, y, layout->barCol));
+    }
+}
+
+
+/* true once the screen shows what key does */
+static bool KeyChanged(char key, const view_t *before, const view_t *after)
+{
+    switch (key)
+    {
+        case 'z':
+            return (after->tankX >= 0) && (after->tankX < before->tankX);
+
+        case 'c':
+            return after->tankX > before->tankX;
+
+        case 'b':
+            return after->muzzleFlash;
+
+        case '+':
+            return after->bars > before->bars;
+
+        case '-':
+            return after->bars < before->bars;
+
+        default:
+            return false;
+    }
+}
+
+
+/*
+ * The next key that can change the screen, taking turns moving, shooting
+ * and changing the volume.  The tank goes back and forth and the volume
+ * up and down between their limits.
+ */
+static char ChooseKey(const view_t *view, int *turn, bool *left, bool *up)
+{
+    for (int tries = 0; tries < 3; tries++)
+    {
+        int kind;
+
+        kind = *turn;
+        *turn = (*turn + 1) % 3;
+
+        if ((0 == kind) && (view->tankX >= 0) && !view->onFire)
+        {
+            if (*left && (0 == view->tankX))
+            {
+                *left = false;
+            }
+            else if (!*left && (Tvu::V20_COLS - 6 == view->tankX))
+            {
+                *left = true;
+            }
+
+            return *left ? 'z' : 'c';
+        }
+        else if ((1 == kind) && (view->tankX >= 0) && !view->onFire &&
+            !view->shotActive)
+        {
+            return 'b';
+        }
+        else if (2 == kind)
+        {
+            if (*up && (10 == view->bars))
+            {
+                *up = false;
+            }
+            else if (!*up && (0 == view->bars))
+            {
+                *up = true;
+            }
+
+            return *up ? '+' : '-';
+        }
+    }
+
+    return '+';
+}
+
+
+/* press key and wait for its change, false if the game went away */
+static bool Press(harness_t *h, char key, press_t *press)
+{
+    view_t before, after;
+    long long sent, deadline;
+
+    GetView(h, &before);
+    press->key = key;
+    press->latencyNs = -1;
+    sent = MonotonicNs();
+
+    if (1 != write(h->master, &key, 1))
+    {
+        return false;
+    }
+
+    press->sentNs = sent;
+    deadline = sent + PRESS_TIMEOUT_MS * 1000000LL;
+
+    for (long long now = sent; now < deadline; now = MonotonicNs())
+    {
+        h->readNs = 0;
+
+        if (!Pump(h, (int)((deadline - now + 999999) / 1000000)))
+        {
+            return false;
+        }
+
+        if (0 == h->readNs)
+        {
+            /* nothing to read */
+            continue;
+        }
+
+        GetView(h, &after);
+
+        if (KeyChanged(key, &before, &after))
+        {
+            press->latencyNs = h->readNs - sent;
+            break;
+        }
+
+        if (after.onFire && (('+' != key) && ('-' != key)))
+        {
+            /* hit before the key was handled, it's ignored (and the tank
+             * starts over on the left when the fire is out) */
+            break;
+        }
+    }
+
+    return true;
+}
+
+
+/* the game in a pseudo-terminal of its own */
+static bool StartGame(harness_t *h, const char *term, char *const args[])
+{
+    struct winsize size;
+
+    size.ws_row = SCREEN_LINES;
+    size.ws_col = SCREEN_COLS;
+    size.ws_xpixel = 0;
+    size.ws_ypixel = 0;
+    h->exited = false;
+    h->pid = forkpty(&h->master, nullptr, nullptr, &size);
+
+    if (h->pid < 0)
+    {
+        perror("starting the game in a pseudo-terminal");
+        return false;
+    }
+
+    if (0 == h->pid)
+    {
+        /* the screen is searched for the game's UTF-8 glyphs */
+        setenv("TERM", term, 1);
+        setenv("LC_ALL", "C.UTF-8", 1);
+        execv(args[0], args);
+        fprintf(stderr, "%s: %s\n", args[0], strerror(errno));
+        _exit(127);
+    }
+
+    fcntl(h->master, F_SETFL, fcntl(h->master, F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+
+/* quit the game and collect it, returns its wait() status */
+static int StopGame(harness_t *h)
+{
+    int status;
+
+    if (!h->exited && (1 == write(h->master, "q", 1)))
+    {
+        PumpFor(h, QUIT_MS);
+    }
+
+    if (0 == waitpid(h->pid, &status, WNOHANG))
+    {
+        kill(h->pid, SIGTERM);
+        waitpid(h->pid, &status, 0);
+    }
+
+    close(h->master);
+    return status;
+}
+
+
+static void ReportKey(const char *name, const press_t *presses, int count,
+    const char *keys, long long *latencies)
+{
+    int n, lost;
+
+    n = 0;
+    lost = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (nullptr == strchr(keys, presses[i].key))
+        {
+            continue;
+        }
+
+        if (presses[i].latencyNs < 0)
+        {
+            lost++;
+        }
+        else
+        {
+            latencies[n++] = presses[i].latencyNs;
+        }
+    }
+
+    if (0 == n)
+    {
+        printf("%-5s %7d %5d\n", name, n, lost);
+        return;
+    }
+
+    qsort(latencies, n, sizeof(long long), CompareLongLong);
+    printf("%-5s %7d %5d %7.1f %7.1f %7.1f %7.1f %7.1f\n", name, n, lost,
+        latencies[0] / 1e6, latencies[n / 2] / 1e6,
+        latencies[(n * 90) / 100] / 1e6, latencies[(n * 99) / 100] / 1e6,
+        latencies[n - 1] / 1e6);
+}
+
+
+static void ReportHistogram(const press_t *presses, int count)
+{
+    int buckets[HISTOGRAM_BUCKETS];
+    int most;
+
+    memset(buckets, 0, sizeof(buckets));
+    most = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int b;
+
+        if (presses[i].latencyNs < 0)
+        {
+            continue;
+        }
+
+        b = (int)(presses[i].latencyNs / (HISTOGRAM_MS * 1000000LL));
+        b = (b < HISTOGRAM_BUCKETS) ? b : HISTOGRAM_BUCKETS - 1;
+        buckets[b]++;
+        most = (buckets[b] > most) ? buckets[b] : most;
+    }
+
+    for (int b = 0; (b < HISTOGRAM_BUCKETS) && (most > 0); b++)
+    {
+        int width;
+
+        width = (buckets[b] * HISTOGRAM_WIDTH + most - 1) / most;
+
+        if (b < HISTOGRAM_BUCKETS - 1)
+        {
+            printf("%4d-%-4d ms %6d ", b * HISTOGRAM_MS,
+                (b + 1) * HISTOGRAM_MS, buckets[b]);
+        }
+        else
+        {
+            printf("%4d+     ms %6d ", b * HISTOGRAM_MS, buckets[b]);
+        }
+
+        for (int i = 0; i < width; i++)
+        {
+            putchar('#');
+        }
+
+        putchar('\n');
+    }
+}
+
+
+static bool WriteCsv(const char *fileName, const press_t *presses, int count)
+{
+    FILE *fp;
+
+    fp = fopen(fileName, "w");
+
+    if (nullptr == fp)
+    {
+        return false;
+    }
+
+    fprintf(fp, "key,sent_ms,latency_ms\n");
+
+    for (int i = 0; i < count; i++)
+    {
+        fprintf(fp, "%c,%.3f,", presses[i].key,
+            (presses[i].sentNs - presses[0].sentNs) / 1e6);
+
+        if (presses[i].latencyNs < 0)
+        {
+            fprintf(fp, "\n");
+        }
+        else
+        {
+            fprintf(fp, "%.3f\n", presses[i].latencyNs / 1e6);
+        }
+    }
+
+    return 0 == fclose(fp);
+}
+
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-n presses] [-s seed] [-g game] [-t term] "
+        "[-o file] [-- game options]\n", progName);
+    fprintf(stderr, "  -n presses  keys to press (default %d)\n",
+        DEFAULT_PRESSES);
+    fprintf(stderr, "  -s seed     seed for the time between presses "
+        "(default %u)\n", DEFAULT_SEED);
+    fprintf(stderr, "  -g game     game to run (default ./tankvufo)\n");
+    fprintf(stderr, "  -t term     terminal type (default xterm-256color)\n");
+    fprintf(stderr, "  -o file     write every press to a CSV file\n");
+    fprintf(stderr, "  options     passed to the game (default -a null)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    static char defaultGame[] = "./tankvufo";
+    static char nullAudio[] = "-a";
+    static char nullName[] = "null";
+    int opt;
+    int presses;
+    unsigned int seed;
+    char *game;
+    const char *term, *csvName;
+    char *args[64];
+    int argCount;
+    harness_t h;
+    press_t *results;
+    long long *latencies;
+    view_t view;
+    int done, turn, status;
+    bool left, up;
+    long long start;
+
+    presses = DEFAULT_PRESSES;
+    seed = DEFAULT_SEED;
+    game = defaultGame;
+    term = "xterm-256color";
+    csvName = nullptr;
+
+    while ((opt = getopt(argc, argv, "n:s:g:t:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                presses = atoi(optarg);
+                break;
+
+            case 's':
+                seed = strtoul(optarg, nullptr, 10);
+                break;
+
+            case 'g':
+                game = optarg;
+                break;
+
+            case 't':
+                term = optarg;
+                break;
+
+            case 'o':
+                csvName = optarg;
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((presses <= 0) || (argc - optind > 60))
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    /* the game and its options */
+    argCount = 0;
+    args[argCount++] = game;
+
+    if (optind == argc)
+    {
+        args[argCount++] = nullAudio;
+        args[argCount++] = nullName;
+    }
+
+    while (optind < argc)
+    {
+        args[argCount++] = argv[optind++];
+    }
+
+    args[argCount] = nullptr;
+
+    results = (press_t *)malloc(sizeof(press_t) * presses);
+    latencies = (long long *)malloc(sizeof(long long) * presses);
+
+    if ((nullptr == results) || (nullptr == latencies) ||
+        !VtInit(&h.vt, SCREEN_LINES, SCREEN_COLS))
+    {
+        perror("allocating the results");
+        return 1;
+    }
+
+    if (!StartGame(&h, term, args))
+    {
+        return 1;
+    }
+
+    /* wait for the first screen */
+    start = MonotonicNs();
+
+    while (!FindLayout(&h.vt, &h.layout))
+    {
+        if (!Pump(&h, 100) ||
+            (MonotonicNs() - start > STARTUP_MS * 1000000LL))
+        {
+            status = StopGame(&h);
+            fprintf(stderr, "%s: no game screen", game);
+
+            if (WIFEXITED(status))
+            {
+                fprintf(stderr, " (exit status %d)", WEXITSTATUS(status));
+            }
+
+            fprintf(stderr, "\n");
+            return 1;
+        }
+    }
+
+    printf("%s in a %dx%d %s pseudo-terminal, %d presses\n", game,
+        SCREEN_COLS, SCREEN_LINES, term, presses);
+    fflush(stdout);
+
+    turn = 0;
+    left = true;
+    up = true;
+
+    for (done = 0; done < presses; done++)
+    {
+        /* land anywhere in the game's tick */
+        if (!PumpFor(&h, rand_r(&seed) % Tvu::TICK_MS))
+        {
+            break;
+        }
+
+        GetView(&h, &view);
+
+        if (!Press(&h, ChooseKey(&view, &turn, &left, &up), &results[done]))
+        {
+            break;
+        }
+    }
+
+    StopGame(&h);
+
+    if (done < presses)
+    {
+        fprintf(stderr, "%s: the game ended after %d presses\n", game, done);
+    }
+
+    printf("latency from key press to screen change (ms)\n");
+    printf("%-5s %7s %5s %7s %7s %7s %7s %7s\n", "key", "presses", "lost",
+        "min", "p50", "p90", "p99", "max");
+
+    for (int k = 0; k < NUM_KEYS; k++)
+    {
+        char name[2] = {KEYS[k], '\0'};
+
+        ReportKey(name, results, done, name, latencies);
+    }
+
+    ReportKey("all", results, done, KEYS, latencies);
+    ReportHistogram(results, done);
+
+    if ((nullptr != csvName) && !WriteCsv(csvName, results, done))
+    {
+        perror(csvName);
+        return 1;
+    }
+
+    free(results);
+    free(latencies);
+    free(h.vt.cells);
+    return (done == presses) ? 0 : 1;
+}
@@ -0,0 +1,451 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : mix_bench.cpp
+*   Purpose : Measures the nanoseconds per frame spent mixing sound voices
+*             with the original per-sample loop and with the block mixer
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <unistd.h>
+
+#include "../mixer.h"
+#include "../resampler.h"
+
+/*
+ * The sample voices are fed made up samples the same lengths as the game's sounds,
+ * so the benchmark doesn't depend on how the sounds are stored.  Every
+ * case mixes the same number of frames in callback sized buffers with
+ * both mixers:
+ *      before - one sample at a time into the stereo buffer, checking for
+ *               the end of the sound every frame (the original callback)
+ *      after  - MixVoice() blocks followed by InterleaveMix()
+ * One-shot voices are restarted when they finish so they're always busy.
+ * Voices generated by the emulated VIC, and samples stepped through at
+ * another rate, have no original loop, so they're only run through the
+ * block mixer.  The polyphase resampler is timed converting the longest
+ * sound from 44.1 kHz to 48 kHz.
+ */
+
+static const int SHOT_LENGTH = 178606;      /* sound_data/tank_shot.wav */
+static const int FALL_LENGTH = 44;          /* sound_data/ufo_falling.wav */
+static const int EXPLODE_LENGTH = 17640;    /* sound_data/explode.wav */
+static const int FIRE_LENGTH = 90405;       /* sound_data/on_fire.wav */
+
+/* the falling sound played on 48 kHz hardware */
+static const int NATIVE_RATE = 48000;
+
+/* like the game's falling tone and shot */
+static const vic_patch_t SQUARE_PATCH = {VIC_SOPRANO, 240, 0, 15, 0, 0, 100};
+static const vic_patch_t NOISE_PATCH = {VIC_NOISE, 254, -1, 15, -3, 80, 50};
+
+static const unsigned long BUFFER_FRAMES = 256;
+static const unsigned long DEFAULT_SECONDS = 600;
+
+typedef struct
+{
+    const char *name;
+    int voices;
+    bool synth;         /* no original mixer to compare with */
+    voice_data_t voice[NUM_VOICES];
+} bench_case_t;
+
+
+static float *MakeSamples(int length)
+{
+    float *samples;
+
+    samples = (float *)malloc(sizeof(float) * length);
+
+    for (int i = 0; i < length; i++)
+    {
+        samples[i] = (float)sin(i * 0.05) * 0.9f;
+    }
+
+    return samples;
+}
+
+
+static void MakeVoice(voice_data_t *voice, sound_t sound,
+    const float *samples, int length, int step, bool loop)
+{
+    voice->sound = sound;
+    voice->samples = samples;
+    voice->length = length;
+    voice->phase = 0;
+    voice->fraction = 0;
+    voice->step = step;
+    voice->stepFraction = 0;
+    voice->loop = loop;
+    voice->synth = false;
+}
+
+
+static void MakeSynthVoice(voice_data_t *voice, sound_t sound,
+    const vic_patch_t *patch)
+{
+    voice->sound = sound;
+    voice->synth = true;
+    VicStart(&voice->vic, patch, VIC_6560, SAMPLE_RATE, false);
+}
+
+
+/* a voice stepping through samples at their rate times pitch */
+static void SetRate(voice_data_t *voice, int rate, int pitch)
+{
+    unsigned long long increment;
+
+    increment = (((unsigned long long)SAMPLE_RATE * pitch) << 32) / rate;
+    voice->step = (int)(increment >> 32);
+    voice->stepFraction = (uint32_t)increment;
+}
+
+
+/* the original callback's loop, extended to add in several voices */
+static void ReferenceMix(voice_data_t *voices, int count, float gain,
+    float *out, unsigned long frames)
+{
+    memset(out, 0, frames * 2 * sizeof(float));
+
+    for (int v = 0; v < count; v++)
+    {
+        voice_data_t *voice = &voices[v];
+        float *o = out;
+
+        for (unsigned long i = 0; i < frames; i++)
+        {
+            float sample;
+
+            sample = gain * voice->samples[voice->phase];
+            *o += sample;
+            o++;
+            *o += sample;
+            o++;
+
+            voice->phase += voice->step;
+
+            if (voice->phase >= voice->length)
+            {
+                if (voice->loop)
+                {
+                    voice->phase -= voice->length;
+                }
+                else
+                {
+                    voice->phase = 0;
+                    voice->sound = SOUND_OFF;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (unsigned long i = 0; i < frames * 2; i++)
+    {
+        if (out[i] > 1.0f)
+        {
+            out[i] = 1.0f;
+        }
+        else if (out[i] < -1.0f)
+        {
+            out[i] = -1.0f;
+        }
+    }
+}
+
+
+/* the callback's use of the block mixer */
+static void BlockMix(voice_data_t *voices, int count, float gain,
+    float *out, unsigned long frames)
+{
+    while (frames > 0)
+    {
+        float mix[MIX_BLOCK];
+        unsigned long n;
+
+        n = (frames < MIX_BLOCK) ? frames : MIX_BLOCK;
+        memset(mix, 0, n * sizeof(float));
+
+        for (int v = 0; v < count; v++)
+        {
+            if (SOUND_OFF != voices[v].sound)
+            {
+                MixVoice(&voices[v], gain, mix, n);
+            }
+        }
+
+        InterleaveMix(mix, out, n);
+        out += 2 * n;
+        frames -= n;
+    }
+}
+
+
+/* keep the one-shot voices playing */
+static void Retrigger(voice_data_t *voices, const voice_data_t *start,
+    int count)
+{
+    for (int v = 0; v < count; v++)
+    {
+        if (SOUND_OFF == voices[v].sound)
+        {
+            voices[v] = start[v];
+        }
+    }
+}
+
+
+static double MonotonicSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+
+static double RunCase(const bench_case_t *bc, bool block,
+    unsigned long buffers, float *out)
+{
+    voice_data_t voices[NUM_VOICES];
+    double start;
+
+    memcpy(voices, bc->voice, sizeof(voices));
+    start = MonotonicSeconds();
+
+    for (unsigned long b = 0; b < buffers; b++)
+    {
+        if (block)
+        {
+            BlockMix(voices, bc->voices, MIX_GAIN, out, BUFFER_FRAMES);
+        }
+        else
+        {
+            ReferenceMix(voices, bc->voices, MIX_GAIN, out, BUFFER_FRAMES);
+        }
+
+        Retrigger(voices, bc->voice, bc->voices);
+    }
+
+    return (MonotonicSeconds() - start) * 1e9 / (buffers * BUFFER_FRAMES);
+}
+
+
+/* largest difference between the mixers' output over the first buffers */
+static double Compare(const bench_case_t *bc, unsigned long buffers)
+{
+    voice_data_t before[NUM_VOICES], after[NUM_VOICES];
+    float outBefore[BUFFER_FRAMES * 2], outAfter[BUFFER_FRAMES * 2];
+    double worst;
+
+    memcpy(before, bc->voice, sizeof(before));
+    memcpy(after, bc->voice, sizeof(after));
+    worst = 0.0;
+
+    for (unsigned long b = 0; b < buffers; b++)
+    {
+        ReferenceMix(before, bc->voices, MIX_GAIN, outBefore, BUFFER_FRAMES);
+        BlockMix(after, bc->voices, MIX_GAIN, outAfter, BUFFER_FRAMES);
+        Retrigger(before, bc->voice, bc->voices);
+        Retrigger(after, bc->voice, bc->voices);
+
+        for (unsigned long i = 0; i < BUFFER_FRAMES * 2; i++)
+        {
+            double diff = fabs(outBefore[i] - outAfter[i]);
+
+            if (diff > worst)
+            {
+                worst = diff;
+            }
+        }
+    }
+
+    return worst;
+}
+
+
+/* nanoseconds per output sample to resample the shot to NATIVE_RATE */
+static double TimeResample(const float *samples, int length)
+{
+    float *out;
+    double start, ns;
+
+    out = (float *)malloc(sizeof(float) *
+        ResampledLength(length, SAMPLE_RATE, NATIVE_RATE));
+    start = MonotonicSeconds();
+    Resample(samples, length, SAMPLE_RATE, out, NATIVE_RATE);
+    ns = (MonotonicSeconds() - start) * 1e9 /
+        ResampledLength(length, SAMPLE_RATE, NATIVE_RATE);
+    free(out);
+    return ns;
+}
+
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-s seconds]\n", progName);
+    fprintf(stderr, "  -s seconds  audio mixed per case (default %lu)\n",
+        DEFAULT_SECONDS);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int opt;
+    unsigned long seconds;
+    unsigned long buffers;
+    float *shot, *fall, *explode, *fire;
+    bench_case_t cases[10];
+    int caseCount;
+    float out[BUFFER_FRAMES * 2];
+
+    seconds = DEFAULT_SECONDS;
+
+    while ((opt = getopt(argc, argv, "s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                seconds = strtoul(optarg, nullptr, 10);
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (0 == seconds)
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    buffers = (seconds * SAMPLE_RATE) / BUFFER_FRAMES;
+
+    shot = MakeSamples(SHOT_LENGTH);
+    fall = MakeSamples(FALL_LENGTH);
+    explode = MakeSamples(EXPLODE_LENGTH);
+    fire = MakeSamples(FIRE_LENGTH);
+
+    /* a voice on its own for each kind of render loop, then all at once */
+    memset(cases, 0, sizeof(cases));
+    cases[0].name = "shot";
+    cases[0].voices = 1;
+    MakeVoice(&cases[0].voice[0], SOUND_TANK_SHOT, shot, SHOT_LENGTH, 1,
+        false);
+    cases[1].name = "fall low";
+    cases[1].voices = 1;
+    MakeVoice(&cases[1].voice[0], SOUND_LOW_FREQ, fall, FALL_LENGTH, 1, true);
+    cases[2].name = "fall high";
+    cases[2].voices = 1;
+    MakeVoice(&cases[2].voice[0], SOUND_HIGH_FREQ, fall, FALL_LENGTH, 2, true);
+    cases[3].name = "explode";
+    cases[3].voices = 1;
+    MakeVoice(&cases[3].voice[0], SOUND_EXPLODE, explode, EXPLODE_LENGTH, 1,
+        false);
+    cases[4].name = "all voices";
+    cases[4].voices = NUM_VOICES;
+    MakeVoice(&cases[4].voice[VOICE_SHOT], SOUND_TANK_SHOT, shot, SHOT_LENGTH,
+        1, false);
+    MakeVoice(&cases[4].voice[VOICE_FALL], SOUND_HIGH_FREQ, fall, FALL_LENGTH,
+        2, true);
+    MakeVoice(&cases[4].voice[VOICE_EXPLODE], SOUND_EXPLODE, explode,
+        EXPLODE_LENGTH, 1, false);
+    MakeVoice(&cases[4].voice[VOICE_FIRE], SOUND_ON_FIRE, fire, FIRE_LENGTH, 1,
+        false);
+    cases[5].name = "vic square";
+    cases[5].voices = 1;
+    cases[5].synth = true;
+    MakeSynthVoice(&cases[5].voice[0], SOUND_LOW_FREQ, &SQUARE_PATCH);
+    cases[6].name = "vic noise";
+    cases[6].voices = 1;
+    cases[6].synth = true;
+    MakeSynthVoice(&cases[6].voice[0], SOUND_TANK_SHOT, &NOISE_PATCH);
+    cases[7].name = "vic all";
+    cases[7].voices = NUM_VOICES;
+    cases[7].synth = true;
+    MakeSynthVoice(&cases[7].voice[VOICE_SHOT], SOUND_TANK_SHOT,
+        &NOISE_PATCH);
+    MakeSynthVoice(&cases[7].voice[VOICE_FALL], SOUND_LOW_FREQ,
+        &SQUARE_PATCH);
+    MakeSynthVoice(&cases[7].voice[VOICE_EXPLODE], SOUND_EXPLODE,
+        &NOISE_PATCH);
+    MakeSynthVoice(&cases[7].voice[VOICE_FIRE], SOUND_ON_FIRE, &NOISE_PATCH);
+    cases[8].name = "fall 48k";
+    cases[8].voices = 1;
+    cases[8].synth = true;
+    MakeVoice(&cases[8].voice[0], SOUND_LOW_FREQ, fall, FALL_LENGTH, 1, true);
+    SetRate(&cases[8].voice[0], NATIVE_RATE, 1);
+    cases[9].name = "fall hi 48k";
+    cases[9].voices = 1;
+    cases[9].synth = true;
+    MakeVoice(&cases[9].voice[0], SOUND_HIGH_FREQ, fall, FALL_LENGTH, 1,
+        true);
+    SetRate(&cases[9].voice[0], NATIVE_RATE, 2);
+    caseCount = 10;
+
+    printf("mixer kernel: %s, %lu frame buffers, %lu seconds per case\n",
+        MixerKernel(), BUFFER_FRAMES, seconds);
+    printf("%-12s %12s %12s %8s %10s\n", "case", "before ns/f", "after ns/f",
+        "speedup", "max diff");
+
+    for (int c = 0; c < caseCount; c++)
+    {
+        double before, after, diff;
+
+        if (cases[c].synth)
+        {
+            after = RunCase(&cases[c], true, buffers, out);
+            printf("%-12s %12s %12.3f %8s %10s\n", cases[c].name, "-", after,
+                "-", "-");
+            continue;
+        }
+
+        diff = Compare(&cases[c], (10 * SAMPLE_RATE) / BUFFER_FRAMES);
+        before = RunCase(&cases[c], false, buffers, out);
+        after = RunCase(&cases[c], true, buffers, out);
+
+        printf("%-12s %12.3f %12.3f %7.2fx %10.2g\n", cases[c].name, before,
+            after, before / after, diff);
+    }
+
+    printf("resampler kernel: %s, %d taps, %d -> %d Hz %.3f ns/sample\n",
+        ResamplerKernel(), RESAMPLE_TAPS, SAMPLE_RATE, NATIVE_RATE,
+        TimeResample(shot, SHOT_LENGTH));
+
+    free(shot);
+    free(fall);
+    free(explode);
+    free(fire);
+    return 0;
+}
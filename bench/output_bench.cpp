@@ -0,0 +1,446 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : output_bench.cpp
+*   Purpose : Measures the terminal output (bytes per frame and bytes per
+*             second) generated while replaying a game session
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <ncurses.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pty.h>
+#include <sys/ioctl.h>
+
+#include "../tankvufo.h"
+#include "../replay.h"
+
+/*
+ * The game is run against a terminal description (the "backend") with all
+ * of its output going to a pseudo-terminal, so ncurses sees a real tty
+ * (baud rate, modes and size) and picks the same cursor motions it would
+ * for a player.  The bytes read from the master side after each tick's
+ * update are what would have been sent to the terminal.  Each terminal is
+ * measured with every output backend:
+ *      legacy - ncurses update after every tick phase (the way the game
+ *               used to refresh from inside each object)
+ *      curses - a single ncurses update at the end of the tick
+ *      ansi   - a single AnsiOutput update at the end of the tick
+ */
+
+typedef enum
+{
+    BACKEND_LEGACY,
+    BACKEND_CURSES,
+    BACKEND_ANSI,
+    NUM_BACKENDS
+} backend_t;
+
+static const char *BACKEND_NAMES[NUM_BACKENDS] = {"legacy", "curses", "ansi"};
+
+static const int TICKS_PER_SECOND = 5;          /* 200ms game tick */
+static const int DEFAULT_TICKS = 3000;          /* 10 minutes of play */
+static const long TARGET_BYTES = 64;            /* goal for a typical tick */
+static const unsigned int SYNTHETIC_SEED = 2020;
+
+static const char *DEFAULT_TERMS[] =
+{
+    "xterm-256color", "screen-256color", "tmux-256color", "linux", "vt100",
+    nullptr
+};
+
+typedef struct
+{
+    long total;
+    long median;
+    long p95;
+    long max;
+} tick_stats_t;
+
+static int CompareLong(const void *a, const void *b)
+{
+    long la = *(const long *)a;
+    long lb = *(const long *)b;
+
+    return (la > lb) - (la < lb);
+}
+
+
+/* keys for one tick of a made up session that moves, shoots and quits */
+static int SyntheticKeys(int tick, int ticks, char *keys)
+{
+    static unsigned int state;
+    int count;
+
+    if (0 == tick)
+    {
+        state = SYNTHETIC_SEED;
+    }
+
+    if (tick == ticks - 1)
+    {
+        keys[0] = 'q';
+        return 1;
+    }
+
+    /* xorshift so the game's rand() sequence isn't disturbed */
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    count = 0;
+
+    switch (state % 8)
+    {
+        case 0:
+        case 1:
+            keys[count++] = 'z';
+            break;
+
+        case 2:
+        case 3:
+            keys[count++] = 'c';
+            break;
+
+        case 4:
+            keys[count++] = 'b';
+            break;
+
+        default:
+            break;
+    }
+
+    if (0 == (state >> 8) % 97)
+    {
+        /* the occasional volume change */
+        keys[count++] = ((state >> 16) % 2) ? '+' : '-';
+    }
+
+    return count;
+}
+
+
+/* read (and count) everything the game has written to the terminal */
+static long DrainPty(int master)
+{
+    char buffer[4096];
+    long total;
+    ssize_t got;
+
+    total = 0;
+
+    while ((got = read(master, buffer, sizeof(buffer))) > 0)
+    {
+        total += got;
+    }
+
+    return total;
+}
+
+
+static bool RunSession(const char *term, backend_t backend, Replay *replay,
+    int ticks, long *tickBytes, int *ticksRun)
+{
+    int master, slave;
+    struct winsize size;
+    FILE *outFile;
+    SCREEN *screen;
+    TankVUfo *tvu;
+    int winX, winY;
+
+    size.ws_row = 40;
+    size.ws_col = 100;
+    size.ws_xpixel = 0;
+    size.ws_ypixel = 0;
+
+    if (openpty(&master, &slave, nullptr, nullptr, &size) != 0)
+    {
+        perror("opening pseudo-terminal");
+        return false;
+    }
+
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+    outFile = fdopen(slave, "r+");
+    screen = newterm(term, outFile, outFile);
+
+    if (nullptr == screen)
+    {
+        fprintf(stderr, "%s: unknown terminal type\n", term);
+        fclose(outFile);
+        close(master);
+        return false;
+    }
+
+    srand((nullptr != replay) ? replay->GetSeed() : SYNTHETIC_SEED);
+    tvu = new TankVUfo(screen);
+
+    if ((BACKEND_ANSI == backend) && !tvu->UseAnsiOutput(slave))
+    {
+        /* not an ANSI terminal */
+        delete tvu;
+        delscreen(screen);
+        fclose(outFile);
+        close(master);
+        return false;
+    }
+
+    /* same layout as main() */
+    winX = (COLS - Tvu::V20_COLS) / 2;
+    winY = (LINES - Tvu::V20_ROWS) / 2;
+    tvu->MakeV20Win(Tvu::V20_ROWS, Tvu::V20_COLS, winY, winX);
+    winY = (LINES - Tvu::VOL_ROWS) / 2;
+    winX += Tvu::V20_COLS + Tvu::VOL_COLS;
+    tvu->MakeVolWin(Tvu::VOL_ROWS, Tvu::VOL_COLS, winY, winX);
+    wnoutrefresh(stdscr);
+    tvu->InitializeV20Win();
+    tvu->DrawVolumeLevelBox();
+    tvu->ShowVolumeLevel(TankVUfo::VOLUME);
+    tvu->InitializeVehicles();
+    tvu->PrintScore();
+    tvu->Refresh();
+
+    /* the initial screen isn't part of any tick */
+    DrainPty(master);
+    *ticksRun = 0;
+
+    if (nullptr != replay)
+    {
+        replay->Rewind();
+    }
+
+    for (int i = 0; i < ticks; i++)
+    {
+        const char *keys;
+        char synthetic[4];
+        int count;
+
+        if (nullptr != replay)
+        {
+            keys = replay->NextTick(&count);
+        }
+        else
+        {
+            count = SyntheticKeys(i, ticks, synthetic);
+            keys = synthetic;
+        }
+
+        if ((nullptr == keys) || (tvu->ReplayKeys(keys, count) < 0))
+        {
+            break;
+        }
+
+        if (BACKEND_LEGACY == backend)
+        {
+            tvu->Refresh();
+            tvu->MoveTank();
+            tvu->Refresh();
+            tvu->MoveUfo();
+            tvu->Refresh();
+            tvu->UpdateTankShot();
+            tvu->Refresh();
+            tvu->UpdateUfoShot();
+            tvu->Refresh();
+        }
+        else
+        {
+            tvu->MoveTank();
+            tvu->MoveUfo();
+            tvu->UpdateTankShot();
+            tvu->UpdateUfoShot();
+        }
+
+        tvu->PrintScore();
+        tvu->Refresh();
+
+        tickBytes[*ticksRun] = DrainPty(master);
+        *ticksRun += 1;
+    }
+
+    delete tvu;
+    delscreen(screen);
+    fclose(outFile);
+    close(master);
+    return true;
+}
+
+
+static void GetStats(long *tickBytes, int ticks, tick_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    if (0 == ticks)
+    {
+        return;
+    }
+
+    for (int i = 0; i < ticks; i++)
+    {
+        stats->total += tickBytes[i];
+    }
+
+    qsort(tickBytes, ticks, sizeof(long), CompareLong);
+    stats->median = tickBytes[ticks / 2];
+    stats->p95 = tickBytes[(ticks * 95) / 100];
+    stats->max = tickBytes[ticks - 1];
+}
+
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-n ticks] [-t term[,term...]] [replay]\n",
+        progName);
+    fprintf(stderr, "  -n ticks  ticks to run (default %d, replay length "
+        "for a replay)\n", DEFAULT_TICKS);
+    fprintf(stderr, "  -t terms  comma separated terminal types\n");
+    fprintf(stderr, "  replay    session recorded with tankvufo -r "
+        "(default synthetic)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    int opt;
+    int ticks;
+    char *termList;
+    const char *terms[32];
+    int termCount;
+    Replay replay;
+    Replay *session;
+    long *tickBytes;
+
+    ticks = DEFAULT_TICKS;
+    termList = nullptr;
+    session = nullptr;
+
+    while ((opt = getopt(argc, argv, "n:t:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                ticks = atoi(optarg);
+                break;
+
+            case 't':
+                termList = optarg;
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (optind < argc)
+    {
+        if (!replay.Load(argv[optind]))
+        {
+            perror(argv[optind]);
+            return 1;
+        }
+
+        session = &replay;
+
+        if (DEFAULT_TICKS == ticks)
+        {
+            ticks = replay.GetTicks();
+        }
+    }
+
+    if (ticks <= 0)
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    /* list of terminal types to measure */
+    termCount = 0;
+
+    if (nullptr != termList)
+    {
+        for (char *t = strtok(termList, ","); (nullptr != t) && (termCount < 31);
+            t = strtok(nullptr, ","))
+        {
+            terms[termCount++] = t;
+        }
+    }
+    else
+    {
+        while (nullptr != DEFAULT_TERMS[termCount])
+        {
+            terms[termCount] = DEFAULT_TERMS[termCount];
+            termCount++;
+        }
+    }
+
+    /* UTF-8 output regardless of the caller's locale */
+    setlocale(LC_ALL, "C.UTF-8");
+
+    tickBytes = (long *)malloc(sizeof(long) * ticks);
+
+    if (nullptr == tickBytes)
+    {
+        perror("allocating tick byte counts");
+        return 1;
+    }
+
+    printf("%-16s %-7s %6s %8s %7s %5s %5s %5s %8s\n", "terminal",
+        "backend", "ticks", "bytes", "mean", "p50", "p95", "max", "B/s");
+
+    for (int t = 0; t < termCount; t++)
+    {
+        for (int b = 0; b < NUM_BACKENDS; b++)
+        {
+            tick_stats_t stats;
+            int ticksRun;
+
+            if (!RunSession(terms[t], (backend_t)b, session, ticks, tickBytes,
+                &ticksRun))
+            {
+                printf("%-16s %-7s not supported\n", terms[t],
+                    BACKEND_NAMES[b]);
+                continue;
+            }
+
+            GetStats(tickBytes, ticksRun, &stats);
+            printf("%-16s %-7s %6d %8ld %7.1f %5ld %5ld %5ld",
+                terms[t], BACKEND_NAMES[b], ticksRun,
+                stats.total, (double)stats.total / ticksRun, stats.median,
+                stats.p95, stats.max);
+            printf(" %8.0f%s\n",
+                (double)stats.total * TICKS_PER_SECOND / ticksRun,
+                (stats.median <= TARGET_BYTES) ? "" : "  (p50 over target)");
+        }
+    }
+
+    free(tickBytes);
+    return 0;
+}
@@ -0,0 +1,558 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : sound_stress.cpp
+*   Purpose : Stress test of the sound command queue.  Floods the
+*             commands from the game thread while the null backend
+*             renders, and checks the callback never sees torn state.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <ctime>
+#include <atomic>
+#include <unistd.h>
+
+#include "../sounds.h"
+#include "../audio_backend.h"
+#include "../vic_synth.h"
+
+/*
+ * The game thread's side of the sound command queue is flooded with
+ * random SelectSound(), StopSound(), NextUfoSound() and volume changes,
+ * with tick times that are now, between ticks or a little ahead, while
+ * the null backend renders in real time.  After every callback the
+ * callback's own state is checked:
+ *      phase   a sample voice's next sample is past its end
+ *      sample  a sample voice plays another sound's samples or length
+ *      voice   a sound is playing on another sound's voice
+ *      volume  the volume is outside 0..1 (or not a number)
+ *      queue   more commands waiting than the queue holds, or the tail
+ *              moved backwards or past the head
+ *      output  a rendered sample is not finite or louder than every voice
+ *              at full volume
+ * The game thread checks its copy of the volume and its view of the queue
+ * the same way.  When the flood is over everything is stopped, and
+ *      settle  the callback still has a voice playing, or another volume,
+ *              SETTLE_MS later (a dropped stop was never sent again)
+ * Each run plays the sound pack and then the emulated VIC.
+ */
+
+static const unsigned long DEFAULT_SECONDS = 2;     /* per run */
+static const long long MAX_AHEAD_NS = 20000000;     /* tick time ahead */
+static const int SETTLE_MS = 1000;
+
+typedef enum
+{
+    CHECK_PHASE,
+    CHECK_SAMPLE,
+    CHECK_VOICE,
+    CHECK_VOLUME,
+    CHECK_QUEUE,
+    CHECK_OUTPUT,
+    CHECK_SETTLE,
+    NUM_CHECKS
+} check_t;
+
+static const char *CHECK_NAME[NUM_CHECKS] =
+{
+    "phase", "sample", "voice", "volume", "queue", "output", "settle"
+};
+
+/* written by the callback thread, read once the run is over */
+typedef struct
+{
+    std::atomic<unsigned long long> callbacks;
+    std::atomic<unsigned long long> maxWaiting;     /* most commands queued */
+    std::atomic<bool> silent;       /* no voice or command after a render */
+    std::atomic<float> volume;      /* ... and the volume it was at */
+    std::atomic<unsigned long long> failed[NUM_CHECKS];
+} stress_checks_t;
+
+
+static long long MonotonicNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/* the voice sounds.cpp plays each sound on */
+static voice_t VoiceFor(sound_t sound)
+{
+    switch (sound)
+    {
+        case SOUND_LOW_FREQ:
+        case SOUND_HIGH_FREQ:
+            return VOICE_FALL;
+
+        case SOUND_EXPLODE:
+            return VOICE_EXPLODE;
+
+        case SOUND_ON_FIRE:
+            return VOICE_FIRE;
+
+        case SOUND_TANK_SHOT:
+        default:
+            return VOICE_SHOT;
+    }
+}
+
+
+static void Fail(stress_checks_t *checks, check_t check)
+{
+    checks->failed[check].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+/*
+ * Renders in real time like the null backend, and checks the callback's
+ * state after each render, on the thread that owns it.
+ */
+class CheckedBackend : public NullBackend
+{
+    public:
+        CheckedBackend(stress_checks_t *checks);
+
+        bool Open(int sampleRate, audio_render_t render, void *userData);
+        const char *Name(void) const { return "checked null"; }
+
+        /* the callback's data, nullptr until Open() */
+        const sound_data_t *Data(void) const { return data; }
+
+    private:
+        stress_checks_t *checks;
+        audio_render_t render;
+        sound_data_t *data;     /* the Sounds' userData */
+        unsigned int lastTail;  /* callback only */
+
+        static void CheckedRender(float *out, unsigned long frames,
+            const audio_status_t *status, void *userData);
+        void Check(const float *out, unsigned long frames);
+};
+
+
+CheckedBackend::CheckedBackend(stress_checks_t *checks)
+{
+    this->checks = checks;
+    render = nullptr;
+    data = nullptr;
+    lastTail = 0;
+}
+
+
+bool CheckedBackend::Open(int sampleRate, audio_render_t render,
+    void *userData)
+{
+    this->render = render;
+    data = (sound_data_t *)userData;
+    lastTail = data->queue.tail.load(std::memory_order_relaxed);
+    return NullBackend::Open(sampleRate, CheckedRender, this);
+}
+
+
+void CheckedBackend::CheckedRender(float *out, unsigned long frames,
+    const audio_status_t *status, void *userData)
+{
+    CheckedBackend *backend = (CheckedBackend *)userData;
+
+    backend->render(out, frames, status, backend->data);
+    backend->Check(out, frames);
+}
+
+
+void CheckedBackend::Check(const float *out, unsigned long frames)
+{
+    const float loudest = NUM_VOICES * MIX_GAIN * 1.001f;
+    const command_queue_t *queue = &data->queue;
+    unsigned int head, tail;
+    unsigned long long waiting;
+    bool silent;
+
+    checks->callbacks.fetch_add(1, std::memory_order_relaxed);
+    silent = true;
+
+    for (int v = 0; v < NUM_VOICES; v++)
+    {
+        const voice_data_t *voice = &data->voice[v];
+        const sample_data_t *sample;
+
+        if (SOUND_OFF == voice->sound)
+        {
+            continue;
+        }
+
+        silent = false;
+
+        if ((voice->sound < SOUND_OFF) || (voice->sound >= NUM_SOUNDS) ||
+            (VoiceFor(voice->sound) != v))
+        {
+            Fail(checks, CHECK_VOICE);
+            continue;
+        }
+
+        if (voice->synth)
+        {
+            continue;
+        }
+
+        sample = &data->sample[voice->sound];
+
+        if ((voice->samples != sample->samples) ||
+            (voice->length != sample->length))
+        {
+            Fail(checks, CHECK_SAMPLE);
+        }
+
+        if ((voice->phase < 0) || (voice->phase >= voice->length))
+        {
+            Fail(checks, CHECK_PHASE);
+        }
+    }
+
+    if (!(data->volume >= 0.0f) || !(data->volume <= 1.0f))
+    {
+        Fail(checks, CHECK_VOLUME);
+    }
+
+
+    /* the tail is ours, the head may have moved on since the render */
+    tail = queue->tail.load(std::memory_order_relaxed);
+    head = queue->head.load(std::memory_order_acquire);
+    waiting = head - tail;
+
+    if ((waiting > COMMAND_QUEUE_SIZE) || (tail - lastTail > head - lastTail))
+    {
+        Fail(checks, CHECK_QUEUE);
+    }
+    else if (waiting > checks->maxWaiting.load(std::memory_order_relaxed))
+    {
+        checks->maxWaiting.store(waiting, std::memory_order_relaxed);
+    }
+
+    lastTail = tail;
+
+    /* nothing playing and nothing more to do */
+    checks->volume.store(data->volume, std::memory_order_relaxed);
+    checks->silent.store(silent && (0 == waiting), std::memory_order_release);
+
+    for (unsigned long i = 0; i < 2 * frames; i++)
+    {
+        if (!std::isfinite(out[i]) || (fabsf(out[i]) > loudest))
+        {
+            Fail(checks, CHECK_OUTPUT);
+            break;
+        }
+    }
+}
+
+
+/* xorshift, the same flood for the same seed */
+static unsigned int NextRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+/* the game thread's side of the checks, false if one failed */
+static bool CheckGame(const Sounds *sounds, const sound_data_t *data,
+    stress_checks_t *checks, bool *full)
+{
+    unsigned int head, tail;
+    float volume;
+    bool ok;
+
+    ok = true;
+    volume = sounds->GetVolume();
+
+    if (!(volume >= 0.0f) || !(volume <= 1.0f))
+    {
+        Fail(checks, CHECK_VOLUME);
+        ok = false;
+    }
+
+    /* the head is ours, the tail only moves towards it */
+    tail = data->queue.tail.load(std::memory_order_acquire);
+    head = data->queue.head.load(std::memory_order_relaxed);
+
+    if (head - tail > COMMAND_QUEUE_SIZE)
+    {
+        Fail(checks, CHECK_QUEUE);
+        ok = false;
+    }
+
+    *full = (COMMAND_QUEUE_SIZE == head - tail);
+    return ok;
+}
+
+
+/*
+ * Floods one Sounds for seconds and reports what it found, false if any
+ * check failed or the callback never ran.
+ */
+static bool RunStress(const char *name, const char *packName,
+    vic_chip_t chip, unsigned long seconds, unsigned int *seed)
+{
+    Sounds *sounds;
+    CheckedBackend *backend;
+    stress_checks_t checks;
+    unsigned long long sends, fullSends, failures;
+    long long end;
+    bool ok, full;
+
+    checks.callbacks.store(0);
+    checks.maxWaiting.store(0);
+    checks.silent.store(false);
+    checks.volume.store(-1.0f);
+
+    for (int c = 0; c < NUM_CHECKS; c++)
+    {
+        checks.failed[c].store(0);
+    }
+
+    sounds = new Sounds();
+
+    if (VIC_NONE == chip)
+    {
+        if (!sounds->LoadSounds(packName))
+        {
+            fprintf(stderr, "sound pack %s: %s\n", sounds->PackName(),
+                strerror(errno));
+            delete sounds;
+            return false;
+        }
+    }
+    else
+    {
+        sounds->UseVicSynth(chip);
+    }
+
+    backend = new CheckedBackend(&checks);
+
+    if (!sounds->CreateSoundStream(backend, 0.5) ||
+        !sounds->StartSoundStream())
+    {
+        fprintf(stderr, "%s: can't start the sound stream\n", name);
+        delete sounds;
+        return false;
+    }
+
+    sends = 0;
+    fullSends = 0;
+    end = MonotonicNs() + (long long)seconds * 1000000000LL;
+
+    while (MonotonicNs() < end)
+    {
+        unsigned int r = NextRandom(seed);
+        sound_t sound = (sound_t)((r >> 8) % NUM_SOUNDS);
+
+        switch (r % 8)
+        {
+            case 0:
+            case 1:
+            case 2:
+                sounds->SelectSound(sound);
+                break;
+
+            case 3:
+                sounds->StopSound(sound);
+                break;
+
+            case 4:
+                sounds->NextUfoSound();
+                break;
+
+            case 5:
+                sounds->IncrementVolume();
+                break;
+
+            case 6:
+                sounds->DecrementVolume();
+                break;
+
+            default:
+                /* now, between ticks, or a tick that's a little ahead */
+                if (0 == (r & 0x100))
+                {
+                    sounds->SetTickTime(-1);
+                }
+                else
+                {
+                    sounds->SetTickTime(MonotonicNs() +
+                        (long long)((r >> 9) % MAX_AHEAD_NS));
+                }
+                continue;
+        }
+
+        sends++;
+        CheckGame(sounds, backend->Data(), &checks, &full);
+
+        if (full)
+        {
+            fullSends++;
+        }
+
+        /* sometimes let the callback drain the queue */
+        if (0 == (r >> 24))
+        {
+            usleep(r & 0xfff);
+        }
+    }
+
+    /* the queue is likely full, the stop still has to get through */
+    sounds->SetTickTime(-1);
+    sounds->SelectSound(SOUND_OFF);
+
+    for (int ms = 0; ms < SETTLE_MS; ms++)
+    {
+        usleep(1000);
+
+        /* the game's ticks go on, each one may resend what was dropped */
+        sounds->SetTickTime(MonotonicNs());
+        sounds->SetTickTime(-1);
+
+        if (checks.silent.load(std::memory_order_acquire) &&
+            (checks.volume.load(std::memory_order_relaxed) ==
+            sounds->GetVolume()))
+        {
+            break;
+        }
+    }
+
+    if (!checks.silent.load(std::memory_order_acquire) ||
+        (checks.volume.load(std::memory_order_relaxed) != sounds->GetVolume()))
+    {
+        Fail(&checks, CHECK_SETTLE);
+    }
+
+    /* the backend is closed before the checks go out of scope */
+    sounds->CloseSoundStream();
+    delete sounds;
+
+    failures = 0;
+
+    for (int c = 0; c < NUM_CHECKS; c++)
+    {
+        failures += checks.failed[c].load();
+    }
+
+    ok = (0 == failures) && (0 != checks.callbacks.load());
+    printf("%-8s %10llu sends %5.1f%% full %8llu callbacks %3llu most queued"
+        " %s\n", name, sends, (0 == sends) ? 0.0 : 100.0 * fullSends / sends,
+        checks.callbacks.load(), checks.maxWaiting.load(),
+        ok ? "ok" : "FAILED");
+
+    for (int c = 0; c < NUM_CHECKS; c++)
+    {
+        if (0 != checks.failed[c].load())
+        {
+            printf("    %-8s %llu failures\n", CHECK_NAME[c],
+                checks.failed[c].load());
+        }
+    }
+
+    return ok;
+}
+
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-s seconds] [-p pack] [-r seed]\n",
+        progName);
+    fprintf(stderr, "  -s seconds  flood time for each run (default %lu)\n",
+        DEFAULT_SECONDS);
+    fprintf(stderr, "  -p pack     sound pack to play (default %s next to"
+        " the program)\n", PACK_FILE_NAME);
+    fprintf(stderr, "  -r seed     random seed for the flood (default from"
+        " the clock)\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    int opt;
+    unsigned long seconds;
+    unsigned int seed;
+    const char *packName;
+    bool ok;
+
+    seconds = DEFAULT_SECONDS;
+    packName = nullptr;
+    seed = (unsigned int)MonotonicNs();
+
+    while ((opt = getopt(argc, argv, "s:p:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                seconds = strtoul(optarg, nullptr, 10);
+                break;
+
+            case 'p':
+                packName = optarg;
+                break;
+
+            case 'r':
+                seed = (unsigned int)strtoul(optarg, nullptr, 0);
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((0 == seconds) || (optind < argc))
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    if (0 == seed)
+    {
+        /* xorshift never leaves 0 */
+        seed = 1;
+    }
+
+    printf("seed %u, %lu seconds per run\n", seed, seconds);
+    ok = RunStress("samples", packName, VIC_NONE, seconds, &seed);
+    ok = RunStress("vic", nullptr, VIC_6560, seconds, &seed) && ok;
+    printf("%s\n", ok ? "no torn state" : "torn state found");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,429 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : flight_recorder.cpp
+*   Purpose : Keeps the last few thousand ticks in a ring and writes
+*             them to a file on SIGUSR1, a late tick or a fatal signal.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <climits>
+#include <atomic>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "flight_recorder.h"
+
+/* the dump is written with nothing but write(), so it works in a handler */
+typedef struct
+{
+    int fd;
+    int length;             /* in buffer */
+    int error;              /* errno of the first failed write, or 0 */
+    char buffer[4096];
+} dump_file_t;
+
+static const char *DIRECTION_NAMES[] =
+{
+    "none", "left", "right", "fall-l", "fall-r", "landed"
+};
+
+static flight_tick_t ring[FLIGHT_TICKS];
+static std::atomic<unsigned long> recorded(0);     /* including overwritten */
+static std::atomic<bool> dumpRequested(false);
+static long long startNs;
+
+/* the directory and tankvufo-<pid>-, each dump adds its number */
+static char fileName[PATH_MAX];
+static int prefixLength = -1;
+static unsigned int dumps = 0;
+static bool fileWritten = false;
+
+static long long NowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/* value in decimal at out, returns the number of characters (at most 20) */
+static int FormatNumber(char *out, long long value)
+{
+    char digits[20];
+    unsigned long long magnitude;
+    int count;
+    int length;
+
+    magnitude = (value < 0) ? 0 - (unsigned long long)value : value;
+    count = 0;
+
+    do
+    {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    length = 0;
+
+    if (value < 0)
+    {
+        out[length++] = '-';
+    }
+
+    while (count > 0)
+    {
+        out[length++] = digits[--count];
+    }
+
+    return length;
+}
+
+
+static void Flush(dump_file_t *file)
+{
+    char *p;
+
+    p = file->buffer;
+
+    while ((file->length > 0) && (0 == file->error))
+    {
+        ssize_t n;
+
+        n = write(file->fd, p, file->length);
+
+        if (n < 0)
+        {
+            if (EINTR != errno)
+            {
+                file->error = errno;
+            }
+
+            continue;
+        }
+
+        p += n;
+        file->length -= n;
+    }
+
+    file->length = 0;
+}
+
+
+static void Put(dump_file_t *file, const char *text)
+{
+    while ('\0' != *text)
+    {
+        if (file->length == sizeof(file->buffer))
+        {
+            Flush(file);
+        }
+
+        file->buffer[file->length++] = *text++;
+    }
+}
+
+
+/* right aligned in width columns, with a space before it */
+static void PutNumber(dump_file_t *file, long long value, int width)
+{
+    char text[40];
+    char number[20];
+    int length;
+    int i;
+
+    length = FormatNumber(number, value);
+    i = 0;
+    text[i++] = ' ';
+
+    while ((width > length) && (i < 20))
+    {
+        text[i++] = ' ';
+        width--;
+    }
+
+    memcpy(text + i, number, length);
+    text[i + length] = '\0';
+    Put(file, text);
+}
+
+
+static void PutTick(dump_file_t *file, const flight_tick_t *tick)
+{
+    const Tvu::TickState *state;
+    char keys[FLIGHT_KEYS + 2];
+    int direction;
+    int i;
+
+    state = &tick->state;
+    PutNumber(file, tick->tick, 8);
+    PutNumber(file, (tick->ns - startNs) / 1000000, 9);
+    PutNumber(file, tick->late, 4);
+    PutNumber(file, tick->simNs / 1000, 6);
+    PutNumber(file, tick->keyUs, 7);
+    PutNumber(file, state->tankX, 4);
+    PutNumber(file, state->ufo.x, 5);
+    PutNumber(file, state->ufo.y, 5);
+
+    direction = state->ufoDirection;
+
+    if ((direction < Tvu::DIR_NONE) || (direction > Tvu::DIR_LANDED))
+    {
+        direction = Tvu::DIR_NONE;
+    }
+
+    Put(file, " ");
+    Put(file, DIRECTION_NAMES[direction]);
+    Put(file, &"       "[strlen(DIRECTION_NAMES[direction])]);
+    PutNumber(file, state->ufoShot.x, 5);
+    PutNumber(file, state->ufoShot.y, 5);
+    PutNumber(file, state->tankShot.x, 5);
+    PutNumber(file, state->tankShot.y, 5);
+    PutNumber(file, state->tankOnFire, 4);
+    PutNumber(file, state->ufosKilled, 5);
+    PutNumber(file, state->tanksKilled, 5);
+    PutNumber(file, state->volume, 3);
+    Put(file, " ");
+
+    for (i = 0; (i < tick->keyCount) && (i < FLIGHT_KEYS); i++)
+    {
+        /* the keys are read from a terminal, they could be anything */
+        keys[i] = ((tick->keys[i] > ' ') && (tick->keys[i] <= '~')) ?
+            tick->keys[i] : '?';
+    }
+
+    keys[i] = '\0';
+    Put(file, keys);
+
+    if (tick->keyCount > FLIGHT_KEYS)
+    {
+        Put(file, " +");
+        PutNumber(file, tick->keyCount - FLIGHT_KEYS, 0);
+    }
+
+    Put(file, "\n");
+}
+
+
+static const char *SignalName(int sig)
+{
+    switch (sig)
+    {
+        case SIGSEGV:
+            return "SIGSEGV";
+
+        case SIGBUS:
+            return "SIGBUS";
+
+        case SIGFPE:
+            return "SIGFPE";
+
+        case SIGILL:
+            return "SIGILL";
+
+        case SIGABRT:
+            return "SIGABRT";
+
+        default:
+            return "signal";
+    }
+}
+
+
+static void RequestDump(int sig)
+{
+    (void)sig;
+    dumpRequested.store(true);
+}
+
+
+/*
+ * Dump the ring and die of the signal.  SA_RESETHAND has put back the
+ * default action, which the raised signal gets once the handler returns.
+ */
+static void FatalSignal(int sig)
+{
+    const char *name;
+
+    name = SignalName(sig);
+
+    if (FlightDump(name))
+    {
+        /* the terminal is probably still in curses mode */
+        write(STDERR_FILENO, "\r\ntankvufo: ", 12);
+        write(STDERR_FILENO, name, strlen(name));
+        write(STDERR_FILENO, ", flight recorder written to ", 29);
+        write(STDERR_FILENO, fileName, strlen(fileName));
+        write(STDERR_FILENO, "\r\n", 2);
+    }
+
+    raise(sig);
+}
+
+
+void FlightStart(const char *directory)
+{
+    static const int FATAL_SIGNALS[] =
+    {
+        SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT
+    };
+
+    struct sigaction action;
+
+    /* the first lap of the ring doesn't page fault */
+    memset(ring, 0, sizeof(ring));
+    recorded.store(0);
+    startNs = NowNs();
+
+    /* room is left for the dump number */
+    prefixLength = snprintf(fileName, sizeof(fileName), "%s/tankvufo-%d-",
+        directory, (int)getpid());
+
+    if (prefixLength >= (int)sizeof(fileName) - 32)
+    {
+        prefixLength = -1;
+    }
+
+    memset(&action, 0, sizeof(action));
+    sigemptyset(&action.sa_mask);
+    action.sa_handler = RequestDump;
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &action, nullptr);
+
+    action.sa_handler = FatalSignal;
+    action.sa_flags = SA_RESETHAND;
+
+    for (int sig : FATAL_SIGNALS)
+    {
+        sigaction(sig, &action, nullptr);
+    }
+}
+
+
+void FlightRecord(const flight_tick_t *tick)
+{
+    unsigned long count;
+
+    count = recorded.load(std::memory_order_relaxed);
+    ring[count & (FLIGHT_TICKS - 1)] = *tick;
+    recorded.store(count + 1, std::memory_order_release);
+}
+
+
+bool FlightDumpRequested(void)
+{
+    if (!dumpRequested.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    return dumpRequested.exchange(false);
+}
+
+
+/*
+ * Called from a signal handler too, so it sticks to async-signal-safe
+ * calls: no stdio, no allocation and no locks.
+ */
+bool FlightDump(const char *reason)
+{
+    dump_file_t file;
+    unsigned long count;
+    unsigned long first;
+    int length;
+
+    fileWritten = false;
+
+    if (prefixLength < 0)
+    {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+
+    dumps++;
+    length = prefixLength + FormatNumber(fileName + prefixLength, dumps);
+    strcpy(fileName + length, ".flight");
+
+    file.fd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (file.fd < 0)
+    {
+        return false;
+    }
+
+    file.length = 0;
+    file.error = 0;
+
+    count = recorded.load(std::memory_order_acquire);
+    first = (count > FLIGHT_TICKS) ? count - FLIGHT_TICKS : 0;
+
+    Put(&file, "# tankvufo flight recorder: ");
+    Put(&file, reason);
+    Put(&file, ", pid");
+    PutNumber(&file, getpid(), 0);
+    Put(&file, "\n# last");
+    PutNumber(&file, count - first, 0);
+    Put(&file, " of");
+    PutNumber(&file, count, 0);
+    Put(&file, " ticks, ms since the game started, t_pts and u_pts are the"
+        " scores\n");
+    Put(&file, "#    tick        ms late sim_us  key_us tank ufo_x ufo_y "
+        "ufo_dir ush_x ush_y tsh_x tsh_y fire t_pts u_pts vol keys\n");
+
+    for (unsigned long i = first; i < count; i++)
+    {
+        PutTick(&file, &ring[i & (FLIGHT_TICKS - 1)]);
+    }
+
+    Flush(&file);
+
+    if (0 != close(file.fd) && (0 == file.error))
+    {
+        file.error = errno;
+    }
+
+    if (0 != file.error)
+    {
+        errno = file.error;
+        return false;
+    }
+
+    fileWritten = true;
+    return true;
+}
+
+
+const char *FlightFileName(void)
+{
+    return fileWritten ? fileName : nullptr;
+}
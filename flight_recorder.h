@@ -0,0 +1,86 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : flight_recorder.h
+*   Purpose : Header for the flight recorder, the last few thousand
+*             ticks kept in memory and written to a file when asked for.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __FLIGHT_RECORDER_H
+#define  __FLIGHT_RECORDER_H
+
+#include <cstdint>
+
+#include "tvu_defs.h"
+
+/* ticks kept, about 13 minutes of play */
+static const unsigned int FLIGHT_TICKS = 4096;     /* must be a power of 2 */
+
+/* keys kept per tick, the rest are only counted */
+static const int FLIGHT_KEYS = 6;
+
+/* fewest ticks between the dumps of late ticks, a minute of play */
+static const unsigned long FLIGHT_LATE_GAP = 300;
+
+/* what's kept of a tick, 48 bytes */
+typedef struct
+{
+    long long ns;               /* CLOCK_MONOTONIC when the tick started */
+    uint32_t tick;
+    uint32_t simNs;             /* time the tick took */
+    uint32_t keyUs;             /* longest key read to tick, 0 for no keys */
+    uint16_t late;              /* timer expirations missed before the tick */
+    uint8_t keyCount;           /* keys handled */
+    char keys[FLIGHT_KEYS];     /* the first FLIGHT_KEYS of them */
+    Tvu::TickState state;       /* after the tick */
+} flight_tick_t;
+
+/*
+ * The simulation records every tick into a ring whose pages FlightStart()
+ * faults in, so a tick costs a 48 byte copy.  A dump
+ * writes the ring to a new text file named tankvufo-<pid>-<n>.flight in
+ * the directory given to FlightStart().  FlightStart() catches SIGUSR1,
+ * which asks for a dump, and the fatal signals (SIGSEGV, SIGBUS, SIGFPE,
+ * SIGILL and SIGABRT), which dump the ring from the signal handler before
+ * the game dies the way it would have.
+ */
+void FlightStart(const char *directory);
+
+/* only called by the simulation */
+void FlightRecord(const flight_tick_t *tick);
+
+/* true once for each time SIGUSR1 has asked for a dump */
+bool FlightDumpRequested(void);
+
+/* write the ring to a new file, false with errno set on failure */
+bool FlightDump(const char *reason);
+
+/* the last file FlightDump() wrote, nullptr if there isn't one */
+const char *FlightFileName(void);
+
+#endif /* ndef  __FLIGHT_RECORDER_H */
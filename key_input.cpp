@@ -0,0 +1,193 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : key_input.cpp
+*   Purpose : Input stage, reads keys on a thread of its own and queues them
+*             with the time they were read for the game loop.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <sys/eventfd.h>
+#include <sys/poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <ctime>
+
+#include "key_input.h"
+#include "trace.h"
+
+KeyInput::KeyInput(int fd)
+{
+    this->fd = fd;
+    stopFd = -1;
+    head.store(0);
+    tail.store(0);
+    dropped.store(0);
+}
+
+
+KeyInput::~KeyInput(void)
+{
+    Stop();
+}
+
+
+bool KeyInput::Start(void)
+{
+    stopFd = eventfd(0, 0);
+
+    if (stopFd < 0)
+    {
+        return false;
+    }
+
+    thread = std::thread(&KeyInput::Run, this);
+    return true;
+}
+
+
+void KeyInput::Stop(void)
+{
+    if (stopFd < 0)
+    {
+        return;
+    }
+
+    if (thread.joinable())
+    {
+        uint64_t one = 1;
+
+        write(stopFd, &one, sizeof(one));
+        thread.join();
+    }
+
+    close(stopFd);
+    stopFd = -1;
+}
+
+
+int KeyInput::Take(key_event_t *keys, int max)
+{
+    unsigned int head, tail;
+    int count;
+
+    tail = this->tail.load(std::memory_order_relaxed);
+    head = this->head.load(std::memory_order_acquire);
+
+    for (count = 0; (count < max) && (tail != head); count++)
+    {
+        keys[count] = event[tail & (KEY_QUEUE_SIZE - 1)];
+        tail++;
+    }
+
+    this->tail.store(tail, std::memory_order_release);
+    return count;
+}
+
+
+unsigned long KeyInput::Dropped(void) const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
+
+
+/* read keys until stopped, the end of the input just stops the reading */
+void KeyInput::Run(void)
+{
+    struct pollfd fdPoll[2];
+
+    fdPoll[0].fd = stopFd;
+    fdPoll[0].events = POLLIN;
+    fdPoll[1].fd = fd;
+    fdPoll[1].events = POLLIN;
+    TraceNameThread("input");
+
+    for (;;)
+    {
+        char buffer[KEY_QUEUE_SIZE];
+        struct timespec now;
+        long long readNs;
+        unsigned int head;
+        ssize_t n;
+
+        if (poll(fdPoll, 2, -1) < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        if (0 != fdPoll[0].revents)
+        {
+            break;
+        }
+
+        if (0 == fdPoll[1].revents)
+        {
+            continue;
+        }
+
+        n = read(fd, buffer, sizeof(buffer));
+
+        if ((n < 0) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        if (n <= 0)
+        {
+            /* nothing more will be read, wait to be stopped */
+            fdPoll[1].fd = -1;
+            continue;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        readNs = now.tv_sec * 1000000000LL + now.tv_nsec;
+        TraceInstant("key");
+        head = this->head.load(std::memory_order_relaxed);
+
+        for (ssize_t i = 0; i < n; i++)
+        {
+            if (head - tail.load(std::memory_order_acquire) >= KEY_QUEUE_SIZE)
+            {
+                /* the game loop has fallen behind */
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            event[head & (KEY_QUEUE_SIZE - 1)].readNs = readNs;
+            event[head & (KEY_QUEUE_SIZE - 1)].key = buffer[i];
+            head++;
+        }
+
+        this->head.store(head, std::memory_order_release);
+    }
+}
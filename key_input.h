@@ -0,0 +1,82 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : key_input.h
+*   Purpose : Input stage, reads keys on a thread of its own and queues them
+*             with the time they were read for the game loop.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __KEY_INPUT_H
+#define  __KEY_INPUT_H
+
+#include <atomic>
+#include <thread>
+
+static const unsigned int KEY_QUEUE_SIZE = 64;     /* must be a power of 2 */
+
+/* a key and when it was read (CLOCK_MONOTONIC) */
+typedef struct
+{
+    long long readNs;
+    char key;
+} key_event_t;
+
+/*
+ * The thread reads bytes from fd as soon as they arrive, so a slow tick or
+ * a slow terminal update doesn't delay them, and passes them to the game
+ * loop through a lock-free single producer, single consumer queue.  Keys
+ * that don't fit in the queue are dropped and counted.
+ */
+class KeyInput
+{
+    public:
+        KeyInput(int fd);
+        ~KeyInput(void);
+
+        /* start the thread, false with errno set if it couldn't be stopped */
+        bool Start(void);
+        void Stop(void);
+
+        /* the keys read since the last call (up to max), oldest first */
+        int Take(key_event_t *keys, int max);
+        unsigned long Dropped(void) const;
+
+    private:
+        int fd;
+        int stopFd;                         /* eventfd, readable to stop */
+        std::thread thread;
+
+        key_event_t event[KEY_QUEUE_SIZE];
+        std::atomic<unsigned int> head;     /* next write, input thread only */
+        std::atomic<unsigned int> tail;     /* next read, game loop only */
+        std::atomic<unsigned long> dropped;
+
+        void Run(void);
+};
+
+#endif /* ndef  __KEY_INPUT_H */
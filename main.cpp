@@ -35,20 +35,539 @@
 #include <cstdlib>
 #include <cstring>
 #include <sys/timerfd.h>
+#include <sys/signalfd.h>
+#include <sys/ioctl.h>
 #include <sys/poll.h>
+#include <sys/eventfd.h>
+#include <csignal>
 #include <unistd.h>
 #include <cerrno>
+#include <ctime>
+#include <thread>
 
 #include "tankvufo.h"
+#include "key_input.h"
+#include "tick_stats.h"
+#include "trace.h"
+#include "flight_recorder.h"
+#include "metrics.h"
 
-int main(void)
+#ifdef ALLOC_GUARD
+#include "alloc_guard.h"
+#endif
+#include "sounds.h"
+#include "audio_backend.h"
+#include "realtime.h"
+#include "resampler.h"
+#include "replay.h"
+
+static const char *PHASE_NAMES[NUM_TICK_PHASES] =
+{
+    "keys", "move tank", "move ufo", "tank shot", "ufo shot", "score"
+};
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-r file | -p file] [-o ansi|curses] [-f fps]"
+        " [-s pack | -v ntsc|pal]\n       [-a portaudio|null] [-R] [-H]"
+        " [-t file] [-d dir]\n",
+        progName);
+    fprintf(stderr, "  -r file  record the game session to file\n");
+    fprintf(stderr, "  -p file  play back the game session in file\n");
+    fprintf(stderr, "  -o type  terminal output: ansi (bandwidth minimizing,"
+        " default) or curses\n");
+    fprintf(stderr, "  -f fps   frames per second drawn between game ticks"
+        " (default %d, 0 for none)\n", Tvu::RENDER_HZ);
+    fprintf(stderr, "  -s pack  sound pack to play (default %s next to the"
+        " game)\n", PACK_FILE_NAME);
+    fprintf(stderr, "  -v chip  generate the sounds with an emulated VIC-20"
+        " sound chip: ntsc\n           (6560) or pal (6561)\n");
+    fprintf(stderr, "  -a out   sound output: portaudio (default) or null (no"
+        " sound)\n");
+    fprintf(stderr, "  -R       run the sound and the game at real-time"
+        " priority if permitted\n");
+    fprintf(stderr, "  -H       show live tick statistics below the volume"
+        " window\n");
+    fprintf(stderr, "  -t file  trace the game, render and audio threads to"
+        " file (Chrome trace\n           JSON)\n");
+    fprintf(stderr, "  -d dir   write flight recorder dumps to dir (default"
+        " $TMPDIR or /tmp)\n");
+}
+
+
+/* center the game field with the volume window to the right of it */
+static void GetLayout(int lines, int cols, Tvu::Layout *layout)
+{
+    layout->v20X = (cols - Tvu::V20_COLS) / 2;
+    layout->v20Y = (lines - Tvu::V20_ROWS) / 2;
+    layout->volY = (lines - Tvu::VOL_ROWS) / 2;
+    layout->volX = layout->v20X + Tvu::V20_COLS + Tvu::VOL_COLS;
+
+    /* the HUD goes below the volume window, on top of things if it won't fit */
+    layout->hudY = layout->volY + Tvu::VOL_ROWS;
+    layout->hudX = layout->volX;
+
+    if (layout->hudY + Tvu::HUD_ROWS > lines)
+    {
+        layout->hudY = lines - Tvu::HUD_ROWS;
+    }
+
+    if (layout->hudX + Tvu::HUD_COLS > cols)
+    {
+        layout->hudX = cols - Tvu::HUD_COLS;
+    }
+}
+
+
+/* create a timerfd that expires every period nanoseconds */
+static int MakeTimer(long period)
+{
+    int fd;
+    struct itimerspec timeout;
+
+    fd = timerfd_create(CLOCK_MONOTONIC, 0);
+
+    if (fd < 0)
+    {
+        return fd;
+    }
+
+    timeout.it_value.tv_sec = period / 1000000000;
+    timeout.it_value.tv_nsec = period % 1000000000;
+    timeout.it_interval = timeout.it_value;
+
+    if (timerfd_settime(fd, 0, &timeout, 0) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+
+static long long NowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/* add the cycles since start to a phase's times, returns the time now */
+static uint64_t EndPhase(Histogram *phases, tick_phase_t phase,
+    uint64_t start)
+{
+    uint64_t now;
+
+    now = TscNow();
+    phases[phase].Add(now - start);
+
+    if (traceOn.load(std::memory_order_relaxed))
+    {
+        TraceRecord(PHASE_NAMES[phase], start, now);
+    }
+
+    return now;
+}
+
+
+static void AddStageTime(Tvu::StageStats *stats, long long ns)
+{
+    stats->steps++;
+    stats->ns += ns;
+
+    if (ns > stats->maxNs)
+    {
+        stats->maxNs = ns;
+    }
+}
+
+
+/* what the render stage works with, and what it measured */
+typedef struct
+{
+    TankVUfo *tvu;
+    Tvu::Layout layout;
+    int fdRender;           /* render timerfd, -1 if only ticks are drawn */
+    int fdFrame;            /* eventfd, written when a tick is published */
+    int fdWinch;            /* SIGWINCH signalfd */
+    int fdStop;             /* eventfd, written when the game is over */
+    metrics_page_t *metrics;    /* nullptr if there isn't a page */
+    Tvu::StageStats stats;
+} render_stage_t;
+
+
+/* the render stage's counters for tankvufo-top and other monitors */
+static void PublishRenderMetrics(render_stage_t *stage)
+{
+    render_metrics_t values;
+    Tvu::StageStats latency;
+    output_stats_t output;
+
+    stage->tvu->GetFrameLatency(&latency);
+    values.updates = stage->stats.steps;
+    values.frames = latency.steps;
+    values.latencyNs = latency.ns;
+    values.latencyMaxNs = latency.maxNs;
+    values.bytes = 0;
+
+    if (stage->tvu->GetOutputStats(&output))
+    {
+        values.bytes = output.bytesWritten;
+    }
+
+    stage->metrics->render.Write(&values);
+}
+
+
+/*
+ * The render stage's thread.  It shows each frame as soon as the tick that
+ * published it is done, draws the motion between ticks on the render
+ * timer, moves the windows when the terminal is resized, and writes queued
+ * output whenever the terminal can take it.  A tick that's late, or
+ * terminal output that's slow, only delays the stage that has it.
+ */
+static void RenderStage(render_stage_t *stage)
+{
+    TankVUfo *tvu;
+    struct pollfd fdPoll[5];
+    long long lastTickNs;
+
+    tvu = stage->tvu;
+    lastTickNs = NowNs();
+    TraceNameThread("render");
+
+    /* -1 is ignored */
+    memset(fdPoll, 0, sizeof(fdPoll));
+    fdPoll[0].fd = stage->fdStop;
+    fdPoll[0].events = POLLIN;
+    fdPoll[1].fd = stage->fdFrame;
+    fdPoll[1].events = POLLIN;
+    fdPoll[2].fd = stage->fdRender;
+    fdPoll[2].events = POLLIN;
+    fdPoll[3].fd = tvu->GetOutputFd();
+    fdPoll[3].events = tvu->IsOutputPending() ? POLLOUT : 0;
+    fdPoll[4].fd = stage->fdWinch;
+    fdPoll[4].events = POLLIN;
+
+    while (poll(fdPoll, 5, -1) > 0)
+    {
+        long long start;
+        uint64_t mark;
+        bool drawn;
+
+        if (0 != fdPoll[0].revents)
+        {
+            /* the game is over */
+            break;
+        }
+
+        start = NowNs();
+        drawn = false;
+
+        if (POLLIN == fdPoll[4].revents)
+        {
+            /* the terminal was resized, move the windows */
+            struct signalfd_siginfo info;
+            struct winsize size;
+
+            while (read(stage->fdWinch, &info, sizeof(info)) == sizeof(info))
+            {
+                /* several resizes are handled as one */
+            }
+
+            if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0)
+            {
+                int lines, cols;
+
+                /* too small a screen is clipped by the terminal */
+                lines = (size.ws_row < Tvu::MIN_LINES) ?
+                    Tvu::MIN_LINES : size.ws_row;
+                cols = (size.ws_col < Tvu::MIN_COLS) ?
+                    Tvu::MIN_COLS : size.ws_col;
+
+                mark = TscNow();
+                GetLayout(lines, cols, &stage->layout);
+#ifdef ALLOC_GUARD
+                /* the screens are reallocated for the new size */
+                AllocGuardPause();
+#endif
+                tvu->Relayout(lines, cols, &stage->layout);
+                tvu->Present();
+
+                /* and so are ncurses' update tables, as they were at start */
+                tvu->WarmUpOutput();
+#ifdef ALLOC_GUARD
+                AllocGuardResume();
+#endif
+                TraceSpan("relayout", mark);
+                drawn = true;
+            }
+        }
+
+        if (0 != fdPoll[3].revents)
+        {
+            /* the terminal can take more output (or is gone) */
+            mark = TscNow();
+            tvu->DrainOutput();
+            TraceSpan("drain", mark);
+        }
+
+        if (POLLIN == fdPoll[2].revents)
+        {
+            /* read the render timer fd */
+            uint64_t elapsed;
+
+            read(stage->fdRender, &elapsed, sizeof(elapsed));
+
+            if (elapsed > 1)
+            {
+                /* frames the stage was too slow for */
+                stage->stats.missed += elapsed - 1;
+            }
+
+            if (0 == fdPoll[1].revents)
+            {
+                mark = TscNow();
+                tvu->RenderFrame((start - lastTickNs) / 1e6 / Tvu::TICK_MS);
+                TraceSpan("render frame", mark);
+                drawn = true;
+            }
+        }
+        else if (0 != fdPoll[2].revents)
+        {
+            /* something went wrong */
+            break;
+        }
+
+        if (POLLIN == fdPoll[1].revents)
+        {
+            /* one terminal update with everything that changed this tick */
+            uint64_t ticks;
+
+            read(stage->fdFrame, &ticks, sizeof(ticks));
+            lastTickNs = start;
+            mark = TscNow();
+            tvu->Present();
+            TraceSpan("present tick", mark);
+            drawn = true;
+        }
+
+        if (drawn)
+        {
+            AddStageTime(&stage->stats, NowNs() - start);
+
+            if (nullptr != stage->metrics)
+            {
+                PublishRenderMetrics(stage);
+            }
+        }
+
+        fdPoll[3].events = tvu->IsOutputPending() ? POLLOUT : 0;
+    }
+}
+
+
+int main(int argc, char *argv[])
 {
     /* setup the ncurses field-of-play */
     TankVUfo *tvu;
-    int winX, winY;
+    Tvu::Layout layout;
+    sigset_t winchMask;
+    sigset_t dumpMask;
     bool result;
+    int opt;
+    const char *recordName;
+    const char *playName;
+    const char *packName;
+    const char *traceName;
+    const char *flightDir;
+    vic_chip_t chip;
+    bool nullAudio;
+    bool realtime;
+    int gamePriorityError;
+    bool ansiOutput;
+    bool hud;
+    int fps;
+    Replay replay;
+    unsigned int seed;
+
+    recordName = nullptr;
+    playName = nullptr;
+    packName = nullptr;
+    traceName = nullptr;
+    flightDir = nullptr;
+    chip = VIC_NONE;
+    nullAudio = false;
+    realtime = false;
+    gamePriorityError = 0;
+    ansiOutput = true;
+    hud = false;
+    fps = Tvu::RENDER_HZ;
+
+    while ((opt = getopt(argc, argv, "r:p:o:f:s:v:a:RHt:d:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                fps = atoi(optarg);
+
+                if ((fps < 0) || (fps > 1000))
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
+
+            case 'o':
+                if (0 == strcmp(optarg, "curses"))
+                {
+                    ansiOutput = false;
+                }
+                else if (0 != strcmp(optarg, "ansi"))
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
 
-    tvu = new TankVUfo();
+            case 'r':
+                recordName = optarg;
+                break;
+
+            case 'p':
+                playName = optarg;
+                break;
+
+            case 's':
+                packName = optarg;
+                break;
+
+            case 'a':
+                if (0 == strcmp(optarg, "null"))
+                {
+                    nullAudio = true;
+                }
+                else if (0 != strcmp(optarg, "portaudio"))
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
+
+            case 'R':
+                realtime = true;
+                break;
+
+            case 'H':
+                hud = true;
+                break;
+
+            case 't':
+                traceName = optarg;
+                break;
+
+            case 'd':
+                flightDir = optarg;
+                break;
+
+            case 'v':
+                if (0 == strcmp(optarg, "ntsc"))
+                {
+                    chip = VIC_6560;
+                }
+                else if (0 == strcmp(optarg, "pal"))
+                {
+                    chip = VIC_6561;
+                }
+                else
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (((nullptr != recordName) && (nullptr != playName)) ||
+        ((nullptr != packName) && (VIC_NONE != chip)))
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    /* a replay needs the random number sequence it was recorded with */
+    seed = (unsigned int)time(NULL);
+
+    if (nullptr != playName)
+    {
+        if (!replay.Load(playName))
+        {
+            perror(playName);
+            return 1;
+        }
+
+        seed = replay.GetSeed();
+    }
+    else if (nullptr != recordName)
+    {
+        if (!replay.StartRecording(recordName, seed))
+        {
+            perror(recordName);
+            return 1;
+        }
+    }
+
+    srand(seed);
+
+    /* before the sound starts, so the audio callback is traced too */
+    if ((nullptr != traceName) && !TraceStart(traceName))
+    {
+        perror(traceName);
+        return 1;
+    }
+
+    TraceNameThread("sim");
+
+    /*
+     * resizes are read from a signalfd in the event loop, block SIGWINCH
+     * before ncurses and the sound thread are started so it's never
+     * delivered any other way
+     */
+    sigemptyset(&winchMask);
+    sigaddset(&winchMask, SIGWINCH);
+    sigprocmask(SIG_BLOCK, &winchMask, nullptr);
+
+    /*
+     * SIGUSR1 asks for a flight recorder dump.  It's unblocked in this
+     * thread once the others are started, so it only ever interrupts the
+     * simulation's (restarted) wait for the timer.
+     */
+    sigemptyset(&dumpMask);
+    sigaddset(&dumpMask, SIGUSR1);
+    sigprocmask(SIG_BLOCK, &dumpMask, nullptr);
+
+    if (nullptr == flightDir)
+    {
+        flightDir = getenv("TMPDIR");
+    }
+
+    FlightStart((nullptr == flightDir) ? "/tmp" : flightDir);
+
+    if (nullAudio)
+    {
+        tvu = new TankVUfo(packName, chip, new NullBackend());
+    }
+    else
+    {
+        tvu = new TankVUfo(packName, chip, new PortAudioBackend());
+    }
 
     if (nullptr == tvu)
     {
@@ -56,11 +575,31 @@ int main(void)
         return 1;
     }
 
+    if (0 != tvu->SoundPackError())
+    {
+        fprintf(stderr, "can't load the sound pack %s: %s\n",
+            tvu->SoundPackName(), strerror(tvu->SoundPackError()));
+        delete tvu;
+        return 1;
+    }
+
+    if (realtime)
+    {
+        /* falls back to normal scheduling if it isn't permitted */
+        gamePriorityError = tvu->UseRealtimePriority();
+    }
+
+    if (ansiOutput)
+    {
+        /* falls back to ncurses output if this isn't an ANSI terminal */
+        tvu->UseAnsiOutput(STDOUT_FILENO);
+    }
+
     /* vic-20 sized window for the game field */
-    winX = (COLS - Tvu::V20_COLS) / 2;
-    winY = (LINES - Tvu::V20_ROWS) / 2;
+    GetLayout(LINES, COLS, &layout);
 
-    result = tvu->MakeV20Win(Tvu::V20_ROWS, Tvu::V20_COLS, winY, winX);
+    result = tvu->MakeV20Win(Tvu::V20_ROWS, Tvu::V20_COLS, layout.v20Y,
+        layout.v20X);
 
     if (false == result)
     {
@@ -70,10 +609,8 @@ int main(void)
     }
 
     /* window for volume meter */
-    winY = (LINES - Tvu::VOL_ROWS) / 2;
-    winX += Tvu::V20_COLS + Tvu::VOL_COLS;
     result = tvu->MakeVolWin(Tvu::VOL_ROWS, Tvu::VOL_COLS,
-        winY, winX);
+        layout.volY, layout.volX);
 
     if (false == result)
     {
@@ -82,7 +619,14 @@ int main(void)
         return 1;
     }
 
-    refresh();      /* Refresh the whole screen to show the windows */
+    if (hud && !tvu->MakeHudWin(layout.hudY, layout.hudX))
+    {
+        delete tvu;
+        perror("creating tick statistics window");
+        return 1;
+    }
+
+    wnoutrefresh(stdscr);   /* the whole screen is shown by Refresh() */
 
     tvu->InitializeV20Win();
 
@@ -101,78 +645,568 @@ int main(void)
     }
 
     tvu->PrintScore();                     /* 0 - 0 score */
+
+    if (fps > 0)
+    {
+        /* move things between ticks */
+        tvu->UseMotionOverlay();
+    }
+
+    /* time the TSC now rather than while drawing the first frame */
+    TscNsPerCycle();
     tvu->Refresh();
+    tvu->WarmUpOutput();
 
-    /* timer and poll variables */
+    if (nullptr != recordName)
+    {
+        tvu->SetRecorder(&replay);
+    }
+
+    /* timer and stage variables */
     int fdTimer;
-    struct itimerspec timeout;
-    struct pollfd fdPoll;
+    render_stage_t render;
+    KeyInput input(STDIN_FILENO);
+    std::thread renderThread;
+    Tvu::StageStats inputStats;
+    Tvu::StageStats simStats;
+    Tvu::StageStats frameLatency;
+    Histogram phaseTimes[NUM_TICK_PHASES];
+    LiveHistogram simTimes;
+    LiveHistogram keyTimes;
+    output_stats_t stats;
+    bool haveStats;
+    voice_stats_t voiceStats[NUM_VOICES];
+    bool haveVoiceStats;
+    trigger_stats_t triggerStats;
+    callback_stats_t callbackStats;
+    const char *soundOutput;
+    size_t sampleBytes;
+    int lockError;
+    bool samplesLocked;
+    flight_tick_t flight;
+    metrics_page_t *metrics;
+    game_metrics_t gameMetrics;
+    int metricsError;
+    unsigned long nextLateDump;
+    unsigned int flightDumps;
+    int flightError;
+    uint64_t one;
 
     /* create a timer fd that expires every 200ms */
-    fdTimer = timerfd_create(CLOCK_MONOTONIC,0);
+    fdTimer = MakeTimer(Tvu::TICK_MS * 1000000L);
 
-    if (fdTimer <= 0)
+    if (fdTimer < 0)
     {
         delete tvu;
         perror("creating timerfd");
         return 1;
     }
 
-    /* make the timer timeout in 200ms and repeat */
-    timeout.it_value.tv_sec = 0;
-    timeout.it_value.tv_nsec = 200 * 1000000;
-    timeout.it_interval.tv_sec = 0;
-    timeout.it_interval.tv_nsec = 200 * 1000000;
+    memset(&render, 0, sizeof(render));
+    render.tvu = tvu;
+    render.layout = layout;
+
+    /* the render clock is separate from the game tick */
+    render.fdRender = -1;
 
-    if (timerfd_settime(fdTimer, 0, &timeout, 0) != 0)
+    if (fps > 0)
+    {
+        render.fdRender = MakeTimer(1000000000L / fps);
+
+        if (render.fdRender < 0)
+        {
+            delete tvu;
+            perror("creating render timerfd");
+            return 1;
+        }
+    }
+
+    /* terminal resizes */
+    render.fdWinch = signalfd(-1, &winchMask, SFD_NONBLOCK);
+
+    if (render.fdWinch < 0)
     {
         delete tvu;
-        perror("setting timerfd");
+        perror("creating signalfd");
         return 1;
     }
 
-    /* set pollfd for timer read event */
-    memset(&fdPoll, 0, sizeof(fdPoll));
-    fdPoll.fd = fdTimer;
-    fdPoll.events = POLLIN;
-    fdPoll.revents = 0;
+    /* counters any monitor can read, the game goes on without them */
+    metrics = MetricsCreate();
+    metricsError = (nullptr == metrics) ? errno : 0;
+    render.metrics = metrics;
+    memset(&gameMetrics, 0, sizeof(gameMetrics));
+
+    /* the stages are told about new frames and the end of the game */
+    render.fdFrame = eventfd(0, 0);
+    render.fdStop = eventfd(0, 0);
+
+    if ((render.fdFrame < 0) || (render.fdStop < 0))
+    {
+        delete tvu;
+        perror("creating eventfd");
+        return 1;
+    }
+
+    if (!input.Start())
+    {
+        delete tvu;
+        perror("starting keyboard input");
+        return 1;
+    }
+
+    renderThread = std::thread(RenderStage, &render);
+    pthread_sigmask(SIG_UNBLOCK, &dumpMask, nullptr);
+    memset(&inputStats, 0, sizeof(inputStats));
+    memset(&simStats, 0, sizeof(simStats));
+    memset(&flight, 0, sizeof(flight));
+    nextLateDump = 0;
+    flightDumps = 0;
+    flightError = 0;
+    one = 1;
 
     /*
-     * This is the event loop that makes the game work.
-     * The timerfd expires every 200ms and starts the loop.
-     * If HandleKeyPress sees a 'q' or a 'Q' the loop will be
-     * exited causing the game to end.
+     * This is the simulation stage, the loop that makes the game work.
+     * The timerfd expires every 200ms and starts a tick.  The keys read by
+     * the input stage since the last tick are handled, a 'q' or a 'Q' ends
+     * the loop and the game.  The tick's frame is published for the render
+     * stage, which draws and outputs it on its own thread.  Every tick is
+     * kept by the flight recorder, which is dumped when a tick is late or
+     * SIGUSR1 asks for it.
      */
-    while (poll(&fdPoll, 1, -1) > 0)
+    for (;;)
     {
-        if (POLLIN == fdPoll.revents)
-        {
-            /* read the timer fd */
-            uint64_t elapsed;
+        key_event_t events[KEY_QUEUE_SIZE];
+        char keys[KEY_QUEUE_SIZE];
+        uint64_t elapsed;
+        uint64_t tickStart;
+        uint64_t mark;
+        long long tickNs;
+        long long keyNs;
+        long long simNs;
+        const char *tickKeys;
+        int tickKeyCount;
+        const char *reason;
+        int count;
 
-            read(fdTimer, &elapsed, sizeof(elapsed));
-        }
-        else
+        /* wait for the timer fd */
+        if (read(fdTimer, &elapsed, sizeof(elapsed)) != sizeof(elapsed))
         {
             /* something went wrong */
             break;
         }
 
-        if (tvu->HandleKeyPress() < 0)
+        tickNs = NowNs();
+        tickStart = TscNow();
+
+        if (elapsed > 1)
+        {
+            /* the loop fell behind the timer */
+            simStats.missed += elapsed - 1;
+        }
+
+        count = input.Take(events, KEY_QUEUE_SIZE);
+        keyNs = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            /* time from the key being read to the tick handling it */
+            keys[i] = events[i].key;
+            AddStageTime(&inputStats, tickNs - events[i].readNs);
+            keyTimes.Add(tickNs - events[i].readNs);
+
+            if (tickNs - events[i].readNs > keyNs)
+            {
+                keyNs = tickNs - events[i].readNs;
+            }
+        }
+
+        tickKeys = keys;
+        tickKeyCount = count;
+
+        tvu->StartTick(tickNs);
+
+        if (nullptr != playName)
+        {
+            /* take the keys from the replay, the keyboard can still quit */
+            const char *replayKeys;
+            int replayCount;
+
+            replayKeys = replay.NextTick(&replayCount);
+
+            if ((nullptr == replayKeys) ||
+                (tvu->ReplayKeys(replayKeys, replayCount) < 0))
+            {
+                /* end of the replay */
+                break;
+            }
+
+            tickKeys = replayKeys;
+            tickKeyCount = replayCount;
+
+            if ((nullptr != memchr(keys, 'q', count)) ||
+                (nullptr != memchr(keys, 'Q', count)))
+            {
+                break;
+            }
+        }
+        else if (tvu->TakeKeys(keys, count) < 0)
         {
             /* we got a quit key */
             break;
         }
 
+        mark = EndPhase(phaseTimes, PHASE_KEYS, tickStart);
         tvu->MoveTank();
+        mark = EndPhase(phaseTimes, PHASE_MOVE_TANK, mark);
         tvu->MoveUfo();
+        mark = EndPhase(phaseTimes, PHASE_MOVE_UFO, mark);
 
         tvu->UpdateTankShot();
+        mark = EndPhase(phaseTimes, PHASE_TANK_SHOT, mark);
         tvu->UpdateUfoShot();
+        mark = EndPhase(phaseTimes, PHASE_UFO_SHOT, mark);
 
         tvu->PrintScore();
+        mark = EndPhase(phaseTimes, PHASE_SCORE, mark);
+        simTimes.Add(mark - tickStart);
+
+        if (hud)
+        {
+            /* the recent times go out with the frame */
+            percentiles_t simUs;
+            percentiles_t keyMs;
+
+            if ((simStats.steps > 0) &&
+                (0 == simStats.steps % Tvu::HUD_WINDOW_TICKS))
+            {
+                simTimes.EndWindow();
+                keyTimes.EndWindow();
+            }
+
+            simTimes.GetPercentiles(&simUs, TscNsPerCycle() / 1000.0);
+            keyTimes.GetPercentiles(&keyMs, 1e-6);
+            tvu->SetSimStats(&simUs, &keyMs);
+        }
+
+        mark = TscNow();
+        tvu->FinishTick();
+        TraceSpan("publish", mark);
+
+        /* the render stage shows it */
+        write(render.fdFrame, &one, sizeof(one));
+        TraceSpan("tick", tickStart);
+        simNs = NowNs() - tickNs;
+
+        /* a copy of the tick for the flight recorder */
+        flight.ns = tickNs;
+        flight.tick = simStats.steps;
+        flight.simNs = simNs;
+        flight.keyUs = keyNs / 1000;
+        flight.late = (elapsed > 0xFFFF) ? 0xFFFF : elapsed - 1;
+        flight.keyCount = (tickKeyCount > 0xFF) ? 0xFF : tickKeyCount;
+        memcpy(flight.keys, tickKeys,
+            (tickKeyCount < FLIGHT_KEYS) ? tickKeyCount : FLIGHT_KEYS);
+        tvu->GetTickState(&flight.state);
+        FlightRecord(&flight);
+        AddStageTime(&simStats, simNs);
+
+        if (nullptr != metrics)
+        {
+            gameMetrics.ticks = simStats.steps;
+            gameMetrics.overruns = simStats.missed;
+            gameMetrics.tickNs = simStats.ns;
+            gameMetrics.tickMaxNs = simStats.maxNs;
+            gameMetrics.lastTickNs = tickNs;
+            gameMetrics.tanksKilled = flight.state.tanksKilled;
+            gameMetrics.ufosKilled = flight.state.ufosKilled;
+            gameMetrics.volume = flight.state.volume;
+
+            if (tvu->GetCallbackStats(&callbackStats))
+            {
+                gameMetrics.xruns =
+                    callbackStats.underflows + callbackStats.overflows;
+            }
+
+            metrics->game.Write(&gameMetrics);
+        }
+
+        reason = nullptr;
+
+        if (FlightDumpRequested())
+        {
+            reason = "SIGUSR1";
+        }
+        else if ((elapsed > 1) && (simStats.steps >= nextLateDump))
+        {
+            /* the ticks leading up to it, but not every one of a slow spell */
+            reason = "late tick";
+            nextLateDump = simStats.steps + FLIGHT_LATE_GAP;
+        }
+
+        if (nullptr != reason)
+        {
+            if (FlightDump(reason))
+            {
+                flightDumps++;
+            }
+            else
+            {
+                flightError = errno;
+            }
+        }
+
+#ifdef ALLOC_GUARD
+        if (1 == simStats.steps)
+        {
+            /* everything's been allocated, nothing more should be */
+            AllocGuardArm();
+        }
+#endif
     }
 
+#ifdef ALLOC_GUARD
+    AllocGuardDisarm();
+#endif
+
+    write(render.fdStop, &one, sizeof(one));
+    renderThread.join();
+    MetricsRemove(metrics);
+    input.Stop();
+    inputStats.missed = input.Dropped();
+
+    tvu->GetFrameLatency(&frameLatency);
+    haveStats = tvu->GetOutputStats(&stats);
+    haveVoiceStats = tvu->GetVoiceStats(voiceStats);
+    haveVoiceStats = haveVoiceStats && tvu->GetTriggerStats(&triggerStats);
+    haveVoiceStats = haveVoiceStats && tvu->GetCallbackStats(&callbackStats);
+    soundOutput = tvu->SoundOutputName();
+    samplesLocked = tvu->GetSampleLock(&sampleBytes, &lockError);
     delete tvu;
+
+    /* every traced thread has stopped */
+    if (!TraceFinish())
+    {
+        perror(traceName);
+    }
+
+    if (flightDumps > 0)
+    {
+        fprintf(stderr, "flight recorder: %u dumps written", flightDumps);
+
+        if (nullptr != FlightFileName())
+        {
+            fprintf(stderr, ", the last to %s", FlightFileName());
+        }
+
+        fprintf(stderr, "\n");
+    }
+
+#ifdef ALLOC_GUARD
+    fprintf(stderr, "alloc guard: %lu allocations, none after the first "
+        "tick but %lu resizing the terminal\n", AllocGuardCount(),
+        AllocGuardPausedCount());
+#endif
+
+    if (0 != metricsError)
+    {
+        fprintf(stderr, "metrics: no shared page (%s)\n",
+            strerror(metricsError));
+    }
+
+    if (0 != flightError)
+    {
+        fprintf(stderr, "flight recorder: dump failed (%s)\n",
+            strerror(flightError));
+    }
+
+    if (haveStats)
+    {
+        fprintf(stderr, "frames: %lu sent, %lu dropped\n",
+            stats.framesSent, stats.framesDropped);
+        fprintf(stderr, "output: %zu bytes, %.3f seconds blocked\n",
+            stats.bytesWritten, stats.blockedTime);
+    }
+
+    /* where the time went in each stage */
+    if (inputStats.steps > 0)
+    {
+        fprintf(stderr, "stage input: %lu keys, %.2f ms mean, %.2f ms max "
+            "until their tick, %lu dropped\n", inputStats.steps,
+            inputStats.ns / 1e6 / inputStats.steps, inputStats.maxNs / 1e6,
+            inputStats.missed);
+    }
+
+    if (simStats.steps > 0)
+    {
+        fprintf(stderr, "stage sim: %lu ticks, %.1f us mean, %.1f us max of "
+            "%d ms, %lu late\n", simStats.steps,
+            simStats.ns / 1e3 / simStats.steps, simStats.maxNs / 1e3,
+            Tvu::TICK_MS, simStats.missed);
+    }
+
+    if (simStats.steps > 0)
+    {
+        fprintf(stderr, "tick phases (%s timed):  p50      p99      max\n",
+            TscName());
+
+        for (int i = 0; i < NUM_TICK_PHASES; i++)
+        {
+            percentiles_t p;
+
+            phaseTimes[i].GetPercentiles(&p, TscNsPerCycle() / 1000.0);
+            fprintf(stderr, "    %-18s %6.1f   %6.1f   %6.1f us\n",
+                PHASE_NAMES[i], p.p50, p.p99, p.max);
+        }
+    }
+
+    if (render.stats.steps > 0)
+    {
+        fprintf(stderr, "stage render: %lu updates, %.1f us mean, %.1f us max"
+            " of %.1f ms, %lu late\n", render.stats.steps,
+            render.stats.ns / 1e3 / render.stats.steps,
+            render.stats.maxNs / 1e3,
+            (fps > 0) ? 1000.0 / fps : (double)Tvu::TICK_MS,
+            render.stats.missed);
+    }
+
+    if (frameLatency.steps > 0)
+    {
+        fprintf(stderr, "tick to screen: %lu frames, %.2f ms mean, %.2f ms "
+            "max, %lu skipped\n", frameLatency.steps,
+            frameLatency.ns / 1e6 / frameLatency.steps,
+            frameLatency.maxNs / 1e6, frameLatency.missed);
+    }
+
+    if (haveVoiceStats)
+    {
+        fprintf(stderr, "sound output: %s at %d Hz", soundOutput,
+            callbackStats.sampleRate);
+
+        if (callbackStats.resampled > 0)
+        {
+            fprintf(stderr, ", %d sounds resampled (%s %d tap filter)",
+                callbackStats.resampled, ResamplerKernel(), RESAMPLE_TAPS);
+        }
+
+        fprintf(stderr, "\n");
+
+        /* cost of mixing each voice */
+        for (int v = 0; v < NUM_VOICES; v++)
+        {
+            if (0 == voiceStats[v].frames)
+            {
+                continue;
+            }
+
+            fprintf(stderr, "voice %-7s %10llu frames, %6.2f ns/frame\n",
+                Sounds::VoiceName((voice_t)v), voiceStats[v].frames,
+                (double)voiceStats[v].ns / voiceStats[v].frames);
+        }
+
+        if (triggerStats.triggers > 0)
+        {
+            /* time from a sound starting until the callback played it */
+            fprintf(stderr, "sound triggers: %llu, %.2f ms mean, %.2f ms max "
+                "(+%.1f ms output latency)\n", triggerStats.triggers,
+                triggerStats.ns / 1e6 / triggerStats.triggers,
+                triggerStats.maxNs / 1e6, triggerStats.outputLatency * 1e3);
+        }
+
+        if (triggerStats.dropped > 0)
+        {
+            /* the callback fell behind, the stops were sent again */
+            fprintf(stderr, "sound commands: %llu dropped, %llu resent\n",
+                triggerStats.dropped, triggerStats.resent);
+        }
+
+        if (triggerStats.onTime + triggerStats.late > 0)
+        {
+            /* how well the sounds lined up with the ticks that started them */
+            fprintf(stderr, "sound schedule: heard %.1f ms after the tick, "
+                "%llu on time (within %.1f us), %llu late (%.2f ms max)\n",
+                triggerStats.scheduleNs / 1e6, triggerStats.onTime,
+                triggerStats.errorMaxNs / 1e3, triggerStats.late,
+                triggerStats.lateMaxNs / 1e6);
+        }
+
+        if (callbackStats.callbacks > 0)
+        {
+            /* how close the callback came to running out of time */
+            fprintf(stderr, "sound callbacks: %llu, %.1f us mean, %.1f us max"
+                " of %.1f us per buffer, %llu underflows, %llu overflows\n",
+                callbackStats.callbacks,
+                callbackStats.ns / 1e3 / callbackStats.callbacks,
+                callbackStats.maxNs / 1e3, callbackStats.deadlineNs / 1e3,
+                callbackStats.underflows, callbackStats.overflows);
+            fprintf(stderr, "callback time / buffer time:");
+
+            for (int b = 0; b < CALLBACK_BUCKETS; b++)
+            {
+                fprintf(stderr, " %s %llu", Sounds::CallbackBucketName(b),
+                    callbackStats.histogram[b]);
+            }
+
+            fprintf(stderr, "\noutput latency: %.1f ms stream",
+                callbackStats.streamLatency * 1e3);
+
+            if (callbackStats.maxLatency > 0.0)
+            {
+                fprintf(stderr, ", %.1f - %.1f ms per buffer",
+                    callbackStats.minLatency * 1e3,
+                    callbackStats.maxLatency * 1e3);
+            }
+
+            fprintf(stderr, "\n");
+
+            /* should stop once everything the callback uses is resident */
+            fprintf(stderr, "callback page faults: %llu, %llu after the "
+                "first second\n", callbackStats.faults,
+                callbackStats.warmFaults);
+        }
+
+        if (sampleBytes > 0)
+        {
+            if (samplesLocked)
+            {
+                fprintf(stderr, "sound samples: %zu KB locked in memory\n",
+                    sampleBytes / 1024);
+            }
+            else
+            {
+                fprintf(stderr, "sound samples: %zu KB prefaulted, not locked"
+                    " (%s)\n", sampleBytes / 1024, strerror(lockError));
+            }
+        }
+
+        if (realtime)
+        {
+            if (0 != callbackStats.priority)
+            {
+                fprintf(stderr, "audio thread: %s %d\n",
+                    PolicyName(SCHED_FIFO), callbackStats.priority);
+            }
+            else
+            {
+                fprintf(stderr, "audio thread: normal priority (%s)\n",
+                    strerror(callbackStats.priorityError));
+            }
+        }
+    }
+
+    if (realtime)
+    {
+        if (0 == gamePriorityError)
+        {
+            fprintf(stderr, "game threads: %s %d\n", PolicyName(SCHED_RR),
+                GAME_PRIORITY);
+        }
+        else
+        {
+            fprintf(stderr, "game threads: normal priority (%s)\n",
+                strerror(gamePriorityError));
+        }
+    }
+
     return 0;
 }
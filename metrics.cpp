@@ -0,0 +1,174 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : metrics.cpp
+*   Purpose : Creates and maps the live metrics page in /dev/shm.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cerrno>
+#include <ctime>
+#include <new>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "metrics.h"
+
+/* the shm_open() name of a page */
+static void MetricsName(pid_t pid, char *name, size_t size)
+{
+    snprintf(name, size, "/%s%d", METRICS_PREFIX, (int)pid);
+}
+
+
+metrics_page_t *MetricsCreate(void)
+{
+    char name[64];
+    metrics_page_t *page;
+    void *p;
+    int fd;
+    int error;
+
+    MetricsName(getpid(), name, sizeof(name));
+
+    /* one left by a game that crashed with this pid is replaced */
+    shm_unlink(name);
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    if (0 != ftruncate(fd, sizeof(metrics_page_t)))
+    {
+        error = errno;
+        close(fd);
+        shm_unlink(name);
+        errno = error;
+        return nullptr;
+    }
+
+    p = mmap(nullptr, sizeof(metrics_page_t), PROT_READ | PROT_WRITE,
+        MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == p)
+    {
+        error = errno;
+        shm_unlink(name);
+        errno = error;
+        return nullptr;
+    }
+
+    page = new(p) metrics_page_t();
+    page->version = METRICS_VERSION;
+    page->size = sizeof(metrics_page_t);
+    page->pid = getpid();
+    page->startTime = time(nullptr);
+
+    /* a monitor ignores the page until it's set */
+    std::atomic_thread_fence(std::memory_order_release);
+    page->magic = METRICS_MAGIC;
+    return page;
+}
+
+
+void MetricsRemove(metrics_page_t *page)
+{
+    char name[64];
+
+    if (nullptr == page)
+    {
+        return;
+    }
+
+    MetricsName(page->pid, name, sizeof(name));
+    munmap(page, sizeof(metrics_page_t));
+    shm_unlink(name);
+}
+
+
+const metrics_page_t *MetricsOpen(pid_t pid)
+{
+    char name[64];
+    const metrics_page_t *page;
+    struct stat info;
+    void *p;
+    int fd;
+
+    MetricsName(pid, name, sizeof(name));
+    fd = shm_open(name, O_RDONLY, 0);
+
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    /* too short a page would fault when it's read */
+    if ((0 != fstat(fd, &info)) ||
+        (info.st_size != (off_t)sizeof(metrics_page_t)))
+    {
+        close(fd);
+        errno = EPROTO;
+        return nullptr;
+    }
+
+    p = mmap(nullptr, sizeof(metrics_page_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == p)
+    {
+        return nullptr;
+    }
+
+    page = (const metrics_page_t *)p;
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if ((METRICS_MAGIC != page->magic) ||
+        (METRICS_VERSION != page->version) ||
+        (sizeof(metrics_page_t) != page->size))
+    {
+        munmap(p, sizeof(metrics_page_t));
+        errno = EPROTO;
+        return nullptr;
+    }
+
+    return page;
+}
+
+
+void MetricsClose(const metrics_page_t *page)
+{
+    if (nullptr != page)
+    {
+        munmap((void *)page, sizeof(metrics_page_t));
+    }
+}
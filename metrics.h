@@ -0,0 +1,105 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : metrics.h
+*   Purpose : Header for the live metrics page, game and render counters
+*             in shared memory for tankvufo-top and other monitors.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __METRICS_H
+#define  __METRICS_H
+
+#include <cstdint>
+#include <sys/types.h>
+
+#include "seqlock.h"
+
+/* "TVUM", and the version of the layout below */
+static const uint32_t METRICS_MAGIC = 0x4D555654;
+static const uint32_t METRICS_VERSION = 1;
+
+/* the page of process pid is /dev/shm/tankvufo.<pid> */
+static const char METRICS_PREFIX[] = "tankvufo.";
+
+/*
+ * Counters only go up, so a monitor gets rates and means from the change
+ * between two reads.  Times are nanoseconds, CLOCK_MONOTONIC for points
+ * in time (the same in every process).
+ */
+
+/* written by the simulation after every tick */
+typedef struct
+{
+    uint64_t ticks;
+    uint64_t overruns;      /* timer expirations missed by late ticks */
+    uint64_t tickNs;        /* total time the ticks took */
+    uint64_t tickMaxNs;     /* longest tick */
+    uint64_t xruns;         /* audio underflows and overflows */
+    int64_t lastTickNs;     /* when the last tick started */
+    uint32_t tanksKilled;   /* the ufo's score */
+    uint32_t ufosKilled;    /* the tank's score */
+    uint32_t volume;        /* tenths */
+    uint32_t reserved;
+} game_metrics_t;
+
+/* written by the render stage after every terminal update */
+typedef struct
+{
+    uint64_t updates;       /* terminal updates */
+    uint64_t frames;        /* ticks shown */
+    uint64_t latencyNs;     /* total tick published to shown */
+    uint64_t latencyMaxNs;
+    uint64_t bytes;         /* sent to the terminal, 0 with ncurses output */
+} render_metrics_t;
+
+/* each writer has a seqlock (and cache line) of its own */
+typedef struct
+{
+    uint32_t magic;         /* set last, once the page is ready */
+    uint32_t version;
+    uint32_t size;          /* sizeof(metrics_page_t) */
+    int32_t pid;
+    int64_t startTime;      /* time(), when the game started */
+    SeqLock<game_metrics_t> game;
+    SeqLock<render_metrics_t> render;
+} metrics_page_t;
+
+/* create this process' page, nullptr with errno set on failure */
+metrics_page_t *MetricsCreate(void);
+
+/* unmap and remove this process' page */
+void MetricsRemove(metrics_page_t *page);
+
+/*
+ * Map the page of a game read only, nullptr with errno set if it isn't
+ * there (ENOENT) or isn't a page this version understands (EPROTO).
+ */
+const metrics_page_t *MetricsOpen(pid_t pid);
+void MetricsClose(const metrics_page_t *page);
+
+#endif /* ndef  __METRICS_H */
@@ -0,0 +1,311 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : mixer.cpp
+*   Purpose : Block mixing of the sound voices.  Each kind of voice has
+*             its own render loop and the mono mix is scaled, clipped
+*             and interleaved into the stereo output a block at a time.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "mixer.h"
+
+/* mix[i] += gain * src[i * STEP] for i < frames */
+template <int STEP>
+static void Accumulate(const float *src, float gain, float *mix,
+    unsigned long frames)
+{
+    unsigned long i;
+
+    i = 0;
+
+#ifdef __SSE2__
+    __m128 g = _mm_set1_ps(gain);
+
+    if (1 == STEP)
+    {
+        for (; i + 4 <= frames; i += 4)
+        {
+            __m128 s = _mm_loadu_ps(src + i);
+            __m128 m = _mm_loadu_ps(mix + i);
+
+            _mm_storeu_ps(mix + i, _mm_add_ps(m, _mm_mul_ps(s, g)));
+        }
+    }
+    else if (2 == STEP)
+    {
+        /* the second load reads one sample past the last one used, so the
+         * final group is left to the scalar loop */
+        for (; i + 4 < frames; i += 4)
+        {
+            __m128 a = _mm_loadu_ps(src + 2 * i);
+            __m128 b = _mm_loadu_ps(src + 2 * i + 4);
+            __m128 s = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 m = _mm_loadu_ps(mix + i);
+
+            _mm_storeu_ps(mix + i, _mm_add_ps(m, _mm_mul_ps(s, g)));
+        }
+    }
+#endif
+
+    for (; i < frames; i++)
+    {
+        mix[i] += gain * src[i * STEP];
+    }
+}
+
+
+/* render a voice in runs that end at the end of the samples */
+template <bool LOOP, int STEP>
+static void RenderVoice(voice_data_t *voice, float gain, float *mix,
+    unsigned long frames)
+{
+    while (frames > 0)
+    {
+        unsigned long run;
+
+        /* frames left before the end of the samples */
+        run = (voice->length - voice->phase + STEP - 1) / STEP;
+
+        if (run > frames)
+        {
+            run = frames;
+        }
+
+        Accumulate<STEP>(voice->samples + voice->phase, gain, mix, run);
+        mix += run;
+        frames -= run;
+        voice->phase += run * STEP;
+
+        if (voice->phase >= voice->length)
+        {
+            if (LOOP)
+            {
+                voice->phase -= voice->length;
+            }
+            else
+            {
+                /* done with this sound */
+                voice->phase = 0;
+                voice->sound = SOUND_OFF;
+                return;
+            }
+        }
+    }
+}
+
+
+/* sample i of a voice, wrapped around if it loops and silent if it doesn't */
+template <bool LOOP>
+static inline float SampleAt(const voice_data_t *voice, int i)
+{
+    if (i < 0)
+    {
+        return LOOP ? voice->samples[i + voice->length] : 0.0f;
+    }
+
+    if (i >= voice->length)
+    {
+        return LOOP ? voice->samples[i - voice->length] : 0.0f;
+    }
+
+    return voice->samples[i];
+}
+
+
+/*
+ * Render a voice that moves a fraction of a sample per frame (its samples
+ * aren't at the output rate).  Each frame is a Catmull-Rom cubic through
+ * the two samples on either side of it, which is exact when the fraction
+ * is 0.
+ */
+template <bool LOOP>
+static void RenderFraction(voice_data_t *voice, float gain, float *mix,
+    unsigned long frames)
+{
+    const float *s = voice->samples;
+    const int length = voice->length;
+    int phase = voice->phase;
+    uint32_t fraction = voice->fraction;
+
+    for (unsigned long i = 0; i < frames; i++)
+    {
+        float y0, y1, y2, y3, t, sample;
+        unsigned long long next;
+
+        if ((phase > 0) && (phase + 2 < length))
+        {
+            y0 = s[phase - 1];
+            y1 = s[phase];
+            y2 = s[phase + 1];
+            y3 = s[phase + 2];
+        }
+        else
+        {
+            /* at an end of the samples */
+            y0 = SampleAt<LOOP>(voice, phase - 1);
+            y1 = s[phase];
+            y2 = SampleAt<LOOP>(voice, phase + 1);
+            y3 = SampleAt<LOOP>(voice, phase + 2);
+        }
+
+        t = fraction * (1.0f / 4294967296.0f);
+        sample = ((((0.5f * (y3 - y0) + 1.5f * (y1 - y2)) * t +
+            (y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3)) * t +
+            0.5f * (y2 - y0)) * t) + y1;
+        mix[i] += gain * sample;
+
+        next = (unsigned long long)fraction + voice->stepFraction;
+        fraction = (uint32_t)next;
+        phase += voice->step + (int)(next >> 32);
+
+        if (phase >= length)
+        {
+            if (LOOP)
+            {
+                phase %= length;
+            }
+            else
+            {
+                /* done with this sound */
+                voice->phase = 0;
+                voice->fraction = 0;
+                voice->sound = SOUND_OFF;
+                return;
+            }
+        }
+    }
+
+    voice->phase = phase;
+    voice->fraction = fraction;
+}
+
+
+void MixVoice(voice_data_t *voice, float gain, float *mix,
+    unsigned long frames)
+{
+    if (voice->synth)
+    {
+        if (!VicRender(&voice->vic, gain, mix, frames))
+        {
+            /* done with this sound */
+            voice->sound = SOUND_OFF;
+        }
+    }
+    else if ((0 != voice->stepFraction) || (0 != voice->fraction))
+    {
+        if (voice->loop)
+        {
+            RenderFraction<true>(voice, gain, mix, frames);
+        }
+        else
+        {
+            RenderFraction<false>(voice, gain, mix, frames);
+        }
+    }
+    else if (voice->loop)
+    {
+        if (2 == voice->step)
+        {
+            RenderVoice<true, 2>(voice, gain, mix, frames);
+        }
+        else
+        {
+            RenderVoice<true, 1>(voice, gain, mix, frames);
+        }
+    }
+    else
+    {
+        if (2 == voice->step)
+        {
+            RenderVoice<false, 2>(voice, gain, mix, frames);
+        }
+        else
+        {
+            RenderVoice<false, 1>(voice, gain, mix, frames);
+        }
+    }
+}
+
+
+void InterleaveMix(const float *mix, float *out, unsigned long frames)
+{
+    unsigned long i;
+
+    i = 0;
+
+#ifdef __SSE2__
+    const __m128 hi = _mm_set1_ps(1.0f);
+    const __m128 lo = _mm_set1_ps(-1.0f);
+
+    for (; i + 4 <= frames; i += 4)
+    {
+        __m128 m = _mm_loadu_ps(mix + i);
+
+        /* the headroom should be enough, but don't wrap if it isn't */
+        m = _mm_min_ps(_mm_max_ps(m, lo), hi);
+
+        /* m0 m0 m1 m1 then m2 m2 m3 m3 */
+        _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(m, m));
+        _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(m, m));
+    }
+#endif
+
+    for (; i < frames; i++)
+    {
+        float sample;
+
+        sample = mix[i];
+
+        if (sample > 1.0f)
+        {
+            sample = 1.0f;
+        }
+        else if (sample < -1.0f)
+        {
+            sample = -1.0f;
+        }
+
+        /* left channel output then right channel output */
+        out[2 * i] = sample;
+        out[2 * i + 1] = sample;
+    }
+}
+
+
+const char *MixerKernel(void)
+{
+#ifdef __SSE2__
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,64 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : mixer.h
+*   Purpose : Block mixing of the sound voices.  Each kind of voice has
+*             its own render loop and the mono mix is scaled, clipped
+*             and interleaved into the stereo output a block at a time.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __MIXER_H
+#define  __MIXER_H
+
+#include "sounds.h"
+
+/* frames mixed at a time, the mono mix buffer lives on the stack */
+static const unsigned long MIX_BLOCK = 256;
+
+/*
+ * The voices all hold mono samples, so they're mixed into a mono block and
+ * only the final mix is written to both channels.  MixVoice() picks a
+ * render loop made for the voice (one-shot or looping, one or two samples
+ * per frame) that only checks for the end of the samples once per run
+ * instead of once per frame.  A voice whose samples aren't at the output
+ * rate steps through them a fraction of a sample at a time and
+ * interpolates between them.  Voices played by the emulated VIC are
+ * generated straight into the mix by VicRender().
+ */
+
+/* add frames (at most MIX_BLOCK) of a voice times gain to mix */
+void MixVoice(voice_data_t *voice, float gain, float *mix,
+    unsigned long frames);
+
+/* write the mono mix to both channels of out, clipped to +/-1 */
+void InterleaveMix(const float *mix, float *out, unsigned long frames);
+
+/* name of the vector instructions the mixer was built with */
+const char *MixerKernel(void);
+
+#endif /* ndef  __MIXER_H */
@@ -0,0 +1,231 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : motion.cpp
+*   Purpose : Motion drawn between game ticks.  Moves the UFO and shots
+*             by fractions of a cell on the render clock, on top of the
+*             state left by the last game tick.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstring>
+#include <langinfo.h>
+#include <ncurses.h>
+#include <term.h>
+
+#include "motion.h"
+
+/* characters drawn by the game objects that the overlay moves */
+static const wchar_t UFO_SHOT_WCH = L'●';
+static const wchar_t TANK_SHOT_WCH = L'▪';
+
+/* left 1/8 to 7/8 blocks, reversed they're the right 7/8 to 1/8 blocks */
+static const wchar_t LEFT_BLOCKS[] = L" ▏▎▍▌▋▊▉";
+
+MotionOverlay::MotionOverlay(WINDOW *window)
+{
+    const char *rev;
+
+    win = window;
+    getmaxyx(window, rows, cols);
+
+    /* partial blocks need a UTF-8 terminal */
+    useBlocks = (0 == strcmp(nl_langinfo(CODESET), "UTF-8"));
+    rev = tigetstr("rev");
+    useReverse = (nullptr != rev) && ((char *)-1 != rev);
+
+    memset(&state, 0, sizeof(state));
+    state.ufoShot.x = -1;
+    state.tankShot.x = -1;
+    step = -1;
+    savedCount = 0;
+}
+
+
+/* start over with the state left by a game tick */
+void MotionOverlay::SetState(const Tvu::FrameState *frameState)
+{
+    Remove();
+    state = *frameState;
+}
+
+
+/*
+ * draw the overlay for the part of the tick (0 to 1) that has gone by,
+ * returns true if the window changed
+ */
+bool MotionOverlay::Update(double fraction)
+{
+    int newStep;
+
+    newStep = (int)(fraction * STEPS);
+
+    if (newStep < 0)
+    {
+        newStep = 0;
+    }
+    else if (newStep >= STEPS)
+    {
+        /* the tick is late, hold the last step */
+        newStep = STEPS - 1;
+    }
+
+    if (newStep == step)
+    {
+        /* nothing new to draw */
+        return false;
+    }
+
+    Remove();
+    step = newStep;
+
+    if (useBlocks)
+    {
+        DrawUfoEdge(step);
+    }
+
+    if (step >= STEPS / 2)
+    {
+        DrawShots();
+    }
+
+    return (0 != savedCount);
+}
+
+
+/* put back everything the overlay replaced */
+void MotionOverlay::Remove(void)
+{
+    /* restore in reverse in case a cell was replaced twice */
+    while (savedCount > 0)
+    {
+        savedCount--;
+        mvwadd_wch(win, saved[savedCount].y, saved[savedCount].x,
+            &saved[savedCount].under);
+    }
+
+    step = -1;
+}
+
+
+/* true if the cell at (y, x) in the window shows ch */
+bool MotionOverlay::Holds(int y, int x, wchar_t ch)
+{
+    cchar_t c;
+
+    if ((y < 0) || (y >= rows) || (x < 0) || (x >= cols))
+    {
+        return false;
+    }
+
+    mvwin_wch(win, y, x, &c);
+    return (ch == c.chars[0]);
+}
+
+
+void MotionOverlay::Put(int y, int x, wchar_t ch, attr_t attr)
+{
+    cchar_t c;
+    wchar_t wstr[2];
+
+    if (savedCount == MAX_CELLS)
+    {
+        return;
+    }
+
+    saved[savedCount].y = y;
+    saved[savedCount].x = x;
+    mvwin_wch(win, y, x, &saved[savedCount].under);
+    savedCount++;
+
+    wstr[0] = ch;
+    wstr[1] = L'\0';
+    setcchar(&c, wstr, attr, 0, nullptr);
+    mvwadd_wch(win, y, x, &c);
+}
+
+
+/* fill the cell the ufo is flying into from the side it's entering */
+void MotionOverlay::DrawUfoEdge(int eighths)
+{
+    int x;
+
+    if ((0 == state.ufoDx) || (0 == eighths))
+    {
+        return;
+    }
+
+    /* the ufo is 3 cells wide */
+    x = (state.ufoDx > 0) ? state.ufo.x + 3 : state.ufo.x - 1;
+
+    if (!Holds(state.ufo.y, x, L' '))
+    {
+        return;
+    }
+
+    if (state.ufoDx > 0)
+    {
+        Put(state.ufo.y, x, LEFT_BLOCKS[eighths], A_NORMAL);
+    }
+    else if (useReverse)
+    {
+        /* right eighths are the reverse of the other left eighths */
+        Put(state.ufo.y, x, LEFT_BLOCKS[STEPS - eighths], A_REVERSE);
+    }
+    else
+    {
+        /* only right 1/8 and 1/2 blocks */
+        Put(state.ufo.y, x, (eighths < STEPS / 2) ? L'▕' : L'▐', A_NORMAL);
+    }
+}
+
+
+/* move shots that will still be falling or rising into their next cell */
+void MotionOverlay::DrawShots(void)
+{
+    int x, y;
+
+    x = state.ufoShot.x;
+    y = state.ufoShot.y;
+
+    if ((x >= 0) && (y < Tvu::TANK_TREAD_ROW) && Holds(y, x, UFO_SHOT_WCH) &&
+        Holds(y + 1, x + state.ufoShotDx, L' '))
+    {
+        Put(y, x, L' ', A_NORMAL);
+        Put(y + 1, x + state.ufoShotDx, UFO_SHOT_WCH, A_NORMAL);
+    }
+
+    x = state.tankShot.x;
+    y = state.tankShot.y;
+
+    if ((x >= 0) && (y - 1 > Tvu::SCORE_ROW) && Holds(y, x, TANK_SHOT_WCH) &&
+        Holds(y - 1, x, L' '))
+    {
+        Put(y, x, L' ', A_NORMAL);
+        Put(y - 1, x, TANK_SHOT_WCH, A_NORMAL);
+    }
+}
@@ -0,0 +1,86 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : motion.h
+*   Purpose : Motion drawn between game ticks.  Moves the UFO and shots
+*             by fractions of a cell on the render clock, on top of the
+*             state left by the last game tick.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __MOTION_H
+#define  __MOTION_H
+
+#include <ncurses.h>
+#include "tvu_defs.h"
+
+/*
+ * The game objects draw the state of each tick into the game window.  A
+ * MotionOverlay draws on top of that state between ticks: the cell in
+ * front of a level flying UFO fills in eighths of a cell as the tick
+ * progresses, and shots step into their next cell half way through the
+ * tick.  The overlay only touches blank cells and remembers what it
+ * replaced, so Remove() leaves the window exactly as the game drew it.
+ */
+class MotionOverlay
+{
+    public:
+        MotionOverlay(WINDOW *window);
+
+        void SetState(const Tvu::FrameState *frameState);
+        bool Update(double fraction);
+        void Remove(void);
+
+    private:
+        static constexpr int MAX_CELLS = 8;     /* cells the overlay covers */
+        static constexpr int STEPS = 8;         /* updates per game tick */
+
+        WINDOW *win;
+        int rows;                   /* window rows */
+        int cols;                   /* window columns */
+        bool useBlocks;             /* terminal can show eighth blocks */
+        bool useReverse;            /* terminal has reverse video */
+
+        Tvu::FrameState state;      /* state left by the last tick */
+        int step;                   /* step drawn, -1 for none */
+
+        /* cells replaced by the overlay */
+        struct
+        {
+            int y;
+            int x;
+            cchar_t under;
+        } saved[MAX_CELLS];
+        int savedCount;
+
+        bool Holds(int y, int x, wchar_t ch);
+        void Put(int y, int x, wchar_t ch, attr_t attr);
+        void DrawUfoEdge(int eighths);
+        void DrawShots(void);
+};
+
+#endif /* ndef  __MOTION_H */
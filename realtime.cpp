@@ -1,21 +1,20 @@
 /***************************************************************************
-*                             Tank Versuses UFO
+*                              Tank Versus UFO
 *
-*   File    : sound_data.h
-*   Purpose : Sounds for a tribute to the Tank-V-UFO, a Commodore VIC-20 Game
-*             by Duane Later
+*   File    : realtime.cpp
+*   Purpose : Real-time scheduling for the game and audio threads
 *   Author  : Michael Dipperstein
-*   Date    : February 20, 2021
+*   Date    : October 18, 2026
 *
 ****************************************************************************
 *
-* Tank Versuses UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
-*                    by Duane Later
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
 *
-* Copyright (C) 2020, 2021 by
+* Copyright (C) 2026 by
 *       Michael Dipperstein (mdipperstein@gmail.com)
 *
-* This file is part of Tank Versuses UFO.
+* This file is part of Tank Versus UFO.
 *
 * Tank Versus UFO is free software; you can redistribute it and/or modify
 * it under the terms of the GNU General Public License as published by the
@@ -31,13 +30,30 @@
 * with this program.  If not, see <http://www.gnu.org/licenses/>.
 *
 ****************************************************************************/
-#ifndef  __SOUND_DATA_H
-#define  __SOUND_DATA_H
+#include <pthread.h>
 
-/* include files with sound data */
-#include "sound_data/ufo_falling.h"
-#include "sound_data/tank_shot.h"
-#include "sound_data/on_fire.h"
-#include "sound_data/explode.h"
+#include "realtime.h"
 
-#endif /* ndef  __SOUND_DATA_H */
+int RaiseThreadPriority(int policy, int priority)
+{
+    struct sched_param param;
+
+    param.sched_priority = priority;
+    return pthread_setschedparam(pthread_self(), policy, &param);
+}
+
+
+const char *PolicyName(int policy)
+{
+    switch (policy)
+    {
+        case SCHED_FIFO:
+            return "SCHED_FIFO";
+
+        case SCHED_RR:
+            return "SCHED_RR";
+
+        default:
+            return "SCHED_OTHER";
+    }
+}
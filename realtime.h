@@ -0,0 +1,54 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : realtime.h
+*   Purpose : Real-time scheduling for the game and audio threads
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __REALTIME_H
+#define  __REALTIME_H
+
+#include <sched.h>
+
+/* SCHED_FIFO priority of the audio callback and SCHED_RR priority of the
+ * game loop, the audio has to win */
+static const int AUDIO_PRIORITY = 20;
+static const int GAME_PRIORITY = 10;
+
+/*
+ * Switch the calling thread to policy (SCHED_FIFO or SCHED_RR) at
+ * priority.  Returns 0, or the error number if it isn't permitted (it
+ * usually needs CAP_SYS_NICE or an RLIMIT_RTPRIO), in which case the
+ * thread keeps its normal priority.
+ */
+int RaiseThreadPriority(int policy, int priority);
+
+/* "SCHED_FIFO" style name of a policy */
+const char *PolicyName(int policy);
+
+#endif /* ndef  __REALTIME_H */
@@ -0,0 +1,205 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : replay.cpp
+*   Purpose : Recording and playback of game sessions (seed + key presses)
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+#include "replay.h"
+
+static const char REPLAY_MAGIC[] = "TVU-REPLAY 1";
+
+Replay::Replay(void)
+{
+    seed = 0;
+    recordFile = nullptr;
+    keyData = nullptr;
+    tickStart = nullptr;
+    ticks = 0;
+    next = 0;
+}
+
+
+Replay::~Replay(void)
+{
+    if (nullptr != recordFile)
+    {
+        fclose(recordFile);
+    }
+
+    free(keyData);
+    free(tickStart);
+}
+
+
+bool Replay::StartRecording(const char *fileName, unsigned int seed)
+{
+    recordFile = fopen(fileName, "w");
+
+    if (nullptr == recordFile)
+    {
+        return false;
+    }
+
+    this->seed = seed;
+    fprintf(recordFile, "%s\nseed %u\n", REPLAY_MAGIC, seed);
+    return true;
+}
+
+
+void Replay::RecordKey(int ch)
+{
+    if ((nullptr == recordFile) || (ch < ' ') || (ch > '~'))
+    {
+        /* not recording or not a key that can be played back */
+        return;
+    }
+
+    fputc(ch, recordFile);
+}
+
+
+void Replay::EndTick(void)
+{
+    if (nullptr != recordFile)
+    {
+        fputc('\n', recordFile);
+    }
+}
+
+
+bool Replay::Load(const char *fileName)
+{
+    FILE *fp;
+    long size;
+    char *line;
+    char *end;
+
+    fp = fopen(fileName, "r");
+
+    if (nullptr == fp)
+    {
+        return false;
+    }
+
+    /* read the whole file into memory */
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+
+    free(keyData);
+    free(tickStart);
+    keyData = (char *)malloc(size + 1);
+    tickStart = nullptr;
+    ticks = 0;
+    next = 0;
+
+    if ((nullptr == keyData) || (fread(keyData, 1, size, fp) != (size_t)size))
+    {
+        fclose(fp);
+        return false;
+    }
+
+    fclose(fp);
+    keyData[size] = '\0';
+    end = keyData + size;
+
+    /* header lines */
+    if (strncmp(keyData, REPLAY_MAGIC, strlen(REPLAY_MAGIC)) != 0)
+    {
+        errno = EINVAL;
+        return false;
+    }
+
+    line = strchr(keyData, '\n');
+
+    if ((nullptr == line) || (sscanf(line + 1, "seed %u", &seed) != 1))
+    {
+        errno = EINVAL;
+        return false;
+    }
+
+    line = strchr(line + 1, '\n');
+
+    if (nullptr == line)
+    {
+        /* no ticks */
+        return true;
+    }
+
+    line++;
+
+    /* one tick per line, worst case every byte is a newline */
+    tickStart = (int *)malloc(sizeof(int) * (end - line + 1));
+
+    if (nullptr == tickStart)
+    {
+        return false;
+    }
+
+    while (line < end)
+    {
+        char *nl;
+
+        nl = strchr(line, '\n');
+
+        if (nullptr == nl)
+        {
+            nl = end;
+        }
+
+        *nl = '\0';
+        tickStart[ticks] = line - keyData;
+        ticks++;
+        line = nl + 1;
+    }
+
+    return true;
+}
+
+
+const char *Replay::NextTick(int *count)
+{
+    const char *keys;
+
+    if (next >= ticks)
+    {
+        /* end of the replay */
+        *count = 0;
+        return nullptr;
+    }
+
+    keys = keyData + tickStart[next];
+    *count = strlen(keys);
+    next++;
+    return keys;
+}
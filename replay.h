@@ -0,0 +1,76 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : replay.h
+*   Purpose : Recording and playback of game sessions (seed + key presses)
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __REPLAY_H
+#define  __REPLAY_H
+
+#include <cstdio>
+
+/*
+ * A replay file is plain text:
+ *      TVU-REPLAY 1
+ *      seed <random number generator seed>
+ *      <keys read during tick 1>
+ *      <keys read during tick 2>
+ *      ...
+ * Every game tick gets exactly one line, so an empty line is a tick without
+ * any key presses.  Only printable ASCII keys are recorded.
+ */
+class Replay
+{
+    public:
+        Replay(void);
+        ~Replay(void);
+
+        /* recording */
+        bool StartRecording(const char *fileName, unsigned int seed);
+        void RecordKey(int ch);
+        void EndTick(void);
+
+        /* playback */
+        bool Load(const char *fileName);
+        const char *NextTick(int *count);
+        unsigned int GetSeed(void) const { return seed; }
+        int GetTicks(void) const { return ticks; }
+        void Rewind(void) { next = 0; }
+
+    private:
+        unsigned int seed;      /* seed for the random number generator */
+        FILE *recordFile;       /* file being recorded, nullptr if none */
+
+        char *keyData;          /* tick lines, '\n' replaced with '\0' */
+        int *tickStart;         /* offset of each tick line in keyData */
+        int ticks;              /* number of ticks in the playback */
+        int next;               /* next tick to be played back */
+};
+
+#endif /* ndef  __REPLAY_H */
@@ -0,0 +1,229 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : resampler.cpp
+*   Purpose : Polyphase sample rate conversion for the sound effects
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "resampler.h"
+
+static const int HALF_TAPS = RESAMPLE_TAPS / 2;
+
+/* passband edge as a share of the lower rate's Nyquist frequency */
+static const double CUTOFF = 0.9;
+
+/* Kaiser window shape, about 80 dB of stopband attenuation */
+static const double KAISER_BETA = 8.0;
+
+/* up and down, the rates' ratio in lowest terms, false if it's too fine */
+static bool RateRatio(int inRate, int outRate, int *up, int *down)
+{
+    int divisor;
+
+    if ((inRate <= 0) || (outRate <= 0))
+    {
+        return false;
+    }
+
+    divisor = std::gcd(inRate, outRate);
+    *up = outRate / divisor;
+    *down = inRate / divisor;
+    return *up <= RESAMPLE_MAX_PHASES;
+}
+
+
+/* zeroth order modified Bessel function of the first kind, for the window */
+static double BesselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+
+        if (term < sum * 1e-12)
+        {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+
+/*
+ * Build the up phases of the filter.  Phase p's taps are the filter at the
+ * distances from an output sample p / up of the way past an input sample
+ * to each of the input samples around it.  Each phase is scaled to unity
+ * gain so the phases don't leave a ripple at the up rate.
+ */
+static void MakeFilter(float *filter, int up, int down)
+{
+    double fc, window;
+
+    /* when going down in rate, cut off below the new Nyquist frequency */
+    fc = CUTOFF * ((up < down) ? (double)up / down : 1.0);
+    window = BesselI0(KAISER_BETA);
+
+    for (int p = 0; p < up; p++)
+    {
+        double tap[RESAMPLE_TAPS];
+        double sum = 0.0;
+
+        for (int k = 0; k < RESAMPLE_TAPS; k++)
+        {
+            double x, r, sinc;
+
+            x = (k - HALF_TAPS + 1) - (double)p / up;
+            r = x / HALF_TAPS;
+            sinc = (0.0 == x) ? 1.0 : sin(M_PI * fc * x) / (M_PI * fc * x);
+
+            tap[k] = (r * r >= 1.0) ? 0.0 :
+                sinc * BesselI0(KAISER_BETA * sqrt(1.0 - r * r)) / window;
+            sum += tap[k];
+        }
+
+        for (int k = 0; k < RESAMPLE_TAPS; k++)
+        {
+            filter[p * RESAMPLE_TAPS + k] = tap[k] / sum;
+        }
+    }
+}
+
+
+/* sum of RESAMPLE_TAPS samples times their taps */
+static float DotProduct(const float *samples, const float *taps)
+{
+    int k;
+    float sum;
+
+    k = 0;
+    sum = 0.0f;
+
+#ifdef __SSE2__
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+
+    /* the taps are 16 byte aligned, the samples can start anywhere */
+    for (; k + 8 <= RESAMPLE_TAPS; k += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(samples + k),
+            _mm_load_ps(taps + k)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(samples + k + 4),
+            _mm_load_ps(taps + k + 4)));
+    }
+
+    /* add the four lanes together */
+    acc0 = _mm_add_ps(acc0, acc1);
+    acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+    acc0 = _mm_add_ss(acc0,
+        _mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(1, 1, 1, 1)));
+    sum = _mm_cvtss_f32(acc0);
+#endif
+
+    for (; k < RESAMPLE_TAPS; k++)
+    {
+        sum += samples[k] * taps[k];
+    }
+
+    return sum;
+}
+
+
+int ResampledLength(int length, int inRate, int outRate)
+{
+    int up, down;
+
+    if (!RateRatio(inRate, outRate, &up, &down))
+    {
+        return 0;
+    }
+
+    /* enough to reach the last input sample */
+    return (int)(((long long)length * up + down - 1) / down);
+}
+
+
+bool Resample(const float *in, int length, int inRate, float *out,
+    int outRate)
+{
+    int up, down, outLength;
+    float *filter, *padded;
+
+    if (!RateRatio(inRate, outRate, &up, &down))
+    {
+        return false;
+    }
+
+    outLength = ResampledLength(length, inRate, outRate);
+
+    /* silence on both sides so the taps never reach past the samples */
+    filter = new (std::align_val_t(16)) float[up * RESAMPLE_TAPS];
+    padded = new float[length + RESAMPLE_TAPS];
+    memset(padded, 0, sizeof(float) * (length + RESAMPLE_TAPS));
+    memcpy(padded + HALF_TAPS, in, sizeof(float) * length);
+    MakeFilter(filter, up, down);
+
+    for (int n = 0; n < outLength; n++)
+    {
+        long long position;
+        int i, p;
+
+        /* output sample n is at input sample i plus p / up */
+        position = (long long)n * down;
+        i = (int)(position / up);
+        p = (int)(position % up);
+
+        /* input samples i - HALF_TAPS + 1 to i + HALF_TAPS */
+        out[n] = DotProduct(padded + i + 1, filter + p * RESAMPLE_TAPS);
+    }
+
+    operator delete[](filter, std::align_val_t(16));
+    delete[] padded;
+    return true;
+}
+
+
+const char *ResamplerKernel(void)
+{
+#ifdef __SSE2__
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
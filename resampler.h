@@ -0,0 +1,61 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : resampler.h
+*   Purpose : Polyphase sample rate conversion for the sound effects
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __RESAMPLER_H
+#define  __RESAMPLER_H
+
+/*
+ * Converts mono float samples from one sample rate to another with a
+ * windowed sinc filter.  The rates are reduced to up / down (160 / 147 for
+ * 44.1 kHz to 48 kHz) and the filter is split into up phases, so each
+ * output sample is a single RESAMPLE_TAPS long dot product of the input
+ * around it with the phase that falls between those input samples.  It's
+ * meant to be run once, before the sound starts, not by the callback.
+ */
+
+/* input samples weighted for each output sample */
+static const int RESAMPLE_TAPS = 32;
+
+/* the most filter phases (up) built, rates that need more can't be done */
+static const int RESAMPLE_MAX_PHASES = 2048;
+
+/* samples out for length samples in, 0 if the rates can't be converted */
+int ResampledLength(int length, int inRate, int outRate);
+
+/* convert in to ResampledLength() samples of out, false if it can't */
+bool Resample(const float *in, int length, int inRate, float *out,
+    int outRate);
+
+/* name of the vector instructions the filter was built with */
+const char *ResamplerKernel(void);
+
+#endif /* ndef  __RESAMPLER_H */
@@ -0,0 +1,107 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : seqlock.h
+*   Purpose : Sequence lock, lets any number of readers (in other
+*             processes too) copy a value one writer updates, without
+*             locks or system calls on either side.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __SEQLOCK_H
+#define  __SEQLOCK_H
+
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+
+/*
+ * The sequence is odd while the writer is changing the value.  A reader
+ * copies the value between two reads of the sequence and keeps the copy
+ * only if the sequence was even and didn't change, so the writer never
+ * waits and a reader only ever retries.  The copy races with the writer by
+ * design, the sequence check throws away the ones that were torn.
+ *
+ * T must be plain data (it's copied with memcpy), and a SeqLock may be
+ * put in shared memory since it doesn't point to anything.  Only one
+ * thread may write.
+ */
+template <typename T>
+class alignas(64) SeqLock
+{
+    public:
+        SeqLock(void) : sequence(0), value() {}
+
+        /* writer only */
+        void Write(const T *newValue)
+        {
+            uint32_t start;
+
+            start = sequence.load(std::memory_order_relaxed);
+            sequence.store(start + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            memcpy((void *)&value, newValue, sizeof(T));
+            sequence.store(start + 2, std::memory_order_release);
+        }
+
+        /* false if the writer was in the way, try again */
+        bool TryRead(T *copy) const
+        {
+            uint32_t start;
+
+            start = sequence.load(std::memory_order_acquire);
+
+            if (0 != (start & 1))
+            {
+                return false;
+            }
+
+            memcpy(copy, (const void *)&value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return sequence.load(std::memory_order_relaxed) == start;
+        }
+
+        /* a consistent copy, false if the writer never let one through */
+        bool Read(T *copy) const
+        {
+            for (int i = 0; i < 1000; i++)
+            {
+                if (TryRead(copy))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        std::atomic<uint32_t> sequence;
+        T value;
+};
+
+#endif /* ndef  __SEQLOCK_H */
@@ -1,17686 +0,0 @@
-/***************************************************************************
-*                              Tank Versus UFO
-*
-*   File    : explode.h
-*   Purpose : Sound of tank shoot exploding when it hits the UFO for a tribute
-*             to the Tank-V-UFO, a Commodore VIC-20 Game by Duane Later
-*   Author  : Michael Dipperstein
-*   Date    : June 20, 2021
-*
-****************************************************************************
-*
-* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
-*                  by Duane Later
-*
-* Copyright (C) 2021 by Michael Dipperstein (mdipperstein@gmail.com)
-*
-* This file is part of Tank Versus UFO.
-*
-* Trim is free software; you can redistribute it and/or modify it under
-* the terms of the GNU General Public License as published by the Free
-* Software Foundation; either version 3 of the License, or (at your
-* option) any later version.
-*
-* Trim is distributed in the hope that it will be useful, but WITHOUT ANY
-* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
-* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
-* for more details.
-*
-* You should have received a copy of the GNU General Public License along
-* with this program.  If not, see <http://www.gnu.org/licenses/>.
-*
-****************************************************************************/
-
-/****
-generated by:
-https://www.leshylabs.com/apps/sfMaker/
-
-Sample Rate: 44100 Hz. Sample values on linear scale. 1 channel (mono).
-Length processed: 17640 samples, 0.40000 seconds.
-Peak amplitude: 1.10329 (linear) 0.85382 dB.  Unweighted RMS: -6.88493 dB.
-DC offset: 0.04385 linear, -27.16132 dB.
-****/
-
-const float explosion[] =
-{
-    0.77176,
-    0.87134,
-    0.89771,
-    0.86825,
-    0.81405,
-    0.76697,
-    0.74802,
-    0.76130,
-    0.79558,
-    0.83203,
-    0.85393,
-    0.85408,
-    0.83685,
-    0.81458,
-    0.80060,
-    0.80270,
-    0.81988,
-    0.84382,
-    0.86368,
-    0.87175,
-    0.86702,
-    0.85508,
-    0.84468,
-    0.84307,
-    0.85241,
-    0.86906,
-    0.88584,
-    0.89605,
-    0.89682,
-    0.89040,
-    0.88268,
-    0.87987,
-    0.88528,
-    0.89769,
-    0.91222,
-    0.92302,
-    0.92632,
-    0.92234,
-    0.91499,
-    0.90969,
-    0.91057,
-    0.91838,
-    0.93028,
-    0.94150,
-    0.94782,
-    0.94775,
-    0.94310,
-    0.93786,
-    0.93600,
-    0.93940,
-    0.94701,
-    0.95555,
-    0.96142,
-    0.96262,
-    0.95975,
-    0.95564,
-    0.95365,
-    0.95588,
-    0.96202,
-    0.96951,
-    0.97504,
-    0.97624,
-    0.97304,
-    0.96766,
-    0.96343,
-    0.96308,
-    0.96725,
-    0.97426,
-    0.98094,
-    0.98434,
-    0.98320,
-    0.97854,
-    0.97308,
-    0.96977,
-    0.97027,
-    0.97415,
-    0.97920,
-    0.98268,
-    0.98276,
-    0.97950,
-    0.97472,
-    0.97101,
-    0.97036,
-    0.97308,
-    0.97768,
-    0.98169,
-    0.98297,
-    0.98078,
-    0.97611,
-    0.97110,
-    0.96782,
-    0.96720,
-    0.96859,
-    0.97014,
-    0.96990,
-    0.96688,
-    0.96163,
-    0.95596,
-    0.95191,
-    0.95068,
-    0.95196,
-    0.95402,
-    0.95467,
-    0.95232,
-    0.94689,
-    0.93978,
-    0.93321,
-    0.92901,
-    0.92776,
-    0.92850,
-    0.92923,
-    0.92805,
-    0.92408,
-    0.91794,
-    0.91137,
-    0.90629,
-    0.90382,
-    0.90366,
-    0.90431,
-    0.90387,
-    0.90104,
-    0.89580,
-    0.88940,
-    0.88368,
-    0.88009,
-    0.87896,
-    0.87933,
-    0.87946,
-    0.87779,
-    0.87370,
-    0.86781,
-    0.86160,
-    0.85657,
-    0.85341,
-    0.85163,
-    0.84984,
-    0.84652,
-    0.84084,
-    0.83315,
-    0.82484,
-    0.81762,
-    0.81268,
-    0.81010,
-    0.80882,
-    0.80726,
-    0.80412,
-    0.79904,
-    0.79276,
-    0.78665,
-    0.78194,
-    0.77905,
-    0.77737,
-    0.77564,
-    0.77263,
-    0.76786,
-    0.76187,
-    0.75587,
-    0.75107,
-    0.74797,
-    0.74601,
-    0.74384,
-    0.74001,
-    0.73384,
-    0.72582,
-    0.71744,
-    0.71051,
-    0.70619,
-    0.70447,
-    0.70404,
-    0.70305,
-    0.69993,
-    0.69429,
-    0.68702,
-    0.67989,
-    0.67466,
-    0.67215,
-    0.67188,
-    0.67237,
-    0.67186,
-    0.66926,
-    0.66458,
-    0.65888,
-    0.65360,
-    0.64974,
-    0.64735,
-    0.64558,
-    0.64322,
-    0.63949,
-    0.63451,
-    0.62931,
-    0.62522,
-    0.62308,
-    0.62266,
-    0.62271,
-    0.62157,
-    0.61811,
-    0.61240,
-    0.60579,
-    0.60029,
-    0.59751,
-    0.59782,
-    0.60004,
-    0.60203,
-    0.60172,
-    0.59824,
-    0.59237,
-    0.58614,
-    0.58183,
-    0.58068,
-    0.58230,
-    0.58482,
-    0.58593,
-    0.58416,
-    0.57975,
-    0.57457,
-    0.57114,
-    0.57130,
-    0.57507,
-    0.58057,
-    0.58492,
-    0.58573,
-    0.58246,
-    0.57671,
-    0.57152,
-    0.56974,
-    0.57247,
-    0.57841,
-    0.58444,
-    0.58727,
-    0.58519,
-    0.57913,
-    0.57223,
-    0.56825,
-    0.56955,
-    0.57566,
-    0.58346,
-    0.58869,
-    0.58828,
-    0.58214,
-    0.57338,
-    0.56692,
-    0.56687,
-    0.57429,
-    0.58638,
-    0.59773,
-    0.60308,
-    0.60015,
-    0.59104,
-    0.58143,
-    0.57770,
-    0.58353,
-    0.59768,
-    0.61434,
-    0.62590,
-    0.62703,
-    0.61778,
-    0.60404,
-    0.59485,
-    0.59772,
-    0.61423,
-    0.63845,
-    0.65921,
-    0.66560,
-    0.65305,
-    0.62697,
-    0.60155,
-    0.59375,
-    0.61469,
-    0.66222,
-    0.71851,
-    0.75424,
-    0.73846,
-    0.65025,
-    0.48762,
-    0.26968,
-    0.03107,
-    -0.18936,
-    -0.36114,
-    -0.47113,
-    -0.52556,
-    -0.54487,
-    -0.55390,
-    -0.57178,
-    -0.60571,
-    -0.65066,
-    -0.69437,
-    -0.72478,
-    -0.73625,
-    -0.73185,
-    -0.72116,
-    -0.71508,
-    -0.72045,
-    -0.73727,
-    -0.75937,
-    -0.77820,
-    -0.78737,
-    -0.78573,
-    -0.77758,
-    -0.77005,
-    -0.76925,
-    -0.77726,
-    -0.79134,
-    -0.80569,
-    -0.81472,
-    -0.81595,
-    -0.81118,
-    -0.80536,
-    -0.80385,
-    -0.80963,
-    -0.82184,
-    -0.83637,
-    -0.84816,
-    -0.85382,
-    -0.85327,
-    -0.84963,
-    -0.84738,
-    -0.84995,
-    -0.85790,
-    -0.86880,
-    -0.87858,
-    -0.88377,
-    -0.88335,
-    -0.87922,
-    -0.87513,
-    -0.87470,
-    -0.87954,
-    -0.88850,
-    -0.89843,
-    -0.90589,
-    -0.90902,
-    -0.90844,
-    -0.90681,
-    -0.90727,
-    -0.91172,
-    -0.91973,
-    -0.92883,
-    -0.93582,
-    -0.93858,
-    -0.93718,
-    -0.93389,
-    -0.93200,
-    -0.93406,
-    -0.94053,
-    -0.94958,
-    -0.95799,
-    -0.96290,
-    -0.96323,
-    -0.96020,
-    -0.95668,
-    -0.95565,
-    -0.95866,
-    -0.96505,
-    -0.97240,
-    -0.97781,
-    -0.97942,
-    -0.97734,
-    -0.97350,
-    -0.97060,
-    -0.97064,
-    -0.97393,
-    -0.97904,
-    -0.98363,
-    -0.98578,
-    -0.98502,
-    -0.98248,
-    -0.98019,
-    -0.97991,
-    -0.98210,
-    -0.98569,
-    -0.98872,
-    -0.98946,
-    -0.98741,
-    -0.98365,
-    -0.98022,
-    -0.97903,
-    -0.98077,
-    -0.98450,
-    -0.98819,
-    -0.98979,
-    -0.98843,
-    -0.98486,
-    -0.98108,
-    -0.97917,
-    -0.98013,
-    -0.98325,
-    -0.98639,
-    -0.98720,
-    -0.98434,
-    -0.97836,
-    -0.97142,
-    -0.96621,
-    -0.96452,
-    -0.96625,
-    -0.96942,
-    -0.97123,
-    -0.96956,
-    -0.96417,
-    -0.95687,
-    -0.95060,
-    -0.94781,
-    -0.94912,
-    -0.95289,
-    -0.95598,
-    -0.95546,
-    -0.95012,
-    -0.94123,
-    -0.93192,
-    -0.92557,
-    -0.92404,
-    -0.92662,
-    -0.93040,
-    -0.93178,
-    -0.92839,
-    -0.92039,
-    -0.91043,
-    -0.90229,
-    -0.89884,
-    -0.90047,
-    -0.90484,
-    -0.90807,
-    -0.90676,
-    -0.89992,
-    -0.88948,
-    -0.87941,
-    -0.87356,
-    -0.87367,
-    -0.87831,
-    -0.88359,
-    -0.88517,
-    -0.88054,
-    -0.87038,
-    -0.85815,
-    -0.84830,
-    -0.84382,
-    -0.84458,
-    -0.84743,
-    -0.84788,
-    -0.84269,
-    -0.83175,
-    -0.81836,
-    -0.80754,
-    -0.80329,
-    -0.80626,
-    -0.81315,
-    -0.81823,
-    -0.81640,
-    -0.80602,
-    -0.79007,
-    -0.77483,
-    -0.76667,
-    -0.76852,
-    -0.77799,
-    -0.78827,
-    -0.79150,
-    -0.78304,
-    -0.76428,
-    -0.74249,
-    -0.72740,
-    -0.72607,
-    -0.73873,
-    -0.75787,
-    -0.77132,
-    -0.76837,
-    -0.74577,
-    -0.71066,
-    -0.67852,
-    -0.66630,
-    -0.68381,
-    -0.72690,
-    -0.77623,
-    -0.80239,
-    -0.77613,
-    -0.67945,
-    -0.51323,
-    -0.29810,
-    -0.06804,
-    0.14066,
-    0.30087,
-    0.40212,
-    0.45150,
-    0.46826,
-    0.47478,
-    0.48785,
-    0.51367,
-    0.54801,
-    0.58075,
-    0.60208,
-    0.60752,
-    0.59960,
-    0.58600,
-    0.57546,
-    0.57368,
-    0.58110,
-    0.59346,
-    0.60442,
-    0.60887,
-    0.60521,
-    0.59571,
-    0.58500,
-    0.57761,
-    0.57584,
-    0.57899,
-    0.58405,
-    0.58743,
-    0.58671,
-    0.58170,
-    0.57428,
-    0.56733,
-    0.56338,
-    0.56346,
-    0.56686,
-    0.57162,
-    0.57547,
-    0.57680,
-    0.57520,
-    0.57144,
-    0.56702,
-    0.56350,
-    0.56186,
-    0.56222,
-    0.56384,
-    0.56558,
-    0.56630,
-    0.56542,
-    0.56315,
-    0.56039,
-    0.55838,
-    0.55812,
-    0.55985,
-    0.56290,
-    0.56594,
-    0.56759,
-    0.56715,
-    0.56504,
-    0.56267,
-    0.56184,
-    0.56371,
-    0.56816,
-    0.57363,
-    0.57780,
-    0.57879,
-    0.57621,
-    0.57163,
-    0.56791,
-    0.56788,
-    0.57283,
-    0.58163,
-    0.59118,
-    0.59781,
-    0.59924,
-    0.59586,
-    0.59076,
-    0.58822,
-    0.59149,
-    0.60088,
-    0.61339,
-    0.62400,
-    0.62829,
-    0.62495,
-    0.61671,
-    0.60932,
-    0.60856,
-    0.61714,
-    0.63285,
-    0.64932,
-    0.65908,
-    0.65758,
-    0.64603,
-    0.63135,
-    0.62306,
-    0.62830,
-    0.64759,
-    0.67365,
-    0.69435,
-    0.69868,
-    0.68303,
-    0.65445,
-    0.62880,
-    0.62394,
-    0.65052,
-    0.70468,
-    0.76609,
-    0.80310,
-    0.78347,
-    0.68647,
-    0.51160,
-    0.28013,
-    0.02863,
-    -0.20289,
-    -0.38371,
-    -0.50099,
-    -0.56133,
-    -0.58511,
-    -0.59674,
-    -0.61500,
-    -0.64730,
-    -0.68965,
-    -0.73144,
-    -0.76215,
-    -0.77676,
-    -0.77756,
-    -0.77213,
-    -0.76910,
-    -0.77388,
-    -0.78670,
-    -0.80338,
-    -0.81812,
-    -0.82674,
-    -0.82854,
-    -0.82616,
-    -0.82375,
-    -0.82463,
-    -0.82980,
-    -0.83781,
-    -0.84600,
-    -0.85212,
-    -0.85548,
-    -0.85703,
-    -0.85850,
-    -0.86125,
-    -0.86557,
-    -0.87068,
-    -0.87547,
-    -0.87923,
-    -0.88208,
-    -0.88467,
-    -0.88757,
-    -0.89079,
-    -0.89372,
-    -0.89574,
-    -0.89685,
-    -0.89803,
-    -0.90081,
-    -0.90635,
-    -0.91441,
-    -0.92310,
-    -0.92959,
-    -0.93160,
-    -0.92886,
-    -0.92362,
-    -0.91979,
-    -0.92093,
-    -0.92817,
-    -0.93927,
-    -0.94945,
-    -0.95386,
-    -0.95032,
-    -0.94096,
-    -0.93148,
-    -0.92842,
-    -0.93549,
-    -0.95111,
-    -0.96864,
-    -0.97947,
-    -0.97758,
-    -0.96332,
-    -0.94395,
-    -0.93057,
-    -0.93233,
-    -0.95106,
-    -0.97914,
-    -1.00237,
-    -1.00684,
-    -0.98685,
-    -0.94959,
-    -0.91374,
-    -0.90158,
-    -0.92759,
-    -0.98860,
-    -1.06038,
-    -1.10329,
-    -1.07543,
-    -0.94851,
-    -0.71995,
-    -0.41600,
-    -0.08423,
-    0.22185,
-    0.45999,
-    0.61165,
-    0.68491,
-    0.70765,
-    0.71412,
-    0.73125,
-    0.76986,
-    0.82408,
-    0.87785,
-    0.91484,
-    0.92690,
-    0.91734,
-    0.89819,
-    0.88357,
-    0.88272,
-    0.89619,
-    0.91667,
-    0.93357,
-    0.93880,
-    0.93065,
-    0.91411,
-    0.89777,
-    0.88920,
-    0.89118,
-    0.90078,
-    0.91130,
-    0.91607,
-    0.91178,
-    0.89995,
-    0.88573,
-    0.87501,
-    0.87138,
-    0.87455,
-    0.88080,
-    0.88524,
-    0.88436,
-    0.87765,
-    0.86758,
-    0.85803,
-    0.85222,
-    0.85114,
-    0.85336,
-    0.85602,
-    0.85642,
-    0.85333,
-    0.84729,
-    0.84005,
-    0.83345,
-    0.82852,
-    0.82523,
-    0.82280,
-    0.82040,
-    0.81760,
-    0.81440,
-    0.81091,
-    0.80701,
-    0.80235,
-    0.79666,
-    0.79029,
-    0.78435,
-    0.78025,
-    0.77886,
-    0.77964,
-    0.78050,
-    0.77860,
-    0.77196,
-    0.76090,
-    0.74849,
-    0.73943,
-    0.73763,
-    0.74368,
-    0.75368,
-    0.76039,
-    0.75662,
-    0.73946,
-    0.71303,
-    0.68808,
-    0.67779,
-    0.69110,
-    0.72638,
-    0.76865,
-    0.79231,
-    0.76900,
-    0.67813,
-    0.51570,
-    0.29779,
-    0.05675,
-    -0.16875,
-    -0.34607,
-    -0.45872,
-    -0.51015,
-    -0.52014,
-    -0.51547,
-    -0.51900,
-    -0.54164,
-    -0.58023,
-    -0.62175,
-    -0.65118,
-    -0.65940,
-    -0.64732,
-    -0.62483,
-    -0.60546,
-    -0.59960,
-    -0.60971,
-    -0.62973,
-    -0.64866,
-    -0.65636,
-    -0.64868,
-    -0.62929,
-    -0.60752,
-    -0.59354,
-    -0.59313,
-    -0.60505,
-    -0.62178,
-    -0.63362,
-    -0.63360,
-    -0.62099,
-    -0.60153,
-    -0.58438,
-    -0.57737,
-    -0.58304,
-    -0.59733,
-    -0.61174,
-    -0.61771,
-    -0.61106,
-    -0.59416,
-    -0.57483,
-    -0.56239,
-    -0.56288,
-    -0.57589,
-    -0.59456,
-    -0.60890,
-    -0.61080,
-    -0.59821,
-    -0.57647,
-    -0.55592,
-    -0.54685,
-    -0.55432,
-    -0.57524,
-    -0.59941,
-    -0.61422,
-    -0.61079,
-    -0.58889,
-    -0.55790,
-    -0.53323,
-    -0.52944,
-    -0.55288,
-    -0.59716,
-    -0.64359,
-    -0.66679,
-    -0.64336,
-    -0.56041,
-    -0.42055,
-    -0.24149,
-    -0.05046,
-    0.12434,
-    0.26203,
-    0.35419,
-    0.40530,
-    0.42882,
-    0.44091,
-    0.45444,
-    0.47536,
-    0.50248,
-    0.53005,
-    0.55165,
-    0.56354,
-    0.56614,
-    0.56339,
-    0.56054,
-    0.56176,
-    0.56842,
-    0.57896,
-    0.59003,
-    0.59821,
-    0.60166,
-    0.60070,
-    0.59753,
-    0.59503,
-    0.59549,
-    0.59973,
-    0.60685,
-    0.61482,
-    0.62140,
-    0.62507,
-    0.62563,
-    0.62419,
-    0.62267,
-    0.62301,
-    0.62641,
-    0.63285,
-    0.64108,
-    0.64913,
-    0.65508,
-    0.65786,
-    0.65767,
-    0.65598,
-    0.65489,
-    0.65624,
-    0.66078,
-    0.66782,
-    0.67548,
-    0.68161,
-    0.68480,
-    0.68517,
-    0.68436,
-    0.68478,
-    0.68840,
-    0.69567,
-    0.70512,
-    0.71400,
-    0.71960,
-    0.72072,
-    0.71844,
-    0.71577,
-    0.71620,
-    0.72190,
-    0.73240,
-    0.74461,
-    0.75419,
-    0.75780,
-    0.75498,
-    0.74873,
-    0.74423,
-    0.74629,
-    0.75666,
-    0.77274,
-    0.78852,
-    0.79738,
-    0.79568,
-    0.78513,
-    0.77256,
-    0.76689,
-    0.77454,
-    0.79556,
-    0.82253,
-    0.84344,
-    0.84744,
-    0.83097,
-    0.80122,
-    0.77449,
-    0.76947,
-    0.79785,
-    0.85618,
-    0.92309,
-    0.96388,
-    0.94152,
-    0.83026,
-    0.62643,
-    0.35187,
-    0.04833,
-    -0.23555,
-    -0.45964,
-    -0.60430,
-    -0.67453,
-    -0.69499,
-    -0.69834,
-    -0.71200,
-    -0.74870,
-    -0.80426,
-    -0.86272,
-    -0.90598,
-    -0.92309,
-    -0.91514,
-    -0.89397,
-    -0.87575,
-    -0.87301,
-    -0.88901,
-    -0.91690,
-    -0.94396,
-    -0.95838,
-    -0.95518,
-    -0.93840,
-    -0.91869,
-    -0.90758,
-    -0.91168,
-    -0.92942,
-    -0.95213,
-    -0.96871,
-    -0.97135,
-    -0.95950,
-    -0.94001,
-    -0.92358,
-    -0.91916,
-    -0.92943,
-    -0.94947,
-    -0.96936,
-    -0.97929,
-    -0.97461,
-    -0.95818,
-    -0.93889,
-    -0.92705,
-    -0.92904,
-    -0.94400,
-    -0.96420,
-    -0.97901,
-    -0.98043,
-    -0.96730,
-    -0.94607,
-    -0.92753,
-    -0.92131,
-    -0.93071,
-    -0.95075,
-    -0.97052,
-    -0.97870,
-    -0.96960,
-    -0.94653,
-    -0.92059,
-    -0.90527,
-    -0.90939,
-    -0.93194,
-    -0.96165,
-    -0.98195,
-    -0.97922,
-    -0.95040,
-    -0.90620,
-    -0.86751,
-    -0.85625,
-    -0.88416,
-    -0.94462,
-    -1.01152,
-    -1.04644,
-    -1.01166,
-    -0.88434,
-    -0.66588,
-    -0.38295,
-    -0.07939,
-    0.19774,
-    0.41275,
-    0.55096,
-    0.62035,
-    0.64503,
-    0.65401,
-    0.66994,
-    0.70223,
-    0.74664,
-    0.79055,
-    0.82087,
-    0.83080,
-    0.82256,
-    0.80556,
-    0.79123,
-    0.78757,
-    0.79579,
-    0.81061,
-    0.82357,
-    0.82754,
-    0.82018,
-    0.80472,
-    0.78800,
-    0.77686,
-    0.77484,
-    0.78075,
-    0.78964,
-    0.79546,
-    0.79417,
-    0.78548,
-    0.77272,
-    0.76088,
-    0.75404,
-    0.75338,
-    0.75686,
-    0.76042,
-    0.76023,
-    0.75459,
-    0.74468,
-    0.73378,
-    0.72552,
-    0.72200,
-    0.72280,
-    0.72532,
-    0.72622,
-    0.72310,
-    0.71572,
-    0.70602,
-    0.69705,
-    0.69136,
-    0.68975,
-    0.69092,
-    0.69219,
-    0.69092,
-    0.68583,
-    0.67762,
-    0.66855,
-    0.66129,
-    0.65752,
-    0.65710,
-    0.65822,
-    0.65829,
-    0.65527,
-    0.64872,
-    0.63998,
-    0.63148,
-    0.62560,
-    0.62343,
-    0.62436,
-    0.62633,
-    0.62694,
-    0.62456,
-    0.61908,
-    0.61191,
-    0.60514,
-    0.60050,
-    0.59846,
-    0.59808,
-    0.59751,
-    0.59508,
-    0.59019,
-    0.58368,
-    0.57746,
-    0.57349,
-    0.57277,
-    0.57475,
-    0.57752,
-    0.57872,
-    0.57671,
-    0.57143,
-    0.56447,
-    0.55832,
-    0.55512,
-    0.55560,
-    0.55867,
-    0.56195,
-    0.56299,
-    0.56053,
-    0.55522,
-    0.54932,
-    0.54553,
-    0.54556,
-    0.54910,
-    0.55390,
-    0.55683,
-    0.55555,
-    0.54989,
-    0.54218,
-    0.53619,
-    0.53527,
-    0.54045,
-    0.54960,
-    0.55823,
-    0.56162,
-    0.55732,
-    0.54675,
-    0.53491,
-    0.52815,
-    0.53093,
-    0.54312,
-    0.55940,
-    0.57132,
-    0.57137,
-    0.55719,
-    0.53385,
-    0.51263,
-    0.50637,
-    0.52306,
-    0.56035,
-    0.60383,
-    0.63021,
-    0.61483,
-    0.54080,
-    0.40605,
-    0.22548,
-    0.02691,
-    -0.15763,
-    -0.30216,
-    -0.39456,
-    -0.43894,
-    -0.45208,
-    -0.45548,
-    -0.46671,
-    -0.49338,
-    -0.53201,
-    -0.57178,
-    -0.60095,
-    -0.61287,
-    -0.60888,
-    -0.59706,
-    -0.58788,
-    -0.58899,
-    -0.60182,
-    -0.62148,
-    -0.63975,
-    -0.64952,
-    -0.64839,
-    -0.63960,
-    -0.63010,
-    -0.62672,
-    -0.63267,
-    -0.64604,
-    -0.66096,
-    -0.67091,
-    -0.67218,
-    -0.66580,
-    -0.65694,
-    -0.65213,
-    -0.65579,
-    -0.66789,
-    -0.68400,
-    -0.69765,
-    -0.70372,
-    -0.70113,
-    -0.69339,
-    -0.68673,
-    -0.68678,
-    -0.69561,
-    -0.71060,
-    -0.72582,
-    -0.73520,
-    -0.73574,
-    -0.72916,
-    -0.72103,
-    -0.71783,
-    -0.72349,
-    -0.73724,
-    -0.75391,
-    -0.76663,
-    -0.77050,
-    -0.76530,
-    -0.75570,
-    -0.74893,
-    -0.75094,
-    -0.76311,
-    -0.78132,
-    -0.79799,
-    -0.80603,
-    -0.80271,
-    -0.79142,
-    -0.78010,
-    -0.77716,
-    -0.78696,
-    -0.80710,
-    -0.82930,
-    -0.84351,
-    -0.84331,
-    -0.82973,
-    -0.81133,
-    -0.80021,
-    -0.80567,
-    -0.82872,
-    -0.86053,
-    -0.88602,
-    -0.89128,
-    -0.87143,
-    -0.83481,
-    -0.80077,
-    -0.79144,
-    -0.82046,
-    -0.88389,
-    -0.95759,
-    -1.00329,
-    -0.98146,
-    -0.86617,
-    -0.65598,
-    -0.37614,
-    -0.07108,
-    0.21000,
-    0.42893,
-    0.56947,
-    0.63962,
-    0.66490,
-    0.67610,
-    0.69690,
-    0.73628,
-    0.78833,
-    0.83841,
-    0.87222,
-    0.88330,
-    0.87562,
-    0.86083,
-    0.85187,
-    0.85661,
-    0.87450,
-    0.89776,
-    0.91600,
-    0.92182,
-    0.91444,
-    0.89971,
-    0.88670,
-    0.88289,
-    0.89038,
-    0.90515,
-    0.91946,
-    0.92608,
-    0.92200,
-    0.90989,
-    0.89644,
-    0.88875,
-    0.89061,
-    0.90069,
-    0.91336,
-    0.92185,
-    0.92178,
-    0.91345,
-    0.90149,
-    0.89234,
-    0.89080,
-    0.89754,
-    0.90881,
-    0.91855,
-    0.92163,
-    0.91650,
-    0.90601,
-    0.89572,
-    0.89092,
-    0.89376,
-    0.90207,
-    0.91058,
-    0.91374,
-    0.90876,
-    0.89716,
-    0.88401,
-    0.87532,
-    0.87477,
-    0.88177,
-    0.89166,
-    0.89816,
-    0.89663,
-    0.88663,
-    0.87215,
-    0.85959,
-    0.85434,
-    0.85787,
-    0.86686,
-    0.87488,
-    0.87579,
-    0.86714,
-    0.85164,
-    0.83593,
-    0.82713,
-    0.82894,
-    0.83944,
-    0.85173,
-    0.85743,
-    0.85114,
-    0.83367,
-    0.81215,
-    0.79664,
-    0.79494,
-    0.80801,
-    0.82869,
-    0.84455,
-    0.84410,
-    0.82313,
-    0.78827,
-    0.75523,
-    0.74208,
-    0.76000,
-    0.80573,
-    0.85937,
-    0.88917,
-    0.86217,
-    0.75650,
-    0.57068,
-    0.32578,
-    0.05947,
-    -0.18592,
-    -0.37683,
-    -0.49818,
-    -0.55598,
-    -0.57216,
-    -0.57427,
-    -0.58452,
-    -0.61252,
-    -0.65414,
-    -0.69636,
-    -0.72517,
-    -0.73281,
-    -0.72111,
-    -0.69995,
-    -0.68197,
-    -0.67637,
-    -0.68492,
-    -0.70180,
-    -0.71711,
-    -0.72216,
-    -0.71371,
-    -0.69535,
-    -0.67535,
-    -0.66238,
-    -0.66113,
-    -0.67025,
-    -0.68322,
-    -0.69188,
-    -0.69054,
-    -0.67873,
-    -0.66122,
-    -0.64542,
-    -0.63753,
-    -0.63949,
-    -0.64807,
-    -0.65680,
-    -0.65933,
-    -0.65276,
-    -0.63908,
-    -0.62406,
-    -0.61418,
-    -0.61320,
-    -0.62018,
-    -0.62991,
-    -0.63566,
-    -0.63271,
-    -0.62086,
-    -0.60467,
-    -0.59113,
-    -0.58605,
-    -0.59088,
-    -0.60184,
-    -0.61167,
-    -0.61337,
-    -0.60400,
-    -0.58648,
-    -0.56843,
-    -0.55848,
-    -0.56169,
-    -0.57655,
-    -0.59513,
-    -0.60665,
-    -0.60286,
-    -0.58271,
-    -0.55391,
-    -0.53021,
-    -0.52526,
-    -0.54562,
-    -0.58601,
-    -0.62918,
-    -0.65084,
-    -0.62803,
-    -0.54760,
-    -0.41154,
-    -0.23698,
-    -0.05083,
-    0.11880,
-    0.25109,
-    0.33786,
-    0.38404,
-    0.40365,
-    0.41319,
-    0.42546,
-    0.44587,
-    0.47243,
-    0.49872,
-    0.51806,
-    0.52695,
-    0.52641,
-    0.52098,
-    0.51624,
-    0.51618,
-    0.52172,
-    0.53080,
-    0.53987,
-    0.54579,
-    0.54727,
-    0.54517,
-    0.54181,
-    0.53963,
-    0.54006,
-    0.54299,
-    0.54707,
-    0.55056,
-    0.55224,
-    0.55196,
-    0.55067,
-    0.54984,
-    0.55084,
-    0.55429,
-    0.55987,
-    0.56647,
-    0.57261,
-    0.57701,
-    0.57901,
-    0.57882,
-    0.57742,
-    0.57626,
-    0.57675,
-    0.57970,
-    0.58503,
-    0.59167,
-    0.59799,
-    0.60240,
-    0.60411,
-    0.60355,
-    0.60226,
-    0.60229,
-    0.60518,
-    0.61121,
-    0.61907,
-    0.62638,
-    0.63083,
-    0.63136,
-    0.62884,
-    0.62581,
-    0.62535,
-    0.62948,
-    0.63806,
-    0.64861,
-    0.65751,
-    0.66175,
-    0.66067,
-    0.65649,
-    0.65341,
-    0.65550,
-    0.66439,
-    0.67815,
-    0.69188,
-    0.70004,
-    0.69948,
-    0.69147,
-    0.68163,
-    0.67745,
-    0.68442,
-    0.70269,
-    0.72606,
-    0.74436,
-    0.74833,
-    0.73487,
-    0.71007,
-    0.68785,
-    0.68426,
-    0.70932,
-    0.75998,
-    0.81761,
-    0.85192,
-    0.83057,
-    0.73098,
-    0.54989,
-    0.30647,
-    0.03746,
-    -0.21422,
-    -0.41302,
-    -0.54151,
-    -0.60411,
-    -0.62277,
-    -0.62667,
-    -0.64041,
-    -0.67542,
-    -0.72784,
-    -0.78310,
-    -0.82450,
-    -0.84173,
-    -0.83551,
-    -0.81652,
-    -0.79972,
-    -0.79709,
-    -0.81218,
-    -0.83919,
-    -0.86659,
-    -0.88319,
-    -0.88378,
-    -0.87137,
-    -0.85526,
-    -0.84603,
-    -0.85007,
-    -0.86651,
-    -0.88789,
-    -0.90420,
-    -0.90816,
-    -0.89890,
-    -0.88241,
-    -0.86833,
-    -0.86498,
-    -0.87509,
-    -0.89437,
-    -0.91380,
-    -0.92426,
-    -0.92128,
-    -0.90730,
-    -0.89046,
-    -0.88036,
-    -0.88305,
-    -0.89780,
-    -0.91746,
-    -0.93208,
-    -0.93416,
-    -0.92273,
-    -0.90401,
-    -0.88841,
-    -0.88506,
-    -0.89688,
-    -0.91867,
-    -0.93943,
-    -0.94789,
-    -0.93858,
-    -0.91513,
-    -0.88910,
-    -0.87444,
-    -0.88026,
-    -0.90550,
-    -0.93850,
-    -0.96199,
-    -0.96165,
-    -0.93409,
-    -0.89025,
-    -0.85177,
-    -0.84159,
-    -0.87221,
-    -0.93715,
-    -1.00959,
-    -1.04974,
-    -1.01844,
-    -0.89180,
-    -0.67116,
-    -0.38403,
-    -0.07574,
-    0.20522,
-    0.42225,
-    0.56068,
-    0.62924,
-    0.65316,
-    0.66234,
-    0.67980,
-    0.71464,
-    0.76198,
-    0.80858,
-    0.84106,
-    0.85276,
-    0.84625,
-    0.83121,
-    0.81901,
-    0.81729,
-    0.82682,
-    0.84207,
-    0.85482,
-    0.85856,
-    0.85163,
-    0.83766,
-    0.82324,
-    0.81441,
-    0.81370,
-    0.81925,
-    0.82614,
-    0.82918,
-    0.82563,
-    0.81635,
-    0.80508,
-    0.79630,
-    0.79285,
-    0.79459,
-    0.79868,
-    0.80128,
-    0.79961,
-    0.79330,
-    0.78450,
-    0.77650,
-    0.77198,
-    0.77158,
-    0.77365,
-    0.77524,
-    0.77365,
-    0.76791,
-    0.75916,
-    0.75002,
-    0.74316,
-    0.73997,
-    0.73987,
-    0.74074,
-    0.74007,
-    0.73629,
-    0.72950,
-    0.72136,
-    0.71412,
-    0.70945,
-    0.70761,
-    0.70738,
-    0.70677,
-    0.70410,
-    0.69883,
-    0.69182,
-    0.68475,
-    0.67927,
-    0.67611,
-    0.67477,
-    0.67383,
-    0.67172,
-    0.66758,
-    0.66162,
-    0.65499,
-    0.64913,
-    0.64502,
-    0.64271,
-    0.64131,
-    0.63948,
-    0.63615,
-    0.63104,
-    0.62478,
-    0.61859,
-    0.61366,
-    0.61062,
-    0.60925,
-    0.60866,
-    0.60770,
-    0.60553,
-    0.60191,
-    0.59728,
-    0.59251,
-    0.58842,
-    0.58549,
-    0.58364,
-    0.58234,
-    0.58085,
-    0.57856,
-    0.57521,
-    0.57098,
-    0.56642,
-    0.56219,
-    0.55886,
-    0.55667,
-    0.55547,
-    0.55477,
-    0.55394,
-    0.55245,
-    0.55011,
-    0.54711,
-    0.54399,
-    0.54133,
-    0.53948,
-    0.53841,
-    0.53766,
-    0.53661,
-    0.53484,
-    0.53239,
-    0.52987,
-    0.52816,
-    0.52801,
-    0.52955,
-    0.53210,
-    0.53441,
-    0.53514,
-    0.53356,
-    0.52995,
-    0.52553,
-    0.52194,
-    0.52047,
-    0.52139,
-    0.52385,
-    0.52625,
-    0.52710,
-    0.52579,
-    0.52297,
-    0.52019,
-    0.51907,
-    0.52040,
-    0.52358,
-    0.52693,
-    0.52852,
-    0.52727,
-    0.52366,
-    0.51964,
-    0.51765,
-    0.51937,
-    0.52473,
-    0.53181,
-    0.53774,
-    0.54019,
-    0.53867,
-    0.53487,
-    0.53190,
-    0.53261,
-    0.53800,
-    0.54651,
-    0.55468,
-    0.55897,
-    0.55770,
-    0.55218,
-    0.54627,
-    0.54440,
-    0.54915,
-    0.55960,
-    0.57148,
-    0.57925,
-    0.57908,
-    0.57132,
-    0.56081,
-    0.55476,
-    0.55902,
-    0.57451,
-    0.59592,
-    0.61366,
-    0.61848,
-    0.60670,
-    0.58334,
-    0.56116,
-    0.55532,
-    0.57569,
-    0.62017,
-    0.67228,
-    0.70495,
-    0.68940,
-    0.60606,
-    0.45289,
-    0.24774,
-    0.02321,
-    -0.18388,
-    -0.34456,
-    -0.44637,
-    -0.49546,
-    -0.51170,
-    -0.51914,
-    -0.53617,
-    -0.56933,
-    -0.61307,
-    -0.65485,
-    -0.68261,
-    -0.69109,
-    -0.68402,
-    -0.67167,
-    -0.66540,
-    -0.67199,
-    -0.69079,
-    -0.71466,
-    -0.73417,
-    -0.74258,
-    -0.73909,
-    -0.72892,
-    -0.72024,
-    -0.71979,
-    -0.72948,
-    -0.74574,
-    -0.76166,
-    -0.77082,
-    -0.77070,
-    -0.76381,
-    -0.75617,
-    -0.75399,
-    -0.76036,
-    -0.77368,
-    -0.78870,
-    -0.79943,
-    -0.80235,
-    -0.79821,
-    -0.79151,
-    -0.78793,
-    -0.79118,
-    -0.80106,
-    -0.81358,
-    -0.82327,
-    -0.82624,
-    -0.82240,
-    -0.81555,
-    -0.81132,
-    -0.81412,
-    -0.82462,
-    -0.83927,
-    -0.85214,
-    -0.85803,
-    -0.85534,
-    -0.84696,
-    -0.83888,
-    -0.83698,
-    -0.84393,
-    -0.85768,
-    -0.87253,
-    -0.88208,
-    -0.88268,
-    -0.87542,
-    -0.86556,
-    -0.85978,
-    -0.86252,
-    -0.87352,
-    -0.88783,
-    -0.89837,
-    -0.89978,
-    -0.89141,
-    -0.87792,
-    -0.86692,
-    -0.86506,
-    -0.87434,
-    -0.89090,
-    -0.90685,
-    -0.91438,
-    -0.90999,
-    -0.89653,
-    -0.88190,
-    -0.87491,
-    -0.88049,
-    -0.89667,
-    -0.91527,
-    -0.92601,
-    -0.92210,
-    -0.90433,
-    -0.88134,
-    -0.86560,
-    -0.86688,
-    -0.88654,
-    -0.91576,
-    -0.93918,
-    -0.94246,
-    -0.92033,
-    -0.88094,
-    -0.84371,
-    -0.83093,
-    -0.85637,
-    -0.91606,
-    -0.98572,
-    -1.02702,
-    -1.00055,
-    -0.88077,
-    -0.66683,
-    -0.38460,
-    -0.07888,
-    0.20110,
-    0.41750,
-    0.55461,
-    0.62098,
-    0.64254,
-    0.65038,
-    0.66834,
-    0.70553,
-    0.75608,
-    0.80520,
-    0.83817,
-    0.84782,
-    0.83738,
-    0.81801,
-    0.80275,
-    0.80029,
-    0.81143,
-    0.82971,
-    0.84549,
-    0.85105,
-    0.84434,
-    0.82941,
-    0.81383,
-    0.80460,
-    0.80467,
-    0.81182,
-    0.82026,
-    0.82392,
-    0.81966,
-    0.80863,
-    0.79549,
-    0.78571,
-    0.78268,
-    0.78609,
-    0.79226,
-    0.79628,
-    0.79458,
-    0.78680,
-    0.77580,
-    0.76602,
-    0.76107,
-    0.76184,
-    0.76612,
-    0.76981,
-    0.76914,
-    0.76260,
-    0.75173,
-    0.74022,
-    0.73199,
-    0.72914,
-    0.73098,
-    0.73440,
-    0.73557,
-    0.73193,
-    0.72348,
-    0.71269,
-    0.70319,
-    0.69786,
-    0.69732,
-    0.69973,
-    0.70174,
-    0.70028,
-    0.69415,
-    0.68460,
-    0.67462,
-    0.66739,
-    0.66459,
-    0.66558,
-    0.66773,
-    0.66788,
-    0.66394,
-    0.65598,
-    0.64619,
-    0.63766,
-    0.63280,
-    0.63203,
-    0.63363,
-    0.63465,
-    0.63251,
-    0.62642,
-    0.61780,
-    0.60960,
-    0.60469,
-    0.60431,
-    0.60734,
-    0.61076,
-    0.61116,
-    0.60650,
-    0.59719,
-    0.58601,
-    0.57675,
-    0.57233,
-    0.57332,
-    0.57766,
-    0.58162,
-    0.58172,
-    0.57643,
-    0.56700,
-    0.55675,
-    0.54945,
-    0.54731,
-    0.54994,
-    0.55450,
-    0.55724,
-    0.55544,
-    0.54888,
-    0.53995,
-    0.53242,
-    0.52940,
-    0.53163,
-    0.53702,
-    0.54168,
-    0.54193,
-    0.53635,
-    0.52668,
-    0.51703,
-    0.51185,
-    0.51354,
-    0.52106,
-    0.53023,
-    0.53582,
-    0.53414,
-    0.52517,
-    0.51269,
-    0.50258,
-    0.49984,
-    0.50593,
-    0.51779,
-    0.52921,
-    0.53389,
-    0.52876,
-    0.51587,
-    0.50163,
-    0.49378,
-    0.49731,
-    0.51154,
-    0.52987,
-    0.54267,
-    0.54199,
-    0.52609,
-    0.50127,
-    0.47980,
-    0.47460,
-    0.49260,
-    0.52994,
-    0.57125,
-    0.59379,
-    0.57515,
-    0.50152,
-    0.37331,
-    0.20585,
-    0.02467,
-    -0.14250,
-    -0.27433,
-    -0.36156,
-    -0.40807,
-    -0.42730,
-    -0.43589,
-    -0.44728,
-    -0.46759,
-    -0.49525,
-    -0.52372,
-    -0.54578,
-    -0.55722,
-    -0.55862,
-    -0.55448,
-    -0.55076,
-    -0.55201,
-    -0.55953,
-    -0.57130,
-    -0.58338,
-    -0.59207,
-    -0.59562,
-    -0.59480,
-    -0.59228,
-    -0.59106,
-    -0.59311,
-    -0.59850,
-    -0.60564,
-    -0.61223,
-    -0.61648,
-    -0.61795,
-    -0.61766,
-    -0.61752,
-    -0.61934,
-    -0.62398,
-    -0.63089,
-    -0.63848,
-    -0.64474,
-    -0.64826,
-    -0.64877,
-    -0.64736,
-    -0.64594,
-    -0.64647,
-    -0.65011,
-    -0.65671,
-    -0.66489,
-    -0.67259,
-    -0.67802,
-    -0.68046,
-    -0.68058,
-    -0.68018,
-    -0.68138,
-    -0.68555,
-    -0.69268,
-    -0.70128,
-    -0.70903,
-    -0.71393,
-    -0.71531,
-    -0.71428,
-    -0.71327,
-    -0.71486,
-    -0.72046,
-    -0.72947,
-    -0.73941,
-    -0.74704,
-    -0.74999,
-    -0.74803,
-    -0.74339,
-    -0.73977,
-    -0.74056,
-    -0.74708,
-    -0.75782,
-    -0.76904,
-    -0.77664,
-    -0.77834,
-    -0.77495,
-    -0.77018,
-    -0.76874,
-    -0.77389,
-    -0.78546,
-    -0.79966,
-    -0.81077,
-    -0.81415,
-    -0.80882,
-    -0.79837,
-    -0.78952,
-    -0.78878,
-    -0.79897,
-    -0.81736,
-    -0.83662,
-    -0.84829,
-    -0.84728,
-    -0.83485,
-    -0.81864,
-    -0.80911,
-    -0.81415,
-    -0.83440,
-    -0.86190,
-    -0.88329,
-    -0.88635,
-    -0.86693,
-    -0.83273,
-    -0.80139,
-    -0.79306,
-    -0.82013,
-    -0.87873,
-    -0.94618,
-    -0.98641,
-    -0.96184,
-    -0.84748,
-    -0.64150,
-    -0.36775,
-    -0.06902,
-    0.20667,
-    0.42137,
-    0.55825,
-    0.62443,
-    0.64490,
-    0.65071,
-    0.66652,
-    0.70255,
-    0.75369,
-    0.80518,
-    0.84162,
-    0.85490,
-    0.84756,
-    0.83064,
-    0.81766,
-    0.81793,
-    0.83260,
-    0.85497,
-    0.87463,
-    0.88305,
-    0.87772,
-    0.86297,
-    0.84736,
-    0.83905,
-    0.84179,
-    0.85342,
-    0.86737,
-    0.87634,
-    0.87607,
-    0.86730,
-    0.85503,
-    0.84569,
-    0.84368,
-    0.84923,
-    0.85845,
-    0.86560,
-    0.86615,
-    0.85911,
-    0.84742,
-    0.83627,
-    0.83036,
-    0.83152,
-    0.83785,
-    0.84490,
-    0.84805,
-    0.84484,
-    0.83616,
-    0.82558,
-    0.81735,
-    0.81420,
-    0.81594,
-    0.81976,
-    0.82188,
-    0.81963,
-    0.81286,
-    0.80402,
-    0.79673,
-    0.79378,
-    0.79562,
-    0.80005,
-    0.80338,
-    0.80242,
-    0.79611,
-    0.78616,
-    0.77620,
-    0.76985,
-    0.76890,
-    0.77239,
-    0.77704,
-    0.77894,
-    0.77554,
-    0.76690,
-    0.75565,
-    0.74563,
-    0.74000,
-    0.73967,
-    0.74294,
-    0.74646,
-    0.74695,
-    0.74284,
-    0.73499,
-    0.72612,
-    0.71931,
-    0.71634,
-    0.71682,
-    0.71842,
-    0.71820,
-    0.71415,
-    0.70632,
-    0.69676,
-    0.68847,
-    0.68377,
-    0.68311,
-    0.68480,
-    0.68588,
-    0.68373,
-    0.67738,
-    0.66810,
-    0.65870,
-    0.65209,
-    0.64971,
-    0.65081,
-    0.65277,
-    0.65252,
-    0.64810,
-    0.63974,
-    0.62973,
-    0.62123,
-    0.61667,
-    0.61642,
-    0.61861,
-    0.62018,
-    0.61845,
-    0.61264,
-    0.60427,
-    0.59638,
-    0.59184,
-    0.59174,
-    0.59465,
-    0.59728,
-    0.59619,
-    0.58970,
-    0.57895,
-    0.56750,
-    0.55963,
-    0.55806,
-    0.56243,
-    0.56924,
-    0.57350,
-    0.57129,
-    0.56183,
-    0.54814,
-    0.53566,
-    0.52957,
-    0.53201,
-    0.54082,
-    0.55037,
-    0.55438,
-    0.54915,
-    0.53579,
-    0.51994,
-    0.50911,
-    0.50877,
-    0.51917,
-    0.53464,
-    0.54599,
-    0.54511,
-    0.52951,
-    0.50463,
-    0.48219,
-    0.47513,
-    0.49090,
-    0.52633,
-    0.56656,
-    0.58889,
-    0.57060,
-    0.49748,
-    0.36989,
-    0.20351,
-    0.02460,
-    -0.13856,
-    -0.26463,
-    -0.34512,
-    -0.38530,
-    -0.39999,
-    -0.40659,
-    -0.41820,
-    -0.43968,
-    -0.46777,
-    -0.49466,
-    -0.51291,
-    -0.51929,
-    -0.51599,
-    -0.50900,
-    -0.50481,
-    -0.50721,
-    -0.51590,
-    -0.52717,
-    -0.53627,
-    -0.53998,
-    -0.53812,
-    -0.53333,
-    -0.52938,
-    -0.52907,
-    -0.53286,
-    -0.53885,
-    -0.54406,
-    -0.54612,
-    -0.54461,
-    -0.54112,
-    -0.53831,
-    -0.53839,
-    -0.54196,
-    -0.54780,
-    -0.55367,
-    -0.55760,
-    -0.55901,
-    -0.55891,
-    -0.55922,
-    -0.56163,
-    -0.56653,
-    -0.57277,
-    -0.57831,
-    -0.58136,
-    -0.58143,
-    -0.57963,
-    -0.57812,
-    -0.57897,
-    -0.58304,
-    -0.58955,
-    -0.59649,
-    -0.60173,
-    -0.60414,
-    -0.60412,
-    -0.60337,
-    -0.60393,
-    -0.60703,
-    -0.61249,
-    -0.61885,
-    -0.62419,
-    -0.62722,
-    -0.62795,
-    -0.62764,
-    -0.62809,
-    -0.63061,
-    -0.63535,
-    -0.64126,
-    -0.64677,
-    -0.65073,
-    -0.65303,
-    -0.65470,
-    -0.65720,
-    -0.66157,
-    -0.66769,
-    -0.67430,
-    -0.67965,
-    -0.68249,
-    -0.68283,
-    -0.68199,
-    -0.68195,
-    -0.68428,
-    -0.68933,
-    -0.69600,
-    -0.70239,
-    -0.70686,
-    -0.70898,
-    -0.70973,
-    -0.71099,
-    -0.71440,
-    -0.72040,
-    -0.72791,
-    -0.73486,
-    -0.73942,
-    -0.74104,
-    -0.74087,
-    -0.74119,
-    -0.74418,
-    -0.75058,
-    -0.75918,
-    -0.76732,
-    -0.77228,
-    -0.77281,
-    -0.76992,
-    -0.76651,
-    -0.76590,
-    -0.77012,
-    -0.77877,
-    -0.78911,
-    -0.79752,
-    -0.80137,
-    -0.80048,
-    -0.79723,
-    -0.79530,
-    -0.79762,
-    -0.80475,
-    -0.81443,
-    -0.82282,
-    -0.82664,
-    -0.82507,
-    -0.82040,
-    -0.81688,
-    -0.81839,
-    -0.82611,
-    -0.83765,
-    -0.84807,
-    -0.85249,
-    -0.84896,
-    -0.83980,
-    -0.83078,
-    -0.82813,
-    -0.83508,
-    -0.84968,
-    -0.86531,
-    -0.87391,
-    -0.87033,
-    -0.85559,
-    -0.83711,
-    -0.82538,
-    -0.82854,
-    -0.84751,
-    -0.87445,
-    -0.89580,
-    -0.89889,
-    -0.87908,
-    -0.84378,
-    -0.81072,
-    -0.80042,
-    -0.82575,
-    -0.88319,
-    -0.95011,
-    -0.99019,
-    -0.96551,
-    -0.85088,
-    -0.64452,
-    -0.37060,
-    -0.07226,
-    0.20226,
-    0.41514,
-    0.54996,
-    0.61437,
-    0.63373,
-    0.63913,
-    0.65491,
-    0.69082,
-    0.74133,
-    0.79157,
-    0.82632,
-    0.83780,
-    0.82880,
-    0.81030,
-    0.79547,
-    0.79317,
-    0.80432,
-    0.82242,
-    0.83779,
-    0.84284,
-    0.83589,
-    0.82150,
-    0.80767,
-    0.80144,
-    0.80526,
-    0.81602,
-    0.82702,
-    0.83166,
-    0.82693,
-    0.81480,
-    0.80102,
-    0.79188,
-    0.79098,
-    0.79740,
-    0.80636,
-    0.81185,
-    0.80978,
-    0.80006,
-    0.78649,
-    0.77472,
-    0.76922,
-    0.77108,
-    0.77754,
-    0.78357,
-    0.78453,
-    0.77858,
-    0.76749,
-    0.75565,
-    0.74771,
-    0.74615,
-    0.75012,
-    0.75593,
-    0.75907,
-    0.75649,
-    0.74810,
-    0.73668,
-    0.72636,
-    0.72046,
-    0.71987,
-    0.72275,
-    0.72567,
-    0.72549,
-    0.72094,
-    0.71320,
-    0.70511,
-    0.69951,
-    0.69768,
-    0.69871,
-    0.70003,
-    0.69885,
-    0.69373,
-    0.68534,
-    0.67608,
-    0.66881,
-    0.66528,
-    0.66523,
-    0.66657,
-    0.66649,
-    0.66298,
-    0.65590,
-    0.64701,
-    0.63900,
-    0.63401,
-    0.63254,
-    0.63316,
-    0.63341,
-    0.63107,
-    0.62549,
-    0.61789,
-    0.61072,
-    0.60634,
-    0.60567,
-    0.60765,
-    0.60974,
-    0.60922,
-    0.60461,
-    0.59648,
-    0.58710,
-    0.57932,
-    0.57508,
-    0.57442,
-    0.57553,
-    0.57577,
-    0.57308,
-    0.56715,
-    0.55955,
-    0.55284,
-    0.54919,
-    0.54912,
-    0.55116,
-    0.55262,
-    0.55104,
-    0.54552,
-    0.53734,
-    0.52930,
-    0.52434,
-    0.52394,
-    0.52730,
-    0.53169,
-    0.53383,
-    0.53157,
-    0.52505,
-    0.51660,
-    0.50960,
-    0.50670,
-    0.50842,
-    0.51289,
-    0.51688,
-    0.51748,
-    0.51371,
-    0.50702,
-    0.50057,
-    0.49744,
-    0.49897,
-    0.50392,
-    0.50910,
-    0.51104,
-    0.50792,
-    0.50074,
-    0.49286,
-    0.48835,
-    0.48980,
-    0.49675,
-    0.50580,
-    0.51220,
-    0.51236,
-    0.50583,
-    0.49572,
-    0.48730,
-    0.48526,
-    0.49115,
-    0.50234,
-    0.51312,
-    0.51755,
-    0.51265,
-    0.50028,
-    0.48653,
-    0.47885,
-    0.48216,
-    0.49591,
-    0.51374,
-    0.52624,
-    0.52562,
-    0.51015,
-    0.48609,
-    0.46570,
-    0.46197,
-    0.48195,
-    0.52181,
-    0.56597,
-    0.59126,
-    0.57462,
-    0.50166,
-    0.37256,
-    0.20291,
-    0.01906,
-    -0.15023,
-    -0.28267,
-    -0.36855,
-    -0.41206,
-    -0.42764,
-    -0.43318,
-    -0.44321,
-    -0.46432,
-    -0.49462,
-    -0.52660,
-    -0.55187,
-    -0.56537,
-    -0.56737,
-    -0.56275,
-    -0.55817,
-    -0.55877,
-    -0.56608,
-    -0.57772,
-    -0.58916,
-    -0.59624,
-    -0.59722,
-    -0.59355,
-    -0.58892,
-    -0.58736,
-    -0.59118,
-    -0.60003,
-    -0.61117,
-    -0.62092,
-    -0.62654,
-    -0.62744,
-    -0.62537,
-    -0.62346,
-    -0.62461,
-    -0.63007,
-    -0.63885,
-    -0.64830,
-    -0.65537,
-    -0.65813,
-    -0.65671,
-    -0.65321,
-    -0.65070,
-    -0.65178,
-    -0.65738,
-    -0.66633,
-    -0.67595,
-    -0.68337,
-    -0.68688,
-    -0.68673,
-    -0.68499,
-    -0.68450,
-    -0.68750,
-    -0.69450,
-    -0.70400,
-    -0.71323,
-    -0.71946,
-    -0.72134,
-    -0.71957,
-    -0.71655,
-    -0.71523,
-    -0.71767,
-    -0.72402,
-    -0.73251,
-    -0.74036,
-    -0.74525,
-    -0.74648,
-    -0.74534,
-    -0.74445,
-    -0.74626,
-    -0.75178,
-    -0.75987,
-    -0.76783,
-    -0.77281,
-    -0.77338,
-    -0.77048,
-    -0.76709,
-    -0.76677,
-    -0.77181,
-    -0.78188,
-    -0.79397,
-    -0.80380,
-    -0.80792,
-    -0.80556,
-    -0.79915,
-    -0.79322,
-    -0.79211,
-    -0.79773,
-    -0.80841,
-    -0.81968,
-    -0.82649,
-    -0.82596,
-    -0.81902,
-    -0.81011,
-    -0.80504,
-    -0.80786,
-    -0.81862,
-    -0.83303,
-    -0.84454,
-    -0.84770,
-    -0.84125,
-    -0.82909,
-    -0.81854,
-    -0.81666,
-    -0.82628,
-    -0.84411,
-    -0.86194,
-    -0.87060,
-    -0.86487,
-    -0.84671,
-    -0.82496,
-    -0.81129,
-    -0.81429,
-    -0.83444,
-    -0.86295,
-    -0.88534,
-    -0.88853,
-    -0.86813,
-    -0.83218,
-    -0.79888,
-    -0.78878,
-    -0.81420,
-    -0.87092,
-    -0.93596,
-    -0.97346,
-    -0.94682,
-    -0.83244,
-    -0.62972,
-    -0.36282,
-    -0.07351,
-    0.19228,
-    0.39903,
-    0.53161,
-    0.59729,
-    0.61955,
-    0.62695,
-    0.64182,
-    0.67336,
-    0.71726,
-    0.76100,
-    0.79177,
-    0.80307,
-    0.79730,
-    0.78359,
-    0.77277,
-    0.77204,
-    0.78208,
-    0.79761,
-    0.81081,
-    0.81555,
-    0.81025,
-    0.79824,
-    0.78557,
-    0.77778,
-    0.77725,
-    0.78244,
-    0.78915,
-    0.79294,
-    0.79137,
-    0.78493,
-    0.77638,
-    0.76906,
-    0.76511,
-    0.76456,
-    0.76566,
-    0.76610,
-    0.76426,
-    0.76002,
-    0.75452,
-    0.74932,
-    0.74549,
-    0.74311,
-    0.74142,
-    0.73952,
-    0.73691,
-    0.73380,
-    0.73077,
-    0.72821,
-    0.72600,
-    0.72346,
-    0.71986,
-    0.71501,
-    0.70954,
-    0.70459,
-    0.70118,
-    0.69950,
-    0.69864,
-    0.69708,
-    0.69363,
-    0.68827,
-    0.68232,
-    0.67782,
-    0.67623,
-    0.67730,
-    0.67883,
-    0.67767,
-    0.67149,
-    0.66043,
-    0.64763,
-    0.63794,
-    0.63550,
-    0.64105,
-    0.65080,
-    0.65764,
-    0.65453,
-    0.63850,
-    0.61342,
-    0.58943,
-    0.57893,
-    0.59032,
-    0.62221,
-    0.66108,
-    0.68389,
-    0.66541,
-    0.58762,
-    0.44745,
-    0.25941,
-    0.05199,
-    -0.14138,
-    -0.29303,
-    -0.38953,
-    -0.43455,
-    -0.44533,
-    -0.44448,
-    -0.45082,
-    -0.47279,
-    -0.50720,
-    -0.54291,
-    -0.56759,
-    -0.57407,
-    -0.56354,
-    -0.54443,
-    -0.52789,
-    -0.52238,
-    -0.52994,
-    -0.54578,
-    -0.56127,
-    -0.56846,
-    -0.56393,
-    -0.55025,
-    -0.53423,
-    -0.52337,
-    -0.52203,
-    -0.52948,
-    -0.54053,
-    -0.54839,
-    -0.54814,
-    -0.53915,
-    -0.52527,
-    -0.51270,
-    -0.50681,
-    -0.50948,
-    -0.51821,
-    -0.52755,
-    -0.53190,
-    -0.52843,
-    -0.51851,
-    -0.50700,
-    -0.49979,
-    -0.50070,
-    -0.50947,
-    -0.52172,
-    -0.53097,
-    -0.53188,
-    -0.52298,
-    -0.50772,
-    -0.49299,
-    -0.48593,
-    -0.49039,
-    -0.50470,
-    -0.52209,
-    -0.53356,
-    -0.53224,
-    -0.51705,
-    -0.49409,
-    -0.47457,
-    -0.47006,
-    -0.48671,
-    -0.52101,
-    -0.55905,
-    -0.58008,
-    -0.56323,
-    -0.49511,
-    -0.37534,
-    -0.21762,
-    -0.04597,
-    0.11275,
-    0.23716,
-    0.31756,
-    0.35761,
-    0.37124,
-    0.37617,
-    0.38683,
-    0.40954,
-    0.44157,
-    0.47420,
-    0.49791,
-    0.50730,
-    0.50351,
-    0.49328,
-    0.48531,
-    0.48602,
-    0.49663,
-    0.51302,
-    0.52819,
-    0.53607,
-    0.53456,
-    0.52646,
-    0.51783,
-    0.51473,
-    0.52010,
-    0.53234,
-    0.54630,
-    0.55608,
-    0.55814,
-    0.55313,
-    0.54544,
-    0.54079,
-    0.54323,
-    0.55292,
-    0.56615,
-    0.57734,
-    0.58204,
-    0.57930,
-    0.57220,
-    0.56617,
-    0.56608,
-    0.57360,
-    0.58630,
-    0.59890,
-    0.60616,
-    0.60564,
-    0.59911,
-    0.59161,
-    0.58876,
-    0.59377,
-    0.60568,
-    0.61983,
-    0.63040,
-    0.63355,
-    0.62958,
-    0.62279,
-    0.61920,
-    0.62315,
-    0.63488,
-    0.65015,
-    0.66244,
-    0.66646,
-    0.66120,
-    0.65065,
-    0.64191,
-    0.64149,
-    0.65167,
-    0.66913,
-    0.68649,
-    0.69618,
-    0.69458,
-    0.68422,
-    0.67269,
-    0.66865,
-    0.67709,
-    0.69625,
-    0.71805,
-    0.73214,
-    0.73149,
-    0.71661,
-    0.69602,
-    0.68235,
-    0.68581,
-    0.70828,
-    0.74135,
-    0.76973,
-    0.77869,
-    0.76224,
-    0.72766,
-    0.69355,
-    0.68179,
-    0.70633,
-    0.76413,
-    0.83268,
-    0.87594,
-    0.85695,
-    0.75204,
-    0.56089,
-    0.30798,
-    0.03489,
-    -0.21368,
-    -0.40439,
-    -0.52471,
-    -0.58385,
-    -0.60579,
-    -0.61772,
-    -0.63926,
-    -0.67659,
-    -0.72333,
-    -0.76661,
-    -0.79501,
-    -0.80434,
-    -0.79898,
-    -0.78880,
-    -0.78379,
-    -0.78922,
-    -0.80385,
-    -0.82147,
-    -0.83480,
-    -0.83936,
-    -0.83540,
-    -0.82719,
-    -0.82030,
-    -0.81856,
-    -0.82233,
-    -0.82882,
-    -0.83408,
-    -0.83531,
-    -0.83236,
-    -0.82744,
-    -0.82364,
-    -0.82302,
-    -0.82552,
-    -0.82923,
-    -0.83170,
-    -0.83151,
-    -0.82906,
-    -0.82618,
-    -0.82491,
-    -0.82610,
-    -0.82889,
-    -0.83128,
-    -0.83148,
-    -0.82913,
-    -0.82567,
-    -0.82347,
-    -0.82430,
-    -0.82799,
-    -0.83226,
-    -0.83390,
-    -0.83074,
-    -0.82322,
-    -0.81455,
-    -0.80921,
-    -0.81039,
-    -0.81787,
-    -0.82763,
-    -0.83368,
-    -0.83124,
-    -0.81973,
-    -0.80371,
-    -0.79096,
-    -0.78844,
-    -0.79808,
-    -0.81484,
-    -0.82842,
-    -0.82828,
-    -0.80969,
-    -0.77767,
-    -0.74631,
-    -0.73292,
-    -0.74931,
-    -0.79373,
-    -0.84789,
-    -0.88086,
-    -0.85928,
-    -0.76002,
-    -0.58014,
-    -0.33987,
-    -0.07696,
-    0.16549,
-    0.35315,
-    0.47071,
-    0.52474,
-    0.53823,
-    0.53958,
-    0.55112,
-    0.58157,
-    0.62542,
-    0.66839,
-    0.69607,
-    0.70132,
-    0.68731,
-    0.66521,
-    0.64820,
-    0.64505,
-    0.65639,
-    0.67523,
-    0.69118,
-    0.69593,
-    0.68723,
-    0.66959,
-    0.65148,
-    0.64085,
-    0.64119,
-    0.65011,
-    0.66098,
-    0.66664,
-    0.66302,
-    0.65104,
-    0.63578,
-    0.62362,
-    0.61885,
-    0.62159,
-    0.62797,
-    0.63234,
-    0.63038,
-    0.62125,
-    0.60800,
-    0.59581,
-    0.58927,
-    0.59003,
-    0.59603,
-    0.60262,
-    0.60503,
-    0.60069,
-    0.59046,
-    0.57804,
-    0.56796,
-    0.56332,
-    0.56432,
-    0.56835,
-    0.57147,
-    0.57053,
-    0.56469,
-    0.55573,
-    0.54697,
-    0.54149,
-    0.54048,
-    0.54276,
-    0.54547,
-    0.54565,
-    0.54176,
-    0.53446,
-    0.52617,
-    0.51971,
-    0.51685,
-    0.51739,
-    0.51936,
-    0.52012,
-    0.51781,
-    0.51234,
-    0.50541,
-    0.49961,
-    0.49700,
-    0.49798,
-    0.50108,
-    0.50370,
-    0.50341,
-    0.49930,
-    0.49239,
-    0.48522,
-    0.48051,
-    0.47987,
-    0.48293,
-    0.48755,
-    0.49090,
-    0.49084,
-    0.48700,
-    0.48090,
-    0.47514,
-    0.47213,
-    0.47281,
-    0.47629,
-    0.48030,
-    0.48242,
-    0.48136,
-    0.47759,
-    0.47309,
-    0.47031,
-    0.47080,
-    0.47441,
-    0.47931,
-    0.48290,
-    0.48322,
-    0.47997,
-    0.47477,
-    0.47034,
-    0.46910,
-    0.47185,
-    0.47726,
-    0.48252,
-    0.48474,
-    0.48254,
-    0.47689,
-    0.47077,
-    0.46774,
-    0.47004,
-    0.47733,
-    0.48665,
-    0.49376,
-    0.49528,
-    0.49050,
-    0.48199,
-    0.47450,
-    0.47261,
-    0.47836,
-    0.48997,
-    0.50248,
-    0.51011,
-    0.50927,
-    0.50067,
-    0.48935,
-    0.48239,
-    0.48538,
-    0.49914,
-    0.51877,
-    0.53551,
-    0.54099,
-    0.53180,
-    0.51222,
-    0.49328,
-    0.48807,
-    0.50512,
-    0.54268,
-    0.58669,
-    0.61399,
-    0.59989,
-    0.52745,
-    0.39468,
-    0.21661,
-    0.02108,
-    -0.16010,
-    -0.30152,
-    -0.39174,
-    -0.43542,
-    -0.44942,
-    -0.45480,
-    -0.46820,
-    -0.49623,
-    -0.53482,
-    -0.57317,
-    -0.60026,
-    -0.61045,
-    -0.60594,
-    -0.59509,
-    -0.58789,
-    -0.59101,
-    -0.60486,
-    -0.62400,
-    -0.64045,
-    -0.64798,
-    -0.64529,
-    -0.63642,
-    -0.62839,
-    -0.62744,
-    -0.63580,
-    -0.65071,
-    -0.66606,
-    -0.67576,
-    -0.67688,
-    -0.67117,
-    -0.66399,
-    -0.66133,
-    -0.66668,
-    -0.67914,
-    -0.69398,
-    -0.70516,
-    -0.70853,
-    -0.70401,
-    -0.69558,
-    -0.68921,
-    -0.68968,
-    -0.69817,
-    -0.71171,
-    -0.72481,
-    -0.73244,
-    -0.73262,
-    -0.72741,
-    -0.72168,
-    -0.72043,
-    -0.72603,
-    -0.73699,
-    -0.74879,
-    -0.75640,
-    -0.75712,
-    -0.75210,
-    -0.74575,
-    -0.74333,
-    -0.74801,
-    -0.75896,
-    -0.77168,
-    -0.78037,
-    -0.78114,
-    -0.77431,
-    -0.76453,
-    -0.75843,
-    -0.76111,
-    -0.77316,
-    -0.79007,
-    -0.80431,
-    -0.80915,
-    -0.80242,
-    -0.78787,
-    -0.77360,
-    -0.76798,
-    -0.77520,
-    -0.79277,
-    -0.81252,
-    -0.82463,
-    -0.82285,
-    -0.80819,
-    -0.78889,
-    -0.77654,
-    -0.77996,
-    -0.80006,
-    -0.82840,
-    -0.85066,
-    -0.85374,
-    -0.83310,
-    -0.79655,
-    -0.76215,
-    -0.75039,
-    -0.77376,
-    -0.82844,
-    -0.89213,
-    -0.92982,
-    -0.90568,
-    -0.79664,
-    -0.60205,
-    -0.34544,
-    -0.06745,
-    0.18741,
-    0.38491,
-    0.51080,
-    0.57264,
-    0.59362,
-    0.60155,
-    0.61787,
-    0.65091,
-    0.69575,
-    0.73955,
-    0.76956,
-    0.77962,
-    0.77262,
-    0.75822,
-    0.74753,
-    0.74773,
-    0.75909,
-    0.77573,
-    0.78930,
-    0.79352,
-    0.78724,
-    0.77461,
-    0.76258,
-    0.75713,
-    0.76027,
-    0.76929,
-    0.77848,
-    0.78226,
-    0.77809,
-    0.76760,
-    0.75561,
-    0.74743,
-    0.74613,
-    0.75105,
-    0.75824,
-    0.76267,
-    0.76082,
-    0.75246,
-    0.74064,
-    0.73002,
-    0.72447,
-    0.72513,
-    0.72989,
-    0.73466,
-    0.73548,
-    0.73055,
-    0.72110,
-    0.71063,
-    0.70306,
-    0.70071,
-    0.70315,
-    0.70749,
-    0.70992,
-    0.70771,
-    0.70057,
-    0.69074,
-    0.68183,
-    0.67692,
-    0.67701,
-    0.68054,
-    0.68421,
-    0.68462,
-    0.68004,
-    0.67115,
-    0.66072,
-    0.65215,
-    0.64781,
-    0.64793,
-    0.65059,
-    0.65277,
-    0.65190,
-    0.64713,
-    0.63966,
-    0.63198,
-    0.62653,
-    0.62440,
-    0.62478,
-    0.62543,
-    0.62390,
-    0.61885,
-    0.61077,
-    0.60179,
-    0.59457,
-    0.59100,
-    0.59120,
-    0.59352,
-    0.59530,
-    0.59428,
-    0.58961,
-    0.58227,
-    0.57449,
-    0.56853,
-    0.56556,
-    0.56511,
-    0.56536,
-    0.56423,
-    0.56048,
-    0.55441,
-    0.54771,
-    0.54248,
-    0.54010,
-    0.54042,
-    0.54178,
-    0.54186,
-    0.53895,
-    0.53291,
-    0.52527,
-    0.51856,
-    0.51487,
-    0.51477,
-    0.51689,
-    0.51854,
-    0.51718,
-    0.51174,
-    0.50340,
-    0.49505,
-    0.48992,
-    0.48981,
-    0.49408,
-    0.49975,
-    0.50291,
-    0.50072,
-    0.49294,
-    0.48226,
-    0.47309,
-    0.46936,
-    0.47245,
-    0.48032,
-    0.48833,
-    0.49150,
-    0.48718,
-    0.47656,
-    0.46441,
-    0.45680,
-    0.45794,
-    0.46771,
-    0.48120,
-    0.49077,
-    0.48985,
-    0.47668,
-    0.45610,
-    0.43814,
-    0.43376,
-    0.44918,
-    0.48151,
-    0.51772,
-    0.53785,
-    0.52162,
-    0.45597,
-    0.34053,
-    0.18870,
-    0.02389,
-    -0.12793,
-    -0.24633,
-    -0.32231,
-    -0.35968,
-    -0.37190,
-    -0.37576,
-    -0.38474,
-    -0.40466,
-    -0.43306,
-    -0.46206,
-    -0.48318,
-    -0.49165,
-    -0.48845,
-    -0.47941,
-    -0.47207,
-    -0.47208,
-    -0.48076,
-    -0.49494,
-    -0.50896,
-    -0.51762,
-    -0.51869,
-    -0.51374,
-    -0.50707,
-    -0.50337,
-    -0.50538,
-    -0.51271,
-    -0.52225,
-    -0.52995,
-    -0.53295,
-    -0.53098,
-    -0.52631,
-    -0.52252,
-    -0.52254,
-    -0.52720,
-    -0.53488,
-    -0.54243,
-    -0.54689,
-    -0.54703,
-    -0.54398,
-    -0.54061,
-    -0.54001,
-    -0.54389,
-    -0.55171,
-    -0.56092,
-    -0.56834,
-    -0.57169,
-    -0.57084,
-    -0.56776,
-    -0.56556,
-    -0.56688,
-    -0.57251,
-    -0.58104,
-    -0.58954,
-    -0.59514,
-    -0.59645,
-    -0.59430,
-    -0.59133,
-    -0.59061,
-    -0.59407,
-    -0.60149,
-    -0.61057,
-    -0.61810,
-    -0.62163,
-    -0.62072,
-    -0.61725,
-    -0.61451,
-    -0.61553,
-    -0.62158,
-    -0.63147,
-    -0.64208,
-    -0.64993,
-    -0.65284,
-    -0.65107,
-    -0.64713,
-    -0.64456,
-    -0.64609,
-    -0.65233,
-    -0.66148,
-    -0.67031,
-    -0.67588,
-    -0.67707,
-    -0.67523,
-    -0.67345,
-    -0.67488,
-    -0.68105,
-    -0.69094,
-    -0.70142,
-    -0.70880,
-    -0.71080,
-    -0.70780,
-    -0.70278,
-    -0.69982,
-    -0.70207,
-    -0.71003,
-    -0.72121,
-    -0.73133,
-    -0.73656,
-    -0.73549,
-    -0.73001,
-    -0.72444,
-    -0.72330,
-    -0.72896,
-    -0.74028,
-    -0.75304,
-    -0.76208,
-    -0.76396,
-    -0.75886,
-    -0.75061,
-    -0.74480,
-    -0.74588,
-    -0.75471,
-    -0.76790,
-    -0.77949,
-    -0.78402,
-    -0.77955,
-    -0.76899,
-    -0.75881,
-    -0.75578,
-    -0.76329,
-    -0.77920,
-    -0.79655,
-    -0.80691,
-    -0.80487,
-    -0.79123,
-    -0.77319,
-    -0.76108,
-    -0.76301,
-    -0.78018,
-    -0.80541,
-    -0.82595,
-    -0.82977,
-    -0.81229,
-    -0.78015,
-    -0.74962,
-    -0.73964,
-    -0.76211,
-    -0.81388,
-    -0.87420,
-    -0.90978,
-    -0.88592,
-    -0.77968,
-    -0.58965,
-    -0.33819,
-    -0.06498,
-    0.18584,
-    0.37987,
-    0.50254,
-    0.56133,
-    0.57979,
-    0.58644,
-    0.60320,
-    0.63830,
-    0.68591,
-    0.73184,
-    0.76209,
-    0.77006,
-    0.75926,
-    0.74081,
-    0.72748,
-    0.72748,
-    0.74096,
-    0.76084,
-    0.77710,
-    0.78212,
-    0.77440,
-    0.75891,
-    0.74414,
-    0.73748,
-    0.74155,
-    0.75312,
-    0.76511,
-    0.77050,
-    0.76591,
-    0.75323,
-    0.73840,
-    0.72820,
-    0.72667,
-    0.73321,
-    0.74306,
-    0.74998,
-    0.74949,
-    0.74114,
-    0.72853,
-    0.71725,
-    0.71186,
-    0.71353,
-    0.71955,
-    0.72495,
-    0.72522,
-    0.71873,
-    0.70753,
-    0.69617,
-    0.68924,
-    0.68884,
-    0.69353,
-    0.69913,
-    0.70100,
-    0.69655,
-    0.68664,
-    0.67507,
-    0.66655,
-    0.66412,
-    0.66755,
-    0.67339,
-    0.67688,
-    0.67447,
-    0.66581,
-    0.65395,
-    0.64372,
-    0.63918,
-    0.64134,
-    0.64756,
-    0.65290,
-    0.65277,
-    0.64543,
-    0.63306,
-    0.62073,
-    0.61371,
-    0.61454,
-    0.62146,
-    0.62911,
-    0.63119,
-    0.62388,
-    0.60816,
-    0.58974,
-    0.57637,
-    0.57389,
-    0.58284,
-    0.59770,
-    0.60907,
-    0.60837,
-    0.59251,
-    0.56638,
-    0.54147,
-    0.53087,
-    0.54261,
-    0.57427,
-    0.61150,
-    0.63163,
-    0.61127,
-    0.53504,
-    0.40210,
-    0.22751,
-    0.03799,
-    -0.13651,
-    -0.27229,
-    -0.35860,
-    -0.39955,
-    -0.41048,
-    -0.41089,
-    -0.41674,
-    -0.43534,
-    -0.46438,
-    -0.49506,
-    -0.51749,
-    -0.52568,
-    -0.52015,
-    -0.50706,
-    -0.49490,
-    -0.49035,
-    -0.49532,
-    -0.50664,
-    -0.51805,
-    -0.52357,
-    -0.52045,
-    -0.51032,
-    -0.49806,
-    -0.48922,
-    -0.48722,
-    -0.49178,
-    -0.49932,
-    -0.50495,
-    -0.50509,
-    -0.49924,
-    -0.49012,
-    -0.48219,
-    -0.47918,
-    -0.48218,
-    -0.48901,
-    -0.49546,
-    -0.49745,
-    -0.49331,
-    -0.48470,
-    -0.47583,
-    -0.47127,
-    -0.47355,
-    -0.48166,
-    -0.49142,
-    -0.49747,
-    -0.49605,
-    -0.48705,
-    -0.47422,
-    -0.46353,
-    -0.46014,
-    -0.46577,
-    -0.47760,
-    -0.48949,
-    -0.49501,
-    -0.49076,
-    -0.47832,
-    -0.46379,
-    -0.45492,
-    -0.45713,
-    -0.47049,
-    -0.48912,
-    -0.50377,
-    -0.50624,
-    -0.49396,
-    -0.47207,
-    -0.45188,
-    -0.44592,
-    -0.46163,
-    -0.49637,
-    -0.53633,
-    -0.56014,
-    -0.54616,
-    -0.48056,
-    -0.36312,
-    -0.20817,
-    -0.04027,
-    0.11377,
-    0.23337,
-    0.31001,
-    0.34831,
-    0.36235,
-    0.36901,
-    0.38133,
-    0.40436,
-    0.43501,
-    0.46527,
-    0.48703,
-    0.49617,
-    0.49417,
-    0.48686,
-    0.48128,
-    0.48232,
-    0.49074,
-    0.50345,
-    0.51551,
-    0.52289,
-    0.52433,
-    0.52170,
-    0.51868,
-    0.51869,
-    0.52311,
-    0.53082,
-    0.53897,
-    0.54469,
-    0.54663,
-    0.54556,
-    0.54387,
-    0.54413,
-    0.54770,
-    0.55405,
-    0.56112,
-    0.56654,
-    0.56893,
-    0.56866,
-    0.56766,
-    0.56834,
-    0.57225,
-    0.57930,
-    0.58771,
-    0.59497,
-    0.59908,
-    0.59962,
-    0.59786,
-    0.59615,
-    0.59675,
-    0.60067,
-    0.60735,
-    0.61499,
-    0.62151,
-    0.62564,
-    0.62741,
-    0.62800,
-    0.62896,
-    0.63137,
-    0.63532,
-    0.63993,
-    0.64404,
-    0.64691,
-    0.64872,
-    0.65043,
-    0.65324,
-    0.65778,
-    0.66371,
-    0.66978,
-    0.67450,
-    0.67696,
-    0.67734,
-    0.67692,
-    0.67742,
-    0.68012,
-    0.68516,
-    0.69146,
-    0.69725,
-    0.70100,
-    0.70224,
-    0.70182,
-    0.70150,
-    0.70301,
-    0.70718,
-    0.71344,
-    0.72009,
-    0.72518,
-    0.72749,
-    0.72713,
-    0.72550,
-    0.72458,
-    0.72590,
-    0.72978,
-    0.73517,
-    0.74022,
-    0.74324,
-    0.74351,
-    0.74166,
-    0.73930,
-    0.73818,
-    0.73930,
-    0.74245,
-    0.74639,
-    0.74951,
-    0.75074,
-    0.75001,
-    0.74831,
-    0.74708,
-    0.74747,
-    0.74971,
-    0.75307,
-    0.75626,
-    0.75817,
-    0.75839,
-    0.75744,
-    0.75633,
-    0.75604,
-    0.75692,
-    0.75850,
-    0.75985,
-    0.76012,
-    0.75905,
-    0.75718,
-    0.75557,
-    0.75514,
-    0.75622,
-    0.75825,
-    0.76014,
-    0.76079,
-    0.75980,
-    0.75763,
-    0.75546,
-    0.75452,
-    0.75541,
-    0.75774,
-    0.76028,
-    0.76158,
-    0.76066,
-    0.75756,
-    0.75328,
-    0.74926,
-    0.74668,
-    0.74585,
-    0.74619,
-    0.74657,
-    0.74601,
-    0.74422,
-    0.74169,
-    0.73933,
-    0.73785,
-    0.73722,
-    0.73665,
-    0.73499,
-    0.73144,
-    0.72617,
-    0.72032,
-    0.71559,
-    0.71331,
-    0.71373,
-    0.71575,
-    0.71744,
-    0.71694,
-    0.71345,
-    0.70764,
-    0.70134,
-    0.69655,
-    0.69444,
-    0.69461,
-    0.69538,
-    0.69464,
-    0.69105,
-    0.68483,
-    0.67770,
-    0.67199,
-    0.66936,
-    0.66983,
-    0.67168,
-    0.67231,
-    0.66961,
-    0.66325,
-    0.65491,
-    0.64748,
-    0.64358,
-    0.64400,
-    0.64718,
-    0.64989,
-    0.64892,
-    0.64286,
-    0.63306,
-    0.62308,
-    0.61689,
-    0.61666,
-    0.62144,
-    0.62734,
-    0.62946,
-    0.62453,
-    0.61292,
-    0.59884,
-    0.58840,
-    0.58636,
-    0.59330,
-    0.60461,
-    0.61233,
-    0.60909,
-    0.59240,
-    0.56699,
-    0.54374,
-    0.53508,
-    0.54858,
-    0.58167,
-    0.61997,
-    0.64074,
-    0.62035,
-    0.54317,
-    0.40833,
-    0.23123,
-    0.03930,
-    -0.13683,
-    -0.27304,
-    -0.35884,
-    -0.39908,
-    -0.41008,
-    -0.41189,
-    -0.42035,
-    -0.44183,
-    -0.47277,
-    -0.50339,
-    -0.52362,
-    -0.52829,
-    -0.51931,
-    -0.50421,
-    -0.49212,
-    -0.48929,
-    -0.49649,
-    -0.50917,
-    -0.52031,
-    -0.52413,
-    -0.51890,
-    -0.50752,
-    -0.49568,
-    -0.48878,
-    -0.48922,
-    -0.49531,
-    -0.50249,
-    -0.50581,
-    -0.50260,
-    -0.49377,
-    -0.48321,
-    -0.47571,
-    -0.47440,
-    -0.47919,
-    -0.48690,
-    -0.49298,
-    -0.49385,
-    -0.48874,
-    -0.47997,
-    -0.47168,
-    -0.46765,
-    -0.46935,
-    -0.47526,
-    -0.48172,
-    -0.48486,
-    -0.48260,
-    -0.47569,
-    -0.46725,
-    -0.46114,
-    -0.45996,
-    -0.46379,
-    -0.47020,
-    -0.47562,
-    -0.47716,
-    -0.47410,
-    -0.46821,
-    -0.46268,
-    -0.46047,
-    -0.46273,
-    -0.46822,
-    -0.47397,
-    -0.47694,
-    -0.47553,
-    -0.47048,
-    -0.46443,
-    -0.46055,
-    -0.46094,
-    -0.46551,
-    -0.47212,
-    -0.47773,
-    -0.47994,
-    -0.47824,
-    -0.47418,
-    -0.47051,
-    -0.46966,
-    -0.47251,
-    -0.47791,
-    -0.48343,
-    -0.48666,
-    -0.48658,
-    -0.48410,
-    -0.48154,
-    -0.48139,
-    -0.48491,
-    -0.49137,
-    -0.49842,
-    -0.50331,
-    -0.50437,
-    -0.50194,
-    -0.49825,
-    -0.49632,
-    -0.49838,
-    -0.50473,
-    -0.51354,
-    -0.52180,
-    -0.52684,
-    -0.52766,
-    -0.52546,
-    -0.52285,
-    -0.52255,
-    -0.52588,
-    -0.53213,
-    -0.53900,
-    -0.54395,
-    -0.54557,
-    -0.54441,
-    -0.54269,
-    -0.54305,
-    -0.54707,
-    -0.55432,
-    -0.56253,
-    -0.56880,
-    -0.57119,
-    -0.56984,
-    -0.56695,
-    -0.56568,
-    -0.56841,
-    -0.57540,
-    -0.58458,
-    -0.59261,
-    -0.59662,
-    -0.59588,
-    -0.59221,
-    -0.58913,
-    -0.58998,
-    -0.59605,
-    -0.60582,
-    -0.61566,
-    -0.62177,
-    -0.62223,
-    -0.61819,
-    -0.61331,
-    -0.61189,
-    -0.61650,
-    -0.62645,
-    -0.63806,
-    -0.64652,
-    -0.64856,
-    -0.64438,
-    -0.63777,
-    -0.63425,
-    -0.63806,
-    -0.64973,
-    -0.66539,
-    -0.67861,
-    -0.68369,
-    -0.67887,
-    -0.66760,
-    -0.65712,
-    -0.65480,
-    -0.66414,
-    -0.68257,
-    -0.70232,
-    -0.71423,
-    -0.71260,
-    -0.69867,
-    -0.68058,
-    -0.66960,
-    -0.67434,
-    -0.69569,
-    -0.72544,
-    -0.74960,
-    -0.75528,
-    -0.73783,
-    -0.70464,
-    -0.67308,
-    -0.66297,
-    -0.68649,
-    -0.74013,
-    -0.80267,
-    -0.84084,
-    -0.82088,
-    -0.72149,
-    -0.54284,
-    -0.30781,
-    -0.05472,
-    0.17543,
-    0.35222,
-    0.46434,
-    0.52039,
-    0.54237,
-    0.55507,
-    0.57621,
-    0.61119,
-    0.65400,
-    0.69292,
-    0.71780,
-    0.72528,
-    0.71984,
-    0.71075,
-    0.70699,
-    0.71291,
-    0.72671,
-    0.74224,
-    0.75274,
-    0.75452,
-    0.74855,
-    0.73952,
-    0.73297,
-    0.73227,
-    0.73717,
-    0.74428,
-    0.74939,
-    0.74982,
-    0.74585,
-    0.74022,
-    0.73637,
-    0.73640,
-    0.73989,
-    0.74443,
-    0.74714,
-    0.74649,
-    0.74315,
-    0.73944,
-    0.73784,
-    0.73927,
-    0.74252,
-    0.74492,
-    0.74405,
-    0.73938,
-    0.73281,
-    0.72768,
-    0.72684,
-    0.73079,
-    0.73709,
-    0.74156,
-    0.74062,
-    0.73346,
-    0.72281,
-    0.71368,
-    0.71058,
-    0.71483,
-    0.72343,
-    0.73045,
-    0.73022,
-    0.72078,
-    0.70546,
-    0.69161,
-    0.68667,
-    0.69381,
-    0.70925,
-    0.72346,
-    0.72574,
-    0.71034,
-    0.68087,
-    0.65015,
-    0.63493,
-    0.64731,
-    0.68667,
-    0.73638,
-    0.76737,
-    0.74810,
-    0.65688,
-    0.49155,
-    0.27211,
-    0.03477,
-    -0.18027,
-    -0.34235,
-    -0.43985,
-    -0.48182,
-    -0.49151,
-    -0.49523,
-    -0.51145,
-    -0.54475,
-    -0.58686,
-    -0.62333,
-    -0.64215,
-    -0.64007,
-    -0.62371,
-    -0.60547,
-    -0.59684,
-    -0.60260,
-    -0.61897,
-    -0.63631,
-    -0.64469,
-    -0.63926,
-    -0.62262,
-    -0.60305,
-    -0.58984,
-    -0.58823,
-    -0.59682,
-    -0.60861,
-    -0.61513,
-    -0.61121,
-    -0.59774,
-    -0.58104,
-    -0.56918,
-    -0.56738,
-    -0.57495,
-    -0.58573,
-    -0.59156,
-    -0.58700,
-    -0.57263,
-    -0.55497,
-    -0.54287,
-    -0.54247,
-    -0.55325,
-    -0.56781,
-    -0.57557,
-    -0.56876,
-    -0.54743,
-    -0.52066,
-    -0.50270,
-    -0.50558,
-    -0.53157,
-    -0.56939,
-    -0.59650,
-    -0.58704,
-    -0.52226,
-    -0.39897,
-    -0.23206,
-    -0.05000,
-    0.11519,
-    0.23896,
-    0.31203,
-    0.34169,
-    0.34654,
-    0.34752,
-    0.35918,
-    0.38503,
-    0.41835,
-    0.44759,
-    0.46312,
-    0.46214,
-    0.44952,
-    0.43471,
-    0.42663,
-    0.42931,
-    0.44048,
-    0.45343,
-    0.46107,
-    0.45969,
-    0.45072,
-    0.43954,
-    0.43231,
-    0.43255,
-    0.43939,
-    0.44827,
-    0.45364,
-    0.45202,
-    0.44389,
-    0.43334,
-    0.42574,
-    0.42480,
-    0.43069,
-    0.43994,
-    0.44747,
-    0.44932,
-    0.44469,
-    0.43633,
-    0.42888,
-    0.42634,
-    0.42996,
-    0.43759,
-    0.44498,
-    0.44811,
-    0.44536,
-    0.43836,
-    0.43102,
-    0.42736,
-    0.42934,
-    0.43578,
-    0.44309,
-    0.44724,
-    0.44595,
-    0.43995,
-    0.43255,
-    0.42791,
-    0.42876,
-    0.43502,
-    0.44387,
-    0.45132,
-    0.45434,
-    0.45242,
-    0.44775,
-    0.44391,
-    0.44381,
-    0.44811,
-    0.45487,
-    0.46071,
-    0.46274,
-    0.46025,
-    0.45518,
-    0.45103,
-    0.45102,
-    0.45621,
-    0.46493,
-    0.47366,
-    0.47898,
-    0.47945,
-    0.47645,
-    0.47340,
-    0.47382,
-    0.47931,
-    0.48852,
-    0.49776,
-    0.50306,
-    0.50242,
-    0.49705,
-    0.49094,
-    0.48881,
-    0.49351,
-    0.50437,
-    0.51736,
-    0.52712,
-    0.52981,
-    0.52526,
-    0.51727,
-    0.51166,
-    0.51323,
-    0.52307,
-    0.53777,
-    0.55109,
-    0.55721,
-    0.55397,
-    0.54424,
-    0.53464,
-    0.53216,
-    0.54026,
-    0.55683,
-    0.57488,
-    0.58608,
-    0.58524,
-    0.57341,
-    0.55785,
-    0.54859,
-    0.55317,
-    0.57222,
-    0.59839,
-    0.61943,
-    0.62428,
-    0.60931,
-    0.58139,
-    0.55581,
-    0.54961,
-    0.57278,
-    0.62154,
-    0.67698,
-    0.71018,
-    0.69225,
-    0.60532,
-    0.44992,
-    0.24575,
-    0.02548,
-    -0.17606,
-    -0.33285,
-    -0.43473,
-    -0.48816,
-    -0.51089,
-    -0.52354,
-    -0.54150,
-    -0.57051,
-    -0.60697,
-    -0.64218,
-    -0.66781,
-    -0.68015,
-    -0.68130,
-    -0.67736,
-    -0.67498,
-    -0.67814,
-    -0.68681,
-    -0.69773,
-    -0.70671,
-    -0.71099,
-    -0.71058,
-    -0.70785,
-    -0.70605,
-    -0.70747,
-    -0.71245,
-    -0.71941,
-    -0.72596,
-    -0.73021,
-    -0.73161,
-    -0.73102,
-    -0.72996,
-    -0.72969,
-    -0.73067,
-    -0.73248,
-    -0.73435,
-    -0.73574,
-    -0.73666,
-    -0.73750,
-    -0.73864,
-    -0.74007,
-    -0.74137,
-    -0.74203,
-    -0.74188,
-    -0.74140,
-    -0.74149,
-    -0.74295,
-    -0.74587,
-    -0.74944,
-    -0.75223,
-    -0.75301,
-    -0.75148,
-    -0.74863,
-    -0.74624,
-    -0.74595,
-    -0.74826,
-    -0.75208,
-    -0.75526,
-    -0.75574,
-    -0.75283,
-    -0.74777,
-    -0.74327,
-    -0.74208,
-    -0.74535,
-    -0.75180,
-    -0.75813,
-    -0.76067,
-    -0.75747,
-    -0.74952,
-    -0.74056,
-    -0.73521,
-    -0.73642,
-    -0.74367,
-    -0.75284,
-    -0.75819,
-    -0.75552,
-    -0.74473,
-    -0.73045,
-    -0.72000,
-    -0.71954,
-    -0.73029,
-    -0.74707,
-    -0.76010,
-    -0.75985,
-    -0.74244,
-    -0.71307,
-    -0.68502,
-    -0.67418,
-    -0.69089,
-    -0.73289,
-    -0.78279,
-    -0.81197,
-    -0.79003,
-    -0.69631,
-    -0.52884,
-    -0.30675,
-    -0.06499,
-    0.15694,
-    0.32775,
-    0.43372,
-    0.48122,
-    0.49163,
-    0.49132,
-    0.50107,
-    0.52923,
-    0.57091,
-    0.61293,
-    0.64168,
-    0.64992,
-    0.63982,
-    0.62105,
-    0.60553,
-    0.60161,
-    0.61054,
-    0.62666,
-    0.64095,
-    0.64585,
-    0.63894,
-    0.62371,
-    0.60740,
-    0.59705,
-    0.59609,
-    0.60286,
-    0.61187,
-    0.61687,
-    0.61406,
-    0.60384,
-    0.59037,
-    0.57918,
-    0.57433,
-    0.57647,
-    0.58266,
-    0.58814,
-    0.58874,
-    0.58297,
-    0.57252,
-    0.56121,
-    0.55294,
-    0.54977,
-    0.55105,
-    0.55401,
-    0.55532,
-    0.55286,
-    0.54666,
-    0.53870,
-    0.53176,
-    0.52786,
-    0.52732,
-    0.52868,
-    0.52959,
-    0.52810,
-    0.52362,
-    0.51715,
-    0.51062,
-    0.50588,
-    0.50373,
-    0.50358,
-    0.50389,
-    0.50299,
-    0.49996,
-    0.49504,
-    0.48937,
-    0.48438,
-    0.48100,
-    0.47927,
-    0.47838,
-    0.47723,
-    0.47503,
-    0.47169,
-    0.46785,
-    0.46444,
-    0.46220,
-    0.46123,
-    0.46102,
-    0.46067,
-    0.45944,
-    0.45703,
-    0.45376,
-    0.45030,
-    0.44737,
-    0.44533,
-    0.44409,
-    0.44323,
-    0.44224,
-    0.44087,
-    0.43918,
-    0.43752,
-    0.43629,
-    0.43566,
-    0.43550,
-    0.43540,
-    0.43489,
-    0.43370,
-    0.43187,
-    0.42981,
-    0.42810,
-    0.42725,
-    0.42746,
-    0.42857,
-    0.43006,
-    0.43132,
-    0.43181,
-    0.43137,
-    0.43019,
-    0.42879,
-    0.42779,
-    0.42765,
-    0.42844,
-    0.42984,
-    0.43122,
-    0.43192,
-    0.43158,
-    0.43030,
-    0.42864,
-    0.42740,
-    0.42723,
-    0.42828,
-    0.43014,
-    0.43190,
-    0.43267,
-    0.43193,
-    0.42993,
-    0.42759,
-    0.42609,
-    0.42639,
-    0.42866,
-    0.43223,
-    0.43589,
-    0.43844,
-    0.43938,
-    0.43912,
-    0.43880,
-    0.43970,
-    0.44252,
-    0.44694,
-    0.45173,
-    0.45538,
-    0.45687,
-    0.45630,
-    0.45488,
-    0.45439,
-    0.45622,
-    0.46059,
-    0.46637,
-    0.47158,
-    0.47445,
-    0.47431,
-    0.47209,
-    0.46988,
-    0.46990,
-    0.47329,
-    0.47951,
-    0.48656,
-    0.49199,
-    0.49422,
-    0.49347,
-    0.49168,
-    0.49148,
-    0.49480,
-    0.50168,
-    0.51014,
-    0.51718,
-    0.52035,
-    0.51921,
-    0.51572,
-    0.51329,
-    0.51503,
-    0.52197,
-    0.53228,
-    0.54211,
-    0.54751,
-    0.54672,
-    0.54125,
-    0.53540,
-    0.53409,
-    0.54017,
-    0.55260,
-    0.56668,
-    0.57628,
-    0.57708,
-    0.56927,
-    0.55789,
-    0.55067,
-    0.55398,
-    0.56912,
-    0.59087,
-    0.60941,
-    0.61514,
-    0.60400,
-    0.58079,
-    0.55823,
-    0.55161,
-    0.57102,
-    0.61463,
-    0.66633,
-    0.69932,
-    0.68509,
-    0.60410,
-    0.45410,
-    0.25237,
-    0.03080,
-    -0.17450,
-    -0.33484,
-    -0.43755,
-    -0.48799,
-    -0.50502,
-    -0.51186,
-    -0.52663,
-    -0.55642,
-    -0.59679,
-    -0.63637,
-    -0.66380,
-    -0.67362,
-    -0.66852,
-    -0.65733,
-    -0.65023,
-    -0.65370,
-    -0.66780,
-    -0.68685,
-    -0.70287,
-    -0.70987,
-    -0.70677,
-    -0.69756,
-    -0.68887,
-    -0.68641,
-    -0.69213,
-    -0.70347,
-    -0.71510,
-    -0.72185,
-    -0.72145,
-    -0.71556,
-    -0.70866,
-    -0.70553,
-    -0.70873,
-    -0.71732,
-    -0.72750,
-    -0.73472,
-    -0.73609,
-    -0.73174,
-    -0.72465,
-    -0.71890,
-    -0.71751,
-    -0.72100,
-    -0.72724,
-    -0.73287,
-    -0.73516,
-    -0.73348,
-    -0.72954,
-    -0.72629,
-    -0.72620,
-    -0.72985,
-    -0.73561,
-    -0.74057,
-    -0.74217,
-    -0.73962,
-    -0.73434,
-    -0.72918,
-    -0.72691,
-    -0.72868,
-    -0.73348,
-    -0.73870,
-    -0.74156,
-    -0.74060,
-    -0.73638,
-    -0.73112,
-    -0.72740,
-    -0.72677,
-    -0.72890,
-    -0.73189,
-    -0.73338,
-    -0.73194,
-    -0.72789,
-    -0.72309,
-    -0.71985,
-    -0.71955,
-    -0.72179,
-    -0.72459,
-    -0.72542,
-    -0.72270,
-    -0.71675,
-    -0.70966,
-    -0.70426,
-    -0.70249,
-    -0.70435,
-    -0.70780,
-    -0.70986,
-    -0.70825,
-    -0.70265,
-    -0.69502,
-    -0.68847,
-    -0.68565,
-    -0.68717,
-    -0.69122,
-    -0.69448,
-    -0.69395,
-    -0.68868,
-    -0.68037,
-    -0.67255,
-    -0.66863,
-    -0.66993,
-    -0.67477,
-    -0.67919,
-    -0.67908,
-    -0.67248,
-    -0.66089,
-    -0.64874,
-    -0.64116,
-    -0.64115,
-    -0.64773,
-    -0.65613,
-    -0.66012,
-    -0.65535,
-    -0.64195,
-    -0.62494,
-    -0.61194,
-    -0.60920,
-    -0.61794,
-    -0.63303,
-    -0.64502,
-    -0.64478,
-    -0.62861,
-    -0.60122,
-    -0.57463,
-    -0.56302,
-    -0.57545,
-    -0.60982,
-    -0.65105,
-    -0.67482,
-    -0.65585,
-    -0.57762,
-    -0.43946,
-    -0.25794,
-    -0.06198,
-    0.11667,
-    0.25371,
-    0.33930,
-    0.37939,
-    0.39110,
-    0.39469,
-    0.40541,
-    0.42877,
-    0.46054,
-    0.49099,
-    0.51074,
-    0.51558,
-    0.50807,
-    0.49561,
-    0.48638,
-    0.48531,
-    0.49211,
-    0.50206,
-    0.50891,
-    0.50830,
-    0.49985,
-    0.48708,
-    0.47533,
-    0.46895,
-    0.46918,
-    0.47380,
-    0.47863,
-    0.47981,
-    0.47583,
-    0.46808,
-    0.45995,
-    0.45480,
-    0.45420,
-    0.45718,
-    0.46089,
-    0.46221,
-    0.45949,
-    0.45334,
-    0.44621,
-    0.44096,
-    0.43933,
-    0.44100,
-    0.44383,
-    0.44513,
-    0.44309,
-    0.43783,
-    0.43129,
-    0.42617,
-    0.42450,
-    0.42650,
-    0.43054,
-    0.43395,
-    0.43448,
-    0.43142,
-    0.42597,
-    0.42053,
-    0.41747,
-    0.41781,
-    0.42079,
-    0.42428,
-    0.42592,
-    0.42436,
-    0.41995,
-    0.41451,
-    0.41037,
-    0.40913,
-    0.41092,
-    0.41438,
-    0.41744,
-    0.41843,
-    0.41690,
-    0.41383,
-    0.41097,
-    0.40991,
-    0.41118,
-    0.41404,
-    0.41689,
-    0.41816,
-    0.41717,
-    0.41445,
-    0.41146,
-    0.40980,
-    0.41038,
-    0.41298,
-    0.41646,
-    0.41939,
-    0.42078,
-    0.42059,
-    0.41965,
-    0.41908,
-    0.41969,
-    0.42154,
-    0.42395,
-    0.42602,
-    0.42714,
-    0.42746,
-    0.42774,
-    0.42893,
-    0.43154,
-    0.43532,
-    0.43933,
-    0.44241,
-    0.44389,
-    0.44396,
-    0.44360,
-    0.44410,
-    0.44632,
-    0.45019,
-    0.45472,
-    0.45849,
-    0.46044,
-    0.46045,
-    0.45947,
-    0.45906,
-    0.46058,
-    0.46448,
-    0.47007,
-    0.47583,
-    0.48026,
-    0.48260,
-    0.48323,
-    0.48347,
-    0.48480,
-    0.48809,
-    0.49312,
-    0.49872,
-    0.50339,
-    0.50617,
-    0.50713,
-    0.50737,
-    0.50837,
-    0.51123,
-    0.51600,
-    0.52168,
-    0.52675,
-    0.53000,
-    0.53123,
-    0.53134,
-    0.53188,
-    0.53420,
-    0.53867,
-    0.54449,
-    0.55007,
-    0.55395,
-    0.55555,
-    0.55555,
-    0.55553,
-    0.55712,
-    0.56111,
-    0.56697,
-    0.57315,
-    0.57787,
-    0.58011,
-    0.58018,
-    0.57957,
-    0.58018,
-    0.58330,
-    0.58889,
-    0.59560,
-    0.60145,
-    0.60490,
-    0.60565,
-    0.60477,
-    0.60410,
-    0.60528,
-    0.60881,
-    0.61385,
-    0.61877,
-    0.62208,
-    0.62335,
-    0.62350,
-    0.62424,
-    0.62710,
-    0.63237,
-    0.63887,
-    0.64446,
-    0.64719,
-    0.64647,
-    0.64351,
-    0.64085,
-    0.64101,
-    0.64514,
-    0.65227,
-    0.65974,
-    0.66454,
-    0.66494,
-    0.66152,
-    0.65702,
-    0.65492,
-    0.65760,
-    0.66497,
-    0.67436,
-    0.68184,
-    0.68427,
-    0.68104,
-    0.67452,
-    0.66893,
-    0.66807,
-    0.67326,
-    0.68245,
-    0.69119,
-    0.69502,
-    0.69194,
-    0.68376,
-    0.67531,
-    0.67200,
-    0.67671,
-    0.68797,
-    0.70030,
-    0.70689,
-    0.70333,
-    0.69039,
-    0.67417,
-    0.66344,
-    0.66502,
-    0.67978,
-    0.70127,
-    0.71826,
-    0.72022,
-    0.70324,
-    0.67339,
-    0.64526,
-    0.63578,
-    0.65559,
-    0.70185,
-    0.75598,
-    0.78818,
-    0.76738,
-    0.67302,
-    0.50373,
-    0.27941,
-    0.03548,
-    -0.18862,
-    -0.36202,
-    -0.47140,
-    -0.52311,
-    -0.53785,
-    -0.54096,
-    -0.55222,
-    -0.57956,
-    -0.61860,
-    -0.65747,
-    -0.68419,
-    -0.69279,
-    -0.68578,
-    -0.67210,
-    -0.66218,
-    -0.66275,
-    -0.67401,
-    -0.69024,
-    -0.70335,
-    -0.70718,
-    -0.70048,
-    -0.68720,
-    -0.67399,
-    -0.66668,
-    -0.66731,
-    -0.67345,
-    -0.67983,
-    -0.68133,
-    -0.67575,
-    -0.66486,
-    -0.65327,
-    -0.64590,
-    -0.64533,
-    -0.65050,
-    -0.65738,
-    -0.66110,
-    -0.65853,
-    -0.64982,
-    -0.63824,
-    -0.62833,
-    -0.62361,
-    -0.62474,
-    -0.62936,
-    -0.63340,
-    -0.63327,
-    -0.62769,
-    -0.61826,
-    -0.60854,
-    -0.60207,
-    -0.60059,
-    -0.60314,
-    -0.60672,
-    -0.60787,
-    -0.60454,
-    -0.59709,
-    -0.58803,
-    -0.58063,
-    -0.57719,
-    -0.57786,
-    -0.58062,
-    -0.58242,
-    -0.58079,
-    -0.57514,
-    -0.56701,
-    -0.55921,
-    -0.55430,
-    -0.55327,
-    -0.55500,
-    -0.55699,
-    -0.55662,
-    -0.55258,
-    -0.54554,
-    -0.53772,
-    -0.53175,
-    -0.52919,
-    -0.52980,
-    -0.53165,
-    -0.53219,
-    -0.52958,
-    -0.52368,
-    -0.51612,
-    -0.50936,
-    -0.50546,
-    -0.50492,
-    -0.50647,
-    -0.50771,
-    -0.50639,
-    -0.50163,
-    -0.49433,
-    -0.48679,
-    -0.48150,
-    -0.47986,
-    -0.48148,
-    -0.48441,
-    -0.48611,
-    -0.48476,
-    -0.48015,
-    -0.47375,
-    -0.46790,
-    -0.46462,
-    -0.46453,
-    -0.46660,
-    -0.46871,
-    -0.46876,
-    -0.46574,
-    -0.46026,
-    -0.45416,
-    -0.44958,
-    -0.44780,
-    -0.44868,
-    -0.45072,
-    -0.45199,
-    -0.45110,
-    -0.44795,
-    -0.44376,
-    -0.44035,
-    -0.43912,
-    -0.44026,
-    -0.44264,
-    -0.44442,
-    -0.44404,
-    -0.44113,
-    -0.43669,
-    -0.43263,
-    -0.43066,
-    -0.43141,
-    -0.43397,
-    -0.43642,
-    -0.43678,
-    -0.43421,
-    -0.42950,
-    -0.42477,
-    -0.42239,
-    -0.42367,
-    -0.42813,
-    -0.43357,
-    -0.43716,
-    -0.43692,
-    -0.43280,
-    -0.42681,
-    -0.42208,
-    -0.42122,
-    -0.42491,
-    -0.43143,
-    -0.43740,
-    -0.43955,
-    -0.43644,
-    -0.42937,
-    -0.42189,
-    -0.41805,
-    -0.42027,
-    -0.42795,
-    -0.43755,
-    -0.44435,
-    -0.44484,
-    -0.43878,
-    -0.42958,
-    -0.42274,
-    -0.42303,
-    -0.43173,
-    -0.44548,
-    -0.45756,
-    -0.46121,
-    -0.45341,
-    -0.43728,
-    -0.42156,
-    -0.41691,
-    -0.43051,
-    -0.46121,
-    -0.49773,
-    -0.52109,
-    -0.51084,
-    -0.45277,
-    -0.34495,
-    -0.19955,
-    -0.03949,
-    0.10893,
-    0.22465,
-    0.29819,
-    0.33341,
-    0.34431,
-    0.34831,
-    0.35909,
-    0.38195,
-    0.41335,
-    0.44431,
-    0.46582,
-    0.47353,
-    0.46965,
-    0.46137,
-    0.45700,
-    0.46176,
-    0.47544,
-    0.49292,
-    0.50712,
-    0.51281,
-    0.50920,
-    0.50023,
-    0.49233,
-    0.49106,
-    0.49830,
-    0.51141,
-    0.52482,
-    0.53299,
-    0.53331,
-    0.52740,
-    0.52010,
-    0.51689,
-    0.52097,
-    0.53159,
-    0.54456,
-    0.55447,
-    0.55761,
-    0.55392,
-    0.54697,
-    0.54208,
-    0.54345,
-    0.55194,
-    0.56459,
-    0.57620,
-    0.58210,
-    0.58060,
-    0.57400,
-    0.56733,
-    0.56576,
-    0.57181,
-    0.58399,
-    0.59751,
-    0.60674,
-    0.60821,
-    0.60243,
-    0.59371,
-    0.58792,
-    0.58941,
-    0.59867,
-    0.61207,
-    0.62369,
-    0.62855,
-    0.62529,
-    0.61708,
-    0.60999,
-    0.60978,
-    0.61866,
-    0.63379,
-    0.64852,
-    0.65576,
-    0.65184,
-    0.63890,
-    0.62422,
-    0.61685,
-    0.62283,
-    0.64161,
-    0.66553,
-    0.68306,
-    0.68447,
-    0.66722,
-    0.63850,
-    0.61302,
-    0.60669,
-    0.62855,
-    0.67462,
-    0.72656,
-    0.75630,
-    0.73531,
-    0.64511,
-    0.48473,
-    0.27237,
-    0.04016,
-    -0.17583,
-    -0.34668,
-    -0.45872,
-    -0.51584,
-    -0.53556,
-    -0.54080,
-    -0.55092,
-    -0.57543,
-    -0.61249,
-    -0.65220,
-    -0.68270,
-    -0.69621,
-    -0.69250,
-    -0.67843,
-    -0.66438,
-    -0.65927,
-    -0.66667,
-    -0.68364,
-    -0.70257,
-    -0.71512,
-    -0.71624,
-    -0.70641,
-    -0.69118,
-    -0.67840,
-    -0.67438,
-    -0.68097,
-    -0.69474,
-    -0.70880,
-    -0.71613,
-    -0.71306,
-    -0.70098,
-    -0.68573,
-    -0.67471,
-    -0.67323,
-    -0.68183,
-    -0.69589,
-    -0.70777,
-    -0.71063,
-    -0.70191,
-    -0.68497,
-    -0.66767,
-    -0.65871,
-    -0.66311,
-    -0.67924,
-    -0.69897,
-    -0.71112,
-    -0.70696,
-    -0.68506,
-    -0.65325,
-    -0.62608,
-    -0.61861,
-    -0.63882,
-    -0.68194,
-    -0.72961,
-    -0.75463,
-    -0.73006,
-    -0.63920,
-    -0.48256,
-    -0.27891,
-    -0.05987,
-    0.14011,
-    0.29450,
-    0.39213,
-    0.43879,
-    0.45267,
-    0.45594,
-    0.46606,
-    0.49025,
-    0.52492,
-    0.55969,
-    0.58368,
-    0.59104,
-    0.58339,
-    0.56837,
-    0.55557,
-    0.55181,
-    0.55833,
-    0.57083,
-    0.58222,
-    0.58639,
-    0.58119,
-    0.56915,
-    0.55583,
-    0.54680,
-    0.54490,
-    0.54904,
-    0.55508,
-    0.55825,
-    0.55558,
-    0.54735,
-    0.53667,
-    0.52775,
-    0.52359,
-    0.52453,
-    0.52824,
-    0.53109,
-    0.53011,
-    0.52448,
-    0.51588,
-    0.50746,
-    0.50208,
-    0.50089,
-    0.50275,
-    0.50499,
-    0.50486,
-    0.50100,
-    0.49406,
-    0.48629,
-    0.48030,
-    0.47762,
-    0.47801,
-    0.47959,
-    0.47995,
-    0.47737,
-    0.47177,
-    0.46462,
-    0.45815,
-    0.45418,
-    0.45320,
-    0.45423,
-    0.45541,
-    0.45502,
-    0.45235,
-    0.44800,
-    0.44342,
-    0.44009,
-    0.43867,
-    0.43875,
-    0.43910,
-    0.43841,
-    0.43604,
-    0.43231,
-    0.42828,
-    0.42514,
-    0.42353,
-    0.42321,
-    0.42320,
-    0.42240,
-    0.42016,
-    0.41664,
-    0.41272,
-    0.40949,
-    0.40767,
-    0.40728,
-    0.40769,
-    0.40802,
-    0.40761,
-    0.40635,
-    0.40462,
-    0.40298,
-    0.40180,
-    0.40104,
-    0.40033,
-    0.39933,
-    0.39801,
-    0.39677,
-    0.39621,
-    0.39674,
-    0.39824,
-    0.40000,
-    0.40105,
-    0.40072,
-    0.39906,
-    0.39688,
-    0.39539,
-    0.39552,
-    0.39735,
-    0.39998,
-    0.40196,
-    0.40209,
-    0.40012,
-    0.39700,
-    0.39442,
-    0.39392,
-    0.39596,
-    0.39963,
-    0.40296,
-    0.40402,
-    0.40198,
-    0.39771,
-    0.39340,
-    0.39149,
-    0.39330,
-    0.39823,
-    0.40399,
-    0.40773,
-    0.40772,
-    0.40436,
-    0.40020,
-    0.39868,
-    0.40215,
-    0.41045,
-    0.42059,
-    0.42814,
-    0.42951,
-    0.42408,
-    0.41490,
-    0.40743,
-    0.40683,
-    0.41503,
-    0.42927,
-    0.44303,
-    0.44917,
-    0.44394,
-    0.42972,
-    0.41482,
-    0.41005,
-    0.42310,
-    0.45344,
-    0.49008,
-    0.51385,
-    0.50370,
-    0.44468,
-    0.33446,
-    0.18532,
-    0.02083,
-    -0.13191,
-    -0.25113,
-    -0.32710,
-    -0.36394,
-    -0.37613,
-    -0.38157,
-    -0.39408,
-    -0.41880,
-    -0.45179,
-    -0.48376,
-    -0.50564,
-    -0.51331,
-    -0.50931,
-    -0.50105,
-    -0.49673,
-    -0.50124,
-    -0.51399,
-    -0.52974,
-    -0.54174,
-    -0.54543,
-    -0.54081,
-    -0.53228,
-    -0.52622,
-    -0.52755,
-    -0.53723,
-    -0.55184,
-    -0.56549,
-    -0.57293,
-    -0.57222,
-    -0.56565,
-    -0.55839,
-    -0.55578,
-    -0.56053,
-    -0.57140,
-    -0.58401,
-    -0.59321,
-    -0.59578,
-    -0.59210,
-    -0.58582,
-    -0.58187,
-    -0.58386,
-    -0.59215,
-    -0.60380,
-    -0.61415,
-    -0.61932,
-    -0.61823,
-    -0.61307,
-    -0.60807,
-    -0.60718,
-    -0.61195,
-    -0.62076,
-    -0.62978,
-    -0.63507,
-    -0.63477,
-    -0.63011,
-    -0.62471,
-    -0.62266,
-    -0.62620,
-    -0.63451,
-    -0.64415,
-    -0.65087,
-    -0.65198,
-    -0.64784,
-    -0.64174,
-    -0.63809,
-    -0.64007,
-    -0.64781,
-    -0.65824,
-    -0.66671,
-    -0.66953,
-    -0.66601,
-    -0.65902,
-    -0.65347,
-    -0.65365,
-    -0.66081,
-    -0.67226,
-    -0.68262,
-    -0.68666,
-    -0.68223,
-    -0.67171,
-    -0.66098,
-    -0.65650,
-    -0.66181,
-    -0.67531,
-    -0.69075,
-    -0.70027,
-    -0.69852,
-    -0.68580,
-    -0.66844,
-    -0.65586,
-    -0.65570,
-    -0.66951,
-    -0.69112,
-    -0.70916,
-    -0.71266,
-    -0.69711,
-    -0.66807,
-    -0.63981,
-    -0.62923,
-    -0.64723,
-    -0.69149,
-    -0.74420,
-    -0.77636,
-    -0.75760,
-    -0.66769,
-    -0.50523,
-    -0.28954,
-    -0.05511,
-    0.15970,
-    0.32502,
-    0.42824,
-    0.47600,
-    0.48892,
-    0.49191,
-    0.50420,
-    0.53304,
-    0.57342,
-    0.61298,
-    0.63940,
-    0.64671,
-    0.63767,
-    0.62172,
-    0.60983,
-    0.60917,
-    0.62000,
-    0.63637,
-    0.64966,
-    0.65326,
-    0.64574,
-    0.63130,
-    0.61721,
-    0.60995,
-    0.61197,
-    0.62070,
-    0.63019,
-    0.63439,
-    0.63029,
-    0.61937,
-    0.60660,
-    0.59772,
-    0.59623,
-    0.60163,
-    0.60986,
-    0.61552,
-    0.61473,
-    0.60709,
-    0.59574,
-    0.58557,
-    0.58060,
-    0.58185,
-    0.58692,
-    0.59140,
-    0.59123,
-    0.58495,
-    0.57444,
-    0.56382,
-    0.55730,
-    0.55679,
-    0.56100,
-    0.56603,
-    0.56758,
-    0.56319,
-    0.55362,
-    0.54245,
-    0.53416,
-    0.53167,
-    0.53483,
-    0.54039,
-    0.54375,
-    0.54145,
-    0.53304,
-    0.52139,
-    0.51120,
-    0.50648,
-    0.50835,
-    0.51436,
-    0.51973,
-    0.51987,
-    0.51291,
-    0.50082,
-    0.48845,
-    0.48102,
-    0.48124,
-    0.48771,
-    0.49550,
-    0.49867,
-    0.49353,
-    0.48089,
-    0.46592,
-    0.45566,
-    0.45524,
-    0.46481,
-    0.47885,
-    0.48852,
-    0.48610,
-    0.46937,
-    0.44363,
-    0.42011,
-    0.41104,
-    0.42337,
-    0.45415,
-    0.48973,
-    0.50957,
-    0.49351,
-    0.42938,
-    0.31817,
-    0.17428,
-    0.02089,
-    -0.11766,
-    -0.22357,
-    -0.29036,
-    -0.32312,
-    -0.33464,
-    -0.33938,
-    -0.34793,
-    -0.36402,
-    -0.38499,
-    -0.40481,
-    -0.41789,
-    -0.42198,
-    -0.41877,
-    -0.41257,
-    -0.40787,
-    -0.40719,
-    -0.41033,
-    -0.41497,
-    -0.41839,
-    -0.41894,
-    -0.41679,
-    -0.41358,
-    -0.41122,
-    -0.41087,
-    -0.41236,
-    -0.41449,
-    -0.41590,
-    -0.41589,
-    -0.41472,
-    -0.41337,
-    -0.41280,
-    -0.41332,
-    -0.41446,
-    -0.41529,
-    -0.41512,
-    -0.41397,
-    -0.41261,
-    -0.41205,
-    -0.41287,
-    -0.41474,
-    -0.41656,
-    -0.41708,
-    -0.41574,
-    -0.41307,
-    -0.41055,
-    -0.40980,
-    -0.41154,
-    -0.41509,
-    -0.41855,
-    -0.41982,
-    -0.41784,
-    -0.41334,
-    -0.40864,
-    -0.40651,
-    -0.40853,
-    -0.41408,
-    -0.42035,
-    -0.42376,
-    -0.42191,
-    -0.41519,
-    -0.40698,
-    -0.40220,
-    -0.40476,
-    -0.41516,
-    -0.42967,
-    -0.44170,
-    -0.44496,
-    -0.43699,
-    -0.42128,
-    -0.40644,
-    -0.40266,
-    -0.41650,
-    -0.44642,
-    -0.48131,
-    -0.50300,
-    -0.49227,
-    -0.43599,
-    -0.33272,
-    -0.19414,
-    -0.04181,
-    0.09978,
-    0.21096,
-    0.28273,
-    0.31827,
-    0.33006,
-    0.33389,
-    0.34252,
-    0.36153,
-    0.38867,
-    0.41668,
-    0.43775,
-    0.44757,
-    0.44716,
-    0.44183,
-    0.43830,
-    0.44130,
-    0.45153,
-    0.46570,
-    0.47856,
-    0.48568,
-    0.48559,
-    0.48039,
-    0.47445,
-    0.47217,
-    0.47585,
-    0.48470,
-    0.49544,
-    0.50407,
-    0.50789,
-    0.50674,
-    0.50291,
-    0.49992,
-    0.50067,
-    0.50607,
-    0.51469,
-    0.52356,
-    0.52973,
-    0.53167,
-    0.53000,
-    0.52711,
-    0.52591,
-    0.52842,
-    0.53478,
-    0.54328,
-    0.55118,
-    0.55604,
-    0.55690,
-    0.55463,
-    0.55150,
-    0.55006,
-    0.55199,
-    0.55731,
-    0.56452,
-    0.57139,
-    0.57601,
-    0.57772,
-    0.57731,
-    0.57658,
-    0.57732,
-    0.58045,
-    0.58551,
-    0.59097,
-    0.59498,
-    0.59640,
-    0.59542,
-    0.59347,
-    0.59254,
-    0.59418,
-    0.59865,
-    0.60473,
-    0.61033,
-    0.61351,
-    0.61351,
-    0.61123,
-    0.60880,
-    0.60857,
-    0.61186,
-    0.61816,
-    0.62529,
-    0.63041,
-    0.63147,
-    0.62827,
-    0.62279,
-    0.61822,
-    0.61746,
-    0.62158,
-    0.62918,
-    0.63696,
-    0.64136,
-    0.64037,
-    0.63473,
-    0.62766,
-    0.62335,
-    0.62481,
-    0.63218,
-    0.64246,
-    0.65091,
-    0.65338,
-    0.64859,
-    0.63897,
-    0.62962,
-    0.62577,
-    0.63000,
-    0.64062,
-    0.65225,
-    0.65848,
-    0.65526,
-    0.64336,
-    0.62849,
-    0.61868,
-    0.62013,
-    0.63359,
-    0.65316,
-    0.66862,
-    0.67040,
-    0.65496,
-    0.62780,
-    0.60217,
-    0.59348,
-    0.61147,
-    0.65364,
-    0.70312,
-    0.73271,
-    0.71388,
-    0.62753,
-    0.47211,
-    0.26563,
-    0.04058,
-    -0.16661,
-    -0.32717,
-    -0.42850,
-    -0.47623,
-    -0.48954,
-    -0.49208,
-    -0.50246,
-    -0.52823,
-    -0.56533,
-    -0.60249,
-    -0.62820,
-    -0.63657,
-    -0.62974,
-    -0.61604,
-    -0.60536,
-    -0.60416,
-    -0.61276,
-    -0.62588,
-    -0.63595,
-    -0.63732,
-    -0.62906,
-    -0.61519,
-    -0.60228,
-    -0.59591,
-    -0.59790,
-    -0.60561,
-    -0.61362,
-    -0.61672,
-    -0.61262,
-    -0.60291,
-    -0.59202,
-    -0.58462,
-    -0.58314,
-    -0.58653,
-    -0.59106,
-    -0.59245,
-    -0.58829,
-    -0.57937,
-    -0.56920,
-    -0.56204,
-    -0.56059,
-    -0.56444,
-    -0.57033,
-    -0.57385,
-    -0.57180,
-    -0.56388,
-    -0.55284,
-    -0.54301,
-    -0.53798,
-    -0.53877,
-    -0.54328,
-    -0.54748,
-    -0.54758,
-    -0.54202,
-    -0.53227,
-    -0.52205,
-    -0.51526,
-    -0.51397,
-    -0.51725,
-    -0.52176,
-    -0.52349,
-    -0.51995,
-    -0.51144,
-    -0.50091,
-    -0.49240,
-    -0.48888,
-    -0.49073,
-    -0.49557,
-    -0.49956,
-    -0.49945,
-    -0.49426,
-    -0.48570,
-    -0.47718,
-    -0.47191,
-    -0.47112,
-    -0.47346,
-    -0.47580,
-    -0.47505,
-    -0.46996,
-    -0.46186,
-    -0.45400,
-    -0.44970,
-    -0.45049,
-    -0.45508,
-    -0.45999,
-    -0.46137,
-    -0.45716,
-    -0.44832,
-    -0.43849,
-    -0.43206,
-    -0.43178,
-    -0.43710,
-    -0.44430,
-    -0.44830,
-    -0.44546,
-    -0.43572,
-    -0.42290,
-    -0.41293,
-    -0.41071,
-    -0.41725,
-    -0.42867,
-    -0.43786,
-    -0.43802,
-    -0.42657,
-    -0.40726,
-    -0.38913,
-    -0.38256,
-    -0.39383,
-    -0.42087,
-    -0.45217,
-    -0.46986,
-    -0.45599,
-    -0.39945,
-    -0.30074,
-    -0.17260,
-    -0.03597,
-    0.08697,
-    0.17994,
-    0.23718,
-    0.26385,
-    0.27237,
-    0.27665,
-    0.28665,
-    0.30535,
-    0.32926,
-    0.35151,
-    0.36591,
-    0.37001,
-    0.36595,
-    0.35887,
-    0.35416,
-    0.35491,
-    0.36074,
-    0.36857,
-    0.37454,
-    0.37616,
-    0.37346,
-    0.36878,
-    0.36528,
-    0.36524,
-    0.36893,
-    0.37461,
-    0.37962,
-    0.38186,
-    0.38083,
-    0.37784,
-    0.37516,
-    0.37476,
-    0.37725,
-    0.38166,
-    0.38599,
-    0.38836,
-    0.38806,
-    0.38586,
-    0.38361,
-    0.38324,
-    0.38572,
-    0.39061,
-    0.39628,
-    0.40082,
-    0.40297,
-    0.40279,
-    0.40149,
-    0.40082,
-    0.40211,
-    0.40558,
-    0.41034,
-    0.41486,
-    0.41779,
-    0.41872,
-    0.41827,
-    0.41779,
-    0.41857,
-    0.42118,
-    0.42518,
-    0.42940,
-    0.43256,
-    0.43403,
-    0.43413,
-    0.43401,
-    0.43506,
-    0.43819,
-    0.44334,
-    0.44949,
-    0.45513,
-    0.45895,
-    0.46046,
-    0.46018,
-    0.45935,
-    0.45940,
-    0.46124,
-    0.46499,
-    0.46993,
-    0.47495,
-    0.47909,
-    0.48189,
-    0.48358,
-    0.48487,
-    0.48654,
-    0.48910,
-    0.49262,
-    0.49674,
-    0.50091,
-    0.50465,
-    0.50771,
-    0.51011,
-    0.51206,
-    0.51377,
-    0.51543,
-    0.51717,
-    0.51907,
-    0.52126,
-    0.52389,
-    0.52703,
-    0.53067,
-    0.53457,
-    0.53839,
-    0.54176,
-    0.54442,
-    0.54634,
-    0.54772,
-    0.54889,
-    0.55016,
-    0.55176,
-    0.55370,
-    0.55593,
-    0.55832,
-    0.56086,
-    0.56358,
-    0.56658,
-    0.56990,
-    0.57344,
-    0.57699,
-    0.58027,
-    0.58307,
-    0.58531,
-    0.58709,
-    0.58859,
-    0.59000,
-    0.59137,
-    0.59262,
-    0.59361,
-    0.59425,
-    0.59458,
-    0.59482,
-    0.59533,
-    0.59640,
-    0.59818,
-    0.60057,
-    0.60328,
-    0.60595,
-    0.60830,
-    0.61025,
-    0.61190,
-    0.61343,
-    0.61496,
-    0.61644,
-    0.61768,
-    0.61840,
-    0.61841,
-    0.61778,
-    0.61681,
-    0.61602,
-    0.61590,
-    0.61676,
-    0.61857,
-    0.62096,
-    0.62338,
-    0.62526,
-    0.62625,
-    0.62632,
-    0.62573,
-    0.62492,
-    0.62429,
-    0.62410,
-    0.62437,
-    0.62491,
-    0.62544,
-    0.62571,
-    0.62562,
-    0.62525,
-    0.62479,
-    0.62446,
-    0.62439,
-    0.62461,
-    0.62498,
-    0.62534,
-    0.62554,
-    0.62552,
-    0.62534,
-    0.62507,
-    0.62477,
-    0.62438,
-    0.62369,
-    0.62246,
-    0.62051,
-    0.61789,
-    0.61488,
-    0.61198,
-    0.60977,
-    0.60863,
-    0.60858,
-    0.60927,
-    0.61003,
-    0.61013,
-    0.60912,
-    0.60692,
-    0.60394,
-    0.60083,
-    0.59821,
-    0.59640,
-    0.59530,
-    0.59442,
-    0.59319,
-    0.59120,
-    0.58847,
-    0.58537,
-    0.58252,
-    0.58042,
-    0.57920,
-    0.57854,
-    0.57783,
-    0.57637,
-    0.57378,
-    0.57008,
-    0.56574,
-    0.56140,
-    0.55763,
-    0.55469,
-    0.55249,
-    0.55071,
-    0.54899,
-    0.54713,
-    0.54512,
-    0.54302,
-    0.54086,
-    0.53850,
-    0.53573,
-    0.53236,
-    0.52844,
-    0.52434,
-    0.52059,
-    0.51767,
-    0.51572,
-    0.51436,
-    0.51284,
-    0.51037,
-    0.50655,
-    0.50166,
-    0.49660,
-    0.49255,
-    0.49036,
-    0.49011,
-    0.49099,
-    0.49156,
-    0.49043,
-    0.48688,
-    0.48128,
-    0.47489,
-    0.46932,
-    0.46579,
-    0.46457,
-    0.46486,
-    0.46522,
-    0.46434,
-    0.46163,
-    0.45747,
-    0.45296,
-    0.44927,
-    0.44693,
-    0.44561,
-    0.44426,
-    0.44181,
-    0.43779,
-    0.43275,
-    0.42800,
-    0.42495,
-    0.42427,
-    0.42548,
-    0.42701,
-    0.42703,
-    0.42439,
-    0.41929,
-    0.41328,
-    0.40851,
-    0.40660,
-    0.40772,
-    0.41039,
-    0.41217,
-    0.41094,
-    0.40607,
-    0.39892,
-    0.39219,
-    0.38857,
-    0.38925,
-    0.39311,
-    0.39717,
-    0.39803,
-    0.39380,
-    0.38532,
-    0.37602,
-    0.37037,
-    0.37149,
-    0.37924,
-    0.38981,
-    0.39718,
-    0.39611,
-    0.38509,
-    0.36785,
-    0.35233,
-    0.34732,
-    0.35798,
-    0.38225,
-    0.40994,
-    0.42526,
-    0.41206,
-    0.35989,
-    0.26839,
-    0.14821,
-    0.01788,
-    -0.10208,
-    -0.19563,
-    -0.25584,
-    -0.28587,
-    -0.29631,
-    -0.30017,
-    -0.30771,
-    -0.32317,
-    -0.34443,
-    -0.36549,
-    -0.38016,
-    -0.38527,
-    -0.38198,
-    -0.37490,
-    -0.36957,
-    -0.36979,
-    -0.37604,
-    -0.38559,
-    -0.39424,
-    -0.39846,
-    -0.39715,
-    -0.39192,
-    -0.38612,
-    -0.38305,
-    -0.38439,
-    -0.38958,
-    -0.39630,
-    -0.40181,
-    -0.40434,
-    -0.40384,
-    -0.40179,
-    -0.40025,
-    -0.40070,
-    -0.40333,
-    -0.40704,
-    -0.41015,
-    -0.41142,
-    -0.41071,
-    -0.40908,
-    -0.40816,
-    -0.40930,
-    -0.41282,
-    -0.41785,
-    -0.42281,
-    -0.42621,
-    -0.42739,
-    -0.42681,
-    -0.42578,
-    -0.42578,
-    -0.42771,
-    -0.43154,
-    -0.43636,
-    -0.44098,
-    -0.44449,
-    -0.44675,
-    -0.44832,
-    -0.45008,
-    -0.45271,
-    -0.45627,
-    -0.46018,
-    -0.46355,
-    -0.46569,
-    -0.46646,
-    -0.46644,
-    -0.46655,
-    -0.46769,
-    -0.47026,
-    -0.47404,
-    -0.47837,
-    -0.48245,
-    -0.48583,
-    -0.48848,
-    -0.49076,
-    -0.49312,
-    -0.49576,
-    -0.49854,
-    -0.50107,
-    -0.50301,
-    -0.50434,
-    -0.50546,
-    -0.50707,
-    -0.50980,
-    -0.51386,
-    -0.51886,
-    -0.52389,
-    -0.52795,
-    -0.53039,
-    -0.53120,
-    -0.53106,
-    -0.53104,
-    -0.53214,
-    -0.53486,
-    -0.53902,
-    -0.54389,
-    -0.54856,
-    -0.55231,
-    -0.55493,
-    -0.55670,
-    -0.55818,
-    -0.55991,
-    -0.56210,
-    -0.56462,
-    -0.56711,
-    -0.56922,
-    -0.57083,
-    -0.57214,
-    -0.57350,
-    -0.57526,
-    -0.57752,
-    -0.58011,
-    -0.58269,
-    -0.58490,
-    -0.58660,
-    -0.58794,
-    -0.58926,
-    -0.59091,
-    -0.59307,
-    -0.59561,
-    -0.59820,
-    -0.60047,
-    -0.60224,
-    -0.60359,
-    -0.60487,
-    -0.60651,
-    -0.60874,
-    -0.61146,
-    -0.61424,
-    -0.61650,
-    -0.61776,
-    -0.61793,
-    -0.61735,
-    -0.61670,
-    -0.61670,
-    -0.61782,
-    -0.62002,
-    -0.62280,
-    -0.62538,
-    -0.62700,
-    -0.62728,
-    -0.62634,
-    -0.62475,
-    -0.62331,
-    -0.62273,
-    -0.62336,
-    -0.62511,
-    -0.62750,
-    -0.62990,
-    -0.63178,
-    -0.63285,
-    -0.63318,
-    -0.63303,
-    -0.63275,
-    -0.63261,
-    -0.63270,
-    -0.63293,
-    -0.63313,
-    -0.63317,
-    -0.63301,
-    -0.63271,
-    -0.63242,
-    -0.63229,
-    -0.63239,
-    -0.63270,
-    -0.63312,
-    -0.63349,
-    -0.63366,
-    -0.63351,
-    -0.63296,
-    -0.63199,
-    -0.63065,
-    -0.62907,
-    -0.62743,
-    -0.62596,
-    -0.62487,
-    -0.62424,
-    -0.62401,
-    -0.62392,
-    -0.62359,
-    -0.62265,
-    -0.62089,
-    -0.61837,
-    -0.61540,
-    -0.61244,
-    -0.60994,
-    -0.60811,
-    -0.60688,
-    -0.60589,
-    -0.60467,
-    -0.60288,
-    -0.60043,
-    -0.59758,
-    -0.59476,
-    -0.59241,
-    -0.59074,
-    -0.58960,
-    -0.58860,
-    -0.58727,
-    -0.58527,
-    -0.58261,
-    -0.57963,
-    -0.57684,
-    -0.57466,
-    -0.57324,
-    -0.57236,
-    -0.57152,
-    -0.57020,
-    -0.56805,
-    -0.56502,
-    -0.56140,
-    -0.55761,
-    -0.55399,
-    -0.55073,
-    -0.54782,
-    -0.54513,
-    -0.54260,
-    -0.54029,
-    -0.53831,
-    -0.53672,
-    -0.53538,
-    -0.53389,
-    -0.53177,
-    -0.52864,
-    -0.52451,
-    -0.51983,
-    -0.51537,
-    -0.51190,
-    -0.50974,
-    -0.50864,
-    -0.50776,
-    -0.50606,
-    -0.50284,
-    -0.49809,
-    -0.49258,
-    -0.48758,
-    -0.48425,
-    -0.48308,
-    -0.48361,
-    -0.48457,
-    -0.48446,
-    -0.48222,
-    -0.47773,
-    -0.47187,
-    -0.46607,
-    -0.46170,
-    -0.45934,
-    -0.45862,
-    -0.45843,
-    -0.45752,
-    -0.45517,
-    -0.45154,
-    -0.44757,
-    -0.44441,
-    -0.44280,
-    -0.44263,
-    -0.44296,
-    -0.44254,
-    -0.44048,
-    -0.43677,
-    -0.43230,
-    -0.42842,
-    -0.42622,
-    -0.42592,
-    -0.42669,
-    -0.42709,
-    -0.42582,
-    -0.42242,
-    -0.41758,
-    -0.41281,
-    -0.40965,
-    -0.40884,
-    -0.40987,
-    -0.41123,
-    -0.41112,
-    -0.40848,
-    -0.40352,
-    -0.39774,
-    -0.39313,
-    -0.39116,
-    -0.39200,
-    -0.39440,
-    -0.39635,
-    -0.39610,
-    -0.39319,
-    -0.38866,
-    -0.38452,
-    -0.38265,
-    -0.38368,
-    -0.38662,
-    -0.38926,
-    -0.38946,
-    -0.38636,
-    -0.38103,
-    -0.37606,
-    -0.37422,
-    -0.37689,
-    -0.38310,
-    -0.38982,
-    -0.39336,
-    -0.39139,
-    -0.38436,
-    -0.37559,
-    -0.36981,
-    -0.37067,
-    -0.37862,
-    -0.39019,
-    -0.39935,
-    -0.40043,
-    -0.39135,
-    -0.37533,
-    -0.36020,
-    -0.35505,
-    -0.36559,
-    -0.39035,
-    -0.41938,
-    -0.43673,
-    -0.42572,
-    -0.37528,
-    -0.28465,
-    -0.16448,
-    -0.03377,
-    0.08628,
-    0.17908,
-    0.23752,
-    0.26507,
-    0.27299,
-    0.27504,
-    0.28196,
-    0.29805,
-    0.32091,
-    0.34403,
-    0.36079,
-    0.36783,
-    0.36639,
-    0.36124,
-    0.35798,
-    0.36028,
-    0.36822,
-    0.37874,
-    0.38748,
-    0.39118,
-    0.38931,
-    0.38425,
-    0.37986,
-    0.37952,
-    0.38443,
-    0.39319,
-    0.40263,
-    0.40951,
-    0.41212,
-    0.41095,
-    0.40829,
-    0.40690,
-    0.40855,
-    0.41321,
-    0.41926,
-    0.42442,
-    0.42703,
-    0.42689,
-    0.42525,
-    0.42406,
-    0.42491,
-    0.42822,
-    0.43316,
-    0.43816,
-    0.44191,
-    0.44398,
-    0.44506,
-    0.44641,
-    0.44909,
-    0.45329,
-    0.45815,
-    0.46230,
-    0.46460,
-    0.46486,
-    0.46403,
-    0.46373,
-    0.46545,
-    0.46973,
-    0.47590,
-    0.48234,
-    0.48733,
-    0.48990,
-    0.49024,
-    0.48961,
-    0.48956,
-    0.49119,
-    0.49455,
-    0.49870,
-    0.50230,
-    0.50440,
-    0.50497,
-    0.50497,
-    0.50581,
-    0.50859,
-    0.51345,
-    0.51949,
-    0.52515,
-    0.52904,
-    0.53062,
-    0.53043,
-    0.52982,
-    0.53019,
-    0.53234,
-    0.53603,
-    0.54023,
-    0.54368,
-    0.54559,
-    0.54606,
-    0.54597,
-    0.54646,
-    0.54832,
-    0.55153,
-    0.55534,
-    0.55868,
-    0.56082,
-    0.56173,
-    0.56210,
-    0.56289,
-    0.56473,
-    0.56752,
-    0.57045,
-    0.57246,
-    0.57290,
-    0.57190,
-    0.57045,
-    0.56985,
-    0.57103,
-    0.57397,
-    0.57770,
-    0.58073,
-    0.58188,
-    0.58094,
-    0.57885,
-    0.57725,
-    0.57761,
-    0.58044,
-    0.58489,
-    0.58917,
-    0.59142,
-    0.59064,
-    0.58733,
-    0.58325,
-    0.58056,
-    0.58083,
-    0.58416,
-    0.58922,
-    0.59389,
-    0.59633,
-    0.59593,
-    0.59353,
-    0.59093,
-    0.58988,
-    0.59113,
-    0.59403,
-    0.59694,
-    0.59814,
-    0.59684,
-    0.59368,
-    0.59040,
-    0.58890,
-    0.59016,
-    0.59363,
-    0.59744,
-    0.59932,
-    0.59786,
-    0.59328,
-    0.58740,
-    0.58276,
-    0.58128,
-    0.58329,
-    0.58728,
-    0.59066,
-    0.59116,
-    0.58794,
-    0.58211,
-    0.57609,
-    0.57233,
-    0.57195,
-    0.57414,
-    0.57657,
-    0.57669,
-    0.57316,
-    0.56670,
-    0.55982,
-    0.55554,
-    0.55574,
-    0.56008,
-    0.56601,
-    0.57003,
-    0.56941,
-    0.56369,
-    0.55492,
-    0.54661,
-    0.54192,
-    0.54190,
-    0.54495,
-    0.54765,
-    0.54666,
-    0.54066,
-    0.53123,
-    0.52218,
-    0.51752,
-    0.51918,
-    0.52576,
-    0.53293,
-    0.53564,
-    0.53080,
-    0.51928,
-    0.50576,
-    0.49659,
-    0.49637,
-    0.50520,
-    0.51798,
-    0.52648,
-    0.52349,
-    0.50690,
-    0.48180,
-    0.45905,
-    0.45063,
-    0.46352,
-    0.49490,
-    0.53111,
-    0.55114,
-    0.53386,
-    0.46599,
-    0.34771,
-    0.19358,
-    0.02809,
-    -0.12228,
-    -0.23750,
-    -0.30963,
-    -0.34376,
-    -0.35413,
-    -0.35750,
-    -0.36649,
-    -0.38571,
-    -0.41174,
-    -0.43652,
-    -0.45220,
-    -0.45512,
-    -0.44728,
-    -0.43489,
-    -0.42513,
-    -0.42274,
-    -0.42817,
-    -0.43789,
-    -0.44655,
-    -0.44980,
-    -0.44627,
-    -0.43794,
-    -0.42879,
-    -0.42271,
-    -0.42156,
-    -0.42452,
-    -0.42874,
-    -0.43098,
-    -0.42926,
-    -0.42379,
-    -0.41662,
-    -0.41052,
-    -0.40750,
-    -0.40786,
-    -0.41019,
-    -0.41221,
-    -0.41192,
-    -0.40867,
-    -0.40332,
-    -0.39772,
-    -0.39372,
-    -0.39225,
-    -0.39288,
-    -0.39414,
-    -0.39433,
-    -0.39242,
-    -0.38853,
-    -0.38389,
-    -0.38016,
-    -0.37862,
-    -0.37955,
-    -0.38202,
-    -0.38439,
-    -0.38507,
-    -0.38324,
-    -0.37925,
-    -0.37451,
-    -0.37079,
-    -0.36949,
-    -0.37097,
-    -0.37440,
-    -0.37811,
-    -0.38031,
-    -0.37983,
-    -0.37668,
-    -0.37196,
-    -0.36742,
-    -0.36467,
-    -0.36446,
-    -0.36639,
-    -0.36912,
-    -0.37101,
-    -0.37093,
-    -0.36880,
-    -0.36564,
-    -0.36306,
-    -0.36248,
-    -0.36434,
-    -0.36783,
-    -0.37125,
-    -0.37279,
-    -0.37151,
-    -0.36786,
-    -0.36354,
-    -0.36076,
-    -0.36107,
-    -0.36459,
-    -0.36982,
-    -0.37436,
-    -0.37614,
-    -0.37450,
-    -0.37066,
-    -0.36717,
-    -0.36660,
-    -0.37011,
-    -0.37666,
-    -0.38339,
-    -0.38705,
-    -0.38574,
-    -0.38026,
-    -0.37395,
-    -0.37126,
-    -0.37534,
-    -0.38614,
-    -0.39985,
-    -0.41038,
-    -0.41230,
-    -0.40392,
-    -0.38896,
-    -0.37561,
-    -0.37315,
-    -0.38722,
-    -0.41589,
-    -0.44853,
-    -0.46825,
-    -0.45744,
-    -0.40436,
-    -0.30802,
-    -0.17947,
-    -0.03867,
-    0.09190,
-    0.19438,
-    0.26077,
-    0.29427,
-    0.30642,
-    0.31162,
-    0.32130,
-    0.34013,
-    0.36566,
-    0.39107,
-    0.40933,
-    0.41692,
-    0.41530,
-    0.40984,
-    0.40685,
-    0.41049,
-    0.42098,
-    0.43488,
-    0.44712,
-    0.45372,
-    0.45361,
-    0.44898,
-    0.44390,
-    0.44212,
-    0.44529,
-    0.45234,
-    0.46032,
-    0.46616,
-    0.46828,
-    0.46734,
-    0.46572,
-    0.46604,
-    0.46975,
-    0.47630,
-    0.48352,
-    0.48883,
-    0.49065,
-    0.48923,
-    0.48650,
-    0.48499,
-    0.48647,
-    0.49105,
-    0.49717,
-    0.50248,
-    0.50516,
-    0.50489,
-    0.50299,
-    0.50176,
-    0.50320,
-    0.50796,
-    0.51504,
-    0.52229,
-    0.52752,
-    0.52966,
-    0.52920,
-    0.52787,
-    0.52768,
-    0.52980,
-    0.53398,
-    0.53873,
-    0.54214,
-    0.54297,
-    0.54129,
-    0.53846,
-    0.53644,
-    0.53675,
-    0.53972,
-    0.54439,
-    0.54907,
-    0.55225,
-    0.55340,
-    0.55315,
-    0.55289,
-    0.55392,
-    0.55666,
-    0.56047,
-    0.56393,
-    0.56571,
-    0.56529,
-    0.56335,
-    0.56140,
-    0.56101,
-    0.56296,
-    0.56682,
-    0.57111,
-    0.57410,
-    0.57465,
-    0.57282,
-    0.56979,
-    0.56726,
-    0.56655,
-    0.56795,
-    0.57059,
-    0.57298,
-    0.57382,
-    0.57269,
-    0.57027,
-    0.56792,
-    0.56695,
-    0.56787,
-    0.57014,
-    0.57249,
-    0.57360,
-    0.57286,
-    0.57070,
-    0.56831,
-    0.56705,
-    0.56762,
-    0.56972,
-    0.57218,
-    0.57362,
-    0.57319,
-    0.57111,
-    0.56851,
-    0.56685,
-    0.56714,
-    0.56930,
-    0.57221,
-    0.57425,
-    0.57412,
-    0.57156,
-    0.56746,
-    0.56347,
-    0.56110,
-    0.56101,
-    0.56266,
-    0.56466,
-    0.56548,
-    0.56426,
-    0.56121,
-    0.55744,
-    0.55430,
-    0.55264,
-    0.55233,
-    0.55240,
-    0.55162,
-    0.54924,
-    0.54543,
-    0.54121,
-    0.53791,
-    0.53636,
-    0.53639,
-    0.53695,
-    0.53658,
-    0.53432,
-    0.53026,
-    0.52552,
-    0.52171,
-    0.51997,
-    0.52034,
-    0.52159,
-    0.52183,
-    0.51950,
-    0.51423,
-    0.50713,
-    0.50029,
-    0.49570,
-    0.49427,
-    0.49532,
-    0.49692,
-    0.49693,
-    0.49416,
-    0.48901,
-    0.48328,
-    0.47919,
-    0.47807,
-    0.47962,
-    0.48187,
-    0.48220,
-    0.47877,
-    0.47156,
-    0.46256,
-    0.45486,
-    0.45106,
-    0.45192,
-    0.45584,
-    0.45963,
-    0.46009,
-    0.45569,
-    0.44745,
-    0.43840,
-    0.43207,
-    0.43050,
-    0.43314,
-    0.43697,
-    0.43812,
-    0.43401,
-    0.42495,
-    0.41426,
-    0.40670,
-    0.40590,
-    0.41221,
-    0.42196,
-    0.42901,
-    0.42773,
-    0.41626,
-    0.39812,
-    0.38131,
-    0.37481,
-    0.38396,
-    0.40673,
-    0.43276,
-    0.44598,
-    0.43002,
-    0.37442,
-    0.27909,
-    0.15510,
-    0.02146,
-    -0.10096,
-    -0.19606,
-    -0.25699,
-    -0.28716,
-    -0.29741,
-    -0.30094,
-    -0.30803,
-    -0.32288,
-    -0.34335,
-    -0.36338,
-    -0.37677,
-    -0.38031,
-    -0.37517,
-    -0.36594,
-    -0.35818,
-    -0.35582,
-    -0.35952,
-    -0.36678,
-    -0.37360,
-    -0.37654,
-    -0.37446,
-    -0.36882,
-    -0.36278,
-    -0.35946,
-    -0.36040,
-    -0.36485,
-    -0.37030,
-    -0.37381,
-    -0.37342,
-    -0.36911,
-    -0.36268,
-    -0.35682,
-    -0.35378,
-    -0.35438,
-    -0.35771,
-    -0.36172,
-    -0.36426,
-    -0.36414,
-    -0.36157,
-    -0.35799,
-    -0.35526,
-    -0.35471,
-    -0.35654,
-    -0.35974,
-    -0.36267,
-    -0.36387,
-    -0.36279,
-    -0.36001,
-    -0.35694,
-    -0.35513,
-    -0.35546,
-    -0.35777,
-    -0.36091,
-    -0.36331,
-    -0.36375,
-    -0.36196,
-    -0.35877,
-    -0.35572,
-    -0.35437,
-    -0.35557,
-    -0.35904,
-    -0.36351,
-    -0.36729,
-    -0.36905,
-    -0.36846,
-    -0.36630,
-    -0.36411,
-    -0.36340,
-    -0.36498,
-    -0.36855,
-    -0.37286,
-    -0.37640,
-    -0.37812,
-    -0.37801,
-    -0.37713,
-    -0.37699,
-    -0.37881,
-    -0.38281,
-    -0.38802,
-    -0.39275,
-    -0.39547,
-    -0.39562,
-    -0.39400,
-    -0.39243,
-    -0.39280,
-    -0.39612,
-    -0.40185,
-    -0.40812,
-    -0.41263,
-    -0.41386,
-    -0.41195,
-    -0.40877,
-    -0.40701,
-    -0.40881,
-    -0.41455,
-    -0.42249,
-    -0.42954,
-    -0.43284,
-    -0.43129,
-    -0.42636,
-    -0.42148,
-    -0.42040,
-    -0.42519,
-    -0.43497,
-    -0.44617,
-    -0.45419,
-    -0.45586,
-    -0.45126,
-    -0.44406,
-    -0.43980,
-    -0.44301,
-    -0.45449,
-    -0.47032,
-    -0.48331,
-    -0.48652,
-    -0.47719,
-    -0.45913,
-    -0.44198,
-    -0.43725,
-    -0.45251,
-    -0.48636,
-    -0.52656,
-    -0.55274,
-    -0.54305,
-    -0.48228,
-    -0.36831,
-    -0.21398,
-    -0.04357,
-    0.11504,
-    0.23934,
-    0.31893,
-    0.35747,
-    0.36933,
-    0.37276,
-    0.38237,
-    0.40427,
-    0.43540,
-    0.46687,
-    0.48936,
-    0.49795,
-    0.49420,
-    0.48486,
-    0.47817,
-    0.47976,
-    0.49028,
-    0.50559,
-    0.51932,
-    0.52634,
-    0.52521,
-    0.51868,
-    0.51192,
-    0.50970,
-    0.51399,
-    0.52318,
-    0.53317,
-    0.53969,
-    0.54055,
-    0.53667,
-    0.53134,
-    0.52835,
-    0.52990,
-    0.53552,
-    0.54249,
-    0.54740,
-    0.54811,
-    0.54486,
-    0.54009,
-    0.53705,
-    0.53793,
-    0.54273,
-    0.54925,
-    0.55436,
-    0.55575,
-    0.55323,
-    0.54878,
-    0.54550,
-    0.54584,
-    0.55020,
-    0.55667,
-    0.56205,
-    0.56354,
-    0.56035,
-    0.55415,
-    0.54824,
-    0.54579,
-    0.54814,
-    0.55407,
-    0.56040,
-    0.56368,
-    0.56209,
-    0.55641,
-    0.54968,
-    0.54555,
-    0.54636,
-    0.55178,
-    0.55896,
-    0.56401,
-    0.56408,
-    0.55896,
-    0.55126,
-    0.54513,
-    0.54400,
-    0.54874,
-    0.55703,
-    0.56452,
-    0.56706,
-    0.56296,
-    0.55398,
-    0.54454,
-    0.53941,
-    0.54116,
-    0.54862,
-    0.55738,
-    0.56197,
-    0.55890,
-    0.54870,
-    0.53600,
-    0.52726,
-    0.52737,
-    0.53671,
-    0.55034,
-    0.56009,
-    0.55856,
-    0.54344,
-    0.51956,
-    0.49770,
-    0.48990,
-    0.50339,
-    0.53555,
-    0.57262,
-    0.59309,
-    0.57477,
-    0.50310,
-    0.37720,
-    0.21134,
-    0.03092,
-    -0.13550,
-    -0.26513,
-    -0.34749,
-    -0.38629,
-    -0.39613,
-    -0.39579,
-    -0.40087,
-    -0.41869,
-    -0.44726,
-    -0.47809,
-    -0.50134,
-    -0.51072,
-    -0.50618,
-    -0.49341,
-    -0.48064,
-    -0.47468,
-    -0.47792,
-    -0.48765,
-    -0.49791,
-    -0.50267,
-    -0.49886,
-    -0.48781,
-    -0.47436,
-    -0.46441,
-    -0.46192,
-    -0.46700,
-    -0.47594,
-    -0.48305,
-    -0.48349,
-    -0.47564,
-    -0.46192,
-    -0.44763,
-    -0.43838,
-    -0.43736,
-    -0.44382,
-    -0.45334,
-    -0.45999,
-    -0.45922,
-    -0.45012,
-    -0.43602,
-    -0.42297,
-    -0.41684,
-    -0.42032,
-    -0.43141,
-    -0.44398,
-    -0.45054,
-    -0.44586,
-    -0.42977,
-    -0.40792,
-    -0.38967,
-    -0.38406,
-    -0.39530,
-    -0.41978,
-    -0.44612,
-    -0.45830,
-    -0.44106,
-    -0.38542,
-    -0.29226,
-    -0.17259,
-    -0.04426,
-    0.07353,
-    0.16596,
-    0.22654,
-    0.25792,
-    0.26953,
-    0.27325,
-    0.27893,
-    0.29128,
-    0.30938,
-    0.32842,
-    0.34270,
-    0.34858,
-    0.34600,
-    0.33822,
-    0.33007,
-    0.32569,
-    0.32682,
-    0.33231,
-    0.33905,
-    0.34365,
-    0.34405,
-    0.34042,
-    0.33487,
-    0.33030,
-    0.32890,
-    0.33119,
-    0.33576,
-    0.34012,
-    0.34184,
-    0.33979,
-    0.33459,
-    0.32829,
-    0.32339,
-    0.32170,
-    0.32350,
-    0.32755,
-    0.33165,
-    0.33379,
-    0.33299,
-    0.32978,
-    0.32582,
-    0.32312,
-    0.32297,
-    0.32542,
-    0.32919,
-    0.33239,
-    0.33342,
-    0.33178,
-    0.32830,
-    0.32472,
-    0.32286,
-    0.32365,
-    0.32673,
-    0.33054,
-    0.33317,
-    0.33325,
-    0.33072,
-    0.32682,
-    0.32354,
-    0.32255,
-    0.32438,
-    0.32812,
-    0.33188,
-    0.33377,
-    0.33297,
-    0.33019,
-    0.32744,
-    0.32696,
-    0.33006,
-    0.33632,
-    0.34361,
-    0.34909,
-    0.35058,
-    0.34775,
-    0.34234,
-    0.33746,
-    0.33605,
-    0.33943,
-    0.34657,
-    0.35454,
-    0.36003,
-    0.36097,
-    0.35773,
-    0.35296,
-    0.35025,
-    0.35228,
-    0.35928,
-    0.36879,
-    0.37684,
-    0.38001,
-    0.37728,
-    0.37081,
-    0.36493,
-    0.36400,
-    0.37000,
-    0.38127,
-    0.39316,
-    0.40022,
-    0.39917,
-    0.39084,
-    0.38014,
-    0.37382,
-    0.37703,
-    0.39034,
-    0.40893,
-    0.42457,
-    0.42961,
-    0.42124,
-    0.40370,
-    0.38712,
-    0.38310,
-    0.39876,
-    0.43196,
-    0.47002,
-    0.49304,
-    0.48069,
-    0.42001,
-    0.31084,
-    0.16677,
-    0.01096,
-    -0.13149,
-    -0.24155,
-    -0.31172,
-    -0.34677,
-    -0.36004,
-    -0.36709,
-    -0.37955,
-    -0.40153,
-    -0.42980,
-    -0.45705,
-    -0.47631,
-    -0.48447,
-    -0.48337,
-    -0.47838,
-    -0.47539,
-    -0.47805,
-    -0.48636,
-    -0.49731,
-    -0.50683,
-    -0.51205,
-    -0.51257,
-    -0.51032,
-    -0.50824,
-    -0.50862,
-    -0.51200,
-    -0.51716,
-    -0.52205,
-    -0.52505,
-    -0.52586,
-    -0.52546,
-    -0.52543,
-    -0.52693,
-    -0.53006,
-    -0.53390,
-    -0.53711,
-    -0.53880,
-    -0.53898,
-    -0.53846,
-    -0.53826,
-    -0.53897,
-    -0.54042,
-    -0.54194,
-    -0.54294,
-    -0.54345,
-    -0.54423,
-    -0.54626,
-    -0.54996,
-    -0.55462,
-    -0.55859,
-    -0.56003,
-    -0.55811,
-    -0.55376,
-    -0.54955,
-    -0.54844,
-    -0.55219,
-    -0.56007,
-    -0.56883,
-    -0.57420,
-    -0.57308,
-    -0.56548,
-    -0.55503,
-    -0.54744,
-    -0.54763,
-    -0.55677,
-    -0.57105,
-    -0.58299,
-    -0.58501,
-    -0.57378,
-    -0.55294,
-    -0.53260,
-    -0.52518,
-    -0.53907,
-    -0.57298,
-    -0.61361,
-    -0.63851,
-    -0.62336,
-    -0.55118,
-    -0.41965,
-    -0.24342,
-    -0.05010,
-    0.12855,
-    0.26703,
-    0.35380,
-    0.39357,
-    0.40336,
-    0.40439,
-    0.41344,
-    0.43708,
-    0.47108,
-    0.50452,
-    0.52636,
-    0.53118,
-    0.52158,
-    0.50637,
-    0.49590,
-    0.49684,
-    0.50929,
-    0.52714,
-    0.54158,
-    0.54570,
-    0.53788,
-    0.52235,
-    0.50687,
-    0.49868,
-    0.50097,
-    0.51154,
-    0.52412,
-    0.53179,
-    0.53041,
-    0.52059,
-    0.50713,
-    0.49639,
-    0.49297,
-    0.49745,
-    0.50627,
-    0.51368,
-    0.51484,
-    0.50825,
-    0.49643,
-    0.48449,
-    0.47740,
-    0.47739,
-    0.48282,
-    0.48911,
-    0.49124,
-    0.48640,
-    0.47556,
-    0.46303,
-    0.45422,
-    0.45282,
-    0.45880,
-    0.46824,
-    0.47529,
-    0.47509,
-    0.46637,
-    0.45228,
-    0.43898,
-    0.43258,
-    0.43595,
-    0.44699,
-    0.45923,
-    0.46479,
-    0.45829,
-    0.43989,
-    0.41600,
-    0.39692,
-    0.39237,
-    0.40661,
-    0.43532,
-    0.46570,
-    0.48007,
-    0.46171,
-    0.40087,
-    0.29859,
-    0.16697,
-    0.02563,
-    -0.10424,
-    -0.20614,
-    -0.27261,
-    -0.30626,
-    -0.31740,
-    -0.31936,
-    -0.32345,
-    -0.33547,
-    -0.35471,
-    -0.37578,
-    -0.39195,
-    -0.39854,
-    -0.39506,
-    -0.38517,
-    -0.37474,
-    -0.36912,
-    -0.37078,
-    -0.37846,
-    -0.38800,
-    -0.39449,
-    -0.39463,
-    -0.38819,
-    -0.37801,
-    -0.36847,
-    -0.36339,
-    -0.36424,
-    -0.36949,
-    -0.37555,
-    -0.37858,
-    -0.37647,
-    -0.36984,
-    -0.36174,
-    -0.35600,
-    -0.35527,
-    -0.35950,
-    -0.36593,
-    -0.37034,
-    -0.36929,
-    -0.36198,
-    -0.35090,
-    -0.34083,
-    -0.33654,
-    -0.34033,
-    -0.35056,
-    -0.36205,
-    -0.36837,
-    -0.36495,
-    -0.35166,
-    -0.33353,
-    -0.31895,
-    -0.31609,
-    -0.32876,
-    -0.35369,
-    -0.38047,
-    -0.39446,
-    -0.38174,
-    -0.33413,
-    -0.25256,
-    -0.14716,
-    -0.03423,
-    0.06886,
-    0.14894,
-    0.20053,
-    0.22644,
-    0.23544,
-    0.23830,
-    0.24369,
-    0.25555,
-    0.27281,
-    0.29104,
-    0.30529,
-    0.31248,
-    0.31266,
-    0.30861,
-    0.30424,
-    0.30269,
-    0.30505,
-    0.31018,
-    0.31564,
-    0.31907,
-    0.31939,
-    0.31722,
-    0.31440,
-    0.31295,
-    0.31403,
-    0.31739,
-    0.32158,
-    0.32483,
-    0.32594,
-    0.32493,
-    0.32303,
-    0.32199,
-    0.32320,
-    0.32693,
-    0.33219,
-    0.33717,
-    0.34012,
-    0.34019,
-    0.33784,
-    0.33464,
-    0.33253,
-    0.33295,
-    0.33615,
-    0.34119,
-    0.34634,
-    0.35000,
-    0.35139,
-    0.35089,
-    0.34981,
-    0.34971,
-    0.35159,
-    0.35544,
-    0.36026,
-    0.36458,
-    0.36721,
-    0.36784,
-    0.36719,
-    0.36658,
-    0.36731,
-    0.36996,
-    0.37411,
-    0.37860,
-    0.38214,
-    0.38404,
-    0.38460,
-    0.38496,
-    0.38652,
-    0.39019,
-    0.39576,
-    0.40201,
-    0.40717,
-    0.40987,
-    0.40980,
-    0.40798,
-    0.40629,
-    0.40655,
-    0.40965,
-    0.41504,
-    0.42099,
-    0.42546,
-    0.42712,
-    0.42605,
-    0.42375,
-    0.42237,
-    0.42365,
-    0.42799,
-    0.43424,
-    0.44032,
-    0.44429,
-    0.44544,
-    0.44466,
-    0.44401,
-    0.44562,
-    0.45041,
-    0.45753,
-    0.46463,
-    0.46909,
-    0.46945,
-    0.46626,
-    0.46203,
-    0.46000,
-    0.46243,
-    0.46936,
-    0.47841,
-    0.48585,
-    0.48859,
-    0.48584,
-    0.47980,
-    0.47461,
-    0.47433,
-    0.48060,
-    0.49153,
-    0.50235,
-    0.50772,
-    0.50457,
-    0.49412,
-    0.48169,
-    0.47439,
-    0.47751,
-    0.49142,
-    0.51077,
-    0.52649,
-    0.53022,
-    0.51879,
-    0.49685,
-    0.47566,
-    0.46837,
-    0.48340,
-    0.51891,
-    0.56102,
-    0.58716,
-    0.57362,
-    0.50446,
-    0.37821,
-    0.20960,
-    0.02521,
-    -0.14507,
-    -0.27771,
-    -0.36241,
-    -0.40377,
-    -0.41739,
-    -0.42239,
-    -0.43367,
-    -0.45707,
-    -0.48895,
-    -0.52006,
-    -0.54112,
-    -0.54774,
-    -0.54216,
-    -0.53167,
-    -0.52458,
-    -0.52611,
-    -0.53614,
-    -0.54983,
-    -0.56049,
-    -0.56324,
-    -0.55740,
-    -0.54663,
-    -0.53681,
-    -0.53292,
-    -0.53658,
-    -0.54541,
-    -0.55449,
-    -0.55904,
-    -0.55692,
-    -0.54957,
-    -0.54113,
-    -0.53613,
-    -0.53709,
-    -0.54331,
-    -0.55129,
-    -0.55663,
-    -0.55639,
-    -0.55044,
-    -0.54151,
-    -0.53358,
-    -0.52982,
-    -0.53102,
-    -0.53532,
-    -0.53937,
-    -0.54023,
-    -0.53694,
-    -0.53095,
-    -0.52522,
-    -0.52252,
-    -0.52383,
-    -0.52781,
-    -0.53148,
-    -0.53193,
-    -0.52788,
-    -0.52042,
-    -0.51251,
-    -0.50735,
-    -0.50665,
-    -0.50977,
-    -0.51396,
-    -0.51590,
-    -0.51345,
-    -0.50685,
-    -0.49858,
-    -0.49209,
-    -0.48987,
-    -0.49214,
-    -0.49667,
-    -0.49995,
-    -0.49908,
-    -0.49335,
-    -0.48471,
-    -0.47673,
-    -0.47276,
-    -0.47407,
-    -0.47907,
-    -0.48411,
-    -0.48537,
-    -0.48089,
-    -0.47168,
-    -0.46128,
-    -0.45388,
-    -0.45208,
-    -0.45544,
-    -0.46055,
-    -0.46288,
-    -0.45925,
-    -0.44975,
-    -0.43793,
-    -0.42914,
-    -0.42767,
-    -0.43417,
-    -0.44487,
-    -0.45311,
-    -0.45266,
-    -0.44123,
-    -0.42233,
-    -0.40437,
-    -0.39693,
-    -0.40586,
-    -0.42923,
-    -0.45637,
-    -0.47060,
-    -0.45501,
-    -0.39890,
-    -0.30239,
-    -0.17720,
-    -0.04308,
-    0.07859,
-    0.17163,
-    0.22968,
-    0.25697,
-    0.26515,
-    0.26785,
-    0.27537,
-    0.29138,
-    0.31301,
-    0.33361,
-    0.34672,
-    0.34936,
-    0.34319,
-    0.33335,
-    0.32571,
-    0.32410,
-    0.32876,
-    0.33670,
-    0.34356,
-    0.34593,
-    0.34301,
-    0.33675,
-    0.33062,
-    0.32768,
-    0.32901,
-    0.33322,
-    0.33730,
-    0.33831,
-    0.33487,
-    0.32792,
-    0.32019,
-    0.31483,
-    0.31380,
-    0.31691,
-    0.32201,
-    0.32603,
-    0.32655,
-    0.32295,
-    0.31665,
-    0.31032,
-    0.30659,
-    0.30673,
-    0.31014,
-    0.31473,
-    0.31803,
-    0.31838,
-    0.31569,
-    0.31135,
-    0.30740,
-    0.30546,
-    0.30589,
-    0.30773,
-    0.30929,
-    0.30915,
-    0.30694,
-    0.30354,
-    0.30063,
-    0.29973,
-    0.30137,
-    0.30475,
-    0.30815,
-    0.30977,
-    0.30875,
-    0.30557,
-    0.30188,
-    0.29961,
-    0.29999,
-    0.30288,
-    0.30680,
-    0.30970,
-    0.31001,
-    0.30748,
-    0.30332,
-    0.29968,
-    0.29852,
-    0.30064,
-    0.30527,
-    0.31046,
-    0.31404,
-    0.31472,
-    0.31274,
-    0.30967,
-    0.30764,
-    0.30817,
-    0.31142,
-    0.31614,
-    0.32038,
-    0.32253,
-    0.32226,
-    0.32065,
-    0.31967,
-    0.32105,
-    0.32530,
-    0.33135,
-    0.33701,
-    0.34011,
-    0.33963,
-    0.33631,
-    0.33230,
-    0.33012,
-    0.33137,
-    0.33593,
-    0.34198,
-    0.34702,
-    0.34917,
-    0.34818,
-    0.34561,
-    0.34396,
-    0.34532,
-    0.35017,
-    0.35705,
-    0.36327,
-    0.36640,
-    0.36557,
-    0.36215,
-    0.35909,
-    0.35944,
-    0.36469,
-    0.37389,
-    0.38397,
-    0.39124,
-    0.39329,
-    0.39031,
-    0.38509,
-    0.38160,
-    0.38296,
-    0.38970,
-    0.39943,
-    0.40798,
-    0.41160,
-    0.40907,
-    0.40247,
-    0.39628,
-    0.39506,
-    0.40095,
-    0.41231,
-    0.42436,
-    0.43152,
-    0.43045,
-    0.42205,
-    0.41136,
-    0.40524,
-    0.40873,
-    0.42215,
-    0.44031,
-    0.45469,
-    0.45767,
-    0.44678,
-    0.42688,
-    0.40876,
-    0.40443,
-    0.42098,
-    0.45580,
-    0.49544,
-    0.51918,
-    0.50608,
-    0.44289,
-    0.32957,
-    0.18007,
-    0.01807,
-    -0.13076,
-    -0.24685,
-    -0.32217,
-    -0.36104,
-    -0.37656,
-    -0.38430,
-    -0.39624,
-    -0.41711,
-    -0.44437,
-    -0.47124,
-    -0.49096,
-    -0.50019,
-    -0.50023,
-    -0.49584,
-    -0.49257,
-    -0.49404,
-    -0.50060,
-    -0.50973,
-    -0.51779,
-    -0.52204,
-    -0.52192,
-    -0.51910,
-    -0.51628,
-    -0.51574,
-    -0.51814,
-    -0.52241,
-    -0.52648,
-    -0.52847,
-    -0.52766,
-    -0.52480,
-    -0.52158,
-    -0.51977,
-    -0.52034,
-    -0.52314,
-    -0.52709,
-    -0.53079,
-    -0.53318,
-    -0.53388,
-    -0.53320,
-    -0.53185,
-    -0.53052,
-    -0.52967,
-    -0.52947,
-    -0.52989,
-    -0.53077,
-    -0.53187,
-    -0.53284,
-    -0.53330,
-    -0.53293,
-    -0.53171,
-    -0.53005,
-    -0.52869,
-    -0.52840,
-    -0.52955,
-    -0.53180,
-    -0.53412,
-    -0.53524,
-    -0.53434,
-    -0.53160,
-    -0.52828,
-    -0.52618,
-    -0.52666,
-    -0.52983,
-    -0.53422,
-    -0.53733,
-    -0.53690,
-    -0.53212,
-    -0.52429,
-    -0.51643,
-    -0.51182,
-    -0.51233,
-    -0.51725,
-    -0.52346,
-    -0.52691,
-    -0.52475,
-    -0.51705,
-    -0.50707,
-    -0.49981,
-    -0.49931,
-    -0.50624,
-    -0.51696,
-    -0.52487,
-    -0.52366,
-    -0.51093,
-    -0.49038,
-    -0.47102,
-    -0.46345,
-    -0.47440,
-    -0.50215,
-    -0.53490,
-    -0.55352,
-    -0.53782,
-    -0.47421,
-    -0.36149,
-    -0.21243,
-    -0.05018,
-    0.09915,
-    0.21484,
-    0.28770,
-    0.32166,
-    0.33046,
-    0.33120,
-    0.33745,
-    0.35488,
-    0.38068,
-    0.40677,
-    0.42466,
-    0.42986,
-    0.42366,
-    0.41204,
-    0.40234,
-    0.39971,
-    0.40493,
-    0.41458,
-    0.42324,
-    0.42639,
-    0.42261,
-    0.41398,
-    0.40474,
-    0.39893,
-    0.39839,
-    0.40203,
-    0.40657,
-    0.40843,
-    0.40551,
-    0.39819,
-    0.38894,
-    0.38098,
-    0.37661,
-    0.37624,
-    0.37832,
-    0.38037,
-    0.38025,
-    0.37722,
-    0.37213,
-    0.36678,
-    0.36294,
-    0.36142,
-    0.36178,
-    0.36265,
-    0.36257,
-    0.36073,
-    0.35727,
-    0.35313,
-    0.34945,
-    0.34698,
-    0.34578,
-    0.34531,
-    0.34476,
-    0.34355,
-    0.34150,
-    0.33886,
-    0.33603,
-    0.33335,
-    0.33095,
-    0.32882,
-    0.32693,
-    0.32533,
-    0.32411,
-    0.32326,
-    0.32259,
-    0.32178,
-    0.32052,
-    0.31879,
-    0.31698,
-    0.31567,
-    0.31536,
-    0.31599,
-    0.31686,
-    0.31685,
-    0.31508,
-    0.31150,
-    0.30717,
-    0.30396,
-    0.30353,
-    0.30632,
-    0.31094,
-    0.31449,
-    0.31393,
-    0.30780,
-    0.29758,
-    0.28761,
-    0.28351,
-    0.28935,
-    0.30478,
-    0.32370,
-    0.33510,
-    0.32644,
-    0.28824,
-    0.21814,
-    0.12274,
-    0.01613,
-    -0.08445,
-    -0.16414,
-    -0.21520,
-    -0.23896,
-    -0.24427,
-    -0.24332,
-    -0.24655,
-    -0.25887,
-    -0.27865,
-    -0.29963,
-    -0.31475,
-    -0.31982,
-    -0.31555,
-    -0.30691,
-    -0.30043,
-    -0.30091,
-    -0.30907,
-    -0.32138,
-    -0.33206,
-    -0.33611,
-    -0.33187,
-    -0.32183,
-    -0.31136,
-    -0.30595,
-    -0.30851,
-    -0.31791,
-    -0.32972,
-    -0.33839,
-    -0.34012,
-    -0.33470,
-    -0.32553,
-    -0.31784,
-    -0.31601,
-    -0.32138,
-    -0.33164,
-    -0.34210,
-    -0.34813,
-    -0.34754,
-    -0.34171,
-    -0.33480,
-    -0.33155,
-    -0.33479,
-    -0.34394,
-    -0.35524,
-    -0.36373,
-    -0.36584,
-    -0.36131,
-    -0.35340,
-    -0.34730,
-    -0.34740,
-    -0.35497,
-    -0.36734,
-    -0.37913,
-    -0.38499,
-    -0.38244,
-    -0.37335,
-    -0.36324,
-    -0.35859,
-    -0.36349,
-    -0.37726,
-    -0.39435,
-    -0.40682,
-    -0.40827,
-    -0.39739,
-    -0.37936,
-    -0.36408,
-    -0.36182,
-    -0.37799,
-    -0.40940,
-    -0.44384,
-    -0.46347,
-    -0.45091,
-    -0.39564,
-    -0.29834,
-    -0.17119,
-    -0.03417,
-    0.09135,
-    0.18919,
-    0.25274,
-    0.28565,
-    0.29884,
-    0.30546,
-    0.31573,
-    0.33387,
-    0.35788,
-    0.38185,
-    0.39961,
-    0.40780,
-    0.40723,
-    0.40217,
-    0.39804,
-    0.39891,
-    0.40581,
-    0.41667,
-    0.42764,
-    0.43509,
-    0.43735,
-    0.43523,
-    0.43147,
-    0.42920,
-    0.43046,
-    0.43534,
-    0.44211,
-    0.44824,
-    0.45169,
-    0.45188,
-    0.44986,
-    0.44771,
-    0.44744,
-    0.45006,
-    0.45513,
-    0.46106,
-    0.46591,
-    0.46833,
-    0.46816,
-    0.46635,
-    0.46453,
-    0.46409,
-    0.46564,
-    0.46874,
-    0.47220,
-    0.47477,
-    0.47572,
-    0.47514,
-    0.47390,
-    0.47312,
-    0.47364,
-    0.47559,
-    0.47842,
-    0.48117,
-    0.48302,
-    0.48364,
-    0.48333,
-    0.48279,
-    0.48271,
-    0.48339,
-    0.48460,
-    0.48572,
-    0.48617,
-    0.48579,
-    0.48497,
-    0.48453,
-    0.48526,
-    0.48748,
-    0.49077,
-    0.49409,
-    0.49620,
-    0.49629,
-    0.49440,
-    0.49147,
-    0.48892,
-    0.48800,
-    0.48919,
-    0.49191,
-    0.49483,
-    0.49647,
-    0.49595,
-    0.49348,
-    0.49027,
-    0.48793,
-    0.48770,
-    0.48977,
-    0.49317,
-    0.49623,
-    0.49738,
-    0.49597,
-    0.49260,
-    0.48882,
-    0.48634,
-    0.48611,
-    0.48780,
-    0.48997,
-    0.49084,
-    0.48924,
-    0.48537,
-    0.48072,
-    0.47735,
-    0.47674,
-    0.47892,
-    0.48222,
-    0.48411,
-    0.48242,
-    0.47665,
-    0.46839,
-    0.46074,
-    0.45679,
-    0.45800,
-    0.46328,
-    0.46935,
-    0.47231,
-    0.46967,
-    0.46183,
-    0.45217,
-    0.44544,
-    0.44530,
-    0.45210,
-    0.46219,
-    0.46933,
-    0.46774,
-    0.45542,
-    0.43600,
-    0.41794,
-    0.41098,
-    0.42125,
-    0.44700,
-    0.47725,
-    0.49427,
-    0.47941,
-    0.42005,
-    0.31498,
-    0.17596,
-    0.02441,
-    -0.11527,
-    -0.22356,
-    -0.29161,
-    -0.32285,
-    -0.33009,
-    -0.32952,
-    -0.33416,
-    -0.34953,
-    -0.37302,
-    -0.39681,
-    -0.41259,
-    -0.41594,
-    -0.40820,
-    -0.39544,
-    -0.38518,
-    -0.38271,
-    -0.38874,
-    -0.39952,
-    -0.40910,
-    -0.41248,
-    -0.40805,
-    -0.39817,
-    -0.38767,
-    -0.38126,
-    -0.38112,
-    -0.38599,
-    -0.39201,
-    -0.39488,
-    -0.39219,
-    -0.38453,
-    -0.37512,
-    -0.36797,
-    -0.36576,
-    -0.36849,
-    -0.37352,
-    -0.37708,
-    -0.37628,
-    -0.37059,
-    -0.36211,
-    -0.35437,
-    -0.35043,
-    -0.35132,
-    -0.35543,
-    -0.35952,
-    -0.36035,
-    -0.35647,
-    -0.34893,
-    -0.34070,
-    -0.33511,
-    -0.33406,
-    -0.33707,
-    -0.34160,
-    -0.34443,
-    -0.34342,
-    -0.33865,
-    -0.33235,
-    -0.32759,
-    -0.32659,
-    -0.32939,
-    -0.33374,
-    -0.33633,
-    -0.33458,
-    -0.32818,
-    -0.31945,
-    -0.31224,
-    -0.30994,
-    -0.31359,
-    -0.32112,
-    -0.32826,
-    -0.33061,
-    -0.32603,
-    -0.31589,
-    -0.30468,
-    -0.29784,
-    -0.29900,
-    -0.30789,
-    -0.32019,
-    -0.32937,
-    -0.32997,
-    -0.32055,
-    -0.30494,
-    -0.29098,
-    -0.28694,
-    -0.29735,
-    -0.31992,
-    -0.34518,
-    -0.35922,
-    -0.34855,
-    -0.30523,
-    -0.23017,
-    -0.13320,
-    -0.02996,
-    0.06321,
-    0.13444,
-    0.17944,
-    0.20173,
-    0.21004,
-    0.21426,
-    0.22161,
-    0.23456,
-    0.25111,
-    0.26677,
-    0.27742,
-    0.28135,
-    0.27991,
-    0.27653,
-    0.27489,
-    0.27710,
-    0.28286,
-    0.28990,
-    0.29527,
-    0.29699,
-    0.29495,
-    0.29097,
-    0.28778,
-    0.28765,
-    0.29133,
-    0.29770,
-    0.30438,
-    0.30889,
-    0.30984,
-    0.30749,
-    0.30359,
-    0.30048,
-    0.29998,
-    0.30262,
-    0.30750,
-    0.31281,
-    0.31673,
-    0.31833,
-    0.31793,
-    0.31683,
-    0.31662,
-    0.31837,
-    0.32213,
-    0.32691,
-    0.33124,
-    0.33394,
-    0.33465,
-    0.33404,
-    0.33344,
-    0.33415,
-    0.33678,
-    0.34098,
-    0.34558,
-    0.34923,
-    0.35107,
-    0.35115,
-    0.35043,
-    0.35029,
-    0.35180,
-    0.35520,
-    0.35977,
-    0.36416,
-    0.36711,
-    0.36808,
-    0.36756,
-    0.36681,
-    0.36722,
-    0.36963,
-    0.37384,
-    0.37870,
-    0.38271,
-    0.38477,
-    0.38478,
-    0.38370,
-    0.38310,
-    0.38434,
-    0.38785,
-    0.39287,
-    0.39784,
-    0.40114,
-    0.40202,
-    0.40096,
-    0.39949,
-    0.39942,
-    0.40187,
-    0.40667,
-    0.41240,
-    0.41708,
-    0.41922,
-    0.41862,
-    0.41652,
-    0.41501,
-    0.41596,
-    0.42002,
-    0.42620,
-    0.43236,
-    0.43631,
-    0.43690,
-    0.43469,
-    0.43166,
-    0.43021,
-    0.43181,
-    0.43624,
-    0.44161,
-    0.44540,
-    0.44587,
-    0.44310,
-    0.43910,
-    0.43686,
-    0.43876,
-    0.44518,
-    0.45413,
-    0.46206,
-    0.46571,
-    0.46378,
-    0.45783,
-    0.45159,
-    0.44910,
-    0.45255,
-    0.46100,
-    0.47062,
-    0.47661,
-    0.47580,
-    0.46853,
-    0.45882,
-    0.45252,
-    0.45419,
-    0.46441,
-    0.47885,
-    0.49000,
-    0.49087,
-    0.47898,
-    0.45856,
-    0.43957,
-    0.43343,
-    0.44724,
-    0.47894,
-    0.51581,
-    0.53758,
-    0.52317,
-    0.45864,
-    0.34306,
-    0.18990,
-    0.02309,
-    -0.13067,
-    -0.25042,
-    -0.32705,
-    -0.36462,
-    -0.37692,
-    -0.38088,
-    -0.38977,
-    -0.40902,
-    -0.43587,
-    -0.46263,
-    -0.48149,
-    -0.48861,
-    -0.48565,
-    -0.47842,
-    -0.47358,
-    -0.47530,
-    -0.48349,
-    -0.49436,
-    -0.50271,
-    -0.50487,
-    -0.50044,
-    -0.49232,
-    -0.48499,
-    -0.48205,
-    -0.48441,
-    -0.49000,
-    -0.49500,
-    -0.49597,
-    -0.49166,
-    -0.48359,
-    -0.47519,
-    -0.46999,
-    -0.46979,
-    -0.47387,
-    -0.47943,
-    -0.48315,
-    -0.48283,
-    -0.47841,
-    -0.47187,
-    -0.46602,
-    -0.46299,
-    -0.46322,
-    -0.46531,
-    -0.46695,
-    -0.46621,
-    -0.46253,
-    -0.45700,
-    -0.45165,
-    -0.44832,
-    -0.44766,
-    -0.44886,
-    -0.45012,
-    -0.44969,
-    -0.44680,
-    -0.44207,
-    -0.43709,
-    -0.43352,
-    -0.43219,
-    -0.43269,
-    -0.43359,
-    -0.43332,
-    -0.43099,
-    -0.42686,
-    -0.42221,
-    -0.41854,
-    -0.41677,
-    -0.41675,
-    -0.41736,
-    -0.41715,
-    -0.41517,
-    -0.41147,
-    -0.40707,
-    -0.40336,
-    -0.40131,
-    -0.40095,
-    -0.40136,
-    -0.40119,
-    -0.39944,
-    -0.39600,
-    -0.39174,
-    -0.38796,
-    -0.38571,
-    -0.38516,
-    -0.38551,
-    -0.38544,
-    -0.38388,
-    -0.38057,
-    -0.37629,
-    -0.37236,
-    -0.36991,
-    -0.36928,
-    -0.36972,
-    -0.36989,
-    -0.36855,
-    -0.36531,
-    -0.36085,
-    -0.35658,
-    -0.35384,
-    -0.35315,
-    -0.35386,
-    -0.35449,
-    -0.35354,
-    -0.35037,
-    -0.34555,
-    -0.34066,
-    -0.33739,
-    -0.33659,
-    -0.33775,
-    -0.33920,
-    -0.33902,
-    -0.33607,
-    -0.33070,
-    -0.32466,
-    -0.32021,
-    -0.31890,
-    -0.32071,
-    -0.32398,
-    -0.32627,
-    -0.32568,
-    -0.32190,
-    -0.31644,
-    -0.31187,
-    -0.31035,
-    -0.31243,
-    -0.31657,
-    -0.31989,
-    -0.31977,
-    -0.31535,
-    -0.30824,
-    -0.30179,
-    -0.29937,
-    -0.30236,
-    -0.30913,
-    -0.31555,
-    -0.31710,
-    -0.31140,
-    -0.30009,
-    -0.28862,
-    -0.28399,
-    -0.29110,
-    -0.30943,
-    -0.33175,
-    -0.34574,
-    -0.33813,
-    -0.29983,
-    -0.22993,
-    -0.13672,
-    -0.03528,
-    0.05755,
-    0.12876,
-    0.17310,
-    0.19385,
-    0.20033,
-    0.20344,
-    0.21116,
-    0.22595,
-    0.24493,
-    0.26237,
-    0.27311,
-    0.27522,
-    0.27072,
-    0.26425,
-    0.26056,
-    0.26215,
-    0.26834,
-    0.27593,
-    0.28120,
-    0.28193,
-    0.27852,
-    0.27361,
-    0.27051,
-    0.27141,
-    0.27619,
-    0.28260,
-    0.28756,
-    0.28883,
-    0.28628,
-    0.28190,
-    0.27875,
-    0.27928,
-    0.28407,
-    0.29147,
-    0.29849,
-    0.30233,
-    0.30183,
-    0.29797,
-    0.29334,
-    0.29079,
-    0.29195,
-    0.29652,
-    0.30252,
-    0.30745,
-    0.30960,
-    0.30892,
-    0.30698,
-    0.30599,
-    0.30759,
-    0.31195,
-    0.31768,
-    0.32266,
-    0.32523,
-    0.32505,
-    0.32333,
-    0.32212,
-    0.32317,
-    0.32698,
-    0.33252,
-    0.33779,
-    0.34095,
-    0.34132,
-    0.33977,
-    0.33824,
-    0.33866,
-    0.34191,
-    0.34729,
-    0.35293,
-    0.35677,
-    0.35772,
-    0.35630,
-    0.35435,
-    0.35403,
-    0.35666,
-    0.36192,
-    0.36804,
-    0.37270,
-    0.37435,
-    0.37306,
-    0.37056,
-    0.36929,
-    0.37113,
-    0.37624,
-    0.38298,
-    0.38874,
-    0.39132,
-    0.39023,
-    0.38701,
-    0.38446,
-    0.38516,
-    0.39000,
-    0.39758,
-    0.40487,
-    0.40883,
-    0.40811,
-    0.40392,
-    0.39954,
-    0.39859,
-    0.40300,
-    0.41173,
-    0.42107,
-    0.42643,
-    0.42487,
-    0.41692,
-    0.40676,
-    0.40033,
-    0.40231,
-    0.41343,
-    0.42949,
-    0.44307,
-    0.44709,
-    0.43875,
-    0.42177,
-    0.40548,
-    0.40085,
-    0.41484,
-    0.44572,
-    0.48154,
-    0.50302,
-    0.48997,
-    0.42898,
-    0.31909,
-    0.17318,
-    0.01429,
-    -0.13183,
-    -0.24500,
-    -0.31649,
-    -0.35048,
-    -0.36062,
-    -0.36362,
-    -0.37253,
-    -0.39248,
-    -0.42038,
-    -0.44812,
-    -0.46746,
-    -0.47434,
-    -0.47046,
-    -0.46202,
-    -0.45626,
-    -0.45784,
-    -0.46685,
-    -0.47914,
-    -0.48884,
-    -0.49153,
-    -0.48643,
-    -0.47667,
-    -0.46749,
-    -0.46355,
-    -0.46656,
-    -0.47461,
-    -0.48329,
-    -0.48808,
-    -0.48666,
-    -0.48001,
-    -0.47179,
-    -0.46633,
-    -0.46641,
-    -0.47182,
-    -0.47959,
-    -0.48560,
-    -0.48674,
-    -0.48250,
-    -0.47520,
-    -0.46869,
-    -0.46639,
-    -0.46946,
-    -0.47624,
-    -0.48319,
-    -0.48669,
-    -0.48494,
-    -0.47886,
-    -0.47152,
-    -0.46652,
-    -0.46606,
-    -0.46984,
-    -0.47522,
-    -0.47868,
-    -0.47776,
-    -0.47238,
-    -0.46492,
-    -0.45896,
-    -0.45733,
-    -0.46048,
-    -0.46618,
-    -0.47055,
-    -0.47016,
-    -0.46388,
-    -0.45367,
-    -0.44371,
-    -0.43830,
-    -0.43960,
-    -0.44637,
-    -0.45450,
-    -0.45898,
-    -0.45660,
-    -0.44774,
-    -0.43637,
-    -0.42818,
-    -0.42752,
-    -0.43487,
-    -0.44617,
-    -0.45451,
-    -0.45358,
-    -0.44122,
-    -0.42130,
-    -0.40264,
-    -0.39519,
-    -0.40496,
-    -0.42997,
-    -0.45924,
-    -0.47563,
-    -0.46168,
-    -0.40627,
-    -0.30930,
-    -0.18253,
-    -0.04600,
-    0.07845,
-    0.17420,
-    0.23454,
-    0.26353,
-    0.27281,
-    0.27613,
-    0.28390,
-    0.29988,
-    0.32125,
-    0.34143,
-    0.35409,
-    0.35644,
-    0.35033,
-    0.34093,
-    0.33397,
-    0.33289,
-    0.33746,
-    0.34430,
-    0.34894,
-    0.34824,
-    0.34195,
-    0.33272,
-    0.32456,
-    0.32079,
-    0.32236,
-    0.32759,
-    0.33308,
-    0.33561,
-    0.33365,
-    0.32805,
-    0.32140,
-    0.31651,
-    0.31500,
-    0.31647,
-    0.31890,
-    0.31979,
-    0.31763,
-    0.31260,
-    0.30652,
-    0.30169,
-    0.29972,
-    0.30055,
-    0.30258,
-    0.30352,
-    0.30172,
-    0.29706,
-    0.29108,
-    0.28619,
-    0.28431,
-    0.28591,
-    0.28962,
-    0.29300,
-    0.29375,
-    0.29097,
-    0.28560,
-    0.27998,
-    0.27659,
-    0.27674,
-    0.27988,
-    0.28382,
-    0.28592,
-    0.28449,
-    0.27969,
-    0.27350,
-    0.26872,
-    0.26746,
-    0.26999,
-    0.27456,
-    0.27823,
-    0.27844,
-    0.27435,
-    0.26743,
-    0.26072,
-    0.25734,
-    0.25883,
-    0.26427,
-    0.27067,
-    0.27447,
-    0.27339,
-    0.26775,
-    0.26041,
-    0.25540,
-    0.25579,
-    0.26195,
-    0.27103,
-    0.27822,
-    0.27911,
-    0.27216,
-    0.26001,
-    0.24867,
-    0.24495,
-    0.25300,
-    0.27147,
-    0.29286,
-    0.30536,
-    0.29688,
-    0.25953,
-    0.19292,
-    0.10484,
-    0.00895,
-    -0.07959,
-    -0.14891,
-    -0.19385,
-    -0.21673,
-    -0.22536,
-    -0.22937,
-    -0.23635,
-    -0.24934,
-    -0.26658,
-    -0.28337,
-    -0.29491,
-    -0.29881,
-    -0.29618,
-    -0.29092,
-    -0.28772,
-    -0.28977,
-    -0.29733,
-    -0.30778,
-    -0.31702,
-    -0.32153,
-    -0.32008,
-    -0.31422,
-    -0.30747,
-    -0.30357,
-    -0.30471,
-    -0.31056,
-    -0.31858,
-    -0.32534,
-    -0.32829,
-    -0.32696,
-    -0.32315,
-    -0.31991,
-    -0.31999,
-    -0.32436,
-    -0.33178,
-    -0.33939,
-    -0.34421,
-    -0.34468,
-    -0.34152,
-    -0.33734,
-    -0.33538,
-    -0.33777,
-    -0.34443,
-    -0.35299,
-    -0.36000,
-    -0.36269,
-    -0.36045,
-    -0.35530,
-    -0.35090,
-    -0.35073,
-    -0.35620,
-    -0.36581,
-    -0.37567,
-    -0.38149,
-    -0.38082,
-    -0.37450,
-    -0.36655,
-    -0.36227,
-    -0.36554,
-    -0.37653,
-    -0.39120,
-    -0.40293,
-    -0.40574,
-    -0.39764,
-    -0.38232,
-    -0.36824,
-    -0.36496,
-    -0.37835,
-    -0.40663,
-    -0.43921,
-    -0.45931,
-    -0.44951,
-    -0.39820,
-    -0.30444,
-    -0.17910,
-    -0.04169,
-    0.08586,
-    0.18616,
-    0.25140,
-    0.28459,
-    0.29678,
-    0.30183,
-    0.31073,
-    0.32812,
-    0.35184,
-    0.37552,
-    0.39258,
-    0.39964,
-    0.39797,
-    0.39247,
-    0.38889,
-    0.39104,
-    0.39909,
-    0.40989,
-    0.41895,
-    0.42287,
-    0.42104,
-    0.41584,
-    0.41122,
-    0.41058,
-    0.41507,
-    0.42310,
-    0.43128,
-    0.43623,
-    0.43633,
-    0.43235,
-    0.42697,
-    0.42329,
-    0.42319,
-    0.42652,
-    0.43132,
-    0.43506,
-    0.43606,
-    0.43435,
-    0.43158,
-    0.43003,
-    0.43122,
-    0.43509,
-    0.43993,
-    0.44338,
-    0.44371,
-    0.44077,
-    0.43615,
-    0.43233,
-    0.43133,
-    0.43368,
-    0.43808,
-    0.44214,
-    0.44366,
-    0.44181,
-    0.43759,
-    0.43331,
-    0.43131,
-    0.43271,
-    0.43676,
-    0.44127,
-    0.44375,
-    0.44280,
-    0.43889,
-    0.43414,
-    0.43116,
-    0.43165,
-    0.43542,
-    0.44045,
-    0.44397,
-    0.44395,
-    0.44030,
-    0.43495,
-    0.43088,
-    0.43047,
-    0.43411,
-    0.43985,
-    0.44430,
-    0.44444,
-    0.43933,
-    0.43080,
-    0.42269,
-    0.41892,
-    0.42140,
-    0.42877,
-    0.43691,
-    0.44091,
-    0.43758,
-    0.42737,
-    0.41441,
-    0.40463,
-    0.40276,
-    0.40974,
-    0.42178,
-    0.43195,
-    0.43358,
-    0.42389,
-    0.40609,
-    0.38855,
-    0.38116,
-    0.39027,
-    0.41448,
-    0.44327,
-    0.45963,
-    0.44579,
-    0.38996,
-    0.29137,
-    0.16147,
-    0.02062,
-    -0.10846,
-    -0.20796,
-    -0.27016,
-    -0.29874,
-    -0.30583,
-    -0.30631,
-    -0.31194,
-    -0.32745,
-    -0.35021,
-    -0.37291,
-    -0.38796,
-    -0.39135,
-    -0.38435,
-    -0.37254,
-    -0.36284,
-    -0.36022,
-    -0.36550,
-    -0.37542,
-    -0.38458,
-    -0.38824,
-    -0.38462,
-    -0.37557,
-    -0.36539,
-    -0.35855,
-    -0.35748,
-    -0.36147,
-    -0.36724,
-    -0.37070,
-    -0.36913,
-    -0.36246,
-    -0.35328,
-    -0.34538,
-    -0.34181,
-    -0.34334,
-    -0.34810,
-    -0.35258,
-    -0.35346,
-    -0.34929,
-    -0.34122,
-    -0.33239,
-    -0.32632,
-    -0.32515,
-    -0.32852,
-    -0.33384,
-    -0.33760,
-    -0.33720,
-    -0.33233,
-    -0.32507,
-    -0.31884,
-    -0.31658,
-    -0.31909,
-    -0.32457,
-    -0.32936,
-    -0.32986,
-    -0.32443,
-    -0.31443,
-    -0.30374,
-    -0.29695,
-    -0.29702,
-    -0.30365,
-    -0.31311,
-    -0.31994,
-    -0.31953,
-    -0.31069,
-    -0.29664,
-    -0.28389,
-    -0.27938,
-    -0.28690,
-    -0.30451,
-    -0.32418,
-    -0.33399,
-    -0.32225,
-    -0.28188,
-    -0.21335,
-    -0.12498,
-    -0.03040,
-    0.05580,
-    0.12256,
-    0.16534,
-    0.18657,
-    0.19369,
-    0.19563,
-    0.19944,
-    0.20821,
-    0.22091,
-    0.23397,
-    0.24364,
-    0.24791,
-    0.24729,
-    0.24429,
-    0.24193,
-    0.24225,
-    0.24545,
-    0.25009,
-    0.25397,
-    0.25539,
-    0.25398,
-    0.25076,
-    0.24754,
-    0.24593,
-    0.24658,
-    0.24893,
-    0.25160,
-    0.25317,
-    0.25288,
-    0.25101,
-    0.24867,
-    0.24724,
-    0.24765,
-    0.25002,
-    0.25360,
-    0.25718,
-    0.25966,
-    0.26044,
-    0.25968,
-    0.25805,
-    0.25644,
-    0.25557,
-    0.25576,
-    0.25694,
-    0.25875,
-    0.26077,
-    0.26263,
-    0.26410,
-    0.26507,
-    0.26555,
-    0.26566,
-    0.26565,
-    0.26584,
-    0.26661,
-    0.26819,
-    0.27058,
-    0.27350,
-    0.27643,
-    0.27885,
-    0.28037,
-    0.28098,
-    0.28095,
-    0.28078,
-    0.28093,
-    0.28167,
-    0.28300,
-    0.28473,
-    0.28663,
-    0.28856,
-    0.29055,
-    0.29268,
-    0.29499,
-    0.29738,
-    0.29963,
-    0.30152,
-    0.30300,
-    0.30425,
-    0.30561,
-    0.30746,
-    0.30993,
-    0.31280,
-    0.31562,
-    0.31789,
-    0.31936,
-    0.32022,
-    0.32102,
-    0.32240,
-    0.32475,
-    0.32794,
-    0.33135,
-    0.33418,
-    0.33587,
-    0.33647,
-    0.33663,
-    0.33734,
-    0.33936,
-    0.34281,
-    0.34701,
-    0.35076,
-    0.35290,
-    0.35297,
-    0.35142,
-    0.34949,
-    0.34859,
-    0.34964,
-    0.35258,
-    0.35644,
-    0.35987,
-    0.36185,
-    0.36227,
-    0.36195,
-    0.36222,
-    0.36412,
-    0.36781,
-    0.37241,
-    0.37645,
-    0.37868,
-    0.37881,
-    0.37774,
-    0.37713,
-    0.37850,
-    0.38237,
-    0.38782,
-    0.39290,
-    0.39557,
-    0.39483,
-    0.39134,
-    0.38723,
-    0.38505,
-    0.38656,
-    0.39170,
-    0.39864,
-    0.40462,
-    0.40736,
-    0.40627,
-    0.40275,
-    0.39948,
-    0.39896,
-    0.40216,
-    0.40793,
-    0.41357,
-    0.41635,
-    0.41503,
-    0.41069,
-    0.40623,
-    0.40486,
-    0.40819,
-    0.41516,
-    0.42234,
-    0.42571,
-    0.42287,
-    0.41472,
-    0.40539,
-    0.40041,
-    0.40377,
-    0.41547,
-    0.43087,
-    0.44252,
-    0.44372,
-    0.43231,
-    0.41263,
-    0.39436,
-    0.38844,
-    0.40147,
-    0.43130,
-    0.46579,
-    0.48595,
-    0.47231,
-    0.41236,
-    0.30586,
-    0.16583,
-    0.01464,
-    -0.12328,
-    -0.22927,
-    -0.29582,
-    -0.32753,
-    -0.33758,
-    -0.34156,
-    -0.35122,
-    -0.37077,
-    -0.39694,
-    -0.42210,
-    -0.43885,
-    -0.44379,
-    -0.43877,
-    -0.42956,
-    -0.42270,
-    -0.42237,
-    -0.42872,
-    -0.43832,
-    -0.44634,
-    -0.44912,
-    -0.44591,
-    -0.43896,
-    -0.43207,
-    -0.42854,
-    -0.42952,
-    -0.43360,
-    -0.43786,
-    -0.43945,
-    -0.43719,
-    -0.43202,
-    -0.42638,
-    -0.42285,
-    -0.42271,
-    -0.42535,
-    -0.42864,
-    -0.43012,
-    -0.42829,
-    -0.42331,
-    -0.41688,
-    -0.41129,
-    -0.40824,
-    -0.40807,
-    -0.40971,
-    -0.41135,
-    -0.41147,
-    -0.40959,
-    -0.40642,
-    -0.40336,
-    -0.40164,
-    -0.40164,
-    -0.40265,
-    -0.40333,
-    -0.40244,
-    -0.39951,
-    -0.39514,
-    -0.39060,
-    -0.38722,
-    -0.38566,
-    -0.38562,
-    -0.38604,
-    -0.38565,
-    -0.38370,
-    -0.38029,
-    -0.37624,
-    -0.37270,
-    -0.37045,
-    -0.36957,
-    -0.36941,
-    -0.36899,
-    -0.36753,
-    -0.36484,
-    -0.36139,
-    -0.35802,
-    -0.35547,
-    -0.35397,
-    -0.35322,
-    -0.35251,
-    -0.35121,
-    -0.34901,
-    -0.34614,
-    -0.34314,
-    -0.34057,
-    -0.33871,
-    -0.33741,
-    -0.33626,
-    -0.33482,
-    -0.33287,
-    -0.33050,
-    -0.32802,
-    -0.32575,
-    -0.32381,
-    -0.32206,
-    -0.32026,
-    -0.31824,
-    -0.31607,
-    -0.31407,
-    -0.31264,
-    -0.31201,
-    -0.31207,
-    -0.31237,
-    -0.31233,
-    -0.31150,
-    -0.30976,
-    -0.30738,
-    -0.30483,
-    -0.30250,
-    -0.30052,
-    -0.29873,
-    -0.29682,
-    -0.29464,
-    -0.29231,
-    -0.29026,
-    -0.28897,
-    -0.28865,
-    -0.28906,
-    -0.28955,
-    -0.28934,
-    -0.28799,
-    -0.28560,
-    -0.28287,
-    -0.28074,
-    -0.27988,
-    -0.28034,
-    -0.28142,
-    -0.28203,
-    -0.28126,
-    -0.27888,
-    -0.27550,
-    -0.27235,
-    -0.27062,
-    -0.27085,
-    -0.27265,
-    -0.27485,
-    -0.27614,
-    -0.27576,
-    -0.27391,
-    -0.27168,
-    -0.27039,
-    -0.27088,
-    -0.27299,
-    -0.27556,
-    -0.27708,
-    -0.27655,
-    -0.27408,
-    -0.27095,
-    -0.26896,
-    -0.26942,
-    -0.27235,
-    -0.27630,
-    -0.27906,
-    -0.27883,
-    -0.27535,
-    -0.27021,
-    -0.26621,
-    -0.26591,
-    -0.27009,
-    -0.27703,
-    -0.28310,
-    -0.28451,
-    -0.27944,
-    -0.26949,
-    -0.25947,
-    -0.25547,
-    -0.26170,
-    -0.27773,
-    -0.29730,
-    -0.30962,
-    -0.30290,
-    -0.26882,
-    -0.20609,
-    -0.12163,
-    -0.02866,
-    0.05756,
-    0.12473,
-    0.16721,
-    0.18718,
-    0.19274,
-    0.19404,
-    0.19917,
-    0.21139,
-    0.22885,
-    0.24655,
-    0.25935,
-    0.26468,
-    0.26360,
-    0.25991,
-    0.25800,
-    0.26057,
-    0.26739,
-    0.27568,
-    0.28177,
-    0.28312,
-    0.27973,
-    0.27407,
-    0.26977,
-    0.26975,
-    0.27472,
-    0.28287,
-    0.29089,
-    0.29564,
-    0.29582,
-    0.29252,
-    0.28860,
-    0.28715,
-    0.28989,
-    0.29631,
-    0.30397,
-    0.30984,
-    0.31189,
-    0.31011,
-    0.30653,
-    0.30408,
-    0.30508,
-    0.31001,
-    0.31728,
-    0.32411,
-    0.32795,
-    0.32784,
-    0.32484,
-    0.32146,
-    0.32027,
-    0.32252,
-    0.32750,
-    0.33292,
-    0.33621,
-    0.33596,
-    0.33278,
-    0.32903,
-    0.32762,
-    0.33045,
-    0.33726,
-    0.34566,
-    0.35230,
-    0.35457,
-    0.35206,
-    0.34691,
-    0.34277,
-    0.34302,
-    0.34887,
-    0.35864,
-    0.36841,
-    0.37394,
-    0.37291,
-    0.36626,
-    0.35791,
-    0.35296,
-    0.35504,
-    0.36424,
-    0.37672,
-    0.38634,
-    0.38776,
-    0.37947,
-    0.36522,
-    0.35297,
-    0.35140,
-    0.36547,
-    0.39283,
-    0.42296,
-    0.43969,
-    0.42650,
-    0.37255,
-    0.27722,
-    0.15116,
-    0.01341,
-    -0.11451,
-    -0.21525,
-    -0.28058,
-    -0.31296,
-    -0.32320,
-    -0.32548,
-    -0.33172,
-    -0.34767,
-    -0.37191,
-    -0.39792,
-    -0.41798,
-    -0.42709,
-    -0.42514,
-    -0.41661,
-    -0.40818,
-    -0.40549,
-    -0.41065,
-    -0.42157,
-    -0.43333,
-    -0.44076,
-    -0.44103,
-    -0.43486,
-    -0.42603,
-    -0.41934,
-    -0.41826,
-    -0.42319,
-    -0.43145,
-    -0.43869,
-    -0.44117,
-    -0.43763,
-    -0.42995,
-    -0.42211,
-    -0.41819,
-    -0.42028,
-    -0.42734,
-    -0.43576,
-    -0.44115,
-    -0.44061,
-    -0.43426,
-    -0.42527,
-    -0.41830,
-    -0.41712,
-    -0.42262,
-    -0.43220,
-    -0.44096,
-    -0.44416,
-    -0.43973,
-    -0.42950,
-    -0.41858,
-    -0.41284,
-    -0.41590,
-    -0.42692,
-    -0.44059,
-    -0.44936,
-    -0.44716,
-    -0.43278,
-    -0.41123,
-    -0.39214,
-    -0.38566,
-    -0.39732,
-    -0.42441,
-    -0.45528,
-    -0.47257,
-    -0.45905,
-    -0.40406,
-    -0.30790,
-    -0.18237,
-    -0.04720,
-    0.07631,
-    0.17198,
-    0.23321,
-    0.26378,
-    0.27484,
-    0.27967,
-    0.28846,
-    0.30513,
-    0.32718,
-    0.34827,
-    0.36207,
-    0.36547,
-    0.35985,
-    0.35009,
-    0.34204,
-    0.33973,
-    0.34378,
-    0.35152,
-    0.35865,
-    0.36153,
-    0.35882,
-    0.35196,
-    0.34413,
-    0.33859,
-    0.33703,
-    0.33893,
-    0.34204,
-    0.34368,
-    0.34212,
-    0.33739,
-    0.33112,
-    0.32558,
-    0.32249,
-    0.32222,
-    0.32375,
-    0.32530,
-    0.32540,
-    0.32355,
-    0.32044,
-    0.31744,
-    0.31577,
-    0.31577,
-    0.31678,
-    0.31744,
-    0.31652,
-    0.31356,
-    0.30914,
-    0.30457,
-    0.30118,
-    0.29968,
-    0.29973,
-    0.30023,
-    0.29989,
-    0.29788,
-    0.29432,
-    0.29012,
-    0.28652,
-    0.28436,
-    0.28370,
-    0.28374,
-    0.28335,
-    0.28165,
-    0.27856,
-    0.27484,
-    0.27174,
-    0.27034,
-    0.27094,
-    0.27286,
-    0.27475,
-    0.27519,
-    0.27337,
-    0.26949,
-    0.26465,
-    0.26036,
-    0.25780,
-    0.25736,
-    0.25848,
-    0.25996,
-    0.26061,
-    0.25973,
-    0.25742,
-    0.25446,
-    0.25186,
-    0.25037,
-    0.25016,
-    0.25075,
-    0.25135,
-    0.25123,
-    0.25004,
-    0.24796,
-    0.24553,
-    0.24338,
-    0.24198,
-    0.24143,
-    0.24157,
-    0.24204,
-    0.24253,
-    0.24283,
-    0.24284,
-    0.24250,
-    0.24174,
-    0.24051,
-    0.23882,
-    0.23683,
-    0.23489,
-    0.23342,
-    0.23275,
-    0.23296,
-    0.23381,
-    0.23483,
-    0.23551,
-    0.23554,
-    0.23497,
-    0.23411,
-    0.23345,
-    0.23332,
-    0.23378,
-    0.23456,
-    0.23521,
-    0.23537,
-    0.23495,
-    0.23420,
-    0.23354,
-    0.23338,
-    0.23382,
-    0.23464,
-    0.23534,
-    0.23547,
-    0.23488,
-    0.23384,
-    0.23293,
-    0.23283,
-    0.23392,
-    0.23609,
-    0.23877,
-    0.24116,
-    0.24259,
-    0.24286,
-    0.24233,
-    0.24173,
-    0.24185,
-    0.24311,
-    0.24538,
-    0.24805,
-    0.25027,
-    0.25143,
-    0.25137,
-    0.25055,
-    0.24979,
-    0.24994,
-    0.25148,
-    0.25435,
-    0.25795,
-    0.26143,
-    0.26402,
-    0.26536,
-    0.26555,
-    0.26510,
-    0.26466,
-    0.26476,
-    0.26564,
-    0.26723,
-    0.26925,
-    0.27141,
-    0.27348,
-    0.27542,
-    0.27729,
-    0.27917,
-    0.28115,
-    0.28320,
-    0.28526,
-    0.28728,
-    0.28922,
-    0.29109,
-    0.29293,
-    0.29478,
-    0.29667,
-    0.29862,
-    0.30064,
-    0.30275,
-    0.30494,
-    0.30715,
-    0.30923,
-    0.31098,
-    0.31221,
-    0.31281,
-    0.31290,
-    0.31277,
-    0.31284,
-    0.31350,
-    0.31497,
-    0.31722,
-    0.31994,
-    0.32269,
-    0.32512,
-    0.32704,
-    0.32854,
-    0.32989,
-    0.33140,
-    0.33327,
-    0.33548,
-    0.33788,
-    0.34021,
-    0.34234,
-    0.34424,
-    0.34602,
-    0.34778,
-    0.34950,
-    0.35103,
-    0.35211,
-    0.35256,
-    0.35244,
-    0.35213,
-    0.35220,
-    0.35323,
-    0.35549,
-    0.35877,
-    0.36241,
-    0.36554,
-    0.36742,
-    0.36782,
-    0.36710,
-    0.36607,
-    0.36567,
-    0.36652,
-    0.36864,
-    0.37146,
-    0.37408,
-    0.37569,
-    0.37600,
-    0.37531,
-    0.37443,
-    0.37429,
-    0.37543,
-    0.37784,
-    0.38086,
-    0.38354,
-    0.38505,
-    0.38504,
-    0.38380,
-    0.38208,
-    0.38078,
-    0.38057,
-    0.38160,
-    0.38355,
-    0.38580,
-    0.38777,
-    0.38913,
-    0.38991,
-    0.39033,
-    0.39066,
-    0.39101,
-    0.39131,
-    0.39139,
-    0.39112,
-    0.39056,
-    0.38998,
-    0.38968,
-    0.38986,
-    0.39047,
-    0.39121,
-    0.39167,
-    0.39160,
-    0.39098,
-    0.39012,
-    0.38950,
-    0.38946,
-    0.39006,
-    0.39102,
-    0.39183,
-    0.39201,
-    0.39143,
-    0.39035,
-    0.38932,
-    0.38894,
-    0.38948,
-    0.39075,
-    0.39215,
-    0.39290,
-    0.39243,
-    0.39067,
-    0.38805,
-    0.38538,
-    0.38342,
-    0.38258,
-    0.38275,
-    0.38338,
-    0.38374,
-    0.38326,
-    0.38176,
-    0.37945,
-    0.37682,
-    0.37432,
-    0.37223,
-    0.37058,
-    0.36926,
-    0.36813,
-    0.36718,
-    0.36649,
-    0.36612,
-    0.36597,
-    0.36575,
-    0.36502,
-    0.36342,
-    0.36088,
-    0.35769,
-    0.35442,
-    0.35165,
-    0.34975,
-    0.34865,
-    0.34795,
-    0.34714,
-    0.34588,
-    0.34424,
-    0.34264,
-    0.34158,
-    0.34130,
-    0.34158,
-    0.34173,
-    0.34095,
-    0.33871,
-    0.33513,
-    0.33097,
-    0.32731,
-    0.32503,
-    0.32435,
-    0.32468,
-    0.32484,
-    0.32373,
-    0.32082,
-    0.31656,
-    0.31210,
-    0.30878,
-    0.30739,
-    0.30774,
-    0.30868,
-    0.30870,
-    0.30668,
-    0.30252,
-    0.29726,
-    0.29258,
-    0.28998,
-    0.28994,
-    0.29170,
-    0.29361,
-    0.29398,
-    0.29201,
-    0.28825,
-    0.28429,
-    0.28192,
-    0.28205,
-    0.28411,
-    0.28622,
-    0.28614,
-    0.28253,
-    0.27583,
-    0.26830,
-    0.26294,
-    0.26196,
-    0.26542,
-    0.27089,
-    0.27445,
-    0.27263,
-    0.26446,
-    0.25245,
-    0.24196,
-    0.23886,
-    0.24649,
-    0.26323,
-    0.28194,
-    0.29171,
-    0.28156,
-    0.24456,
-    0.18079,
-    0.09785,
-    0.00867,
-    -0.07271,
-    -0.13550,
-    -0.17528,
-    -0.19454,
-    -0.20067,
-    -0.20252,
-    -0.20687,
-    -0.21627,
-    -0.22912,
-    -0.24137,
-    -0.24912,
-    -0.25068,
-    -0.24731,
-    -0.24230,
-    -0.23925,
-    -0.24026,
-    -0.24505,
-    -0.25133,
-    -0.25612,
-    -0.25732,
-    -0.25474,
-    -0.25002,
-    -0.24573,
-    -0.24400,
-    -0.24550,
-    -0.24919,
-    -0.25301,
-    -0.25499,
-    -0.25424,
-    -0.25134,
-    -0.24793,
-    -0.24583,
-    -0.24605,
-    -0.24832,
-    -0.25133,
-    -0.25346,
-    -0.25365,
-    -0.25190,
-    -0.24925,
-    -0.24715,
-    -0.24668,
-    -0.24800,
-    -0.25032,
-    -0.25233,
-    -0.25299,
-    -0.25199,
-    -0.24998,
-    -0.24809,
-    -0.24736,
-    -0.24814,
-    -0.24992,
-    -0.25164,
-    -0.25229,
-    -0.25151,
-    -0.24978,
-    -0.24825,
-    -0.24806,
-    -0.24978,
-    -0.25303,
-    -0.25669,
-    -0.25941,
-    -0.26030,
-    -0.25941,
-    -0.25771,
-    -0.25656,
-    -0.25706,
-    -0.25948,
-    -0.26309,
-    -0.26655,
-    -0.26856,
-    -0.26855,
-    -0.26695,
-    -0.26502,
-    -0.26422,
-    -0.26555,
-    -0.26903,
-    -0.27374,
-    -0.27823,
-    -0.28119,
-    -0.28207,
-    -0.28123,
-    -0.27973,
-    -0.27877,
-    -0.27918,
-    -0.28101,
-    -0.28369,
-    -0.28635,
-    -0.28834,
-    -0.28954,
-    -0.29036,
-    -0.29147,
-    -0.29339,
-    -0.29618,
-    -0.29940,
-    -0.30233,
-    -0.30442,
-    -0.30556,
-    -0.30618,
-    -0.30700,
-    -0.30869,
-    -0.31147,
-    -0.31494,
-    -0.31829,
-    -0.32063,
-    -0.32147,
-    -0.32093,
-    -0.31972,
-    -0.31883,
-    -0.31906,
-    -0.32071,
-    -0.32348,
-    -0.32665,
-    -0.32944,
-    -0.33141,
-    -0.33259,
-    -0.33344,
-    -0.33459,
-    -0.33645,
-    -0.33909,
-    -0.34215,
-    -0.34510,
-    -0.34744,
-    -0.34897,
-    -0.34980,
-    -0.35025,
-    -0.35067,
-    -0.35124,
-    -0.35198,
-    -0.35280,
-    -0.35368,
-    -0.35473,
-    -0.35618,
-    -0.35824,
-    -0.36090,
-    -0.36383,
-    -0.36645,
-    -0.36818,
-    -0.36868,
-    -0.36810,
-    -0.36704,
-    -0.36637,
-    -0.36685,
-    -0.36879,
-    -0.37195,
-    -0.37561,
-    -0.37891,
-    -0.38119,
-    -0.38227,
-    -0.38244,
-    -0.38224,
-    -0.38217,
-    -0.38244,
-    -0.38292,
-    -0.38329,
-    -0.38333,
-    -0.38311,
-    -0.38301,
-    -0.38353,
-    -0.38503,
-    -0.38740,
-    -0.39010,
-    -0.39233,
-    -0.39336,
-    -0.39297,
-    -0.39149,
-    -0.38973,
-    -0.38853,
-    -0.38844,
-    -0.38939,
-    -0.39082,
-    -0.39201,
-    -0.39247,
-    -0.39225,
-    -0.39193,
-    -0.39228,
-    -0.39381,
-    -0.39641,
-    -0.39934,
-    -0.40153,
-    -0.40210,
-    -0.40088,
-    -0.39848,
-    -0.39611,
-    -0.39495,
-    -0.39558,
-    -0.39770,
-    -0.40021,
-    -0.40184,
-    -0.40171,
-    -0.39987,
-    -0.39724,
-    -0.39517,
-    -0.39475,
-    -0.39624,
-    -0.39892,
-    -0.40145,
-    -0.40253,
-    -0.40159,
-    -0.39905,
-    -0.39608,
-    -0.39396,
-    -0.39340,
-    -0.39419,
-    -0.39529,
-    -0.39547,
-    -0.39401,
-    -0.39109,
-    -0.38779,
-    -0.38543,
-    -0.38487,
-    -0.38597,
-    -0.38762,
-    -0.38832,
-    -0.38705,
-    -0.38387,
-    -0.37996,
-    -0.37702,
-    -0.37630,
-    -0.37777,
-    -0.38006,
-    -0.38103,
-    -0.37898,
-    -0.37369,
-    -0.36674,
-    -0.36095,
-    -0.35891,
-    -0.36160,
-    -0.36759,
-    -0.37358,
-    -0.37587,
-    -0.37227,
-    -0.36346,
-    -0.35286,
-    -0.34513,
-    -0.34379,
-    -0.34924,
-    -0.35814,
-    -0.36483,
-    -0.36402,
-    -0.35379,
-    -0.33715,
-    -0.32128,
-    -0.31448,
-    -0.32198,
-    -0.34251,
-    -0.36730,
-    -0.38226,
-    -0.37283,
-    -0.32943,
-    -0.25161,
-    -0.14882,
-    -0.03757,
-    0.06392,
-    0.14163,
-    0.18981,
-    0.21174,
-    0.21718,
-    0.21778,
-    0.22242,
-    0.23448,
-    0.25175,
-    0.26876,
-    0.28011,
-    0.28323,
-    0.27929,
-    0.27225,
-    0.26660,
-    0.26512,
-    0.26782,
-    0.27232,
-    0.27545,
-    0.27503,
-    0.27100,
-    0.26527,
-    0.26056,
-    0.25889,
-    0.26051,
-    0.26385,
-    0.26644,
-    0.26624,
-    0.26266,
-    0.25683,
-    0.25086,
-    0.24676,
-    0.24540,
-    0.24622,
-    0.24764,
-    0.24801,
-    0.24654,
-    0.24360,
-    0.24045,
-    0.23840,
-    0.23807,
-    0.23902,
-    0.24007,
-    0.24001,
-    0.23829,
-    0.23539,
-    0.23246,
-    0.23071,
-    0.23063,
-    0.23170,
-    0.23269,
-    0.23234,
-    0.23016,
-    0.22676,
-    0.22357,
-    0.22209,
-    0.22306,
-    0.22597,
-    0.22922,
-    0.23097,
-    0.23000,
-    0.22639,
-    0.22151,
-    0.21730,
-    0.21534,
-    0.21604,
-    0.21851,
-    0.22107,
-    0.22218,
-    0.22121,
-    0.21878,
-    0.21632,
-    0.21527,
-    0.21623,
-    0.21866,
-    0.22117,
-    0.22233,
-    0.22144,
-    0.21899,
-    0.21636,
-    0.21505,
-    0.21582,
-    0.21829,
-    0.22108,
-    0.22261,
-    0.22197,
-    0.21948,
-    0.21649,
-    0.21471,
-    0.21519,
-    0.21771,
-    0.22091,
-    0.22298,
-    0.22270,
-    0.22015,
-    0.21671,
-    0.21432,
-    0.21440,
-    0.21699,
-    0.22069,
-    0.22338,
-    0.22342,
-    0.22067,
-    0.21668,
-    0.21394,
-    0.21455,
-    0.21896,
-    0.22560,
-    0.23154,
-    0.23402,
-    0.23195,
-    0.22669,
-    0.22144,
-    0.21965,
-    0.22313,
-    0.23092,
-    0.23960,
-    0.24496,
-    0.24423,
-    0.23776,
-    0.22909,
-    0.22337,
-    0.22473,
-    0.23389,
-    0.24748,
-    0.25938,
-    0.26368,
-    0.25791,
-    0.24476,
-    0.23133,
-    0.22604,
-    0.23431,
-    0.25513,
-    0.28024,
-    0.29639,
-    0.29009,
-    0.25287,
-    0.18484,
-    0.09505,
-    -0.00150,
-    -0.08906,
-    -0.15620,
-    -0.19901,
-    -0.22112,
-    -0.23093,
-    -0.23755,
-    -0.24714,
-    -0.26122,
-    -0.27728,
-    -0.29114,
-    -0.29956,
-    -0.30194,
-    -0.30038,
-    -0.29837,
-    -0.29886,
-    -0.30293,
-    -0.30952,
-    -0.31631,
-    -0.32111,
-    -0.32302,
-    -0.32270,
-    -0.32179,
-    -0.32188,
-    -0.32360,
-    -0.32638,
-    -0.32900,
-    -0.33034,
-    -0.33016,
-    -0.32918,
-    -0.32864,
-    -0.32956,
-    -0.33211,
-    -0.33561,
-    -0.33893,
-    -0.34125,
-    -0.34249,
-    -0.34333,
-    -0.34469,
-    -0.34707,
-    -0.35011,
-    -0.35275,
-    -0.35389,
-    -0.35314,
-    -0.35119,
-    -0.34961,
-    -0.34996,
-    -0.35288,
-    -0.35758,
-    -0.36209,
-    -0.36432,
-    -0.36326,
-    -0.35968,
-    -0.35592,
-    -0.35472,
-    -0.35764,
-    -0.36409,
-    -0.37134,
-    -0.37587,
-    -0.37527,
-    -0.36975,
-    -0.36237,
-    -0.35770,
-    -0.35940,
-    -0.36807,
-    -0.38042,
-    -0.39051,
-    -0.39262,
-    -0.38447,
-    -0.36905,
-    -0.35397,
-    -0.34828,
-    -0.35783,
-    -0.38142,
-    -0.40954,
-    -0.42669,
-    -0.41654,
-    -0.36821,
-    -0.28081,
-    -0.16458,
-    -0.03787,
-    0.07885,
-    0.16960,
-    0.22749,
-    0.25576,
-    0.26509,
-    0.26845,
-    0.27593,
-    0.29153,
-    0.31294,
-    0.33408,
-    0.34882,
-    0.35409,
-    0.35112,
-    0.34441,
-    0.33923,
-    0.33909,
-    0.34429,
-    0.35218,
-    0.35884,
-    0.36124,
-    0.35863,
-    0.35277,
-    0.34685,
-    0.34377,
-    0.34480,
-    0.34905,
-    0.35419,
-    0.35765,
-    0.35794,
-    0.35520,
-    0.35100,
-    0.34735,
-    0.34567,
-    0.34616,
-    0.34784,
-    0.34922,
-    0.34908,
-    0.34714,
-    0.34405,
-    0.34101,
-    0.33905,
-    0.33858,
-    0.33917,
-    0.33992,
-    0.33994,
-    0.33881,
-    0.33677,
-    0.33449,
-    0.33269,
-    0.33175,
-    0.33149,
-    0.33133,
-    0.33057,
-    0.32874,
-    0.32583,
-    0.32226,
-    0.31871,
-    0.31581,
-    0.31395,
-    0.31318,
-    0.31324,
-    0.31366,
-    0.31395,
-    0.31369,
-    0.31264,
-    0.31080,
-    0.30842,
-    0.30589,
-    0.30366,
-    0.30202,
-    0.30094,
-    0.30005,
-    0.29878,
-    0.29664,
-    0.29350,
-    0.28977,
-    0.28629,
-    0.28394,
-    0.28321,
-    0.28383,
-    0.28487,
-    0.28508,
-    0.28361,
-    0.28050,
-    0.27682,
-    0.27417,
-    0.27379,
-    0.27577,
-    0.27864,
-    0.27991,
-    0.27725,
-    0.26993,
-    0.25970,
-    0.25047,
-    0.24686,
-    0.25180,
-    0.26442,
-    0.27914,
-    0.28671,
-    0.27703,
-    0.24278,
-    0.18257,
-    0.10218,
-    0.01321,
-    -0.07035,
-    -0.13657,
-    -0.17920,
-    -0.19921,
-    -0.20357,
-    -0.20206,
-    -0.20324,
-    -0.21141,
-    -0.22570,
-    -0.24138,
-    -0.25272,
-    -0.25600,
-    -0.25120,
-    -0.24191,
-    -0.23334,
-    -0.22985,
-    -0.23290,
-    -0.24056,
-    -0.24867,
-    -0.25307,
-    -0.25166,
-    -0.24538,
-    -0.23763,
-    -0.23250,
-    -0.23261,
-    -0.23782,
-    -0.24532,
-    -0.25105,
-    -0.25180,
-    -0.24676,
-    -0.23801,
-    -0.22943,
-    -0.22481,
-    -0.22596,
-    -0.23183,
-    -0.23909,
-    -0.24381,
-    -0.24347,
-    -0.23823,
-    -0.23082,
-    -0.22515,
-    -0.22428,
-    -0.22880,
-    -0.23647,
-    -0.24332,
-    -0.24565,
-    -0.24202,
-    -0.23406,
-    -0.22579,
-    -0.22163,
-    -0.22411,
-    -0.23240,
-    -0.24252,
-    -0.24918,
-    -0.24837,
-    -0.23966,
-    -0.22673,
-    -0.21606,
-    -0.21393,
-    -0.22323,
-    -0.24145,
-    -0.26081,
-    -0.27069,
-    -0.26143,
-    -0.22794,
-    -0.17175,
-    -0.10060,
-    -0.02588,
-    0.04114,
-    0.09269,
-    0.12633,
-    0.14466,
-    0.15342,
-    0.15872,
-    0.16488,
-    0.17339,
-    0.18333,
-    0.19268,
-    0.19975,
-    0.20408,
-    0.20644,
-    0.20817,
-    0.21035,
-    0.21325,
-    0.21634,
-    0.21877,
-    0.22005,
-    0.22029,
-    0.22023,
-    0.22066,
-    0.22203,
-    0.22407,
-    0.22605,
-    0.22721,
-    0.22724,
-    0.22656,
-    0.22608,
-    0.22675,
-    0.22894,
-    0.23231,
-    0.23586,
-    0.23855,
-    0.23984,
-    0.23994,
-    0.23969,
-    0.24004,
-    0.24145,
-    0.24363,
-    0.24569,
-    0.24674,
-    0.24651,
-    0.24565,
-    0.24549,
-    0.24735,
-    0.25168,
-    0.25764,
-    0.26331,
-    0.26660,
-    0.26638,
-    0.26318,
-    0.25917,
-    0.25718,
-    0.25921,
-    0.26526,
-    0.27300,
-    0.27877,
-    0.27938,
-    0.27400,
-    0.26518,
-    0.25813,
-    0.25861,
-    0.26989,
-    0.29034,
-    0.31269,
-    0.32561,
-    0.31719,
-    0.27921,
-    0.21046,
-    0.11787,
-    0.01473,
-    -0.08319,
-    -0.16246,
-    -0.21582,
-    -0.24377,
-    -0.25337,
-    -0.25495,
-    -0.25804,
-    -0.26806,
-    -0.28515,
-    -0.30513,
-    -0.32212,
-    -0.33161,
-    -0.33249,
-    -0.32739,
-    -0.32128,
-    -0.31909,
-    -0.32340,
-    -0.33335,
-    -0.34519,
-    -0.35411,
-    -0.35655,
-    -0.35194,
-    -0.34297,
-    -0.33439,
-    -0.33079,
-    -0.33446,
-    -0.34425,
-    -0.35603,
-    -0.36458,
-    -0.36602,
-    -0.35974,
-    -0.34879,
-    -0.33860,
-    -0.33448,
-    -0.33905,
-    -0.35075,
-    -0.36437,
-    -0.37333,
-    -0.37280,
-    -0.36239,
-    -0.34682,
-    -0.33427,
-    -0.33282,
-    -0.34630,
-    -0.37157,
-    -0.39827,
-    -0.41169,
-    -0.39764,
-    -0.34764,
-    -0.26242,
-    -0.15222,
-    -0.03380,
-    0.07475,
-    0.15953,
-    0.21457,
-    0.24258,
-    0.25273,
-    0.25636,
-    0.26269,
-    0.27592,
-    0.29487,
-    0.31471,
-    0.33003,
-    0.33747,
-    0.33715,
-    0.33220,
-    0.32702,
-    0.32514,
-    0.32778,
-    0.33362,
-    0.33978,
-    0.34344,
-    0.34318,
-    0.33952,
-    0.33454,
-    0.33069,
-    0.32967,
-    0.33167,
-    0.33550,
-    0.33923,
-    0.34120,
-    0.34068,
-    0.33810,
-    0.33467,
-    0.33171,
-    0.33010,
-    0.32993,
-    0.33061,
-    0.33129,
-    0.33125,
-    0.33019,
-    0.32828,
-    0.32602,
-    0.32394,
-    0.32241,
-    0.32159,
-    0.32136,
-    0.32145,
-    0.32152,
-    0.32123,
-    0.32031,
-    0.31868,
-    0.31643,
-    0.31389,
-    0.31147,
-    0.30954,
-    0.30824,
-    0.30741,
-    0.30671,
-    0.30576,
-    0.30443,
-    0.30293,
-    0.30172,
-    0.30116,
-    0.30126,
-    0.30144,
-    0.30075,
-    0.29835,
-    0.29408,
-    0.28883,
-    0.28434,
-    0.28248,
-    0.28428,
-    0.28909,
-    0.29457,
-    0.29743,
-    0.29501,
-    0.28675,
-    0.27503,
-    0.26457,
-    0.26061,
-    0.26625,
-    0.28031,
-    0.29650,
-    0.30480,
-    0.29452,
-    0.25819,
-    0.19467,
-    0.11026,
-    0.01715,
-    -0.07020,
-    -0.13957,
-    -0.18460,
-    -0.20621,
-    -0.21145,
-    -0.21018,
-    -0.21116,
-    -0.21909,
-    -0.23353,
-    -0.25013,
-    -0.26329,
-    -0.26902,
-    -0.26671,
-    -0.25921,
-    -0.25124,
-    -0.24711,
-    -0.24875,
-    -0.25504,
-    -0.26256,
-    -0.26737,
-    -0.26695,
-    -0.26131,
-    -0.25283,
-    -0.24503,
-    -0.24085,
-    -0.24129,
-    -0.24505,
-    -0.24934,
-    -0.25127,
-    -0.24934,
-    -0.24409,
-    -0.23780,
-    -0.23324,
-    -0.23233,
-    -0.23508,
-    -0.23962,
-    -0.24312,
-    -0.24320,
-    -0.23917,
-    -0.23244,
-    -0.22589,
-    -0.22246,
-    -0.22368,
-    -0.22873,
-    -0.23474,
-    -0.23805,
-    -0.23604,
-    -0.22865,
-    -0.21874,
-    -0.21112,
-    -0.21040,
-    -0.21871,
-    -0.23398,
-    -0.24999,
-    -0.25796,
-    -0.24948,
-    -0.21957,
-    -0.16869,
-    -0.10293,
-    -0.03226,
-    0.03254,
-    0.08315,
-    0.11600,
-    0.13273,
-    0.13886,
-    0.14125,
-    0.14550,
-    0.15413,
-    0.16633,
-    0.17901,
-    0.18868,
-    0.19319,
-    0.19254,
-    0.18872,
-    0.18454,
-    0.18233,
-    0.18296,
-    0.18574,
-    0.18900,
-    0.19116,
-    0.19153,
-    0.19060,
-    0.18963,
-    0.18986,
-    0.19178,
-    0.19482,
-    0.19771,
-    0.19909,
-    0.19837,
-    0.19600,
-    0.19332,
-    0.19190,
-    0.19272,
-    0.19573,
-    0.19982,
-    0.20342,
-    0.20528,
-    0.20503,
-    0.20339,
-    0.20173,
-    0.20139,
-    0.20299,
-    0.20614,
-    0.20968,
-    0.21229,
-    0.21314,
-    0.21235,
-    0.21085,
-    0.20994,
-    0.21059,
-    0.21295,
-    0.21630,
-    0.21942,
-    0.22120,
-    0.22120,
-    0.21988,
-    0.21836,
-    0.21791,
-    0.21929,
-    0.22249,
-    0.22670,
-    0.23073,
-    0.23356,
-    0.23472,
-    0.23445,
-    0.23353,
-    0.23283,
-    0.23297,
-    0.23412,
-    0.23603,
-    0.23828,
-    0.24052,
-    0.24259,
-    0.24451,
-    0.24635,
-    0.24806,
-    0.24949,
-    0.25042,
-    0.25076,
-    0.25068,
-    0.25059,
-    0.25098,
-    0.25223,
-    0.25439,
-    0.25718,
-    0.26009,
-    0.26267,
-    0.26470,
-    0.26628,
-    0.26770,
-    0.26927,
-    0.27104,
-    0.27279,
-    0.27412,
-    0.27469,
-    0.27453,
-    0.27405,
-    0.27396,
-    0.27493,
-    0.27726,
-    0.28069,
-    0.28444,
-    0.28756,
-    0.28932,
-    0.28956,
-    0.28875,
-    0.28779,
-    0.28758,
-    0.28865,
-    0.29086,
-    0.29356,
-    0.29589,
-    0.29720,
-    0.29736,
-    0.29681,
-    0.29633,
-    0.29665,
-    0.29808,
-    0.30038,
-    0.30288,
-    0.30482,
-    0.30570,
-    0.30557,
-    0.30496,
-    0.30466,
-    0.30531,
-    0.30712,
-    0.30974,
-    0.31243,
-    0.31435,
-    0.31496,
-    0.31423,
-    0.31266,
-    0.31105,
-    0.31022,
-    0.31062,
-    0.31226,
-    0.31471,
-    0.31729,
-    0.31939,
-    0.32062,
-    0.32098,
-    0.32072,
-    0.32027,
-    0.31995,
-    0.31994,
-    0.32019,
-    0.32051,
-    0.32071,
-    0.32067,
-    0.32042,
-    0.32010,
-    0.31989,
-    0.31990,
-    0.32014,
-    0.32047,
-    0.32074,
-    0.32079,
-    0.32059,
-    0.32023,
-    0.31990,
-    0.31977,
-    0.31992,
-    0.32029,
-    0.32069,
-    0.32091,
-    0.32083,
-    0.32047,
-    0.31999,
-    0.31965,
-    0.31965,
-    0.32000,
-    0.32056,
-    0.32104,
-    0.32116,
-    0.32082,
-    0.32015,
-    0.31949,
-    0.31921,
-    0.31953,
-    0.32038,
-    0.32137,
-    0.32197,
-    0.32170,
-    0.32036,
-    0.31818,
-    0.31571,
-    0.31359,
-    0.31233,
-    0.31204,
-    0.31241,
-    0.31287,
-    0.31280,
-    0.31179,
-    0.30980,
-    0.30713,
-    0.30426,
-    0.30167,
-    0.29965,
-    0.29827,
-    0.29742,
-    0.29695,
-    0.29669,
-    0.29649,
-    0.29621,
-    0.29561,
-    0.29444,
-    0.29251,
-    0.28984,
-    0.28673,
-    0.28372,
-    0.28146,
-    0.28038,
-    0.28050,
-    0.28136,
-    0.28219,
-    0.28219,
-    0.28093,
-    0.27848,
-    0.27540,
-    0.27244,
-    0.27020,
-    0.26878,
-    0.26781,
-    0.26664,
-    0.26476,
-    0.26211,
-    0.25918,
-    0.25681,
-    0.25571,
-    0.25610,
-    0.25747,
-    0.25877,
-    0.25887,
-    0.25709,
-    0.25353,
-    0.24912,
-    0.24514,
-    0.24267,
-    0.24209,
-    0.24295,
-    0.24417,
-    0.24464,
-    0.24374,
-    0.24159,
-    0.23893,
-    0.23667,
-    0.23533,
-    0.23477,
-    0.23427,
-    0.23293,
-    0.23023,
-    0.22641,
-    0.22237,
-    0.21931,
-    0.21805,
-    0.21862,
-    0.22020,
-    0.22145,
-    0.22124,
-    0.21919,
-    0.21588,
-    0.21254,
-    0.21042,
-    0.21014,
-    0.21134,
-    0.21288,
-    0.21342,
-    0.21212,
-    0.20913,
-    0.20549,
-    0.20261,
-    0.20153,
-    0.20234,
-    0.20415,
-    0.20549,
-    0.20515,
-    0.20273,
-    0.19893,
-    0.19516,
-    0.19284,
-    0.19270,
-    0.19437,
-    0.19669,
-    0.19824,
-    0.19814,
-    0.19643,
-    0.19398,
-    0.19193,
-    0.19104,
-    0.19122,
-    0.19166,
-    0.19133,
-    0.18965,
-    0.18697,
-    0.18440,
-    0.18324,
-    0.18423,
-    0.18702,
-    0.19024,
-    0.19217,
-    0.19168,
-    0.18886,
-    0.18512,
-    0.18245,
-    0.18239,
-    0.18516,
-    0.18942,
-    0.19290,
-    0.19362,
-    0.19099,
-    0.18622,
-    0.18180,
-    0.18022,
-    0.18259,
-    0.18791,
-    0.19345,
-    0.19614,
-    0.19422,
-    0.18832,
-    0.18135,
-    0.17712,
-    0.17831,
-    0.18487,
-    0.19379,
-    0.20032,
-    0.20043,
-    0.19306,
-    0.18114,
-    0.17063,
-    0.16783,
-    0.17617,
-    0.19387,
-    0.21373,
-    0.22537,
-    0.21895,
-    0.18901,
-    0.13673,
-    0.06965,
-    -0.00100,
-    -0.06414,
-    -0.11234,
-    -0.14361,
-    -0.16093,
-    -0.17004,
-    -0.17668,
-    -0.18451,
-    -0.19440,
-    -0.20522,
-    -0.21516,
-    -0.22299,
-    -0.22846,
-    -0.23196,
-    -0.23381,
-    -0.23396,
-    -0.23229,
-    -0.22936,
-    -0.22695,
-    -0.22784,
-    -0.23440,
-    -0.24678,
-    -0.26133,
-    -0.27067,
-    -0.26552,
-    -0.23807,
-    -0.18553,
-    -0.11212,
-    -0.02858,
-    0.05109,
-    0.11432,
-    0.15429,
-    0.17195,
-    0.17493,
-    0.17384,
-    0.17760,
-    0.18991,
-    0.20845,
-    0.22693,
-    0.23890,
-    0.24134,
-    0.23628,
-    0.22965,
-    0.22799,
-    0.23483,
-    0.24867,
-    0.26359,
-    0.27233,
-    0.27033,
-    0.25856,
-    0.24360,
-    0.23472,
-    0.23911,
-    0.25763,
-    0.28304,
-    0.30189,
-    0.29938,
-    0.26526,
-    0.19820,
-    0.10679,
-    0.00664,
-    -0.08505,
-    -0.15534,
-    -0.19928,
-    -0.22042,
-    -0.22793,
-    -0.23213,
-    -0.24026,
-    -0.25433,
-    -0.27163,
-    -0.28726,
-    -0.29721,
-    -0.30042,
-    -0.29908,
-    -0.29709,
-    -0.29788,
-    -0.30265,
-    -0.30995,
-    -0.31675,
-    -0.32023,
-    -0.31933,
-    -0.31534,
-    -0.31109,
-    -0.30945,
-    -0.31177,
-    -0.31724,
-    -0.32335,
-    -0.32724,
-    -0.32722,
-    -0.32356,
-    -0.31835,
-    -0.31439,
-    -0.31377,
-    -0.31694,
-    -0.32250,
-    -0.32804,
-    -0.33138,
-    -0.33157,
-    -0.32925,
-    -0.32621,
-    -0.32434,
-    -0.32467,
-    -0.32693,
-    -0.32979,
-    -0.33165,
-    -0.33154,
-    -0.32959,
-    -0.32692,
-    -0.32498,
-    -0.32479,
-    -0.32638,
-    -0.32885,
-    -0.33085,
-    -0.33134,
-    -0.33010,
-    -0.32786,
-    -0.32583,
-    -0.32507,
-    -0.32595,
-    -0.32795,
-    -0.32999,
-    -0.33099,
-    -0.33045,
-    -0.32870,
-    -0.32669,
-    -0.32548,
-    -0.32568,
-    -0.32716,
-    -0.32912,
-    -0.33053,
-    -0.33067,
-    -0.32948,
-    -0.32758,
-    -0.32596,
-    -0.32545,
-    -0.32632,
-    -0.32814,
-    -0.33003,
-    -0.33105,
-    -0.33067,
-    -0.32895,
-    -0.32648,
-    -0.32409,
-    -0.32242,
-    -0.32171,
-    -0.32170,
-    -0.32185,
-    -0.32162,
-    -0.32071,
-    -0.31917,
-    -0.31732,
-    -0.31557,
-    -0.31423,
-    -0.31341,
-    -0.31298,
-    -0.31273,
-    -0.31241,
-    -0.31182,
-    -0.31083,
-    -0.30939,
-    -0.30749,
-    -0.30517,
-    -0.30261,
-    -0.30009,
-    -0.29797,
-    -0.29658,
-    -0.29604,
-    -0.29624,
-    -0.29675,
-    -0.29701,
-    -0.29648,
-    -0.29488,
-    -0.29227,
-    -0.28907,
-    -0.28589,
-    -0.28331,
-    -0.28171,
-    -0.28113,
-    -0.28128,
-    -0.28169,
-    -0.28188,
-    -0.28147,
-    -0.28027,
-    -0.27833,
-    -0.27585,
-    -0.27314,
-    -0.27055,
-    -0.26838,
-    -0.26683,
-    -0.26598,
-    -0.26569,
-    -0.26570,
-    -0.26566,
-    -0.26523,
-    -0.26422,
-    -0.26260,
-    -0.26052,
-    -0.25823,
-    -0.25593,
-    -0.25374,
-    -0.25165,
-    -0.24957,
-    -0.24749,
-    -0.24550,
-    -0.24380,
-    -0.24262,
-    -0.24206,
-    -0.24198,
-    -0.24204,
-    -0.24176,
-    -0.24078,
-    -0.23906,
-    -0.23687,
-    -0.23480,
-    -0.23340,
-    -0.23296,
-    -0.23334,
-    -0.23396,
-    -0.23403,
-    -0.23292,
-    -0.23045,
-    -0.22698,
-    -0.22329,
-    -0.22030,
-    -0.21861,
-    -0.21834,
-    -0.21901,
-    -0.21985,
-    -0.22006,
-    -0.21917,
-    -0.21722,
-    -0.21469,
-    -0.21225,
-    -0.21050,
-    -0.20973,
-    -0.20988,
-    -0.21059,
-    -0.21141,
-    -0.21194,
-    -0.21198,
-    -0.21146,
-    -0.21042,
-    -0.20898,
-    -0.20725,
-    -0.20541,
-    -0.20370,
-    -0.20240,
-    -0.20174,
-    -0.20182,
-    -0.20248,
-    -0.20338,
-    -0.20409,
-    -0.20427,
-    -0.20386,
-    -0.20307,
-    -0.20232,
-    -0.20200,
-    -0.20228,
-    -0.20302,
-    -0.20383,
-    -0.20427,
-    -0.20409,
-    -0.20337,
-    -0.20250,
-    -0.20194,
-    -0.20202,
-    -0.20272,
-    -0.20367,
-    -0.20435,
-    -0.20439,
-    -0.20372,
-    -0.20269,
-    -0.20185,
-    -0.20169,
-    -0.20232,
-    -0.20343,
-    -0.20443,
-    -0.20475,
-    -0.20418,
-    -0.20298,
-    -0.20180,
-    -0.20130,
-    -0.20179,
-    -0.20307,
-    -0.20445,
-    -0.20517,
-    -0.20478,
-    -0.20342,
-    -0.20181,
-    -0.20085,
-    -0.20114,
-    -0.20259,
-    -0.20446,
-    -0.20565,
-    -0.20539,
-    -0.20372,
-    -0.20156,
-    -0.20035,
-    -0.20131,
-    -0.20470,
-    -0.20954,
-    -0.21397,
-    -0.21611,
-    -0.21506,
-    -0.21152,
-    -0.20763,
-    -0.20600,
-    -0.20838,
-    -0.21459,
-    -0.22233,
-    -0.22809,
-    -0.22882,
-    -0.22369,
-    -0.21489,
-    -0.20718,
-    -0.20581,
-    -0.21400,
-    -0.23070,
-    -0.24995,
-    -0.26232,
-    -0.25788,
-    -0.22996,
-    -0.17783,
-    -0.10748,
-    -0.02996,
-    0.04219,
-    0.09893,
-    0.13572,
-    0.15431,
-    0.16121,
-    0.16457,
-    0.17083,
-    0.18249,
-    0.19790,
-    0.21283,
-    0.22301,
-    0.22642,
-    0.22422,
-    0.22003,
-    0.21804,
-    0.22094,
-    0.22867,
-    0.23854,
-    0.24673,
-    0.25017,
-    0.24812,
-    0.24240,
-    0.23652,
-    0.23386,
-    0.23606,
-    0.24228,
-    0.24974,
-    0.25513,
-    0.25630,
-    0.25329,
-    0.24821,
-    0.24413,
-    0.24354,
-    0.24715,
-    0.25356,
-    0.26016,
-    0.26439,
-    0.26510,
-    0.26300,
-    0.26019,
-    0.25896,
-    0.26057,
-    0.26459,
-    0.26922,
-    0.27234,
-    0.27270,
-    0.27064,
-    0.26792,
-    0.26670,
-    0.26833,
-    0.27247,
-    0.27724,
-    0.28015,
-    0.27954,
-    0.27556,
-    0.27031,
-    0.26679,
-    0.26743,
-    0.27267,
-    0.28060,
-    0.28779,
-    0.29094,
-    0.28863,
-    0.28213,
-    0.27487,
-    0.27076,
-    0.27221,
-    0.27880,
-    0.28744,
-    0.29389,
-    0.29501,
-    0.29048,
-    0.28311,
-    0.27751,
-    0.27756,
-    0.28425,
-    0.29473,
-    0.30353,
-    0.30530,
-    0.29781,
-    0.28372,
-    0.26995,
-    0.26465,
-    0.27307,
-    0.29404,
-    0.31904,
-    0.33435,
-    0.32586,
-    0.28448,
-    0.21006,
-    0.11200,
-    0.00635,
-    -0.08960,
-    -0.16291,
-    -0.20873,
-    -0.23066,
-    -0.23806,
-    -0.24154,
-    -0.24865,
-    -0.26168,
-    -0.27804,
-    -0.29273,
-    -0.30148,
-    -0.30305,
-    -0.29958,
-    -0.29517,
-    -0.29361,
-    -0.29646,
-    -0.30250,
-    -0.30865,
-    -0.31185,
-    -0.31076,
-    -0.30636,
-    -0.30136,
-    -0.29862,
-    -0.29958,
-    -0.30354,
-    -0.30813,
-    -0.31065,
-    -0.30958,
-    -0.30532,
-    -0.29993,
-    -0.29593,
-    -0.29492,
-    -0.29675,
-    -0.29964,
-    -0.30129,
-    -0.30021,
-    -0.29652,
-    -0.29189,
-    -0.28855,
-    -0.28795,
-    -0.28989,
-    -0.29263,
-    -0.29387,
-    -0.29216,
-    -0.28780,
-    -0.28277,
-    -0.27963,
-    -0.27988,
-    -0.28292,
-    -0.28610,
-    -0.28607,
-    -0.28086,
-    -0.27140,
-    -0.26171,
-    -0.25724,
-    -0.26201,
-    -0.27581,
-    -0.29295,
-    -0.30337,
-    -0.29598,
-    -0.26296,
-    -0.20321,
-    -0.12341,
-    -0.03622,
-    0.04397,
-    0.10577,
-    0.14434,
-    0.16218,
-    0.16717,
-    0.16873,
-    0.17394,
-    0.18511,
-    0.19986,
-    0.21323,
-    0.22066,
-    0.22041,
-    0.21431,
-    0.20663,
-    0.20181,
-    0.20229,
-    0.20750,
-    0.21436,
-    0.21908,
-    0.21912,
-    0.21441,
-    0.20724,
-    0.20096,
-    0.19821,
-    0.19967,
-    0.20378,
-    0.20774,
-    0.20900,
-    0.20654,
-    0.20134,
-    0.19576,
-    0.19223,
-    0.19198,
-    0.19449,
-    0.19779,
-    0.19962,
-    0.19854,
-    0.19473,
-    0.18978,
-    0.18583,
-    0.18440,
-    0.18567,
-    0.18835,
-    0.19048,
-    0.19044,
-    0.18779,
-    0.18348,
-    0.17929,
-    0.17691,
-    0.17705,
-    0.17908,
-    0.18140,
-    0.18229,
-    0.18079,
-    0.17720,
-    0.17285,
-    0.16946,
-    0.16825,
-    0.16934,
-    0.17179,
-    0.17409,
-    0.17500,
-    0.17410,
-    0.17198,
-    0.16985,
-    0.16887,
-    0.16955,
-    0.17151,
-    0.17371,
-    0.17498,
-    0.17467,
-    0.17284,
-    0.17024,
-    0.16780,
-    0.16622,
-    0.16559,
-    0.16551,
-    0.16538,
-    0.16478,
-    0.16377,
-    0.16280,
-    0.16239,
-    0.16283,
-    0.16394,
-    0.16515,
-    0.16579,
-    0.16550,
-    0.16443,
-    0.16316,
-    0.16237,
-    0.16252,
-    0.16351,
-    0.16480,
-    0.16567,
-    0.16565,
-    0.16475,
-    0.16350,
-    0.16259,
-    0.16253,
-    0.16332,
-    0.16446,
-    0.16526,
-    0.16526,
-    0.16457,
-    0.16384,
-    0.16395,
-    0.16552,
-    0.16845,
-    0.17193,
-    0.17469,
-    0.17569,
-    0.17458,
-    0.17200,
-    0.16930,
-    0.16792,
-    0.16872,
-    0.17157,
-    0.17540,
-    0.17873,
-    0.18042,
-    0.18018,
-    0.17872,
-    0.17734,
-    0.17726,
-    0.17900,
-    0.18212,
-    0.18546,
-    0.18778,
-    0.18839,
-    0.18749,
-    0.18609,
-    0.18545,
-    0.18640,
-    0.18897,
-    0.19231,
-    0.19519,
-    0.19663,
-    0.19638,
-    0.19507,
-    0.19383,
-    0.19377,
-    0.19538,
-    0.19837,
-    0.20187,
-    0.20490,
-    0.20687,
-    0.20782,
-    0.20830,
-    0.20892,
-    0.21002,
-    0.21141,
-    0.21261,
-    0.21319,
-    0.21318,
-    0.21315,
-    0.21396,
-    0.21626,
-    0.21998,
-    0.22426,
-    0.22775,
-    0.22929,
-    0.22855,
-    0.22629,
-    0.22410,
-    0.22360,
-    0.22563,
-    0.22973,
-    0.23435,
-    0.23756,
-    0.23811,
-    0.23609,
-    0.23300,
-    0.23098,
-    0.23172,
-    0.23551,
-    0.24098,
-    0.24577,
-    0.24776,
-    0.24619,
-    0.24222,
-    0.23843,
-    0.23745,
-    0.24060,
-    0.24700,
-    0.25391,
-    0.25807,
-    0.25743,
-    0.25243,
-    0.24596,
-    0.24206,
-    0.24377,
-    0.25139,
-    0.26195,
-    0.27040,
-    0.27216,
-    0.26563,
-    0.25361,
-    0.24251,
-    0.23958,
-    0.24919,
-    0.26986,
-    0.29355,
-    0.30771,
-    0.29965,
-    0.26138,
-    0.19298,
-    0.10311,
-    0.00634,
-    -0.08172,
-    -0.14944,
-    -0.19247,
-    -0.21414,
-    -0.22291,
-    -0.22839,
-    -0.23740,
-    -0.25190,
-    -0.26936,
-    -0.28493,
-    -0.29442,
-    -0.29648,
-    -0.29303,
-    -0.28807,
-    -0.28556,
-    -0.28746,
-    -0.29305,
-    -0.29956,
-    -0.30386,
-    -0.30408,
-    -0.30054,
-    -0.29544,
-    -0.29157,
-    -0.29084,
-    -0.29339,
-    -0.29759,
-    -0.30110,
-    -0.30207,
-    -0.30017,
-    -0.29660,
-    -0.29341,
-    -0.29230,
-    -0.29378,
-    -0.29690,
-    -0.29984,
-    -0.30099,
-    -0.29976,
-    -0.29693,
-    -0.29415,
-    -0.29302,
-    -0.29420,
-    -0.29701,
-    -0.29982,
-    -0.30089,
-    -0.29935,
-    -0.29559,
-    -0.29115,
-    -0.28782,
-    -0.28679,
-    -0.28798,
-    -0.29017,
-    -0.29166,
-    -0.29115,
-    -0.28847,
-    -0.28458,
-    -0.28109,
-    -0.27933,
-    -0.27968,
-    -0.28138,
-    -0.28295,
-    -0.28302,
-    -0.28105,
-    -0.27760,
-    -0.27405,
-    -0.27179,
-    -0.27151,
-    -0.27282,
-    -0.27446,
-    -0.27499,
-    -0.27359,
-    -0.27050,
-    -0.26687,
-    -0.26415,
-    -0.26330,
-    -0.26428,
-    -0.26603,
-    -0.26706,
-    -0.26627,
-    -0.26351,
-    -0.25972,
-    -0.25639,
-    -0.25483,
-    -0.25541,
-    -0.25739,
-    -0.25925,
-    -0.25949,
-    -0.25737,
-    -0.25328,
-    -0.24852,
-    -0.24465,
-    -0.24269,
-    -0.24268,
-    -0.24374,
-    -0.24461,
-    -0.24436,
-    -0.24280,
-    -0.24054,
-    -0.23848,
-    -0.23724,
-    -0.23671,
-    -0.23614,
-    -0.23465,
-    -0.23180,
-    -0.22806,
-    -0.22465,
-    -0.22293,
-    -0.22355,
-    -0.22600,
-    -0.22863,
-    -0.22948,
-    -0.22730,
-    -0.22236,
-    -0.21652,
-    -0.21237,
-    -0.21196,
-    -0.21554,
-    -0.22116,
-    -0.22544,
-    -0.22512,
-    -0.21887,
-    -0.20834,
-    -0.19775,
-    -0.19218,
-    -0.19502,
-    -0.20591,
-    -0.21996,
-    -0.22901,
-    -0.22438,
-    -0.20016,
-    -0.15572,
-    -0.09631,
-    -0.03147,
-    0.02811,
-    0.07408,
-    0.10294,
-    0.11650,
-    0.12049,
-    0.12178,
-    0.12560,
-    0.13383,
-    0.14499,
-    0.15557,
-    0.16220,
-    0.16331,
-    0.15983,
-    0.15451,
-    0.15050,
-    0.14983,
-    0.15257,
-    0.15701,
-    0.16073,
-    0.16187,
-    0.16001,
-    0.15632,
-    0.15282,
-    0.15130,
-    0.15244,
-    0.15550,
-    0.15880,
-    0.16062,
-    0.16008,
-    0.15756,
-    0.15447,
-    0.15242,
-    0.15244,
-    0.15446,
-    0.15734,
-    0.15958,
-    0.16001,
-    0.15846,
-    0.15579,
-    0.15342,
-    0.15258,
-    0.15368,
-    0.15611,
-    0.15858,
-    0.15979,
-    0.15913,
-    0.15696,
-    0.15443,
-    0.15288,
-    0.15310,
-    0.15499,
-    0.15754,
-    0.15942,
-    0.15963,
-    0.15806,
-    0.15551,
-    0.15333,
-    0.15265,
-    0.15387,
-    0.15638,
-    0.15889,
-    0.16008,
-    0.15928,
-    0.15682,
-    0.15392,
-    0.15206,
-    0.15227,
-    0.15462,
-    0.15822,
-    0.16164,
-    0.16362,
-    0.16372,
-    0.16247,
-    0.16109,
-    0.16082,
-    0.16230,
-    0.16524,
-    0.16858,
-    0.17106,
-    0.17188,
-    0.17114,
-    0.16973,
-    0.16894,
-    0.16971,
-    0.17215,
-    0.17551,
-    0.17851,
-    0.18009,
-    0.17989,
-    0.17852,
-    0.17722,
-    0.17719,
-    0.17899,
-    0.18222,
-    0.18572,
-    0.18814,
-    0.18870,
-    0.18757,
-    0.18583,
-    0.18489,
-    0.18579,
-    0.18862,
-    0.19247,
-    0.19586,
-    0.19753,
-    0.19706,
-    0.19511,
-    0.19313,
-    0.19259,
-    0.19432,
-    0.19802,
-    0.20252,
-    0.20633,
-    0.20841,
-    0.20863,
-    0.20783,
-    0.20726,
-    0.20789,
-    0.20992,
-    0.21269,
-    0.21506,
-    0.21616,
-    0.21583,
-    0.21478,
-    0.21421,
-    0.21506,
-    0.21752,
-    0.22082,
-    0.22368,
-    0.22494,
-    0.22434,
-    0.22264,
-    0.22129,
-    0.22167,
-    0.22425,
-    0.22827,
-    0.23213,
-    0.23416,
-    0.23361,
-    0.23115,
-    0.22856,
-    0.22787,
-    0.23018,
-    0.23500,
-    0.24038,
-    0.24385,
-    0.24381,
-    0.24050,
-    0.23605,
-    0.23347,
-    0.23503,
-    0.24082,
-    0.24840,
-    0.25380,
-    0.25351,
-    0.24666,
-    0.23596,
-    0.22706,
-    0.22607,
-    0.23639,
-    0.25618,
-    0.27785,
-    0.28994,
-    0.28101,
-    0.24393,
-    0.17894,
-    0.09410,
-    0.00291,
-    -0.08005,
-    -0.14371,
-    -0.18369,
-    -0.20276,
-    -0.20878,
-    -0.21105,
-    -0.21670,
-    -0.22846,
-    -0.24464,
-    -0.26095,
-    -0.27302,
-    -0.27863,
-    -0.27844,
-    -0.27536,
-    -0.27284,
-    -0.27319,
-    -0.27665,
-    -0.28160,
-    -0.28567,
-    -0.28705,
-    -0.28540,
-    -0.28190,
-    -0.27848,
-    -0.27684,
-    -0.27759,
-    -0.28008,
-    -0.28287,
-    -0.28454,
-    -0.28439,
-    -0.28270,
-    -0.28050,
-    -0.27893,
-    -0.27866,
-    -0.27966,
-    -0.28128,
-    -0.28267,
-    -0.28326,
-    -0.28295,
-    -0.28202,
-    -0.28090,
-    -0.27983,
-    -0.27877,
-    -0.27753,
-    -0.27598,
-    -0.27427,
-    -0.27279,
-    -0.27203,
-    -0.27223,
-    -0.27320,
-    -0.27437,
-    -0.27500,
-    -0.27459,
-    -0.27309,
-    -0.27093,
-    -0.26881,
-    -0.26728,
-    -0.26654,
-    -0.26631,
-    -0.26608,
-    -0.26540,
-    -0.26417,
-    -0.26263,
-    -0.26124,
-    -0.26030,
-    -0.25979,
-    -0.25936,
-    -0.25855,
-    -0.25715,
-    -0.25535,
-    -0.25368,
-    -0.25269,
-    -0.25255,
-    -0.25290,
-    -0.25295,
-    -0.25194,
-    -0.24966,
-    -0.24670,
-    -0.24421,
-    -0.24327,
-    -0.24413,
-    -0.24584,
-    -0.24651,
-    -0.24426,
-    -0.23844,
-    -0.23042,
-    -0.22345,
-    -0.22140,
-    -0.22671,
-    -0.23858,
-    -0.25212,
-    -0.25930,
-    -0.25138,
-    -0.22216,
-    -0.17071,
-    -0.10232,
-    -0.02726,
-    0.04233,
-    0.09636,
-    0.12982,
-    0.14400,
-    0.14525,
-    0.14209,
-    0.14178,
-    0.14783,
-    0.15940,
-    0.17250,
-    0.18250,
-    0.18644,
-    0.18434,
-    0.17890,
-    0.17393,
-    0.17242,
-    0.17510,
-    0.18033,
-    0.18513,
-    0.18675,
-    0.18417,
-    0.17846,
-    0.17218,
-    0.16805,
-    0.16754,
-    0.17022,
-    0.17407,
-    0.17658,
-    0.17602,
-    0.17231,
-    0.16698,
-    0.16230,
-    0.16014,
-    0.16103,
-    0.16393,
-    0.16682,
-    0.16773,
-    0.16575,
-    0.16144,
-    0.15649,
-    0.15287,
-    0.15185,
-    0.15346,
-    0.15653,
-    0.15933,
-    0.16042,
-    0.15932,
-    0.15661,
-    0.15350,
-    0.15120,
-    0.15026,
-    0.15042,
-    0.15084,
-    0.15069,
-    0.14960,
-    0.14789,
-    0.14639,
-    0.14588,
-    0.14666,
-    0.14837,
-    0.15012,
-    0.15099,
-    0.15051,
-    0.14895,
-    0.14713,
-    0.14601,
-    0.14618,
-    0.14754,
-    0.14937,
-    0.15069,
-    0.15080,
-    0.14967,
-    0.14789,
-    0.14641,
-    0.14602,
-    0.14692,
-    0.14861,
-    0.15020,
-    0.15085,
-    0.15021,
-    0.14864,
-    0.14697,
-    0.14608,
-    0.14645,
-    0.14786,
-    0.14957,
-    0.15068,
-    0.15060,
-    0.14938,
-    0.14767,
-    0.14637,
-    0.14616,
-    0.14714,
-    0.14878,
-    0.15024,
-    0.15076,
-    0.15009,
-    0.14859,
-    0.14704,
-    0.14620,
-    0.14645,
-    0.14760,
-    0.14907,
-    0.15022,
-    0.15075,
-    0.15084,
-    0.15105,
-    0.15191,
-    0.15362,
-    0.15585,
-    0.15790,
-    0.15909,
-    0.15918,
-    0.15858,
-    0.15816,
-    0.15880,
-    0.16085,
-    0.16387,
-    0.16674,
-    0.16820,
-    0.16754,
-    0.16503,
-    0.16191,
-    0.15990,
-    0.16033,
-    0.16349,
-    0.16836,
-    0.17309,
-    0.17583,
-    0.17565,
-    0.17303,
-    0.16967,
-    0.16771,
-    0.16867,
-    0.17272,
-    0.17855,
-    0.18404,
-    0.18727,
-    0.18749,
-    0.18544,
-    0.18298,
-    0.18208,
-    0.18379,
-    0.18770,
-    0.19216,
-    0.19518,
-    0.19553,
-    0.19343,
-    0.19053,
-    0.18902,
-    0.19041,
-    0.19469,
-    0.20019,
-    0.20439,
-    0.20532,
-    0.20268,
-    0.19818,
-    0.19480,
-    0.19519,
-    0.20020,
-    0.20811,
-    0.21530,
-    0.21800,
-    0.21438,
-    0.20593,
-    0.19724,
-    0.19406,
-    0.20041,
-    0.21594,
-    0.23490,
-    0.24746,
-    0.24292,
-    0.21378,
-    0.15895,
-    0.08467,
-    0.00277,
-    -0.07320,
-    -0.13237,
-    -0.16982,
-    -0.18745,
-    -0.19235,
-    -0.19335,
-    -0.19745,
-    -0.20747,
-    -0.22180,
-    -0.23612,
-    -0.24602,
-    -0.24929,
-    -0.24684,
-    -0.24205,
-    -0.23889,
-    -0.23999,
-    -0.24547,
-    -0.25317,
-    -0.25990,
-    -0.26314,
-    -0.26222,
-    -0.25847,
-    -0.25445,
-    -0.25248,
-    -0.25355,
-    -0.25689,
-    -0.26057,
-    -0.26258,
-    -0.26193,
-    -0.25909,
-    -0.25569,
-    -0.25359,
-    -0.25384,
-    -0.25622,
-    -0.25936,
-    -0.26155,
-    -0.26163,
-    -0.25966,
-    -0.25676,
-    -0.25452,
-    -0.25413,
-    -0.25575,
-    -0.25844,
-    -0.26072,
-    -0.26135,
-    -0.26005,
-    -0.25756,
-    -0.25526,
-    -0.25440,
-    -0.25542,
-    -0.25773,
-    -0.26005,
-    -0.26111,
-    -0.26034,
-    -0.25819,
-    -0.25585,
-    -0.25462,
-    -0.25516,
-    -0.25716,
-    -0.25952,
-    -0.26092,
-    -0.26059,
-    -0.25872,
-    -0.25633,
-    -0.25477,
-    -0.25491,
-    -0.25669,
-    -0.25910,
-    -0.26080,
-    -0.26081,
-    -0.25909,
-    -0.25663,
-    -0.25485,
-    -0.25484,
-    -0.25664,
-    -0.25918,
-    -0.26076,
-    -0.25997,
-    -0.25653,
-    -0.25154,
-    -0.24704,
-    -0.24496,
-    -0.24607,
-    -0.24948,
-    -0.25299,
-    -0.25413,
-    -0.25155,
-    -0.24578,
-    -0.23916,
-    -0.23473,
-    -0.23467,
-    -0.23899,
-    -0.24528,
-    -0.24974,
-    -0.24900,
-    -0.24207,
-    -0.23121,
-    -0.22130,
-    -0.21771,
-    -0.22357,
-    -0.23763,
-    -0.25373,
-    -0.26244,
-    -0.25426,
-    -0.22321,
-    -0.16940,
-    -0.09943,
-    -0.02446,
-    0.04342,
-    0.09503,
-    0.12673,
-    0.14089,
-    0.14418,
-    0.14450,
-    0.14780,
-    0.15627,
-    0.16821,
-    0.17966,
-    0.18676,
-    0.18768,
-    0.18345,
-    0.17725,
-    0.17272,
-    0.17223,
-    0.17583,
-    0.18141,
-    0.18590,
-    0.18686,
-    0.18363,
-    0.17764,
-    0.17152,
-    0.16786,
-    0.16786,
-    0.17084,
-    0.17469,
-    0.17691,
-    0.17595,
-    0.17190,
-    0.16641,
-    0.16182,
-    0.15995,
-    0.16121,
-    0.16442,
-    0.16742,
-    0.16819,
-    0.16585,
-    0.16109,
-    0.15579,
-    0.15213,
-    0.15144,
-    0.15364,
-    0.15728,
-    0.16034,
-    0.16118,
-    0.15939,
-    0.15585,
-    0.15222,
-    0.15003,
-    0.14988,
-    0.15113,
-    0.15238,
-    0.15228,
-    0.15033,
-    0.14725,
-    0.14461,
-    0.14390,
-    0.14569,
-    0.14909,
-    0.15213,
-    0.15267,
-    0.14963,
-    0.14368,
-    0.13711,
-    0.13281,
-    0.13285,
-    0.13729,
-    0.14395,
-    0.14933,
-    0.15029,
-    0.14576,
-    0.13752,
-    0.12968,
-    0.12684,
-    0.13174,
-    0.14348,
-    0.15716,
-    0.16526,
-    0.16036,
-    0.13803,
-    0.09878,
-    0.04810,
-    -0.00527,
-    -0.05238,
-    -0.08702,
-    -0.10745,
-    -0.11636,
-    -0.11919,
-    -0.12155,
-    -0.12702,
-    -0.13612,
-    -0.14675,
-    -0.15572,
-    -0.16056,
-    -0.16070,
-    -0.15761,
-    -0.15387,
-    -0.15182,
-    -0.15249,
-    -0.15523,
-    -0.15832,
-    -0.15998,
-    -0.15935,
-    -0.15692,
-    -0.15414,
-    -0.15262,
-    -0.15329,
-    -0.15593,
-    -0.15942,
-    -0.16239,
-    -0.16393,
-    -0.16404,
-    -0.16344,
-    -0.16307,
-    -0.16346,
-    -0.16443,
-    -0.16529,
-    -0.16533,
-    -0.16446,
-    -0.16335,
-    -0.16318,
-    -0.16487,
-    -0.16849,
-    -0.17292,
-    -0.17636,
-    -0.17716,
-    -0.17484,
-    -0.17051,
-    -0.16646,
-    -0.16514,
-    -0.16776,
-    -0.17356,
-    -0.17995,
-    -0.18376,
-    -0.18289,
-    -0.17770,
-    -0.17122,
-    -0.16786,
-    -0.17125,
-    -0.18196,
-    -0.19628,
-    -0.20691,
-    -0.20531,
-    -0.18496,
-    -0.14421,
-    -0.08736,
-    -0.02354,
-    0.03627,
-    0.08295,
-    0.11215,
-    0.12522,
-    0.12803,
-    0.12806,
-    0.13130,
-    0.14012,
-    0.15300,
-    0.16592,
-    0.17483,
-    0.17767,
-    0.17533,
-    0.17102,
-    0.16848,
-    0.17015,
-    0.17604,
-    0.18386,
-    0.19037,
-    0.19304,
-    0.19132,
-    0.18686,
-    0.18255,
-    0.18107,
-    0.18352,
-    0.18896,
-    0.19497,
-    0.19895,
-    0.19944,
-    0.19680,
-    0.19299,
-    0.19049,
-    0.19105,
-    0.19480,
-    0.20026,
-    0.20514,
-    0.20751,
-    0.20673,
-    0.20372,
-    0.20039,
-    0.19863,
-    0.19934,
-    0.20207,
-    0.20539,
-    0.20772,
-    0.20824,
-    0.20731,
-    0.20618,
-    0.20625,
-    0.20816,
-    0.21138,
-    0.21444,
-    0.21572,
-    0.21442,
-    0.21114,
-    0.20764,
-    0.20608,
-    0.20780,
-    0.21263,
-    0.21878,
-    0.22369,
-    0.22529,
-    0.22305,
-    0.21833,
-    0.21374,
-    0.21181,
-    0.21372,
-    0.21857,
-    0.22383,
-    0.22660,
-    0.22515,
-    0.21996,
-    0.21360,
-    0.20953,
-    0.21026,
-    0.21594,
-    0.22396,
-    0.23010,
-    0.23060,
-    0.22426,
-    0.21348,
-    0.20360,
-    0.20054,
-    0.20780,
-    0.22407,
-    0.24270,
-    0.25342,
-    0.24584,
-    0.21338,
-    0.15610,
-    0.08112,
-    0.00050,
-    -0.07271,
-    -0.12864,
-    -0.16346,
-    -0.17987,
-    -0.18514,
-    -0.18775,
-    -0.19395,
-    -0.20580,
-    -0.22108,
-    -0.23521,
-    -0.24381,
-    -0.24495,
-    -0.23988,
-    -0.23233,
-    -0.22654,
-    -0.22532,
-    -0.22886,
-    -0.23495,
-    -0.24027,
-    -0.24216,
-    -0.23989,
-    -0.23490,
-    -0.22992,
-    -0.22754,
-    -0.22887,
-    -0.23303,
-    -0.23773,
-    -0.24047,
-    -0.23986,
-    -0.23632,
-    -0.23183,
-    -0.22883,
-    -0.22894,
-    -0.23209,
-    -0.23654,
-    -0.23977,
-    -0.23975,
-    -0.23605,
-    -0.23006,
-    -0.22432,
-    -0.22126,
-    -0.22195,
-    -0.22554,
-    -0.22970,
-    -0.23177,
-    -0.23012,
-    -0.22505,
-    -0.21863,
-    -0.21367,
-    -0.21232,
-    -0.21490,
-    -0.21967,
-    -0.22369,
-    -0.22426,
-    -0.22038,
-    -0.21333,
-    -0.20616,
-    -0.20218,
-    -0.20327,
-    -0.20874,
-    -0.21553,
-    -0.21957,
-    -0.21779,
-    -0.20988,
-    -0.19874,
-    -0.18943,
-    -0.18693,
-    -0.19354,
-    -0.20728,
-    -0.22192,
-    -0.22886,
-    -0.22013,
-    -0.19142,
-    -0.14382,
-    -0.08372,
-    -0.02072,
-    0.03544,
-    0.07786,
-    0.10419,
-    0.11667,
-    0.12051,
-    0.12155,
-    0.12409,
-    0.12976,
-    0.13762,
-    0.14533,
-    0.15061,
-    0.15237,
-    0.15110,
-    0.14839,
-    0.14604,
-    0.14523,
-    0.14613,
-    0.14799,
-    0.14976,
-    0.15063,
-    0.15038,
-    0.14939,
-    0.14825,
-    0.14740,
-    0.14687,
-    0.14634,
-    0.14537,
-    0.14378,
-    0.14180,
-    0.13996,
-    0.13888,
-    0.13889,
-    0.13985,
-    0.14119,
-    0.14216,
-    0.14216,
-    0.14100,
-    0.13893,
-    0.13651,
-    0.13435,
-    0.13284,
-    0.13208,
-    0.13192,
-    0.13209,
-    0.13238,
-    0.13270,
-    0.13303,
-    0.13337,
-    0.13364,
-    0.13369,
-    0.13339,
-    0.13267,
-    0.13160,
-    0.13034,
-    0.12904,
-    0.12780,
-    0.12659,
-    0.12539,
-    0.12425,
-    0.12337,
-    0.12304,
-    0.12348,
-    0.12465,
-    0.12615,
-    0.12731,
-    0.12748,
-    0.12638,
-    0.12438,
-    0.12236,
-    0.12142,
-    0.12228,
-    0.12481,
-    0.12795,
-    0.13006,
-    0.12974,
-    0.12661,
-    0.12176,
-    0.11754,
-    0.11656,
-    0.12041,
-    0.12850,
-    0.13767,
-    0.14286,
-    0.13865,
-    0.12126,
-    0.09005,
-    0.04809,
-    0.00140,
-    -0.04292,
-    -0.07885,
-    -0.10320,
-    -0.11629,
-    -0.12133,
-    -0.12283,
-    -0.12479,
-    -0.12933,
-    -0.13632,
-    -0.14396,
-    -0.14999,
-    -0.15296,
-    -0.15287,
-    -0.15105,
-    -0.14942,
-    -0.14950,
-    -0.15171,
-    -0.15527,
-    -0.15874,
-    -0.16077,
-    -0.16087,
-    -0.15957,
-    -0.15814,
-    -0.15786,
-    -0.15939,
-    -0.16237,
-    -0.16570,
-    -0.16809,
-    -0.16877,
-    -0.16792,
-    -0.16655,
-    -0.16599,
-    -0.16715,
-    -0.17000,
-    -0.17351,
-    -0.17612,
-    -0.17659,
-    -0.17464,
-    -0.17120,
-    -0.16810,
-    -0.16718,
-    -0.16939,
-    -0.17427,
-    -0.18002,
-    -0.18435,
-    -0.18550,
-    -0.18319,
-    -0.17887,
-    -0.17507,
-    -0.17431,
-    -0.17777,
-    -0.18458,
-    -0.19206,
-    -0.19686,
-    -0.19658,
-    -0.19110,
-    -0.18300,
-    -0.17673,
-    -0.17665,
-    -0.18488,
-    -0.19974,
-    -0.21557,
-    -0.22420,
-    -0.21763,
-    -0.19095,
-    -0.14435,
-    -0.08345,
-    -0.01769,
-    0.04257,
-    0.08928,
-    0.11889,
-    0.13301,
-    0.13705,
-    0.13783,
-    0.14083,
-    0.14850,
-    0.15988,
-    0.17178,
-    0.18071,
-    0.18461,
-    0.18383,
-    0.18070,
-    0.17835,
-    0.17908,
-    0.18340,
-    0.18986,
-    0.19597,
-    0.19946,
-    0.19939,
-    0.19656,
-    0.19298,
-    0.19081,
-    0.19125,
-    0.19397,
-    0.19742,
-    0.19963,
-    0.19938,
-    0.19677,
-    0.19327,
-    0.19091,
-    0.19124,
-    0.19454,
-    0.19964,
-    0.20451,
-    0.20722,
-    0.20695,
-    0.20432,
-    0.20103,
-    0.19899,
-    0.19933,
-    0.20184,
-    0.20510,
-    0.20731,
-    0.20722,
-    0.20484,
-    0.20145,
-    0.19889,
-    0.19859,
-    0.20080,
-    0.20439,
-    0.20743,
-    0.20822,
-    0.20621,
-    0.20238,
-    0.19875,
-    0.19733,
-    0.19905,
-    0.20318,
-    0.20758,
-    0.20985,
-    0.20852,
-    0.20403,
-    0.19858,
-    0.19513,
-    0.19582,
-    0.20078,
-    0.20775,
-    0.21307,
-    0.21347,
-    0.20788,
-    0.19841,
-    0.18972,
-    0.18703,
-    0.19346,
-    0.20792,
-    0.22456,
-    0.23421,
-    0.22748,
-    0.19825,
-    0.14624,
-    0.07757,
-    0.00303,
-    -0.06537,
-    -0.11813,
-    -0.15106,
-    -0.16593,
-    -0.16907,
-    -0.16841,
-    -0.17043,
-    -0.17804,
-    -0.19025,
-    -0.20340,
-    -0.21335,
-    -0.21755,
-    -0.21603,
-    -0.21119,
-    -0.20636,
-    -0.20427,
-    -0.20582,
-    -0.20992,
-    -0.21428,
-    -0.21668,
-    -0.21607,
-    -0.21298,
-    -0.20912,
-    -0.20638,
-    -0.20582,
-    -0.20716,
-    -0.20901,
-    -0.20971,
-    -0.20822,
-    -0.20478,
-    -0.20079,
-    -0.19812,
-    -0.19808,
-    -0.20070,
-    -0.20462,
-    -0.20772,
-    -0.20811,
-    -0.20514,
-    -0.19974,
-    -0.19405,
-    -0.19041,
-    -0.19019,
-    -0.19311,
-    -0.19727,
-    -0.20012,
-    -0.19961,
-    -0.19536,
-    -0.18885,
-    -0.18281,
-    -0.17993,
-    -0.18144,
-    -0.18642,
-    -0.19205,
-    -0.19489,
-    -0.19257,
-    -0.18513,
-    -0.17528,
-    -0.16743,
-    -0.16571,
-    -0.17186,
-    -0.18393,
-    -0.19640,
-    -0.20182,
-    -0.19346,
-    -0.16780,
-    -0.12608,
-    -0.07402,
-    -0.02008,
-    0.02736,
-    0.06255,
-    0.08390,
-    0.09388,
-    0.09745,
-    0.09985,
-    0.10456,
-    0.11235,
-    0.12150,
-    0.12919,
-    0.13304,
-    0.13234,
-    0.12830,
-    0.12334,
-    0.11995,
-    0.11954,
-    0.12191,
-    0.12555,
-    0.12849,
-    0.12935,
-    0.12788,
-    0.12507,
-    0.12248,
-    0.12142,
-    0.12232,
-    0.12457,
-    0.12689,
-    0.12804,
-    0.12747,
-    0.12559,
-    0.12348,
-    0.12231,
-    0.12273,
-    0.12448,
-    0.12657,
-    0.12773,
-    0.12708,
-    0.12455,
-    0.12093,
-    0.11747,
-    0.11530,
-    0.11492,
-    0.11601,
-    0.11768,
-    0.11889,
-    0.11903,
-    0.11811,
-    0.11672,
-    0.11566,
-    0.11550,
-    0.11627,
-    0.11753,
-    0.11855,
-    0.11879,
-    0.11815,
-    0.11701,
-    0.11599,
-    0.11565,
-    0.11616,
-    0.11721,
-    0.11823,
-    0.11866,
-    0.11828,
-    0.11732,
-    0.11630,
-    0.11578,
-    0.11603,
-    0.11691,
-    0.11793,
-    0.11853,
-    0.11840,
-    0.11761,
-    0.11660,
-    0.11591,
-    0.11592,
-    0.11662,
-    0.11764,
-    0.11841,
-    0.11851,
-    0.11790,
-    0.11688,
-    0.11602,
-    0.11578,
-    0.11631,
-    0.11735,
-    0.11834,
-    0.11874,
-    0.11829,
-    0.11717,
-    0.11593,
-    0.11523,
-    0.11557,
-    0.11705,
-    0.11934,
-    0.12185,
-    0.12396,
-    0.12529,
-    0.12576,
-    0.12557,
-    0.12506,
-    0.12455,
-    0.12426,
-    0.12431,
-    0.12475,
-    0.12562,
-    0.12693,
-    0.12858,
-    0.13039,
-    0.13202,
-    0.13318,
-    0.13373,
-    0.13380,
-    0.13379,
-    0.13419,
-    0.13534,
-    0.13723,
-    0.13945,
-    0.14138,
-    0.14246,
-    0.14253,
-    0.14200,
-    0.14161,
-    0.14215,
-    0.14400,
-    0.14686,
-    0.14982,
-    0.15177,
-    0.15191,
-    0.15023,
-    0.14757,
-    0.14531,
-    0.14473,
-    0.14643,
-    0.14998,
-    0.15411,
-    0.15730,
-    0.15848,
-    0.15756,
-    0.15550,
-    0.15380,
-    0.15380,
-    0.15602,
-    0.15986,
-    0.16394,
-    0.16673,
-    0.16731,
-    0.16580,
-    0.16327,
-    0.16119,
-    0.16068,
-    0.16202,
-    0.16456,
-    0.16714,
-    0.16877,
-    0.16914,
-    0.16875,
-    0.16860,
-    0.16948,
-    0.17147,
-    0.17382,
-    0.17533,
-    0.17505,
-    0.17295,
-    0.17011,
-    0.16826,
-    0.16893,
-    0.17257,
-    0.17813,
-    0.18344,
-    0.18623,
-    0.18525,
-    0.18104,
-    0.17581,
-    0.17242,
-    0.17290,
-    0.17734,
-    0.18365,
-    0.18844,
-    0.18876,
-    0.18379,
-    0.17567,
-    0.16883,
-    0.16809,
-    0.17613,
-    0.19155,
-    0.20848,
-    0.21812,
-    0.21162,
-    0.18346,
-    0.13375,
-    0.06855,
-    -0.00186,
-    -0.06632,
-    -0.11621,
-    -0.14791,
-    -0.16323,
-    -0.16797,
-    -0.16919,
-    -0.17250,
-    -0.18027,
-    -0.19153,
-    -0.20315,
-    -0.21178,
-    -0.21550,
-    -0.21456,
-    -0.21102,
-    -0.20756,
-    -0.20621,
-    -0.20752,
-    -0.21052,
-    -0.21348,
-    -0.21487,
-    -0.21412,
-    -0.21180,
-    -0.20924,
-    -0.20776,
-    -0.20803,
-    -0.20976,
-    -0.21194,
-    -0.21343,
-    -0.21353,
-    -0.21230,
-    -0.21047,
-    -0.20903,
-    -0.20868,
-    -0.20952,
-    -0.21102,
-    -0.21235,
-    -0.21282,
-    -0.21226,
-    -0.21104,
-    -0.20988,
-    -0.20945,
-    -0.20996,
-    -0.21106,
-    -0.21201,
-    -0.21201,
-    -0.21064,
-    -0.20806,
-    -0.20503,
-    -0.20248,
-    -0.20117,
-    -0.20128,
-    -0.20231,
-    -0.20333,
-    -0.20336,
-    -0.20185,
-    -0.19897,
-    -0.19556,
-    -0.19276,
-    -0.19158,
-    -0.19235,
-    -0.19462,
-    -0.19726,
-    -0.19895,
-    -0.19873,
-    -0.19644,
-    -0.19280,
-    -0.18907,
-    -0.18655,
-    -0.18594,
-    -0.18705,
-    -0.18886,
-    -0.19003,
-    -0.18948,
-    -0.18695,
-    -0.18318,
-    -0.17951,
-    -0.17732,
-    -0.17729,
-    -0.17904,
-    -0.18130,
-    -0.18242,
-    -0.18126,
-    -0.17775,
-    -0.17299,
-    -0.16881,
-    -0.16691,
-    -0.16799,
-    -0.17136,
-    -0.17523,
-    -0.17751,
-    -0.17683,
-    -0.17325,
-    -0.16826,
-    -0.16412,
-    -0.16265,
-    -0.16433,
-    -0.16788,
-    -0.17088,
-    -0.17091,
-    -0.16695,
-    -0.16008,
-    -0.15323,
-    -0.14991,
-    -0.15242,
-    -0.16035,
-    -0.17008,
-    -0.17574,
-    -0.17112,
-    -0.15210,
-    -0.11835,
-    -0.07378,
-    -0.02531,
-    0.01928,
-    0.05393,
-    0.07600,
-    0.08671,
-    0.09005,
-    0.09093,
-    0.09317,
-    0.09828,
-    0.10536,
-    0.11209,
-    0.11612,
-    0.11631,
-    0.11323,
-    0.10880,
-    0.10525,
-    0.10416,
-    0.10572,
-    0.10889,
-    0.11195,
-    0.11343,
-    0.11278,
-    0.11052,
-    0.10790,
-    0.10625,
-    0.10627,
-    0.10782,
-    0.11001,
-    0.11171,
-    0.11214,
-    0.11118,
-    0.10940,
-    0.10774,
-    0.10698,
-    0.10745,
-    0.10882,
-    0.11039,
-    0.11136,
-    0.11132,
-    0.11033,
-    0.10893,
-    0.10782,
-    0.10751,
-    0.10811,
-    0.10930,
-    0.11048,
-    0.11109,
-    0.11085,
-    0.10991,
-    0.10873,
-    0.10789,
-    0.10778,
-    0.10844,
-    0.10955,
-    0.11057,
-    0.11101,
-    0.11065,
-    0.10967,
-    0.10853,
-    0.10779,
-    0.10782,
-    0.10862,
-    0.10981,
-    0.11082,
-    0.11114,
-    0.11058,
-    0.10940,
-    0.10815,
-    0.10747,
-    0.10774,
-    0.10885,
-    0.11029,
-    0.11133,
-    0.11142,
-    0.11045,
-    0.10887,
-    0.10746,
-    0.10696,
-    0.10769,
-    0.10935,
-    0.11113,
-    0.11212,
-    0.11175,
-    0.11011,
-    0.10795,
-    0.10634,
-    0.10614,
-    0.10756,
-    0.11007,
-    0.11265,
-    0.11434,
-    0.11473,
-    0.11421,
-    0.11372,
-    0.11421,
-    0.11602,
-    0.11863,
-    0.12079,
-    0.12128,
-    0.11958,
-    0.11641,
-    0.11350,
-    0.11288,
-    0.11577,
-    0.12175,
-    0.12871,
-    0.13364,
-    0.13403,
-    0.12928,
-    0.12132,
-    0.11405,
-    0.11171,
-    0.11683,
-    0.12859,
-    0.14246,
-    0.15148,
-    0.14860,
-    0.12937,
-    0.09378,
-    0.04649,
-    -0.00470,
-    -0.05144,
-    -0.08754,
-    -0.11072,
-    -0.12273,
-    -0.12800,
-    -0.13148,
-    -0.13665,
-    -0.14445,
-    -0.15355,
-    -0.16152,
-    -0.16640,
-    -0.16766,
-    -0.16643,
-    -0.16474,
-    -0.16446,
-    -0.16637,
-    -0.16987,
-    -0.17348,
-    -0.17562,
-    -0.17550,
-    -0.17348,
-    -0.17078,
-    -0.16890,
-    -0.16883,
-    -0.17069,
-    -0.17376,
-    -0.17694,
-    -0.17929,
-    -0.18043,
-    -0.18055,
-    -0.18015,
-    -0.17970,
-    -0.17939,
-    -0.17920,
-    -0.17907,
-    -0.17908,
-    -0.17953,
-    -0.18079,
-    -0.18293,
-    -0.18562,
-    -0.18810,
-    -0.18956,
-    -0.18954,
-    -0.18824,
-    -0.18647,
-    -0.18529,
-    -0.18545,
-    -0.18694,
-    -0.18895,
-    -0.19031,
-    -0.19010,
-    -0.18826,
-    -0.18566,
-    -0.18373,
-    -0.18373,
-    -0.18599,
-    -0.18971,
-    -0.19328,
-    -0.19517,
-    -0.19475,
-    -0.19277,
-    -0.19093,
-    -0.19101,
-    -0.19373,
-    -0.19815,
-    -0.20198,
-    -0.20270,
-    -0.19909,
-    -0.19222,
-    -0.18539,
-    -0.18277,
-    -0.18730,
-    -0.19862,
-    -0.21231,
-    -0.22081,
-    -0.21590,
-    -0.19184,
-    -0.14785,
-    -0.08889,
-    -0.02424,
-    0.03547,
-    0.08179,
-    0.11100,
-    0.12473,
-    0.12867,
-    0.12973,
-    0.13331,
-    0.14140,
-    0.15255,
-    0.16324,
-    0.16999,
-    0.17119,
-    0.16775,
-    0.16244,
-    0.15843,
-    0.15774,
-    0.16043,
-    0.16478,
-    0.16838,
-    0.16944,
-    0.16760,
-    0.16407,
-    0.16081,
-    0.15949,
-    0.16065,
-    0.16350,
-    0.16645,
-    0.16795,
-    0.16732,
-    0.16505,
-    0.16241,
-    0.16080,
-    0.16098,
-    0.16272,
-    0.16503,
-    0.16669,
-    0.16694,
-    0.16580,
-    0.16395,
-    0.16230,
-    0.16140,
-    0.16120,
-    0.16109,
-    0.16036,
-    0.15868,
-    0.15639,
-    0.15431,
-    0.15339,
-    0.15405,
-    0.15595,
-    0.15804,
-    0.15907,
-    0.15821,
-    0.15548,
-    0.15179,
-    0.14849,
-    0.14671,
-    0.14681,
-    0.14820,
-    0.14966,
-    0.14994,
-    0.14842,
-    0.14540,
-    0.14195,
-    0.13934,
-    0.13842,
-    0.13916,
-    0.14068,
-    0.14171,
-    0.14120,
-    0.13888,
-    0.13537,
-    0.13192,
-    0.12976,
-    0.12957,
-    0.13115,
-    0.13354,
-    0.13549,
-    0.13600,
-    0.13477,
-    0.13223,
-    0.12930,
-    0.12692,
-    0.12565,
-    0.12546,
-    0.12586,
-    0.12615,
-    0.12580,
-    0.12464,
-    0.12283,
-    0.12077,
-    0.11889,
-    0.11748,
-    0.11663,
-    0.11632,
-    0.11647,
-    0.11695,
-    0.11757,
-    0.11806,
-    0.11810,
-    0.11739,
-    0.11584,
-    0.11363,
-    0.11121,
-    0.10918,
-    0.10803,
-    0.10793,
-    0.10863,
-    0.10959,
-    0.11025,
-    0.11028,
-    0.10978,
-    0.10913,
-    0.10879,
-    0.10898,
-    0.10947,
-    0.10968,
-    0.10897,
-    0.10703,
-    0.10417,
-    0.10119,
-    0.09913,
-    0.09870,
-    0.09991,
-    0.10202,
-    0.10384,
-    0.10435,
-    0.10321,
-    0.10100,
-    0.09896,
-    0.09830,
-    0.09957,
-    0.10223,
-    0.10487,
-    0.10588,
-    0.10435,
-    0.10077,
-    0.09691,
-    0.09512,
-    0.09704,
-    0.10249,
-    0.10899,
-    0.11232,
-    0.10791,
-    0.09268,
-    0.06643,
-    0.03221,
-    -0.00457,
-    -0.03785,
-    -0.06303,
-    -0.07836,
-    -0.08524,
-    -0.08730,
-    -0.08871,
-    -0.09244,
-    -0.09927,
-    -0.10785,
-    -0.11566,
-    -0.12042,
-    -0.12122,
-    -0.11887,
-    -0.11543,
-    -0.11306,
-    -0.11308,
-    -0.11534,
-    -0.11850,
-    -0.12081,
-    -0.12106,
-    -0.11920,
-    -0.11632,
-    -0.11399,
-    -0.11347,
-    -0.11501,
-    -0.11772,
-    -0.12011,
-    -0.12086,
-    -0.11954,
-    -0.11683,
-    -0.11422,
-    -0.11324,
-    -0.11468,
-    -0.11820,
-    -0.12255,
-    -0.12609,
-    -0.12767,
-    -0.12709,
-    -0.12513,
-    -0.12310,
-    -0.12217,
-    -0.12278,
-    -0.12455,
-    -0.12657,
-    -0.12798,
-    -0.12846,
-    -0.12840,
-    -0.12858,
-    -0.12969,
-    -0.13179,
-    -0.13424,
-    -0.13597,
-    -0.13607,
-    -0.13442,
-    -0.13180,
-    -0.12967,
-    -0.12943,
-    -0.13170,
-    -0.13596,
-    -0.14070,
-    -0.14412,
-    -0.14498,
-    -0.14321,
-    -0.13996,
-    -0.13704,
-    -0.13600,
-    -0.13744,
-    -0.14070,
-    -0.14429,
-    -0.14668,
-    -0.14713,
-    -0.14604,
-    -0.14472,
-    -0.14457,
-    -0.14628,
-    -0.14931,
-    -0.15219,
-    -0.15326,
-    -0.15171,
-    -0.14819,
-    -0.14467,
-    -0.14352,
-    -0.14624,
-    -0.15250,
-    -0.16000,
-    -0.16542,
-    -0.16600,
-    -0.16102,
-    -0.15255,
-    -0.14477,
-    -0.14222,
-    -0.14756,
-    -0.15988,
-    -0.17440,
-    -0.18378,
-    -0.18069,
-    -0.16054,
-    -0.12337,
-    -0.07405,
-    -0.02074,
-    0.02786,
-    0.06523,
-    0.08887,
-    0.10051,
-    0.10478,
-    0.10709,
-    0.11147,
-    0.11939,
-    0.12979,
-    0.14010,
-    0.14776,
-    0.15137,
-    0.15123,
-    0.14892,
-    0.14644,
-    0.14528,
-    0.14590,
-    0.14774,
-    0.14971,
-    0.15084,
-    0.15069,
-    0.14953,
-    0.14801,
-    0.14686,
-    0.14649,
-    0.14691,
-    0.14785,
-    0.14896,
-    0.15006,
-    0.15113,
-    0.15228,
-    0.15359,
-    0.15498,
-    0.15622,
-    0.15707,
-    0.15737,
-    0.15716,
-    0.15665,
-    0.15612,
-    0.15578,
-    0.15571,
-    0.15585,
-    0.15608,
-    0.15628,
-    0.15642,
-    0.15651,
-    0.15655,
-    0.15655,
-    0.15645,
-    0.15623,
-    0.15594,
-    0.15570,
-    0.15568,
-    0.15597,
-    0.15647,
-    0.15697,
-    0.15717,
-    0.15690,
-    0.15623,
-    0.15545,
-    0.15499,
-    0.15517,
-    0.15597,
-    0.15704,
-    0.15782,
-    0.15783,
-    0.15696,
-    0.15558,
-    0.15439,
-    0.15408,
-    0.15493,
-    0.15663,
-    0.15837,
-    0.15922,
-    0.15859,
-    0.15657,
-    0.15391,
-    0.15160,
-    0.15040,
-    0.15040,
-    0.15097,
-    0.15112,
-    0.15014,
-    0.14807,
-    0.14576,
-    0.14453,
-    0.14531,
-    0.14799,
-    0.15121,
-    0.15287,
-    0.15112,
-    0.14556,
-    0.13779,
-    0.13103,
-    0.12882,
-    0.13325,
-    0.14347,
-    0.15532,
-    0.16234,
-    0.15793,
-    0.13781,
-    0.10184,
-    0.05439,
-    0.00298,
-    -0.04413,
-    -0.08063,
-    -0.10395,
-    -0.11557,
-    -0.11981,
-    -0.12172,
-    -0.12502,
-    -0.13090,
-    -0.13816,
-    -0.14437,
-    -0.14738,
-    -0.14653,
-    -0.14290,
-    -0.13870,
-    -0.13609,
-    -0.13618,
-    -0.13858,
-    -0.14177,
-    -0.14400,
-    -0.14418,
-    -0.14241,
-    -0.13983,
-    -0.13790,
-    -0.13764,
-    -0.13912,
-    -0.14143,
-    -0.14325,
-    -0.14349,
-    -0.14183,
-    -0.13884,
-    -0.13558,
-    -0.13310,
-    -0.13192,
-    -0.13192,
-    -0.13254,
-    -0.13314,
-    -0.13338,
-    -0.13328,
-    -0.13308,
-    -0.13289,
-    -0.13257,
-    -0.13176,
-    -0.13010,
-    -0.12763,
-    -0.12491,
-    -0.12282,
-    -0.12218,
-    -0.12323,
-    -0.12541,
-    -0.12755,
-    -0.12838,
-    -0.12720,
-    -0.12428,
-    -0.12075,
-    -0.11808,
-    -0.11725,
-    -0.11821,
-    -0.11982,
-    -0.12052,
-    -0.11916,
-    -0.11589,
-    -0.11226,
-    -0.11058,
-    -0.11271,
-    -0.11874,
-    -0.12639,
-    -0.13139,
-    -0.12890,
-    -0.11541,
-    -0.09034,
-    -0.05660,
-    -0.01978,
-    0.01364,
-    0.03855,
-    0.05278,
-    0.05760,
-    0.05684,
-    0.05511,
-    0.05595,
-    0.06062,
-    0.06802,
-    0.07559,
-    0.08080,
-    0.08231,
-    0.08053,
-    0.07724,
-    0.07457,
-    0.07398,
-    0.07564,
-    0.07850,
-    0.08097,
-    0.08180,
-    0.08066,
-    0.07829,
-    0.07598,
-    0.07492,
-    0.07557,
-    0.07748,
-    0.07961,
-    0.08087,
-    0.08068,
-    0.07922,
-    0.07731,
-    0.07589,
-    0.07561,
-    0.07648,
-    0.07803,
-    0.07956,
-    0.08059,
-    0.08109,
-    0.08145,
-    0.08218,
-    0.08356,
-    0.08542,
-    0.08722,
-    0.08829,
-    0.08822,
-    0.08709,
-    0.08547,
-    0.08416,
-    0.08377,
-    0.08447,
-    0.08587,
-    0.08727,
-    0.08798,
-    0.08766,
-    0.08649,
-    0.08506,
-    0.08404,
-    0.08389,
-    0.08468,
-    0.08610,
-    0.08768,
-    0.08908,
-    0.09018,
-    0.09114,
-    0.09216,
-    0.09332,
-    0.09444,
-    0.09517,
-    0.09517,
-    0.09442,
-    0.09327,
-    0.09240,
-    0.09249,
-    0.09396,
-    0.09665,
-    0.09987,
-    0.10265,
-    0.10415,
-    0.10403,
-    0.10259,
-    0.10065,
-    0.09918,
-    0.09893,
-    0.10010,
-    0.10231,
-    0.10484,
-    0.10698,
-    0.10829,
-    0.10880,
-    0.10885,
-    0.10890,
-    0.10922,
-    0.10978,
-    0.11031,
-    0.11045,
-    0.11002,
-    0.10914,
-    0.10820,
-    0.10772,
-    0.10810,
-    0.10945,
-    0.11151,
-    0.11383,
-    0.11588,
-    0.11728,
-    0.11791,
-    0.11788,
-    0.11746,
-    0.11693,
-    0.11654,
-    0.11646,
-    0.11679,
-    0.11761,
-    0.11892,
-    0.12065,
-    0.12258,
-    0.12442,
-    0.12580,
-    0.12648,
-    0.12640,
-    0.12574,
-    0.12488,
-    0.12418,
-    0.12391,
-    0.12409,
-    0.12457,
-    0.12512,
-    0.12560,
-    0.12607,
-    0.12675,
-    0.12789,
-    0.12957,
-    0.13159,
-    0.13349,
-    0.13474,
-    0.13497,
-    0.13420,
-    0.13283,
-    0.13153,
-    0.13092,
-    0.13127,
-    0.13239,
-    0.13371,
-    0.13456,
-    0.13451,
-    0.13358,
-    0.13224,
-    0.13119,
-    0.13096,
-    0.13170,
-    0.13303,
-    0.13428,
-    0.13481,
-    0.13433,
-    0.13305,
-    0.13160,
-    0.13067,
-    0.13074,
-    0.13181,
-    0.13345,
-    0.13509,
-    0.13628,
-    0.13697,
-    0.13748,
-    0.13823,
-    0.13948,
-    0.14108,
-    0.14251,
-    0.14314,
-    0.14260,
-    0.14106,
-    0.13922,
-    0.13801,
-    0.13809,
-    0.13951,
-    0.14162,
-    0.14333,
-    0.14370,
-    0.14243,
-    0.14008,
-    0.13784,
-    0.13695,
-    0.13801,
-    0.14062,
-    0.14347,
-    0.14502,
-    0.14427,
-    0.14139,
-    0.13774,
-    0.13527,
-    0.13551,
-    0.13872,
-    0.14353,
-    0.14750,
-    0.14821,
-    0.14460,
-    0.13772,
-    0.13048,
-    0.12650,
-    0.12828,
-    0.13570,
-    0.14541,
-    0.15161,
-    0.14796,
-    0.12996,
-    0.09683,
-    0.05205,
-    0.00243,
-    -0.04409,
-    -0.08095,
-    -0.10491,
-    -0.11663,
-    -0.11989,
-    -0.11971,
-    -0.12037,
-    -0.12397,
-    -0.13021,
-    -0.13707,
-    -0.14221,
-    -0.14419,
-    -0.14311,
-    -0.14038,
-    -0.13790,
-    -0.13710,
-    -0.13828,
-    -0.14065,
-    -0.14284,
-    -0.14369,
-    -0.14282,
-    -0.14081,
-    -0.13881,
-    -0.13792,
-    -0.13860,
-    -0.14044,
-    -0.14241,
-    -0.14332,
-    -0.14247,
-    -0.13992,
-    -0.13646,
-    -0.13321,
-    -0.13115,
-    -0.13068,
-    -0.13155,
-    -0.13302,
-    -0.13428,
-    -0.13475,
-    -0.13427,
-    -0.13307,
-    -0.13154,
-    -0.13000,
-    -0.12860,
-    -0.12731,
-    -0.12608,
-    -0.12496,
-    -0.12412,
-    -0.12380,
-    -0.12411,
-    -0.12491,
-    -0.12579,
-    -0.12621,
-    -0.12571,
-    -0.12410,
-    -0.12165,
-    -0.11893,
-    -0.11666,
-    -0.11538,
-    -0.11530,
-    -0.11621,
-    -0.11756,
-    -0.11869,
-    -0.11908,
-    -0.11847,
-    -0.11696,
-    -0.11489,
-    -0.11269,
-    -0.11080,
-    -0.10947,
-    -0.10880,
-    -0.10870,
-    -0.10898,
-    -0.10939,
-    -0.10970,
-    -0.10978,
-    -0.10961,
-    -0.10927,
-    -0.10896,
-    -0.10885,
-    -0.10906,
-    -0.10954,
-    -0.11009,
-    -0.11039,
-    -0.11014,
-    -0.10916,
-    -0.10751,
-    -0.10546,
-    -0.10342,
-    -0.10179,
-    -0.10083,
-    -0.10058,
-    -0.10084,
-    -0.10134,
-    -0.10178,
-    -0.10199,
-    -0.10195,
-    -0.10176,
-    -0.10154,
-    -0.10140,
-    -0.10137,
-    -0.10142,
-    -0.10150,
-    -0.10156,
-    -0.10160,
-    -0.10163,
-    -0.10167,
-    -0.10169,
-    -0.10167,
-    -0.10159,
-    -0.10146,
-    -0.10135,
-    -0.10132,
-    -0.10143,
-    -0.10163,
-    -0.10183,
-    -0.10192,
-    -0.10183,
-    -0.10157,
-    -0.10127,
-    -0.10109,
-    -0.10116,
-    -0.10146,
-    -0.10185,
-    -0.10213,
-    -0.10212,
-    -0.10180,
-    -0.10132,
-    -0.10092,
-    -0.10084,
-    -0.10116,
-    -0.10173,
-    -0.10226,
-    -0.10245,
-    -0.10216,
-    -0.10152,
-    -0.10084,
-    -0.10051,
-    -0.10073,
-    -0.10143,
-    -0.10227,
-    -0.10278,
-    -0.10267,
-    -0.10193,
-    -0.10092,
-    -0.10018,
-    -0.10013,
-    -0.10087,
-    -0.10207,
-    -0.10311,
-    -0.10341,
-    -0.10273,
-    -0.10133,
-    -0.09986,
-    -0.09911,
-    -0.09955,
-    -0.10116,
-    -0.10340,
-    -0.10551,
-    -0.10688,
-    -0.10739,
-    -0.10740,
-    -0.10758,
-    -0.10840,
-    -0.10989,
-    -0.11147,
-    -0.11229,
-    -0.11171,
-    -0.10974,
-    -0.10718,
-    -0.10533,
-    -0.10538,
-    -0.10772,
-    -0.11166,
-    -0.11562,
-    -0.11788,
-    -0.11747,
-    -0.11483,
-    -0.11176,
-    -0.11065,
-    -0.11329,
-    -0.11960,
-    -0.12721,
-    -0.13186,
-    -0.12884,
-    -0.11473,
-    -0.08891,
-    -0.05403,
-    -0.01535,
-    0.02095,
-    0.04975,
-    0.06851,
-    0.07780,
-    0.08063,
-    0.08095,
-    0.08210,
-    0.08565,
-    0.09125,
-    0.09724,
-    0.10182,
-    0.10401,
-    0.10405,
-    0.10321,
-    0.10296,
-    0.10422,
-    0.10690,
-    0.11006,
-    0.11239,
-    0.11300,
-    0.11182,
-    0.10959,
-    0.10750,
-    0.10651,
-    0.10697,
-    0.10847,
-    0.11018,
-    0.11136,
-    0.11174,
-    0.11168,
-    0.11186,
-    0.11289,
-    0.11487,
-    0.11730,
-    0.11932,
-    0.12013,
-    0.11946,
-    0.11773,
-    0.11584,
-    0.11475,
-    0.11496,
-    0.11632,
-    0.11808,
-    0.11931,
-    0.11937,
-    0.11827,
-    0.11663,
-    0.11532,
-    0.11505,
-    0.11593,
-    0.11747,
-    0.11883,
-    0.11929,
-    0.11860,
-    0.11715,
-    0.11574,
-    0.11512,
-    0.11564,
-    0.11700,
-    0.11846,
-    0.11922,
-    0.11887,
-    0.11760,
-    0.11609,
-    0.11517,
-    0.11536,
-    0.11656,
-    0.11812,
-    0.11918,
-    0.11916,
-    0.11805,
-    0.11643,
-    0.11520,
-    0.11504,
-    0.11608,
-    0.11776,
-    0.11917,
-    0.11952,
-    0.11858,
-    0.11683,
-    0.11520,
-    0.11462,
-    0.11546,
-    0.11730,
-    0.11918,
-    0.12004,
-    0.11933,
-    0.11737,
-    0.11518,
-    0.11398,
-    0.11451,
-    0.11661,
-    0.11921,
-    0.12088,
-    0.12058,
-    0.11830,
-    0.11514,
-    0.11281,
-    0.11274,
-    0.11527,
-    0.11926,
-    0.12264,
-    0.12333,
-    0.12048,
-    0.11508,
-    0.10980,
-    0.10778,
-    0.11110,
-    0.11933,
-    0.12914,
-    0.13514,
-    0.13167,
-    0.11502,
-    0.08498,
-    0.04524,
-    0.00226,
-    -0.03686,
-    -0.06670,
-    -0.08512,
-    -0.09355,
-    -0.09598,
-    -0.09706,
-    -0.10020,
-    -0.10655,
-    -0.11492,
-    -0.12284,
-    -0.12797,
-    -0.12924,
-    -0.12729,
-    -0.12399,
-    -0.12145,
-    -0.12100,
-    -0.12268,
-    -0.12542,
-    -0.12770,
-    -0.12840,
-    -0.12734,
-    -0.12526,
-    -0.12333,
-    -0.12242,
-    -0.12265,
-    -0.12334,
-    -0.12344,
-    -0.12217,
-    -0.11955,
-    -0.11640,
-    -0.11401,
-    -0.11340,
-    -0.11482,
-    -0.11751,
-    -0.12002,
-    -0.12094,
-    -0.11955,
-    -0.11616,
-    -0.11200,
-    -0.10859,
-    -0.10703,
-    -0.10750,
-    -0.10926,
-    -0.11102,
-    -0.11170,
-    -0.11093,
-    -0.10920,
-    -0.10759,
-    -0.10707,
-    -0.10801,
-    -0.10986,
-    -0.11147,
-    -0.11164,
-    -0.10978,
-    -0.10628,
-    -0.10232,
-    -0.09935,
-    -0.09837,
-    -0.09944,
-    -0.10168,
-    -0.10372,
-    -0.10441,
-    -0.10342,
-    -0.10136,
-    -0.09947,
-    -0.09887,
-    -0.09990,
-    -0.10193,
-    -0.10357,
-    -0.10342,
-    -0.10087,
-    -0.09648,
-    -0.09184,
-    -0.08884,
-    -0.08874,
-    -0.09146,
-    -0.09556,
-    -0.09884,
-    -0.09944,
-    -0.09680,
-    -0.09206,
-    -0.08763,
-    -0.08609,
-    -0.08886,
-    -0.09531,
-    -0.10265,
-    -0.10687,
-    -0.10414,
-    -0.09234,
-    -0.07189,
-    -0.04570,
-    -0.01811,
-    0.00656,
-    0.02541,
-    0.03763,
-    0.04438,
-    0.04796,
-    0.05064,
-    0.05383,
-    0.05774,
-    0.06160,
-    0.06439,
-    0.06543,
-    0.06479,
-    0.06320,
-    0.06164,
-    0.06086,
-    0.06110,
-    0.06201,
-    0.06298,
-    0.06350,
-    0.06336,
-    0.06278,
-    0.06216,
-    0.06187,
-    0.06202,
-    0.06245,
-    0.06283,
-    0.06292,
-    0.06269,
-    0.06232,
-    0.06208,
-    0.06216,
-    0.06252,
-    0.06292,
-    0.06308,
-    0.06286,
-    0.06234,
-    0.06183,
-    0.06167,
-    0.06200,
-    0.06271,
-    0.06341,
-    0.06369,
-    0.06332,
-    0.06239,
-    0.06134,
-    0.06074,
-    0.06099,
-    0.06215,
-    0.06390,
-    0.06573,
-    0.06719,
-    0.06810,
-    0.06867,
-    0.06924,
-    0.07011,
-    0.07122,
-    0.07219,
-    0.07249,
-    0.07174,
-    0.07009,
-    0.06820,
-    0.06703,
-    0.06739,
-    0.06946,
-    0.07264,
-    0.07574,
-    0.07751,
-    0.07732,
-    0.07559,
-    0.07368,
-    0.07335,
-    0.07580,
-    0.08085,
-    0.08662,
-    0.08983,
-    0.08690,
-    0.07522,
-    0.05424,
-    0.02593,
-    -0.00576,
-    -0.03600,
-    -0.06061,
-    -0.07729,
-    -0.08610,
-    -0.08915,
-    -0.08958,
-    -0.09035,
-    -0.09319,
-    -0.09823,
-    -0.10425,
-    -0.10950,
-    -0.11252,
-    -0.11282,
-    -0.11098,
-    -0.10834,
-    -0.10632,
-    -0.10585,
-    -0.10704,
-    -0.10925,
-    -0.11150,
-    -0.11297,
-    -0.11340,
-    -0.11314,
-    -0.11295,
-    -0.11354,
-    -0.11520,
-    -0.11755,
-    -0.11976,
-    -0.12086,
-    -0.12031,
-    -0.11825,
-    -0.11556,
-    -0.11350,
-    -0.11313,
-    -0.11480,
-    -0.11785,
-    -0.12088,
-    -0.12229,
-    -0.12112,
-    -0.11766,
-    -0.11352,
-    -0.11110,
-    -0.11263,
-    -0.11892,
-    -0.12864,
-    -0.13829,
-    -0.14303,
-    -0.13830,
-    -0.12140,
-    -0.09266,
-    -0.05561,
-    -0.01602,
-    0.01988,
-    0.04730,
-    0.06425,
-    0.07192,
-    0.07381,
-    0.07424,
-    0.07659,
-    0.08223,
-    0.09031,
-    0.09852,
-    0.10438,
-    0.10645,
-    0.10494,
-    0.10147,
-    0.09826,
-    0.09702,
-    0.09825,
-    0.10114,
-    0.10405,
-    0.10550,
-    0.10481,
-    0.10246,
-    0.09977,
-    0.09814,
-    0.09838,
-    0.10028,
-    0.10278,
-    0.10456,
-    0.10469,
-    0.10316,
-    0.10083,
-    0.09894,
-    0.09849,
-    0.09968,
-    0.10186,
-    0.10385,
-    0.10459,
-    0.10371,
-    0.10168,
-    0.09959,
-    0.09857,
-    0.09916,
-    0.10105,
-    0.10323,
-    0.10452,
-    0.10423,
-    0.10248,
-    0.10021,
-    0.09863,
-    0.09861,
-    0.10020,
-    0.10258,
-    0.10448,
-    0.10485,
-    0.10343,
-    0.10093,
-    0.09865,
-    0.09786,
-    0.09907,
-    0.10173,
-    0.10447,
-    0.10579,
-    0.10486,
-    0.10201,
-    0.09865,
-    0.09658,
-    0.09709,
-    0.10018,
-    0.10448,
-    0.10777,
-    0.10806,
-    0.10464,
-    0.09863,
-    0.09257,
-    0.08937,
-    0.09087,
-    0.09670,
-    0.10403,
-    0.10833,
-    0.10492,
-    0.09079,
-    0.06575,
-    0.03274,
-    -0.00309,
-    -0.03608,
-    -0.06180,
-    -0.07831,
-    -0.08640,
-    -0.08893,
-    -0.08940,
-    -0.09063,
-    -0.09384,
-    -0.09856,
-    -0.10325,
-    -0.10622,
-    -0.10658,
-    -0.10456,
-    -0.10141,
-    -0.09870,
-    -0.09765,
-    -0.09857,
-    -0.10084,
-    -0.10329,
-    -0.10473,
-    -0.10455,
-    -0.10294,
-    -0.10075,
-    -0.09904,
-    -0.09860,
-    -0.09959,
-    -0.10151,
-    -0.10344,
-    -0.10450,
-    -0.10422,
-    -0.10272,
-    -0.10062,
-    -0.09867,
-    -0.09741,
-    -0.09694,
-    -0.09686,
-    -0.09659,
-    -0.09568,
-    -0.09408,
-    -0.09226,
-    -0.09097,
-    -0.09086,
-    -0.09213,
-    -0.09432,
-    -0.09646,
-    -0.09745,
-    -0.09664,
-    -0.09420,
-    -0.09113,
-    -0.08896,
-    -0.08904,
-    -0.09178,
-    -0.09628,
-    -0.10033,
-    -0.10107,
-    -0.09591,
-    -0.08352,
-    -0.06440,
-    -0.04088,
-    -0.01640,
-    0.00551,
-    0.02230,
-    0.03312,
-    0.03877,
-    0.04125,
-    0.04280,
-    0.04504,
-    0.04851,
-    0.05263,
-    0.05624,
-    0.05827,
-    0.05826,
-    0.05661,
-    0.05433,
-    0.05256,
-    0.05206,
-    0.05290,
-    0.05452,
-    0.05604,
-    0.05674,
-    0.05634,
-    0.05515,
-    0.05384,
-    0.05306,
-    0.05318,
-    0.05405,
-    0.05518,
-    0.05598,
-    0.05606,
-    0.05544,
-    0.05447,
-    0.05367,
-    0.05345,
-    0.05388,
-    0.05470,
-    0.05547,
-    0.05579,
-    0.05553,
-    0.05484,
-    0.05410,
-    0.05371,
-    0.05384,
-    0.05441,
-    0.05510,
-    0.05554,
-    0.05552,
-    0.05506,
-    0.05442,
-    0.05395,
-    0.05388,
-    0.05424,
-    0.05482,
-    0.05532,
-    0.05547,
-    0.05520,
-    0.05466,
-    0.05415,
-    0.05393,
-    0.05412,
-    0.05461,
-    0.05514,
-    0.05543,
-    0.05532,
-    0.05487,
-    0.05432,
-    0.05395,
-    0.05397,
-    0.05438,
-    0.05499,
-    0.05548,
-    0.05557,
-    0.05518,
-    0.05444,
-    0.05370,
-    0.05336,
-    0.05372,
-    0.05488,
-    0.05669,
-    0.05881,
-    0.06081,
-    0.06235,
-    0.06322,
-    0.06342,
-    0.06313,
-    0.06262,
-    0.06216,
-    0.06195,
-    0.06206,
-    0.06240,
-    0.06280,
-    0.06305,
-    0.06298,
-    0.06258,
-    0.06202,
-    0.06159,
-    0.06164,
-    0.06243,
-    0.06401,
-    0.06617,
-    0.06846,
-    0.07038,
-    0.07151,
-    0.07171,
-    0.07115,
-    0.07025,
-    0.06950,
-    0.06927,
-    0.06964,
-    0.07038,
-    0.07109,
-    0.07138,
-    0.07106,
-    0.07024,
-    0.06933,
-    0.06884,
-    0.06915,
-    0.07039,
-    0.07236,
-    0.07460,
-    0.07662,
-    0.07804,
-    0.07873,
-    0.07880,
-    0.07854,
-    0.07822,
-    0.07801,
-    0.07796,
-    0.07800,
-    0.07803,
-    0.07802,
-    0.07801,
-    0.07807,
-    0.07823,
-    0.07842,
-    0.07851,
-    0.07839,
-    0.07802,
-    0.07753,
-    0.07720,
-    0.07736,
-    0.07823,
-    0.07983,
-    0.08193,
-    0.08408,
-    0.08584,
-    0.08686,
-    0.08708,
-    0.08668,
-    0.08603,
-    0.08549,
-    0.08530,
-    0.08547,
-    0.08585,
-    0.08621,
-    0.08637,
-    0.08628,
-    0.08602,
-    0.08575,
-    0.08561,
-    0.08567,
-    0.08587,
-    0.08608,
-    0.08619,
-    0.08615,
-    0.08599,
-    0.08582,
-    0.08573,
-    0.08576,
-    0.08590,
-    0.08604,
-    0.08612,
-    0.08608,
-    0.08597,
-    0.08584,
-    0.08578,
-    0.08581,
-    0.08592,
-    0.08603,
-    0.08609,
-    0.08605,
-    0.08595,
-    0.08584,
-    0.08579,
-    0.08583,
-    0.08593,
-    0.08604,
-    0.08609,
-    0.08605,
-    0.08594,
-    0.08583,
-    0.08578,
-    0.08582,
-    0.08593,
-    0.08605,
-    0.08610,
-    0.08606,
-    0.08595,
-    0.08583,
-    0.08577,
-    0.08580,
-    0.08591,
-    0.08604,
-    0.08611,
-    0.08609,
-    0.08598,
-    0.08586,
-    0.08578,
-    0.08578,
-    0.08586,
-    0.08598,
-    0.08608,
-    0.08610,
-    0.08605,
-    0.08595,
-    0.08586,
-    0.08580,
-    0.08579,
-    0.08581,
-    0.08587,
-    0.08597,
-    0.08614,
-    0.08633,
-    0.08644,
-    0.08630,
-    0.08568,
-    0.08445,
-    0.08264,
-    0.08050,
-    0.07845,
-    0.07696,
-    0.07638,
-    0.07674,
-    0.07773,
-    0.07883,
-    0.07948,
-    0.07938,
-    0.07859,
-    0.07754,
-    0.07678,
-    0.07677,
-    0.07758,
-    0.07882,
-    0.07983,
-    0.07993,
-    0.07876,
-    0.07647,
-    0.07366,
-    0.07115,
-    0.06959,
-    0.06922,
-    0.06976,
-    0.07061,
-    0.07113,
-    0.07101,
-    0.07036,
-    0.06965,
-    0.06940,
-    0.06984,
-    0.07074,
-    0.07147,
-    0.07131,
-    0.06984,
-    0.06717,
-    0.06404,
-    0.06141,
-    0.06012,
-    0.06044,
-    0.06193,
-    0.06368,
-    0.06469,
-    0.06442,
-    0.06301,
-    0.06124,
-    0.06009,
-    0.06026,
-    0.06174,
-    0.06384,
-    0.06543,
-    0.06557,
-    0.06396,
-    0.06109,
-    0.05807,
-    0.05600,
-    0.05546,
-    0.05616,
-    0.05712,
-    0.05720,
-    0.05577,
-    0.05316,
-    0.05064,
-    0.04981,
-    0.05175,
-    0.05625,
-    0.06152,
-    0.06462,
-    0.06248,
-    0.05309,
-    0.03641,
-    0.01457,
-    -0.00877,
-    -0.02963,
-    -0.04499,
-    -0.05372,
-    -0.05672,
-    -0.05632,
-    -0.05520,
-    -0.05537,
-    -0.05748,
-    -0.06087,
-    -0.06416,
-    -0.06603,
-    -0.06589,
-    -0.06412,
-    -0.06178,
-    -0.06010,
-    -0.05981,
-    -0.06091,
-    -0.06270,
-    -0.06421,
-    -0.06472,
-    -0.06405,
-    -0.06265,
-    -0.06128,
-    -0.06064,
-    -0.06100,
-    -0.06210,
-    -0.06334,
-    -0.06407,
-    -0.06394,
-    -0.06308,
-    -0.06197,
-    -0.06119,
-    -0.06113,
-    -0.06177,
-    -0.06276,
-    -0.06357,
-    -0.06379,
-    -0.06334,
-    -0.06248,
-    -0.06165,
-    -0.06130,
-    -0.06157,
-    -0.06231,
-    -0.06313,
-    -0.06361,
-    -0.06351,
-    -0.06290,
-    -0.06209,
-    -0.06149,
-    -0.06141,
-    -0.06188,
-    -0.06267,
-    -0.06340,
-    -0.06369,
-    -0.06340,
-    -0.06263,
-    -0.06172,
-    -0.06108,
-    -0.06105,
-    -0.06177,
-    -0.06317,
-    -0.06497,
-    -0.06684,
-    -0.06851,
-    -0.06977,
-    -0.07056,
-    -0.07092,
-    -0.07093,
-    -0.07074,
-    -0.07045,
-    -0.07018,
-    -0.07003,
-    -0.07001,
-    -0.07012,
-    -0.07029,
-    -0.07044,
-    -0.07049,
-    -0.07044,
-    -0.07034,
-    -0.07026,
-    -0.07025,
-    -0.07034,
-    -0.07042,
-    -0.07042,
-    -0.07025,
-    -0.06996,
-    -0.06973,
-    -0.06983,
-    -0.07049,
-    -0.07184,
-    -0.07375,
-    -0.07590,
-    -0.07783,
-    -0.07914,
-    -0.07961,
-    -0.07930,
-    -0.07853,
-    -0.07770,
-    -0.07720,
-    -0.07719,
-    -0.07762,
-    -0.07823,
-    -0.07873,
-    -0.07891,
-    -0.07873,
-    -0.07831,
-    -0.07786,
-    -0.07753,
-    -0.07743,
-    -0.07753,
-    -0.07780,
-    -0.07823,
-    -0.07891,
-    -0.07994,
-    -0.08140,
-    -0.08320,
-    -0.08508,
-    -0.08664,
-    -0.08753,
-    -0.08757,
-    -0.08687,
-    -0.08582,
-    -0.08492,
-    -0.08458,
-    -0.08494,
-    -0.08578,
-    -0.08668,
-    -0.08716,
-    -0.08699,
-    -0.08626,
-    -0.08536,
-    -0.08477,
-    -0.08483,
-    -0.08552,
-    -0.08646,
-    -0.08712,
-    -0.08708,
-    -0.08630,
-    -0.08518,
-    -0.08444,
-    -0.08476,
-    -0.08646,
-    -0.08927,
-    -0.09243,
-    -0.09496,
-    -0.09610,
-    -0.09569,
-    -0.09419,
-    -0.09253,
-    -0.09161,
-    -0.09193,
-    -0.09331,
-    -0.09498,
-    -0.09603,
-    -0.09584,
-    -0.09443,
-    -0.09251,
-    -0.09113,
-    -0.09112,
-    -0.09262,
-    -0.09498,
-    -0.09695,
-    -0.09734,
-    -0.09567,
-    -0.09253,
-    -0.08945,
-    -0.08825,
-    -0.09015,
-    -0.09495,
-    -0.10076,
-    -0.10442,
-    -0.10251,
-    -0.09257,
-    -0.07410,
-    -0.04888,
-    -0.02052,
-    0.00667,
-    0.02895,
-    0.04428,
-    0.05265,
-    0.05580,
-    0.05633,
-    0.05668,
-    0.05830,
-    0.06143,
-    0.06528,
-    0.06870,
-    0.07081,
-    0.07134,
-    0.07073,
-    0.06977,
-    0.06919,
-    0.06933,
-    0.07005,
-    0.07090,
-    0.07138,
-    0.07125,
-    0.07062,
-    0.06986,
-    0.06938,
-    0.06942,
-    0.06993,
-    0.07062,
-    0.07111,
-    0.07116,
-    0.07076,
-    0.07016,
-    0.06966,
-    0.06952,
-    0.06979,
-    0.07032,
-    0.07083,
-    0.07106,
-    0.07092,
-    0.07048,
-    0.06996,
-    0.06961,
-    0.06959,
-    0.06991,
-    0.07044,
-    0.07097,
-    0.07129,
-    0.07123,
-    0.07070,
-    0.06969,
-    0.06826,
-    0.06654,
-    0.06473,
-    0.06309,
-    0.06188,
-    0.06129,
-    0.06137,
-    0.06195,
-    0.06271,
-    0.06328,
-    0.06340,
-    0.06303,
-    0.06236,
-    0.06177,
-    0.06160,
-    0.06199,
-    0.06279,
-    0.06356,
-    0.06376,
-    0.06299,
-    0.06120,
-    0.05873,
-    0.05618,
-    0.05421,
-    0.05325,
-    0.05336,
-    0.05419,
-    0.05516,
-    0.05575,
-    0.05569,
-    0.05505,
-    0.05421,
-    0.05363,
-    0.05364,
-    0.05424,
-    0.05517,
-    0.05596,
-    0.05617,
-    0.05557,
-    0.05419,
-    0.05232,
-    0.05036,
-    0.04865,
-    0.04739,
-    0.04662,
-    0.04627,
-    0.04620,
-    0.04633,
-    0.04660,
-    0.04693,
-    0.04725,
-    0.04745,
-    0.04742,
-    0.04714,
-    0.04669,
-    0.04627,
-    0.04609,
-    0.04628,
-    0.04682,
-    0.04752,
-    0.04804,
-    0.04808,
-    0.04745,
-    0.04619,
-    0.04450,
-    0.04269,
-    0.04106,
-    0.03980,
-    0.03894,
-    0.03844,
-    0.03823,
-    0.03828,
-    0.03855,
-    0.03900,
-    0.03951,
-    0.03990,
-    0.03996,
-    0.03960,
-    0.03890,
-    0.03817,
-    0.03778,
-    0.03801,
-    0.03887,
-    0.04001,
-    0.04085,
-    0.04085,
-    0.03980,
-    0.03806,
-    0.03644,
-    0.03594,
-    0.03722,
-    0.04013,
-    0.04356,
-    0.04561,
-    0.04423,
-    0.03794,
-    0.02646,
-    0.01097,
-    -0.00618,
-    -0.02225,
-    -0.03494,
-    -0.04311,
-    -0.04703,
-    -0.04812,
-    -0.04822,
-    -0.04886,
-    -0.05068,
-    -0.05338,
-    -0.05600,
-    -0.05754,
-    -0.05748,
-    -0.05605,
-    -0.05410,
-    -0.05262,
-    -0.05233,
-    -0.05327,
-    -0.05488,
-    -0.05629,
-    -0.05679,
-    -0.05616,
-    -0.05479,
-    -0.05342,
-    -0.05278,
-    -0.05316,
-    -0.05435,
-    -0.05568,
-    -0.05645,
-    -0.05626,
-    -0.05523,
-    -0.05393,
-    -0.05305,
-    -0.05307,
-    -0.05397,
-    -0.05525,
-    -0.05622,
-    -0.05634,
-    -0.05556,
-    -0.05429,
-    -0.05323,
-    -0.05300,
-    -0.05372,
-    -0.05501,
-    -0.05613,
-    -0.05641,
-    -0.05562,
-    -0.05417,
-    -0.05296,
-    -0.05294,
-    -0.05461,
-    -0.05773,
-    -0.06136,
-    -0.06426,
-    -0.06548,
-    -0.06479,
-    -0.06282,
-    -0.06073,
-    -0.05969,
-    -0.06025,
-    -0.06212,
-    -0.06428,
-    -0.06552,
-    -0.06511,
-    -0.06319,
-    -0.06073,
-    -0.05907,
-    -0.05922,
-    -0.06127,
-    -0.06426,
-    -0.06661,
-    -0.06691,
-    -0.06467,
-    -0.06076,
-    -0.05710,
-    -0.05584,
-    -0.05832,
-    -0.06421,
-    -0.07138,
-    -0.07649,
-    -0.07625,
-    -0.06863,
-    -0.05375,
-    -0.03386,
-    -0.01264,
-    0.00617,
-    0.01998,
-    0.02809,
-    0.03162,
-    0.03284,
-    0.03405,
-    0.03664,
-    0.04073,
-    0.04534,
-    0.04905,
-    0.05079,
-    0.05034,
-    0.04836,
-    0.04604,
-    0.04452,
-    0.04438,
-    0.04546,
-    0.04706,
-    0.04835,
-    0.04876,
-    0.04822,
-    0.04714,
-    0.04609,
-    0.04552,
-    0.04560,
-    0.04613,
-    0.04683,
-    0.04748,
-    0.04808,
-    0.04885,
-    0.05003,
-    0.05167,
-    0.05355,
-    0.05525,
-    0.05630,
-    0.05644,
-    0.05575,
-    0.05466,
-    0.05371,
-    0.05335,
-    0.05370,
-    0.05451,
-    0.05535,
-    0.05578,
-    0.05561,
-    0.05497,
-    0.05423,
-    0.05378,
-    0.05383,
-    0.05434,
-    0.05500,
-    0.05546,
-    0.05548,
-    0.05507,
-    0.05447,
-    0.05402,
-    0.05395,
-    0.05428,
-    0.05482,
-    0.05527,
-    0.05538,
-    0.05511,
-    0.05461,
-    0.05417,
-    0.05403,
-    0.05426,
-    0.05472,
-    0.05515,
-    0.05531,
-    0.05512,
-    0.05469,
-    0.05427,
-    0.05409,
-    0.05425,
-    0.05465,
-    0.05507,
-    0.05527,
-    0.05514,
-    0.05475,
-    0.05433,
-    0.05411,
-    0.05422,
-    0.05460,
-    0.05503,
-    0.05527,
-    0.05518,
-    0.05480,
-    0.05436,
-    0.05409,
-    0.05417,
-    0.05454,
-    0.05501,
-    0.05530,
-    0.05525,
-    0.05487,
-    0.05438,
-    0.05405,
-    0.05408,
-    0.05446,
-    0.05499,
-    0.05536,
-    0.05535,
-    0.05496,
-    0.05439,
-    0.05398,
-    0.05397,
-    0.05438,
-    0.05499,
-    0.05544,
-    0.05545,
-    0.05499,
-    0.05433,
-    0.05389,
-    0.05400,
-    0.05462,
-    0.05536,
-    0.05553,
-    0.05454,
-    0.05225,
-    0.04908,
-    0.04599,
-    0.04402,
-    0.04385,
-    0.04540,
-    0.04780,
-    0.04978,
-    0.05021,
-    0.04871,
-    0.04591,
-    0.04321,
-    0.04222,
-    0.04388,
-    0.04788,
-    0.05256,
-    0.05533,
-    0.05362,
-    0.04584,
-    0.03207,
-    0.01410,
-    -0.00510,
-    -0.02238,
-    -0.03544,
-    -0.04342,
-    -0.04702,
-    -0.04794,
-    -0.04813,
-    -0.04900,
-    -0.05098,
-    -0.05361,
-    -0.05598,
-    -0.05723,
-    -0.05704,
-    -0.05575,
-    -0.05414,
-    -0.05302,
-    -0.05287,
-    -0.05364,
-    -0.05484,
-    -0.05584,
-    -0.05616,
-    -0.05571,
-    -0.05478,
-    -0.05390,
-    -0.05348,
-    -0.05371,
-    -0.05441,
-    -0.05520,
-    -0.05567,
-    -0.05561,
-    -0.05509,
-    -0.05441,
-    -0.05391,
-    -0.05383,
-    -0.05419,
-    -0.05478,
-    -0.05529,
-    -0.05546,
-    -0.05524,
-    -0.05476,
-    -0.05426,
-    -0.05400,
-    -0.05410,
-    -0.05448,
-    -0.05496,
-    -0.05527,
-    -0.05529,
-    -0.05500,
-    -0.05457,
-    -0.05421,
-    -0.05410,
-    -0.05428,
-    -0.05466,
-    -0.05505,
-    -0.05524,
-    -0.05516,
-    -0.05484,
-    -0.05445,
-    -0.05418,
-    -0.05417,
-    -0.05441,
-    -0.05479,
-    -0.05512,
-    -0.05523,
-    -0.05507,
-    -0.05472,
-    -0.05434,
-    -0.05414,
-    -0.05421,
-    -0.05452,
-    -0.05493,
-    -0.05522,
-    -0.05525,
-    -0.05499,
-    -0.05457,
-    -0.05420,
-    -0.05407,
-    -0.05425,
-    -0.05467,
-    -0.05511,
-    -0.05535,
-    -0.05526,
-    -0.05486,
-    -0.05436,
-    -0.05400,
-    -0.05399,
-    -0.05434,
-    -0.05490,
-    -0.05537,
-    -0.05551,
-    -0.05522,
-    -0.05463,
-    -0.05403,
-    -0.05375,
-    -0.05396,
-    -0.05456,
-    -0.05528,
-    -0.05573,
-    -0.05564,
-    -0.05504,
-    -0.05420,
-    -0.05355,
-    -0.05348,
-    -0.05405,
-    -0.05502,
-    -0.05590,
-    -0.05620,
-    -0.05569,
-    -0.05458,
-    -0.05340,
-    -0.05281,
-    -0.05319,
-    -0.05445,
-    -0.05603,
-    -0.05708,
-    -0.05694,
-    -0.05549,
-    -0.05331,
-    -0.05148,
-    -0.05112,
-    -0.05279,
-    -0.05610,
-    -0.05966,
-    -0.06149,
-    -0.05971,
-    -0.05327,
-    -0.04239,
-    -0.02859,
-    -0.01416,
-    -0.00142,
-    0.00802,
-    0.01369,
-    0.01625,
-    0.01702,
-    0.01742,
-    0.01837,
-    0.02005,
-    0.02207,
-    0.02378,
-    0.02472,
-    0.02490,
-    0.02476,
-    0.02493,
-    0.02590,
-    0.02772,
-    0.02999,
-    0.03204,
-    0.03324,
-    0.03332,
-    0.03244,
-    0.03115,
-    0.03009,
-    0.02973,
-    0.03014,
-    0.03104,
-    0.03194,
-    0.03241,
-    0.03227,
-    0.03164,
-    0.03087,
-    0.03036,
-    0.03033,
-    0.03076,
-    0.03139,
-    0.03190,
-    0.03206,
-    0.03181,
-    0.03130,
-    0.03080,
-    0.03056,
-    0.03066,
-    0.03104,
-    0.03151,
-    0.03182,
-    0.03185,
-    0.03160,
-    0.03118,
-    0.03080,
-    0.03063,
-    0.03076,
-    0.03113,
-    0.03158,
-    0.03190,
-    0.03194,
-    0.03162,
-    0.03105,
-    0.03044,
-    0.03011,
-    0.03034,
-    0.03133,
-    0.03302,
-    0.03517,
-    0.03736,
-    0.03911,
-    0.04009,
-    0.04022,
-    0.03968,
-    0.03890,
-    0.03831,
-    0.03822,
-    0.03866,
-    0.03935,
-    0.03989,
-    0.03995,
-    0.03947,
-    0.03867,
-    0.03800,
-    0.03790,
-    0.03850,
-    0.03956,
-    0.04053,
-    0.04079,
-    0.04002,
-    0.03846,
-    0.03685,
-    0.03617,
-    0.03715,
-    0.03976,
-    0.04302,
-    0.04515,
-    0.04409,
-    0.03828,
-    0.02725,
-    0.01194,
-    -0.00554,
-    -0.02257,
-    -0.03682,
-    -0.04693,
-    -0.05285,
-    -0.05562,
-    -0.05680,
-    -0.05781,
-    -0.05939,
-    -0.06150,
-    -0.06352,
-    -0.06470,
-    -0.06466,
-    -0.06356,
-    -0.06204,
-    -0.06090,
-    -0.06066,
-    -0.06139,
-    -0.06264,
-    -0.06374,
-    -0.06413,
-    -0.06365,
-    -0.06259,
-    -0.06153,
-    -0.06102,
-    -0.06131,
-    -0.06222,
-    -0.06325,
-    -0.06385,
-    -0.06372,
-    -0.06295,
-    -0.06195,
-    -0.06127,
-    -0.06126,
-    -0.06191,
-    -0.06287,
-    -0.06362,
-    -0.06376,
-    -0.06322,
-    -0.06229,
-    -0.06148,
-    -0.06123,
-    -0.06168,
-    -0.06258,
-    -0.06345,
-    -0.06378,
-    -0.06339,
-    -0.06248,
-    -0.06157,
-    -0.06122,
-    -0.06167,
-    -0.06271,
-    -0.06368,
-    -0.06378,
-    -0.06248,
-    -0.05980,
-    -0.05642,
-    -0.05341,
-    -0.05176,
-    -0.05195,
-    -0.05367,
-    -0.05595,
-    -0.05758,
-    -0.05765,
-    -0.05602,
-    -0.05343,
-    -0.05121,
-    -0.05065,
-    -0.05237,
-    -0.05592,
-    -0.05976,
-    -0.06178,
-    -0.06003,
-    -0.05347,
-    -0.04242,
-    -0.02846,
-    -0.01394,
-    -0.00119,
-    0.00819,
-    0.01375,
-    0.01616,
-    0.01679,
-    0.01709,
-    0.01805,
-    0.01994,
-    0.02231,
-    0.02441,
-    0.02557,
-    0.02553,
-    0.02453,
-    0.02318,
-    0.02216,
-    0.02188,
-    0.02239,
-    0.02334,
-    0.02424,
-    0.02466,
-    0.02444,
-    0.02376,
-    0.02297,
-    0.02247,
-    0.02248,
-    0.02296,
-    0.02365,
-    0.02419,
-    0.02434,
-    0.02404,
-    0.02345,
-    0.02287,
-    0.02259,
-    0.02273,
-    0.02321,
-    0.02381,
-    0.02423,
-    0.02426,
-    0.02388,
-    0.02327,
-    0.02271,
-    0.02248,
-    0.02270,
-    0.02332,
-    0.02409,
-    0.02467,
-    0.02474,
-    0.02413,
-    0.02285,
-    0.02112,
-    0.01922,
-    0.01748,
-    0.01613,
-    0.01529,
-    0.01493,
-    0.01495,
-    0.01520,
-    0.01552,
-    0.01580,
-    0.01596,
-    0.01597,
-    0.01586,
-    0.01568,
-    0.01549,
-    0.01536,
-    0.01535,
-    0.01545,
-    0.01562,
-    0.01580,
-    0.01590,
-    0.01588,
-    0.01574,
-    0.01554,
-    0.01537,
-    0.01533,
-    0.01542,
-    0.01563,
-    0.01583,
-    0.01594,
-    0.01590,
-    0.01571,
-    0.01548,
-    0.01530,
-    0.01529,
-    0.01545,
-    0.01570,
-    0.01593,
-    0.01601,
-    0.01589,
-    0.01563,
-    0.01535,
-    0.01521,
-    0.01528,
-    0.01553,
-    0.01585,
-    0.01607,
-    0.01606,
-    0.01582,
-    0.01546,
-    0.01518,
-    0.01511,
-    0.01532,
-    0.01570,
-    0.01606,
-    0.01621,
-    0.01605,
-    0.01565,
-    0.01521,
-    0.01497,
-    0.01506,
-    0.01547,
-    0.01599,
-    0.01635,
-    0.01634,
-    0.01594,
-    0.01534,
-    0.01484,
-    0.01474,
-    0.01511,
-    0.01580,
-    0.01646,
-    0.01672,
-    0.01640,
-    0.01561,
-    0.01475,
-    0.01427,
-    0.01449,
-    0.01539,
-    0.01654,
-    0.01735,
-    0.01730,
-    0.01627,
-    0.01468,
-    0.01330,
-    0.01298,
-    0.01417,
-    0.01660,
-    0.01925,
-    0.02064,
-    0.01937,
-    0.01464,
-    0.00666,
-    -0.00337,
-    -0.01367,
-    -0.02244,
-    -0.02849,
-    -0.03159,
-    -0.03242,
-    -0.03225,
-    -0.03231,
-    -0.03337,
-    -0.03549,
-    -0.03807,
-    -0.04027,
-    -0.04138,
-    -0.04119,
-    -0.04004,
-    -0.03861,
-    -0.03761,
-    -0.03745,
-    -0.03811,
-    -0.03916,
-    -0.04005,
-    -0.04036,
-    -0.03999,
-    -0.03919,
-    -0.03839,
-    -0.03799,
-    -0.03816,
-    -0.03877,
-    -0.03949,
-    -0.03995,
-    -0.03993,
-    -0.03947,
-    -0.03884,
-    -0.03834,
-    -0.03824,
-    -0.03855,
-    -0.03911,
-    -0.03963,
-    -0.03985,
-    -0.03967,
-    -0.03919,
-    -0.03866,
-    -0.03833,
-    -0.03836,
-    -0.03874,
-    -0.03929,
-    -0.03975,
-    -0.03990,
-    -0.03965,
-    -0.03908,
-    -0.03842,
-    -0.03795,
-    -0.03793,
-    -0.03850,
-    -0.03966,
-    -0.04126,
-    -0.04309,
-    -0.04486,
-    -0.04633,
-    -0.04732,
-    -0.04778,
-    -0.04774,
-    -0.04737,
-    -0.04688,
-    -0.04649,
-    -0.04632,
-    -0.04642,
-    -0.04672,
-    -0.04705,
-    -0.04727,
-    -0.04728,
-    -0.04710,
-    -0.04682,
-    -0.04659,
-    -0.04651,
-    -0.04662,
-    -0.04685,
-    -0.04708,
-    -0.04720,
-    -0.04715,
-    -0.04696,
-    -0.04673,
-    -0.04659,
-    -0.04660,
-    -0.04676,
-    -0.04697,
-    -0.04713,
-    -0.04715,
-    -0.04702,
-    -0.04682,
-    -0.04665,
-    -0.04661,
-    -0.04671,
-    -0.04690,
-    -0.04707,
-    -0.04714,
-    -0.04706,
-    -0.04688,
-    -0.04670,
-    -0.04661,
-    -0.04667,
-    -0.04684,
-    -0.04703,
-    -0.04713,
-    -0.04709,
-    -0.04693,
-    -0.04674,
-    -0.04662,
-    -0.04664,
-    -0.04680,
-    -0.04700,
-    -0.04714,
-    -0.04713,
-    -0.04698,
-    -0.04676,
-    -0.04660,
-    -0.04659,
-    -0.04674,
-    -0.04698,
-    -0.04717,
-    -0.04720,
-    -0.04704,
-    -0.04678,
-    -0.04655,
-    -0.04650,
-    -0.04666,
-    -0.04697,
-    -0.04725,
-    -0.04734,
-    -0.04715,
-    -0.04678,
-    -0.04644,
-    -0.04634,
-    -0.04658,
-    -0.04697,
-    -0.04703,
-    -0.04610,
-    -0.04354,
-    -0.03897,
-    -0.03244,
-    -0.02446,
-    -0.01595,
-    -0.00790,
-    -0.00120,
-    0.00364,
-    0.00657,
-    0.00790,
-    0.00820,
-    0.00803,
-    0.00780,
-    0.00772,
-    0.00779,
-    0.00790,
-    0.00795,
-    0.00791,
-    0.00779,
-    0.00769,
-    0.00766,
-    0.00772,
-    0.00783,
-    0.00793,
-    0.00796,
-    0.00791,
-    0.00780,
-    0.00771,
-    0.00768,
-    0.00772,
-    0.00781,
-    0.00790,
-    0.00793,
-    0.00790,
-    0.00783,
-    0.00775,
-    0.00771,
-    0.00772,
-    0.00779,
-    0.00786,
-    0.00791,
-    0.00790,
-    0.00785,
-    0.00778,
-    0.00773,
-    0.00773,
-    0.00777,
-    0.00784,
-    0.00788,
-    0.00789,
-    0.00786,
-    0.00780,
-    0.00775,
-    0.00774,
-    0.00776,
-    0.00781,
-    0.00786,
-    0.00788,
-    0.00786,
-    0.00782,
-    0.00778,
-    0.00775,
-    0.00776,
-    0.00780,
-    0.00784,
-    0.00787,
-    0.00786,
-    0.00783,
-    0.00779,
-    0.00777,
-    0.00776,
-    0.00779,
-    0.00782,
-    0.00785,
-    0.00786,
-    0.00784,
-    0.00781,
-    0.00778,
-    0.00777,
-    0.00778,
-    0.00781,
-    0.00784,
-    0.00785,
-    0.00785,
-    0.00782,
-    0.00779,
-    0.00778,
-    0.00778,
-    0.00780,
-    0.00782,
-    0.00784,
-    0.00785,
-    0.00783,
-    0.00781,
-    0.00779,
-    0.00778,
-    0.00779,
-    0.00781,
-    0.00783,
-    0.00784,
-    0.00784,
-    0.00782,
-    0.00780,
-    0.00779,
-    0.00779,
-    0.00780,
-    0.00782,
-    0.00784,
-    0.00784,
-    0.00782,
-    0.00781,
-    0.00779,
-    0.00779,
-    0.00780,
-    0.00781,
-    0.00783,
-    0.00784,
-    0.00783,
-    0.00781,
-    0.00780,
-    0.00779,
-    0.00779,
-    0.00781,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00781,
-    0.00780,
-    0.00779,
-    0.00780,
-    0.00781,
-    0.00783,
-    0.00783,
-    0.00783,
-    0.00781,
-    0.00780,
-    0.00780,
-    0.00780,
-    0.00781,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00781,
-    0.00780,
-    0.00780,
-    0.00780,
-    0.00781,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00780,
-    0.00780,
-    0.00780,
-    0.00781,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00781,
-    0.00780,
-    0.00780,
-    0.00780,
-    0.00781,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00781,
-    0.00780,
-    0.00780,
-    0.00780,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00781,
-    0.00780,
-    0.00779,
-    0.00780,
-    0.00781,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00780,
-    0.00779,
-    0.00779,
-    0.00780,
-    0.00782,
-    0.00783,
-    0.00783,
-    0.00783,
-    0.00781,
-    0.00780,
-    0.00779,
-    0.00780,
-    0.00781,
-    0.00783,
-    0.00783,
-    0.00783,
-    0.00782,
-    0.00780,
-    0.00779,
-    0.00779,
-    0.00780,
-    0.00782,
-    0.00783,
-    0.00784,
-    0.00783,
-    0.00781,
-    0.00779,
-    0.00779,
-    0.00779,
-    0.00781,
-    0.00783,
-    0.00784,
-    0.00784,
-    0.00782,
-    0.00780,
-    0.00778,
-    0.00779,
-    0.00780,
-    0.00783,
-    0.00784,
-    0.00784,
-    0.00783,
-    0.00780,
-    0.00778,
-    0.00778,
-    0.00779,
-    0.00782,
-    0.00784,
-    0.00785,
-    0.00784,
-    0.00781,
-    0.00779,
-    0.00777,
-    0.00778,
-    0.00780,
-    0.00783,
-    0.00785,
-    0.00785,
-    0.00783,
-    0.00780,
-    0.00777,
-    0.00777,
-    0.00779,
-    0.00782,
-    0.00786,
-    0.00787,
-    0.00785,
-    0.00781,
-    0.00777,
-    0.00775,
-    0.00777,
-    0.00781,
-    0.00785,
-    0.00788,
-    0.00787,
-    0.00783,
-    0.00778,
-    0.00774,
-    0.00774,
-    0.00778,
-    0.00784,
-    0.00788,
-    0.00790,
-    0.00786,
-    0.00780,
-    0.00774,
-    0.00772,
-    0.00774,
-    0.00781,
-    0.00788,
-    0.00792,
-    0.00791,
-    0.00784,
-    0.00775,
-    0.00768,
-    0.00768,
-    0.00775,
-    0.00786,
-    0.00796,
-    0.00798,
-    0.00792,
-    0.00779,
-    0.00765,
-    0.00759,
-    0.00764,
-    0.00780,
-    0.00799,
-    0.00812,
-    0.00809,
-    0.00790,
-    0.00762,
-    0.00738,
-    0.00734,
-    0.00757,
-    0.00803,
-    0.00852,
-    0.00877,
-    0.00852,
-    0.00758,
-    0.00600,
-    0.00400,
-    0.00195,
-    0.00025,
-    -0.00081,
-    -0.00114,
-    -0.00086,
-    -0.00027,
-    0.00032,
-    0.00065,
-    0.00061,
-    0.00028,
-    -0.00014,
-    -0.00044,
-    -0.00049,
-    -0.00030,
-    0.00003,
-    0.00032,
-    0.00042,
-    0.00031,
-    0.00005,
-    -0.00023,
-    -0.00038,
-    -0.00033,
-    -0.00011,
-    0.00016,
-    0.00034,
-    0.00034,
-    0.00017,
-    -0.00009,
-    -0.00030,
-    -0.00035,
-    -0.00022,
-    0.00003,
-    0.00026,
-    0.00036,
-    0.00027,
-    0.00004,
-    -0.00023,
-    -0.00037,
-    -0.00033,
-    -0.00010,
-    0.00018,
-    0.00038,
-    0.00038,
-    0.00018,
-    -0.00013,
-    -0.00039,
-    -0.00045,
-    -0.00027,
-    0.00007,
-    0.00039,
-    0.00053,
-    0.00038,
-    0.00001,
-    -0.00039,
-    -0.00062,
-    -0.00053,
-    -0.00013,
-    0.00040,
-    0.00077,
-    0.00075,
-    0.00031,
-    -0.00039,
-    -0.00100,
-    -0.00115,
-    -0.00065,
-    0.00039,
-    0.00153,
-    0.00214,
-    0.00160,
-    -0.00039,
-    -0.00372,
-    -0.00784,
-    -0.01195,
-    -0.01524,
-    -0.01720,
-    -0.01771,
-    -0.01711,
-    -0.01600,
-    -0.01500,
-    -0.01452,
-    -0.01467,
-    -0.01526,
-    -0.01592,
-    -0.01633,
-    -0.01633,
-    -0.01598,
-    -0.01549,
-    -0.01513,
-    -0.01506,
-    -0.01528,
-    -0.01566,
-    -0.01597,
-    -0.01609,
-    -0.01595,
-    -0.01566,
-    -0.01538,
-    -0.01524,
-    -0.01531,
-    -0.01554,
-    -0.01580,
-    -0.01595,
-    -0.01592,
-    -0.01574,
-    -0.01551,
-    -0.01535,
-    -0.01535,
-    -0.01548,
-    -0.01569,
-    -0.01585,
-    -0.01589,
-    -0.01579,
-    -0.01560,
-    -0.01544,
-    -0.01538,
-    -0.01545,
-    -0.01561,
-    -0.01577,
-    -0.01585,
-    -0.01581,
-    -0.01567,
-    -0.01551,
-    -0.01542,
-    -0.01544,
-    -0.01555,
-    -0.01570,
-    -0.01581,
-    -0.01581,
-    -0.01572,
-    -0.01558,
-    -0.01546,
-    -0.01544,
-    -0.01551,
-    -0.01565,
-    -0.01576,
-    -0.01581,
-    -0.01575,
-    -0.01563,
-    -0.01551,
-    -0.01545,
-    -0.01549,
-    -0.01560,
-    -0.01572,
-    -0.01579,
-    -0.01577,
-    -0.01568,
-    -0.01555,
-    -0.01547,
-    -0.01547,
-    -0.01555,
-    -0.01567,
-    -0.01577,
-    -0.01579,
-    -0.01572,
-    -0.01560,
-    -0.01549,
-    -0.01546,
-    -0.01551,
-    -0.01563,
-    -0.01574,
-    -0.01579,
-    -0.01575,
-    -0.01565,
-    -0.01553,
-    -0.01546,
-    -0.01548,
-    -0.01558,
-    -0.01570,
-    -0.01579,
-    -0.01578,
-    -0.01569,
-    -0.01557,
-    -0.01547,
-    -0.01546,
-    -0.01553,
-    -0.01566,
-    -0.01577,
-    -0.01580,
-    -0.01574,
-    -0.01561,
-    -0.01549,
-    -0.01544,
-    -0.01549,
-    -0.01561,
-    -0.01574,
-    -0.01581,
-    -0.01578,
-    -0.01567,
-    -0.01552,
-    -0.01543,
-    -0.01544,
-    -0.01555,
-    -0.01570,
-    -0.01582,
-    -0.01583,
-    -0.01573,
-    -0.01557,
-    -0.01544,
-    -0.01540,
-    -0.01549,
-    -0.01565,
-    -0.01581,
-    -0.01587,
-    -0.01580,
-    -0.01563,
-    -0.01546,
-    -0.01537,
-    -0.01541,
-    -0.01558,
-    -0.01578,
-    -0.01590,
-    -0.01588,
-    -0.01572,
-    -0.01549,
-    -0.01533,
-    -0.01532,
-    -0.01548,
-    -0.01573,
-    -0.01593,
-    -0.01598,
-    -0.01583,
-    -0.01556,
-    -0.01531,
-    -0.01521,
-    -0.01534,
-    -0.01564,
-    -0.01595,
-    -0.01612,
-    -0.01602,
-    -0.01569,
-    -0.01529,
-    -0.01504,
-    -0.01509,
-    -0.01546,
-    -0.01597,
-    -0.01636,
-    -0.01638,
-    -0.01597,
-    -0.01528,
-    -0.01466,
-    -0.01447,
-    -0.01495,
-    -0.01597,
-    -0.01712,
-    -0.01775,
-    -0.01725,
-    -0.01528,
-    -0.01194,
-    -0.00779,
-    -0.00366
-};
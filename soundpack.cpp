@@ -0,0 +1,211 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : soundpack.cpp
+*   Purpose : Sound effect pack.  The samples for every sound are kept in
+*             one binary file that's mapped into memory and played from
+*             where it's mapped.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "soundpack.h"
+
+SoundPack::SoundPack(void)
+{
+    map = nullptr;
+    mapSize = 0;
+    lockError = ENOENT;
+    entry = nullptr;
+    count = 0;
+}
+
+
+SoundPack::~SoundPack(void)
+{
+    if (nullptr != map)
+    {
+        munmap(map, mapSize);
+    }
+}
+
+
+bool SoundPack::Load(const char *fileName)
+{
+    int fd;
+    struct stat info;
+    void *newMap;
+    const pack_header_t *header;
+    const pack_entry_t *newEntry;
+
+    fd = open(fileName, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    if ((size_t)info.st_size < sizeof(pack_header_t))
+    {
+        close(fd);
+        errno = EINVAL;
+        return false;
+    }
+
+    /* the mapping outlives the descriptor */
+    newMap = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == newMap)
+    {
+        return false;
+    }
+
+    /* check everything up front, the audio callback trusts the pack */
+    header = (const pack_header_t *)newMap;
+    newEntry = (const pack_entry_t *)(header + 1);
+
+    if ((memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) ||
+        (PACK_VERSION != header->version) ||
+        (header->count > (info.st_size - sizeof(pack_header_t)) /
+            sizeof(pack_entry_t)))
+    {
+        munmap(newMap, info.st_size);
+        errno = EINVAL;
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header->count; i++)
+    {
+        const pack_entry_t *e = &newEntry[i];
+
+        /* an empty sound would never advance a looping voice */
+        if ((0 != (e->offset % PACK_ALIGN)) ||
+            (e->offset > (size_t)info.st_size) || (0 == e->length) ||
+            (e->length > (info.st_size - e->offset) / sizeof(float)) ||
+            (e->length > INT_MAX) || (0 == e->sampleRate) ||
+            (nullptr == memchr(e->name, '\0', PACK_NAME_SIZE)))
+        {
+            munmap(newMap, info.st_size);
+            errno = EINVAL;
+            return false;
+        }
+    }
+
+    /*
+     * The samples are read on the audio thread, fault them in now and keep
+     * them in memory so a sound's first play doesn't wait on the disk.  If
+     * they can't be locked (RLIMIT_MEMLOCK) touch every page instead.
+     */
+    madvise(newMap, info.st_size, MADV_WILLNEED);
+
+    if (nullptr != map)
+    {
+        munmap(map, mapSize);
+    }
+
+    if (0 == mlock(newMap, info.st_size))
+    {
+        lockError = 0;
+    }
+    else
+    {
+        const volatile char *page = (const volatile char *)newMap;
+        long pageSize = sysconf(_SC_PAGESIZE);
+
+        lockError = errno;
+
+        for (off_t i = 0; i < info.st_size; i += pageSize)
+        {
+            (void)page[i];
+        }
+    }
+
+    map = newMap;
+    mapSize = info.st_size;
+    entry = newEntry;
+    count = header->count;
+    return true;
+}
+
+
+const float *SoundPack::Find(const char *name, int *length,
+    int *sampleRate) const
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (0 == strcmp(entry[i].name, name))
+        {
+            *length = entry[i].length;
+            *sampleRate = entry[i].sampleRate;
+            return (const float *)((const char *)map + entry[i].offset);
+        }
+    }
+
+    return nullptr;
+}
+
+
+const char *SoundPack::DefaultPath(void)
+{
+    static char path[PATH_MAX];
+    ssize_t len;
+    char *slash;
+
+    len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+
+    if (len <= 0)
+    {
+        /* try the current directory */
+        return PACK_FILE_NAME;
+    }
+
+    path[len] = '\0';
+    slash = strrchr(path, '/');
+
+    if ((nullptr == slash) ||
+        ((size_t)(slash + 1 - path) + sizeof(PACK_FILE_NAME) > sizeof(path)))
+    {
+        return PACK_FILE_NAME;
+    }
+
+    strcpy(slash + 1, PACK_FILE_NAME);
+    return path;
+}
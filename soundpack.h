@@ -0,0 +1,101 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : soundpack.h
+*   Purpose : Sound effect pack.  The samples for every sound are kept in
+*             one binary file that's mapped into memory and played from
+*             where it's mapped.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __SOUNDPACK_H
+#define  __SOUNDPACK_H
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * A sound pack is a binary file in the machine's byte order:
+ *      pack_header_t   magic, version and the number of sounds
+ *      pack_entry_t    one per sound: name, where its samples are, how
+ *                      many there are and their sample rate
+ *      samples         mono float samples for each sound, each sound
+ *                      starting on a PACK_ALIGN byte boundary
+ * tools/make_pack builds a pack from WAV files.
+ */
+static const char PACK_MAGIC[8] = {'T', 'V', 'U', 'S', 'P', 'A', 'C', 'K'};
+static const uint32_t PACK_VERSION = 1;
+static const uint32_t PACK_ALIGN = 64;          /* a cache line */
+static const int PACK_NAME_SIZE = 24;           /* including the '\0' */
+static const char PACK_FILE_NAME[] = "tankvufo.pak";
+
+typedef struct
+{
+    char magic[8];          /* PACK_MAGIC */
+    uint32_t version;       /* PACK_VERSION */
+    uint32_t count;         /* entries following the header */
+} pack_header_t;
+
+typedef struct
+{
+    char name[PACK_NAME_SIZE];  /* WAV file name without the .wav */
+    uint32_t offset;            /* byte offset of the samples in the pack */
+    uint32_t length;            /* number of samples */
+    uint32_t sampleRate;        /* samples per second */
+    uint32_t reserved;          /* 0 */
+} pack_entry_t;
+
+class SoundPack
+{
+    public:
+        SoundPack(void);
+        ~SoundPack(void);
+
+        /* map a pack, false with errno set if it can't be used */
+        bool Load(const char *fileName);
+
+        /* samples in the mapped pack, nullptr if there's no such sound */
+        const float *Find(const char *name, int *length,
+            int *sampleRate) const;
+
+        /* PACK_FILE_NAME in the directory the game was run from */
+        static const char *DefaultPath(void);
+
+        /* bytes mapped, and whether they're locked in memory (errno if not) */
+        size_t Size(void) const { return mapSize; }
+        bool IsLocked(void) const { return 0 == lockError; }
+        int LockError(void) const { return lockError; }
+
+    private:
+        void *map;              /* the whole pack, read only */
+        size_t mapSize;
+        int lockError;          /* 0 if the pack is locked in memory */
+        const pack_entry_t *entry;
+        uint32_t count;
+};
+
+#endif /* ndef  __SOUNDPACK_H */
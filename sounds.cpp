@@ -32,256 +32,959 @@
 ****************************************************************************/
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <cerrno>
-#include <unistd.h>
-#include <fcntl.h>
+#include <ctime>
+#include <climits>
+#include <sys/resource.h>
+#include <sys/mman.h>
 #include "sounds.h"
-#include "sound_data.h"
-
-/* This routine will be called by the PortAudio engine when audio is needed.
-** It may called at interrupt level on some machines so don't do anything
-** that could mess up the system like calling malloc() or free().
-*/
-static int SoundCallback(const void *inputBuffer,
-    void *outputBuffer,
-    unsigned long framesPerBuffer,
-    const PaStreamCallbackTimeInfo* timeInfo,
-    PaStreamCallbackFlags statusFlags,
-    void *userData)
+#include "mixer.h"
+#include "resampler.h"
+#include "realtime.h"
+#include "trace.h"
+
+/* name of each sound's samples in the pack */
+static const char *PACK_NAME[NUM_SOUNDS] =
 {
-    sound_data_t *data = (sound_data_t*)userData;
-    float *out = (float*)outputBuffer;
-    unsigned long i;
-    int data_length;
+    nullptr, "ufo_falling", "ufo_falling", "tank_shot", "on_fire", "explode"
+};
+
+static voice_t VoiceFor(sound_t sound)
+{
+    switch (sound)
+    {
+        case SOUND_LOW_FREQ:
+        case SOUND_HIGH_FREQ:
+            return VOICE_FALL;
+
+        case SOUND_EXPLODE:
+            return VOICE_EXPLODE;
 
-    /* Prevent unused variable warnings. */
-    (void)timeInfo;         /* doesn't work with PulseAudio */
-    (void)statusFlags;
-    (void)inputBuffer;
+        case SOUND_ON_FIRE:
+            return VOICE_FIRE;
+
+        case SOUND_TANK_SHOT:
+        default:
+            return VOICE_SHOT;
+    }
+}
+
+
+/* a sound played on each voice, to stop it by */
+static const sound_t VOICE_SOUND[NUM_VOICES] =
+{
+    SOUND_TANK_SHOT, SOUND_LOW_FREQ, SOUND_EXPLODE, SOUND_ON_FIRE
+};
 
-    if (SOUND_OFF == data->sound)
+
+/*
+ * VIC patches for each sound.  The ufo falls to a soprano square wave a
+ * little under 1 kHz or its octave, the shot is noise that falls in pitch
+ * as it rises and fades away, the fire is a rumble that dies down and the
+ * explosion is a quick noise burst that drops in pitch.
+ */
+static const vic_patch_t VIC_PATCH[NUM_SOUNDS] =
+{
+    /* voice, reg, regStep, volume, fade, steps, stepMs */
+    {VIC_SOPRANO, 0, 0, 0, 0, 1, 1},            /* SOUND_OFF, never played */
+    {VIC_SOPRANO, 240, 0, 15, 0, 0, 100},       /* SOUND_LOW_FREQ */
+    {VIC_SOPRANO, 248, 0, 15, 0, 0, 100},       /* SOUND_HIGH_FREQ */
+    {VIC_NOISE, 254, -1, 15, -3, 80, 50},       /* SOUND_TANK_SHOT */
+    {VIC_NOISE, 190, 0, 12, -4, 41, 50},        /* SOUND_ON_FIRE */
+    {VIC_NOISE, 230, -4, 15, -12, 20, 20}       /* SOUND_EXPLODE */
+};
+
+
+/* set up a voice to play a sound, called from the callback */
+static void StartVoice(voice_data_t *voice, const sound_data_t *data,
+    sound_t sound)
+{
+    const sample_data_t *sample = data->sample;
+    unsigned long long increment;
+    bool falling;
+
+    if (sound == voice->sound)
     {
-        data->phase = 0;
-        return paComplete;
+        /* already playing */
+        return;
     }
 
-    /* handle explode first, because it might become high frequency sound */
-    if (SOUND_EXPLODE == data->sound)
+    falling = (SOUND_LOW_FREQ == voice->sound) ||
+        (SOUND_HIGH_FREQ == voice->sound);
+
+    if (VIC_NONE != data->chip)
     {
-        /* this is the sound for a tank shot */
-        data_length = sizeof(explosion) / sizeof(explosion[0]);
+        /* keep the square wave going when the falling frequency changes */
+        voice->synth = true;
+        VicStart(&voice->vic, &VIC_PATCH[sound], data->chip,
+            data->sampleRate, falling);
+        voice->sound = sound;
+        return;
+    }
 
-        for(i = 0; i < framesPerBuffer; i++)
-        {
-            /* left channel output then right channel output */
-            *out = data->volume * explosion[data->phase];
-            out++;
-            *out = data->volume * explosion[data->phase];
-            out++;
+    if (nullptr == sample[sound].samples)
+    {
+        /* nothing to play */
+        return;
+    }
 
-            data->phase++;
+    /* samples per frame in 32.32 fixed point, high frequency is 2x */
+    increment = ((unsigned long long)sample[sound].rate << 32) /
+        data->sampleRate;
 
-            if(data->phase >= data_length)
-            {
-                /* switch to falling sound */
-                data->phase = 0;
-                data->sound = SOUND_HIGH_FREQ;
-                framesPerBuffer -= (i + 1);
-                break;
-            }
-        }
+    if (SOUND_HIGH_FREQ == sound)
+    {
+        increment *= 2;
+    }
+
+    voice->synth = false;
+    voice->samples = sample[sound].samples;
+    voice->length = sample[sound].length;
+    voice->step = (int)(increment >> 32);
+    voice->stepFraction = (uint32_t)increment;
+    voice->loop = (SOUND_LOW_FREQ == sound) || (SOUND_HIGH_FREQ == sound);
+
+    if (falling)
+    {
+        /* keep the phase when the falling frequency changes */
+        voice->phase %= voice->length;
+    }
+    else
+    {
+        voice->phase = 0;
+        voice->fraction = 0;
+    }
+
+    voice->sound = sound;
+}
+
+
+static long long MonotonicNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/* only the callback writes the statistics, the game thread just reads them */
+static void AddStat(std::atomic<unsigned long long> *stat,
+    unsigned long long amount)
+{
+    stat->store(stat->load(std::memory_order_relaxed) + amount,
+        std::memory_order_relaxed);
+}
+
+
+/* keep the largest amount seen in stat, called from the callback */
+static void MaxStat(std::atomic<unsigned long long> *stat,
+    unsigned long long amount)
+{
+    if (amount > stat->load(std::memory_order_relaxed))
+    {
+        stat->store(amount, std::memory_order_relaxed);
+    }
+}
+
+
+/* how far ahead of the buffer a command can be, more is a clock mix up */
+static const long long MAX_SCHEDULE_NS = 1000000000LL;
+
+/* how close a started sound came to being heard when it was due */
+static void AddScheduleStats(sound_data_t *data, long long dueNs,
+    long long startNs)
+{
+    long long error;
+
+    error = startNs - dueNs;
+
+    if (error < 0)
+    {
+        /* a clock mix up, it wasn't scheduled */
+        return;
+    }
+
+    if (error < 1000000000LL / data->sampleRate)
+    {
+        /* on the frame that's heard when it's due */
+        AddStat(&data->onTime, 1);
+        MaxStat(&data->errorMaxNs, error);
+    }
+    else
+    {
+        AddStat(&data->late, 1);
+        MaxStat(&data->lateMaxNs, error);
     }
+}
+
+
+/*
+ * Apply the commands the game thread has queued that are due by frame from
+ * of this buffer, called from the callback.  A command is due on the frame
+ * that's heard scheduleNs after the tick that sent it, so sounds line up
+ * with the ticks no matter where the callback's buffers fall.  Returns the
+ * frame the next command is due on, or frames if it isn't due in this
+ * buffer.
+ */
+static unsigned long ApplyCommands(sound_data_t *data,
+    const audio_status_t *status, unsigned long from, unsigned long frames)
+{
+    command_queue_t *queue = &data->queue;
+    unsigned int head, tail;
+    unsigned long next;
+    long long now, startNs;
+
+    /* acquire pairs with the game thread's release of head */
+    tail = queue->tail.load(std::memory_order_relaxed);
+    head = queue->head.load(std::memory_order_acquire);
+    now = MonotonicNs();
+    startNs = status->timeNs + (long long)from * 1000000000LL /
+        data->sampleRate;
+    next = frames;
 
-    if ((SOUND_LOW_FREQ == data->sound) ||  (SOUND_HIGH_FREQ == data->sound))
+    while (tail != head)
     {
-        /* this is the sound for a falling UFO */
-        data_length = sizeof(ufo_falling) / sizeof(ufo_falling[0]);
+        const sound_command_t *cmd;
+        long long dueNs;
 
-        for(i = 0; i < framesPerBuffer; i++)
+        cmd = &queue->command[tail & (COMMAND_QUEUE_SIZE - 1)];
+        dueNs = cmd->tickNs + data->scheduleNs;
+
+        if ((dueNs > startNs) && (dueNs - startNs < MAX_SCHEDULE_NS))
         {
-            /* left channel output then right channel output */
-            *out = data->volume * ufo_falling[data->phase];
-            out++;
-            *out = data->volume * ufo_falling[data->phase];
-            out++;
-
-            /* shift to next phase of wave based on frequency */
-            if (SOUND_HIGH_FREQ == data->sound)
-            {
-                data->phase += 2;
-            }
-            else
-            {
-                data->phase++;
-            }
+            /* the first frame heard at or after dueNs, the commands are
+             * in tick order so the rest wait too */
+            next = from + (unsigned long)(((dueNs - startNs) *
+                data->sampleRate + 999999999LL) / 1000000000LL);
 
-            if(data->phase >= data_length)
+            if (next > frames)
             {
-                data->phase -= data_length;
+                next = frames;
             }
+
+            break;
         }
+
+        switch (cmd->command)
+        {
+            case COMMAND_START:
+                StartVoice(&data->voice[VoiceFor(cmd->sound)], data,
+                    cmd->sound);
+                AddStat(&data->triggers, 1);
+                AddStat(&data->triggerNs, now - cmd->sentNs);
+                MaxStat(&data->triggerMaxNs, now - cmd->sentNs);
+                AddScheduleStats(data, dueNs, startNs);
+                break;
+
+            case COMMAND_STOP:
+                if (SOUND_OFF == cmd->sound)
+                {
+                    for (int v = 0; v < NUM_VOICES; v++)
+                    {
+                        data->voice[v].sound = SOUND_OFF;
+                    }
+                }
+                else
+                {
+                    data->voice[VoiceFor(cmd->sound)].sound = SOUND_OFF;
+                }
+                break;
+
+            case COMMAND_VOLUME:
+                data->volume = cmd->volume;
+                break;
+        }
+
+        tail++;
+    }
+
+    /* the slots may be reused once the game thread sees the new tail */
+    queue->tail.store(tail, std::memory_order_release);
+    return next;
+}
+
+
+/* what the backend said about the buffer and how long it took to fill */
+static void AddCallbackStats(sound_data_t *data, unsigned long frames,
+    const audio_status_t *status, unsigned long long ns)
+{
+    static const unsigned int bucketPercent[CALLBACK_BUCKETS - 1] =
+        {10, 25, 50, 75, 100};
+    unsigned long long deadline;
+    int bucket;
+
+    AddStat(&data->callbacks, 1);
+    AddStat(&data->callbackNs, ns);
+    MaxStat(&data->callbackMaxNs, ns);
+
+    if (status->flags & AUDIO_OUTPUT_UNDERFLOW)
+    {
+        AddStat(&data->underflows, 1);
     }
-    else if (SOUND_TANK_SHOT == data->sound)
+
+    if (status->flags & AUDIO_OUTPUT_OVERFLOW)
     {
-        /* this is the sound for a tank shot */
-        data_length = sizeof(shot_sound) / sizeof(shot_sound[0]);
+        AddStat(&data->overflows, 1);
+    }
 
-        for(i = 0; i < framesPerBuffer; i++)
+    /* the next buffer is needed by the time this one has played */
+    deadline = frames * 1000000000ULL / data->sampleRate;
+    data->deadlineNs.store(deadline, std::memory_order_relaxed);
+
+    for (bucket = 0; bucket < CALLBACK_BUCKETS - 1; bucket++)
+    {
+        if (ns * 100 < deadline * bucketPercent[bucket])
         {
-            /* left channel output then right channel output */
-            *out = data->volume * shot_sound[data->phase];
-            out++;
-            *out = data->volume * shot_sound[data->phase];
-            out++;
+            break;
+        }
+    }
 
-            data->phase++;
+    AddStat(&data->histogram[bucket], 1);
 
-            if(data->phase >= data_length)
-            {
-                data->phase = 0;
-                data->sound = SOUND_OFF;
-                return paComplete;
-            }
+    if (status->latency > 0.0)
+    {
+        unsigned long long latency = status->latency * 1e9;
+
+        MaxStat(&data->maxLatencyNs, latency);
+
+        if (latency < data->minLatencyNs.load(std::memory_order_relaxed))
+        {
+            data->minLatencyNs.store(latency, std::memory_order_relaxed);
         }
     }
-    else if (SOUND_ON_FIRE == data->sound)
+}
+
+
+/* page faults taken by the calling thread so far */
+static unsigned long long ThreadFaults(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_THREAD, &usage);
+    return usage.ru_minflt + usage.ru_majflt;
+}
+
+
+/* move the callback's thread to the requested priority, once */
+static void ApplyPriority(sound_data_t *data)
+{
+    int requested, error;
+
+    requested = data->requestedPriority.load(std::memory_order_relaxed);
+
+    if (requested == data->priority.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    error = RaiseThreadPriority(SCHED_FIFO, requested);
+
+    if (0 == error)
     {
-        /* this is the sound of a tank or ufo on fire */
-        data_length = sizeof(on_fire) / sizeof(on_fire[0]);
+        data->priority.store(requested, std::memory_order_relaxed);
+        data->priorityError.store(0, std::memory_order_relaxed);
+    }
+    else
+    {
+        /* don't try again, keep running at the normal priority */
+        data->priorityError.store(error, std::memory_order_relaxed);
+        data->requestedPriority.store(0, std::memory_order_relaxed);
+    }
+}
 
-        for(i = 0; i < framesPerBuffer; i++)
-        {
-            /* left channel output then right channel output */
-            *out = data->volume * on_fire[data->phase];
-            out++;
-            *out = data->volume * on_fire[data->phase];
-            out++;
 
-            data->phase++;
+/* mix frames of the voices into out, a block at a time */
+static void MixFrames(sound_data_t *data, float *out, unsigned long frames)
+{
+    while (frames > 0)
+    {
+        float mix[MIX_BLOCK];
+        unsigned long block;
+
+        block = (frames < MIX_BLOCK) ? frames : MIX_BLOCK;
+
+        /* start with silence and add in each playing voice */
+        memset(mix, 0, block * sizeof(float));
+
+        for (int v = 0; v < NUM_VOICES; v++)
+        {
+            voice_data_t *voice = &data->voice[v];
+            struct timespec start, end;
 
-            if(data->phase >= data_length)
+            if (SOUND_OFF == voice->sound)
             {
-                data->phase = 0;
-                data->sound = SOUND_OFF;
-                return paComplete;
+                continue;
             }
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            MixVoice(voice, data->volume * MIX_GAIN, mix, block);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            AddStat(&data->frames[v], block);
+            AddStat(&data->ns[v], (end.tv_sec - start.tv_sec) * 1000000000LL +
+                (end.tv_nsec - start.tv_nsec));
         }
+
+        InterleaveMix(mix, out, block);
+        out += 2 * block;
+        frames -= block;
+    }
+}
+
+
+/* render frames of the mix into out, called by the audio backend */
+static void RenderSound(float *out, unsigned long frames,
+    const audio_status_t *status, void *userData)
+{
+    sound_data_t *data = (sound_data_t*)userData;
+    unsigned long done;
+    unsigned long long faults;
+    long long start;
+    uint64_t traceStart;
+
+    traceStart = TscNow();
+    start = MonotonicNs();
+    TraceNameThread("audio");
+
+    if (status->flags & AUDIO_OUTPUT_UNDERFLOW)
+    {
+        /* the gap was before this buffer */
+        TraceInstant("audio underflow");
+    }
+
+    faults = ThreadFaults();
+    ApplyPriority(data);
+
+    /* everything sent has to wait as long as the slowest send could */
+    if (status->leadNs > data->scheduleNs)
+    {
+        data->scheduleNs = status->leadNs;
+        data->schedule.store(data->scheduleNs, std::memory_order_relaxed);
+    }
+
+    /* mix up to each frame a command is due on, then apply it */
+    done = 0;
+
+    while (done < frames)
+    {
+        unsigned long next;
+
+        next = ApplyCommands(data, status, done, frames);
+        MixFrames(data, out + 2 * done, next - done);
+        done = next;
+    }
+
+    /* after the first second everything used should be in memory */
+    faults = ThreadFaults() - faults;
+    AddStat(&data->faults, faults);
+
+    if (data->renderedFrames >= (unsigned long long)data->sampleRate)
+    {
+        AddStat(&data->warmFaults, faults);
     }
 
-    return paContinue;
+    data->renderedFrames += frames;
+    AddCallbackStats(data, frames, status, MonotonicNs() - start);
+    TraceSpan("audio callback", traceStart);
 }
 
 
 Sounds::Sounds(void)
 {
-    int newStdErr;
-    int oldStdErr;
+    /* no stream until CreateSoundStream() (headless runs never create one) */
+    backend = nullptr;
+    streaming = false;
+    packName = nullptr;
+    resampled = nullptr;
+    resampledSize = 0;
+    resampledLockError = 0;
+    resampledCount = 0;
+    soundData.volume = 0.0;
+    soundData.sampleRate = SAMPLE_RATE;
+    soundData.chip = VIC_NONE;
+    memset(soundData.sample, 0, sizeof(soundData.sample));
+    memset(soundData.voice, 0, sizeof(soundData.voice));
+
+    for (int v = 0; v < NUM_VOICES; v++)
+    {
+        soundData.voice[v].sound = SOUND_OFF;
+        soundData.frames[v].store(0);
+        soundData.ns[v].store(0);
+    }
 
-    /* hide ALSA error during initialization (stderr -> /dev/null) */
-    fflush(stderr);
-    oldStdErr = dup(2);
-    newStdErr = open("/dev/null", O_WRONLY);
-    dup2(newStdErr, 2);
-    close(newStdErr);
+    soundData.triggers.store(0);
+    soundData.triggerNs.store(0);
+    soundData.triggerMaxNs.store(0);
+    soundData.scheduleNs = 0;
+    soundData.schedule.store(0);
+    soundData.onTime.store(0);
+    soundData.errorMaxNs.store(0);
+    soundData.late.store(0);
+    soundData.lateMaxNs.store(0);
+    soundData.callbacks.store(0);
+    soundData.underflows.store(0);
+    soundData.overflows.store(0);
+    soundData.callbackNs.store(0);
+    soundData.callbackMaxNs.store(0);
+    soundData.deadlineNs.store(0);
 
-    lastError = Pa_Initialize();
+    for (int b = 0; b < CALLBACK_BUCKETS; b++)
+    {
+        soundData.histogram[b].store(0);
+    }
+
+    soundData.minLatencyNs.store(ULLONG_MAX);
+    soundData.maxLatencyNs.store(0);
+    soundData.faults.store(0);
+    soundData.warmFaults.store(0);
+    soundData.renderedFrames = 0;
+    soundData.requestedPriority.store(0);
+    soundData.priority.store(0);
+    soundData.priorityError.store(0);
 
-    /* restore stderr */
-    fflush(stderr);
-    dup2(oldStdErr, 2);
-    close(oldStdErr);
+    soundData.queue.head.store(0);
+    soundData.queue.tail.store(0);
+    volume = 0.0;
+    fallSound = SOUND_OFF;
+    tickNs = -1;
+    dropped = 0;
+    resent = 0;
+    ClearDropped();
 }
 
 
 Sounds::~Sounds(void)
 {
-    Pa_CloseStream(soundData.stream);
-    Pa_Terminate();
+    CloseSoundStream();
+    FreeResampled();
 }
 
 
+/* why the backend couldn't be opened or started */
 void Sounds::HandleError(void)
 {
-    fprintf(stderr, "Error [%d]: %s\n", lastError, Pa_GetErrorText(lastError));
-    Pa_CloseStream(soundData.stream);
-    Pa_Terminate();
+    if (nullptr != backend)
+    {
+        fprintf(stderr, "sound output %s: %s\n", backend->Name(),
+            backend->ErrorText());
+    }
+
+    CloseSoundStream();
+}
+
+
+/*
+ * map the sound pack (nullptr for the default), false with errno set if it
+ * can't, PackName() is the pack that was tried
+ */
+bool Sounds::LoadSounds(const char *packName)
+{
+    if (nullptr == packName)
+    {
+        packName = SoundPack::DefaultPath();
+    }
+
+    this->packName = packName;
+
+    if (!pack.Load(packName))
+    {
+        return false;
+    }
+
+    for (int s = SOUND_OFF + 1; s < NUM_SOUNDS; s++)
+    {
+        sample_data_t *sample = &soundData.sample[s];
+
+        /* any rate will do, they're converted when the stream is created */
+        sample->samples = pack.Find(PACK_NAME[s], &sample->length,
+            &sample->rate);
+
+        if (nullptr == sample->samples)
+        {
+            /* errno can't say which one */
+            fprintf(stderr, "sound pack %s: no %s sound\n", packName,
+                PACK_NAME[s]);
+            errno = EINVAL;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/* generate the sounds with an emulated VIC instead of playing samples */
+void Sounds::UseVicSynth(vic_chip_t chip)
+{
+    /* the callback isn't running yet */
+    soundData.chip = chip;
 }
 
 
-void Sounds::CreateSoundStream(float volume)
+/* takes ownership of backend, false if it can't be opened */
+bool Sounds::CreateSoundStream(AudioBackend *backend, float volume)
 {
+    int rate;
+
+    CloseSoundStream();
+
+    /* play at the device's rate rather than have the host convert it */
+    rate = backend->NativeRate();
+
+    if (rate <= 0)
+    {
+        rate = SAMPLE_RATE;
+    }
+
+    /* the callback isn't running yet */
+    ResampleSounds(rate);
+    soundData.sampleRate = rate;
     soundData.volume = volume;
-    soundData.phase = 0;
-    soundData.sound = SOUND_OFF;
+    this->volume = volume;
+    this->backend = backend;
 
-    lastError = Pa_OpenDefaultStream(&(soundData.stream), 0, 2, paFloat32,
-        SAMPLE_RATE, paFramesPerBufferUnspecified, SoundCallback,
-        &soundData);
+    return backend->Open(rate, RenderSound, &soundData);
 }
 
 
-void Sounds::RestartSoundStream(void)
+/*
+ * Convert the one-shot sounds to the output rate with the polyphase
+ * filter, so the callback plays them a sample per frame.  The looping ufo
+ * sound stays at its own rate, a converted loop wouldn't be a whole number
+ * of samples long.  The voice steps through it a fraction of a sample at a
+ * time instead, as it does for anything the filter can't convert.
+ */
+void Sounds::ResampleSounds(int rate)
 {
-    lastError = Pa_IsStreamStopped(soundData.stream);
+    static const size_t ALIGN_FLOATS = PACK_ALIGN / sizeof(float);
+    const sound_t oneShot[] = {SOUND_TANK_SHOT, SOUND_ON_FIRE, SOUND_EXPLODE};
+    size_t offset[NUM_SOUNDS];
+    size_t total;
+    void *newMap;
+
+    FreeResampled();
+
+    /* start over from the pack's samples */
+    for (int s = SOUND_OFF + 1; s < NUM_SOUNDS; s++)
+    {
+        sample_data_t *sample = &soundData.sample[s];
+
+        if (nullptr != sample->samples)
+        {
+            sample->samples = pack.Find(PACK_NAME[s], &sample->length,
+                &sample->rate);
+        }
+    }
+
+    /* each converted sound starts on a cache line, like in the pack */
+    total = 0;
 
-    if (lastError >= 0)
+    for (sound_t s : oneShot)
     {
-        /* not an error */
-        if (paNoError == lastError)
+        const sample_data_t *sample = &soundData.sample[s];
+        int length;
+
+        offset[s] = total;
+
+        if ((nullptr == sample->samples) || (rate == sample->rate))
         {
-            /* stream was not stopped, stop it */
-            lastError = Pa_StopStream(soundData.stream);
+            continue;
         }
 
-        if (lastError >= 0)
+        length = ResampledLength(sample->length, sample->rate, rate);
+        total += (length + ALIGN_FLOATS - 1) & ~(ALIGN_FLOATS - 1);
+    }
+
+    if (0 == total)
+    {
+        /* nothing to convert (or nothing that can be) */
+        return;
+    }
+
+    newMap = mmap(nullptr, total * sizeof(float), PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == newMap)
+    {
+        /* step through them at their own rate */
+        return;
+    }
+
+    resampled = (float *)newMap;
+    resampledSize = total * sizeof(float);
+
+    for (sound_t s : oneShot)
+    {
+        sample_data_t *sample = &soundData.sample[s];
+        float *out = resampled + offset[s];
+
+        if ((nullptr == sample->samples) || (rate == sample->rate) ||
+            !Resample(sample->samples, sample->length, sample->rate, out,
+                rate))
         {
-            /* restart the sound stream */
+            continue;
         }
 
-        soundData.phase = 0;
-        lastError = Pa_StartStream(soundData.stream);
+        sample->length = ResampledLength(sample->length, sample->rate, rate);
+        sample->samples = out;
+        sample->rate = rate;
+        resampledCount++;
+    }
+
+    /* read by the callback like the pack, and kept in memory the same way */
+    resampledLockError = (0 == mlock(resampled, resampledSize)) ? 0 : errno;
+}
+
+
+void Sounds::FreeResampled(void)
+{
+    if (nullptr != resampled)
+    {
+        munmap(resampled, resampledSize);
+        resampled = nullptr;
+    }
+
+    resampledSize = 0;
+    resampledLockError = 0;
+    resampledCount = 0;
+}
+
+
+/* the stream runs until it's closed, sounds only change the voices */
+bool Sounds::StartSoundStream(void)
+{
+    if (nullptr == backend)
+    {
+        /* running without a sound stream */
+        return true;
     }
+
+    streaming = backend->Start();
+    return streaming;
 }
 
 
 void Sounds::CloseSoundStream(void)
 {
-    lastError = Pa_CloseStream(soundData.stream);
+    if (nullptr != backend)
+    {
+        backend->Close();
+        delete backend;
+        backend = nullptr;
+    }
+
+    streaming = false;
+    ClearDropped();
 }
 
 
-void Sounds::SelectSound(sound_t sound)
+const char *Sounds::OutputName(void) const
+{
+    return (nullptr == backend) ? "none" : backend->Name();
+}
+
+
+/* queue a command for the callback, false if the queue is full */
+bool Sounds::QueueCommand(command_t command, sound_t sound)
+{
+    command_queue_t *queue = &soundData.queue;
+    unsigned int head, tail;
+    sound_command_t *cmd;
+
+    if (!streaming)
+    {
+        /* nothing to play the sound */
+        return true;
+    }
+
+    /* acquire pairs with the callback's release of tail */
+    head = queue->head.load(std::memory_order_relaxed);
+    tail = queue->tail.load(std::memory_order_acquire);
+
+    if (COMMAND_QUEUE_SIZE == head - tail)
+    {
+        /* the callback hasn't kept up, drop the command */
+        return false;
+    }
+
+    cmd = &queue->command[head & (COMMAND_QUEUE_SIZE - 1)];
+    cmd->command = command;
+    cmd->sound = sound;
+    cmd->volume = volume;
+    cmd->sentNs = MonotonicNs();
+    cmd->tickNs = (tickNs < 0) ? cmd->sentNs : tickNs;
+
+    /* publish the command */
+    queue->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+
+/*
+ * Queue a command for the callback, after anything turned away before it.
+ * If there's no room it's counted, and kept to send again if it has to be.
+ */
+void Sounds::SendCommand(command_t command, sound_t sound)
 {
-    if (sound == soundData.sound)
+    bool queued;
+
+    ResendDropped();
+    queued = QueueCommand(command, sound);
+
+    if (!queued)
     {
-        /* already selected */
+        dropped++;
+    }
+
+    UpdateResend(command, sound, queued);
+}
+
+
+/* a queued command replaces what was kept for its voices */
+void Sounds::UpdateResend(command_t command, sound_t sound, bool queued)
+{
+    if (COMMAND_VOLUME == command)
+    {
+        resendVolume = !queued;
         return;
     }
 
-    soundData.phase = 0;
-    soundData.sound = sound;
+    for (int v = 0; v < NUM_VOICES; v++)
+    {
+        resend_t *r = &resend[v];
+
+        if ((SOUND_OFF != sound) && (VoiceFor(sound) != v))
+        {
+            continue;
+        }
+
+        if (queued)
+        {
+            r->pending = false;
+        }
+        else if (COMMAND_STOP == command)
+        {
+            r->pending = true;
+            r->command = COMMAND_STOP;
+            r->sound = (SOUND_OFF == sound) ? VOICE_SOUND[v] : sound;
+        }
+        else if ((SOUND_LOW_FREQ == sound) || (SOUND_HIGH_FREQ == sound))
+        {
+            r->pending = true;
+            r->command = COMMAND_START;
+            r->sound = sound;
+        }
+    }
+}
+
+
+/* send what the full queue turned away, in order, while there's room */
+void Sounds::ResendDropped(void)
+{
+    for (int v = 0; v < NUM_VOICES; v++)
+    {
+        resend_t *r = &resend[v];
+
+        if (r->pending)
+        {
+            if (!QueueCommand(r->command, r->sound))
+            {
+                return;
+            }
+
+            r->pending = false;
+            resent++;
+        }
+    }
+
+    if (resendVolume)
+    {
+        if (!QueueCommand(COMMAND_VOLUME, SOUND_OFF))
+        {
+            return;
+        }
+
+        resendVolume = false;
+        resent++;
+    }
+}
+
+
+void Sounds::ClearDropped(void)
+{
+    for (int v = 0; v < NUM_VOICES; v++)
+    {
+        resend[v].pending = false;
+    }
+
+    resendVolume = false;
+}
+
+
+/*
+ * Sounds sent from now on belong to the tick that started at ns on the game
+ * clock (see audio_status_t), < 0 once the tick is over.  They're heard a
+ * fixed time after their tick instead of whenever the callback next runs.
+ */
+void Sounds::SetTickTime(long long ns)
+{
+    tickNs = ns;
 
+    if (ns >= 0)
+    {
+        /* the tick may send nothing, try what was turned away anyway */
+        ResendDropped();
+    }
+}
+
+
+/* start a sound on its voice, SOUND_OFF stops every voice */
+void Sounds::SelectSound(sound_t sound)
+{
     if (SOUND_OFF == sound)
     {
-        lastError = Pa_AbortStream(soundData.stream);
+        fallSound = SOUND_OFF;
+        SendCommand(COMMAND_STOP, SOUND_OFF);
+        return;
+    }
+
+    if ((SOUND_LOW_FREQ == sound) || (SOUND_HIGH_FREQ == sound))
+    {
+        fallSound = sound;
     }
+
+    SendCommand(COMMAND_START, sound);
+}
+
+
+void Sounds::StopSound(sound_t sound)
+{
+    if ((SOUND_LOW_FREQ == sound) || (SOUND_HIGH_FREQ == sound))
+    {
+        fallSound = SOUND_OFF;
+    }
+
+    SendCommand(COMMAND_STOP, sound);
 }
 
 
 void Sounds::NextUfoSound(void)
 {
     /* explosion or toggle between frequencies */
-    if ((SOUND_OFF == soundData.sound) || (SOUND_TANK_SHOT == soundData.sound))
+    if (SOUND_OFF == fallSound)
     {
-        /* start with the explosion */
+        /* the explosion plays over the start of the fall */
         SelectSound(SOUND_EXPLODE);
+        SelectSound(SOUND_HIGH_FREQ);
     }
-    else if (SOUND_LOW_FREQ == soundData.sound)
+    else if (SOUND_LOW_FREQ == fallSound)
     {
         /* switch to high frequency falling sound */
         SelectSound(SOUND_HIGH_FREQ);
     }
-    else if (SOUND_HIGH_FREQ == soundData.sound)
+    else if (SOUND_HIGH_FREQ == fallSound)
     {
         /* switch to low frequency falling sound */
         SelectSound(SOUND_LOW_FREQ);
@@ -293,18 +996,19 @@ float Sounds::IncrementVolume(void)
 {
     float new_volume;
 
-    new_volume = soundData.volume + 0.1;
+    new_volume = volume + 0.1;
 
     if (new_volume > 1.0)
     {
-        soundData.volume = 1.0;
+        volume = 1.0;
     }
     else
     {
-        soundData.volume = new_volume;
+        volume = new_volume;
     }
 
-    return soundData.volume;
+    SendCommand(COMMAND_VOLUME, SOUND_OFF);
+    return volume;
 }
 
 
@@ -312,22 +1016,116 @@ float Sounds::DecrementVolume(void)
 {
     float new_volume;
 
-    new_volume = soundData.volume - 0.1;
+    new_volume = volume - 0.1;
 
     if (new_volume < 0.0)
     {
-        soundData.volume = 0.0;
+        volume = 0.0;
     }
     else
     {
-        soundData.volume = new_volume;
+        volume = new_volume;
+    }
+
+    SendCommand(COMMAND_VOLUME, SOUND_OFF);
+    return volume;
+}
+
+
+void Sounds::GetVoiceStats(voice_stats_t *stats) const
+{
+    for (int v = 0; v < NUM_VOICES; v++)
+    {
+        stats[v].frames = soundData.frames[v].load(std::memory_order_relaxed);
+        stats[v].ns = soundData.ns[v].load(std::memory_order_relaxed);
+    }
+}
+
+
+const char *Sounds::VoiceName(voice_t voice)
+{
+    static const char *names[NUM_VOICES] = {"shot", "fall", "explode", "fire"};
+
+    return names[voice];
+}
+
+
+void Sounds::GetTriggerStats(trigger_stats_t *stats) const
+{
+    stats->triggers = soundData.triggers.load(std::memory_order_relaxed);
+    stats->ns = soundData.triggerNs.load(std::memory_order_relaxed);
+    stats->maxNs = soundData.triggerMaxNs.load(std::memory_order_relaxed);
+    stats->outputLatency = (nullptr == backend) ? 0.0 :
+        backend->OutputLatency();
+    stats->scheduleNs = soundData.schedule.load(std::memory_order_relaxed);
+    stats->onTime = soundData.onTime.load(std::memory_order_relaxed);
+    stats->errorMaxNs = soundData.errorMaxNs.load(std::memory_order_relaxed);
+    stats->late = soundData.late.load(std::memory_order_relaxed);
+    stats->lateMaxNs = soundData.lateMaxNs.load(std::memory_order_relaxed);
+    stats->dropped = dropped;
+    stats->resent = resent;
+}
+
+
+void Sounds::GetCallbackStats(callback_stats_t *stats) const
+{
+    unsigned long long minLatency;
+
+    stats->callbacks = soundData.callbacks.load(std::memory_order_relaxed);
+    stats->underflows = soundData.underflows.load(std::memory_order_relaxed);
+    stats->overflows = soundData.overflows.load(std::memory_order_relaxed);
+    stats->ns = soundData.callbackNs.load(std::memory_order_relaxed);
+    stats->maxNs = soundData.callbackMaxNs.load(std::memory_order_relaxed);
+    stats->deadlineNs = soundData.deadlineNs.load(std::memory_order_relaxed);
+
+    for (int b = 0; b < CALLBACK_BUCKETS; b++)
+    {
+        stats->histogram[b] =
+            soundData.histogram[b].load(std::memory_order_relaxed);
     }
 
-    return soundData.volume;
+    minLatency = soundData.minLatencyNs.load(std::memory_order_relaxed);
+    stats->minLatency = (ULLONG_MAX == minLatency) ? 0.0 : minLatency / 1e9;
+    stats->maxLatency =
+        soundData.maxLatencyNs.load(std::memory_order_relaxed) / 1e9;
+    stats->streamLatency = (nullptr == backend) ? 0.0 :
+        backend->OutputLatency();
+    stats->faults = soundData.faults.load(std::memory_order_relaxed);
+    stats->warmFaults = soundData.warmFaults.load(std::memory_order_relaxed);
+    stats->sampleRate = soundData.sampleRate;
+    stats->resampled = resampledCount;
+    stats->priority = soundData.priority.load(std::memory_order_relaxed);
+    stats->priorityError =
+        soundData.priorityError.load(std::memory_order_relaxed);
 }
 
 
-sound_error_t Sounds::GetError(void)
+/* size of the samples and whether they're locked in memory */
+bool Sounds::GetSampleLock(size_t *bytes, int *error) const
 {
-    return lastError;
+    *bytes = pack.Size() + resampledSize;
+    *error = pack.LockError();
+
+    if (0 == *error)
+    {
+        *error = resampledLockError;
+    }
+
+    return 0 == *error;
+}
+
+
+/* SCHED_FIFO priority for the audio callback, applied by its next call */
+void Sounds::SetAudioPriority(int priority)
+{
+    soundData.requestedPriority.store(priority, std::memory_order_relaxed);
+}
+
+
+const char *Sounds::CallbackBucketName(int bucket)
+{
+    static const char *names[CALLBACK_BUCKETS] =
+        {"<10%", "<25%", "<50%", "<75%", "<100%", "late"};
+
+    return names[bucket];
 }
@@ -33,8 +33,15 @@
 #ifndef  __SOUNDS_H
 #define  __SOUNDS_H
 
-#include <portaudio.h>
+#include <atomic>
+#include "audio_backend.h"
+#include "soundpack.h"
+#include "vic_synth.h"
+
+/* output rate if the backend has no rate of its own */
 static const int SAMPLE_RATE = 44100;
+static const float MIX_GAIN = 0.5;     /* headroom for summing the voices */
+static const unsigned int COMMAND_QUEUE_SIZE = 64;     /* must be a power of 2 */
 
 typedef enum
 {
@@ -43,20 +50,179 @@ typedef enum
     SOUND_HIGH_FREQ,    /* 2x ufo falling frequency */
     SOUND_TANK_SHOT,    /* tank shot flying */
     SOUND_ON_FIRE,      /* tank or ufo on fire */
-    SOUND_EXPLODE       /* tank shot exploding when it hits ufo */
+    SOUND_EXPLODE,      /* tank shot exploding when it hits ufo */
+    NUM_SOUNDS
 } sound_t;
 
+/* a sound's samples, from the sound pack or resampled to the output rate */
+typedef struct
+{
+    const float *samples;
+    int length;
+    int rate;               /* samples per second */
+} sample_data_t;
 
-typedef struct sound_data_t
+
+/* every sound plays on its own voice, the voices are mixed together */
+typedef enum
+{
+    VOICE_SHOT,         /* tank shot */
+    VOICE_FALL,         /* ufo falling (low and high frequency) */
+    VOICE_EXPLODE,      /* tank shot hitting the ufo */
+    VOICE_FIRE,         /* tank or ufo on fire */
+    NUM_VOICES
+} voice_t;
+
+
+typedef struct
+{
+    sound_t sound;          /* sound being played, SOUND_OFF if idle */
+    const float *samples;   /* sound data */
+    int length;             /* number of samples */
+    int phase;              /* next sample */
+    uint32_t fraction;      /* fraction of a sample past phase (0.32) */
+    int step;               /* whole samples per frame */
+    uint32_t stepFraction;  /* fraction of a sample per frame (0.32) */
+    bool loop;              /* repeat until stopped */
+    bool synth;             /* played by vic instead of from samples */
+    vic_state_t vic;        /* emulated VIC voice */
+} voice_data_t;
+
+
+/* cost of rendering a voice, kept by the audio callback */
+typedef struct voice_stats_t
+{
+    unsigned long long frames;  /* frames rendered */
+    unsigned long long ns;      /* nanoseconds spent rendering them */
+} voice_stats_t;
+
+
+/* requests from the game thread to the audio callback */
+typedef enum
 {
+    COMMAND_START,      /* start a sound on its voice */
+    COMMAND_STOP,       /* stop a sound's voice, SOUND_OFF stops them all */
+    COMMAND_VOLUME      /* change the volume */
+} command_t;
+
+
+typedef struct
+{
+    command_t command;
+    sound_t sound;
     float volume;
-    int phase;
-    sound_t sound;       /* normal, 2x frequency, tank shot, or off */
-    PaStream *stream;
-} sound_data_t;
+    long long sentNs;   /* CLOCK_MONOTONIC time the command was queued */
+    long long tickNs;   /* game clock time of the tick that sent it */
+} sound_command_t;
 
 
-typedef PaError sound_error_t;
+/*
+ * Time from starting a sound until the callback renders its first sample,
+ * and how close that sample came to being heard scheduleNs after the tick
+ * that started it.  Sounds that make it in time start on the right sample
+ * (errorMaxNs is under a frame), late ones start as soon as they can.
+ */
+typedef struct trigger_stats_t
+{
+    unsigned long long triggers;    /* sounds started */
+    unsigned long long ns;          /* total nanoseconds to render them */
+    unsigned long long maxNs;       /* slowest */
+    double outputLatency;           /* seconds from callback to speaker */
+    unsigned long long scheduleNs;  /* tick to heard, 0 for offline */
+    unsigned long long onTime;      /* started on their sample */
+    unsigned long long errorMaxNs;  /* ... and the furthest from it */
+    unsigned long long late;        /* started after their sample */
+    unsigned long long lateMaxNs;   /* ... and the latest */
+    unsigned long long dropped;     /* commands the full queue turned away */
+    unsigned long long resent;      /* stops and volumes sent again later */
+} trigger_stats_t;
+
+
+/* callback cost as a share of its buffer's play time: <10%, <25%, <50%,
+ * <75%, <100% and late (the buffer would have run out first) */
+static const int CALLBACK_BUCKETS = 6;
+
+typedef struct callback_stats_t
+{
+    unsigned long long callbacks;
+    unsigned long long underflows;  /* the device ran out of sound */
+    unsigned long long overflows;   /* the device dropped sound */
+    unsigned long long ns;          /* total nanoseconds in the callback */
+    unsigned long long maxNs;       /* slowest callback */
+    unsigned long long deadlineNs;  /* play time of the last buffer */
+    unsigned long long histogram[CALLBACK_BUCKETS];
+    double minLatency;              /* seconds from a callback until its */
+    double maxLatency;              /* buffer is heard, 0 if unknown */
+    double streamLatency;           /* the backend's reported latency */
+    int sampleRate;                 /* frames per second rendered */
+    int resampled;                  /* sounds converted to sampleRate */
+    unsigned long long faults;      /* page faults taken in the callback */
+    unsigned long long warmFaults;  /* ... after its first second of sound */
+    int priority;                   /* SCHED_FIFO priority, 0 for normal */
+    int priorityError;              /* errno if it couldn't be raised */
+} callback_stats_t;
+
+
+/*
+ * A stop, a looping start or a volume change the full queue turned away.
+ * The game thread sends the latest one for each voice again before its
+ * next command and at the start of every tick, so a stalled callback can't
+ * leave the ufo falling forever.  One-shot starts are late by then and
+ * aren't resent.
+ */
+typedef struct
+{
+    bool pending;
+    command_t command;      /* COMMAND_STOP or COMMAND_START */
+    sound_t sound;
+} resend_t;
+
+
+/* wait-free single producer (game thread), single consumer (callback) ring */
+typedef struct
+{
+    sound_command_t command[COMMAND_QUEUE_SIZE];
+    std::atomic<unsigned int> head;     /* next write, game thread only */
+    std::atomic<unsigned int> tail;     /* next read, callback only */
+} command_queue_t;
+
+
+/* everything but the queue and the statistics belongs to the callback */
+typedef struct sound_data_t
+{
+    float volume;
+    int sampleRate;                     /* output frames per second */
+    sample_data_t sample[NUM_SOUNDS];   /* read only once the stream starts */
+    vic_chip_t chip;                    /* VIC_NONE to play the samples */
+    voice_data_t voice[NUM_VOICES];     /* preallocated, never resized */
+    std::atomic<unsigned long long> frames[NUM_VOICES];
+    std::atomic<unsigned long long> ns[NUM_VOICES];
+    std::atomic<unsigned long long> triggers;
+    std::atomic<unsigned long long> triggerNs;
+    std::atomic<unsigned long long> triggerMaxNs;
+    long long scheduleNs;                   /* callback only, tick to heard */
+    std::atomic<unsigned long long> schedule;   /* copy for the game */
+    std::atomic<unsigned long long> onTime;
+    std::atomic<unsigned long long> errorMaxNs;
+    std::atomic<unsigned long long> late;
+    std::atomic<unsigned long long> lateMaxNs;
+    std::atomic<unsigned long long> callbacks;
+    std::atomic<unsigned long long> underflows;
+    std::atomic<unsigned long long> overflows;
+    std::atomic<unsigned long long> callbackNs;
+    std::atomic<unsigned long long> callbackMaxNs;
+    std::atomic<unsigned long long> deadlineNs;
+    std::atomic<unsigned long long> histogram[CALLBACK_BUCKETS];
+    std::atomic<unsigned long long> minLatencyNs;   /* ULLONG_MAX if none */
+    std::atomic<unsigned long long> maxLatencyNs;
+    std::atomic<unsigned long long> faults;
+    std::atomic<unsigned long long> warmFaults;
+    unsigned long long renderedFrames;      /* callback only */
+    std::atomic<int> requestedPriority;     /* 0 for normal scheduling */
+    std::atomic<int> priority;              /* what the callback got */
+    std::atomic<int> priorityError;
+    command_queue_t queue;
+} sound_data_t;
 
 
 class Sounds
@@ -67,21 +233,62 @@ class Sounds
 
         void HandleError(void);
 
-        void CreateSoundStream(float volume);
-        void RestartSoundStream(void);
+        bool LoadSounds(const char *packName);
+        const char *PackName(void) const { return packName; }
+        void UseVicSynth(vic_chip_t chip);
+        bool CreateSoundStream(AudioBackend *backend, float volume);
+        bool StartSoundStream(void);
         void CloseSoundStream(void);
+        bool HasSoundStream(void) const { return streaming; }
+        const char *OutputName(void) const;
 
+        void SetTickTime(long long ns);
         void SelectSound(sound_t sound);
+        void StopSound(sound_t sound);
         void NextUfoSound(void);
 
         float IncrementVolume(void);
         float DecrementVolume(void);
+        float GetVolume(void) const { return volume; }
 
-        sound_error_t GetError(void);
+        void GetVoiceStats(voice_stats_t *stats) const;
+        static const char *VoiceName(voice_t voice);
+        void GetTriggerStats(trigger_stats_t *stats) const;
+        unsigned long long Dropped(void) const { return dropped; }
+        void GetCallbackStats(callback_stats_t *stats) const;
+        bool GetSampleLock(size_t *bytes, int *error) const;
+        void SetAudioPriority(int priority);
+        static const char *CallbackBucketName(int bucket);
 
     private:
-        sound_error_t lastError;
+        AudioBackend *backend;  /* owned, nullptr until CreateSoundStream() */
+        bool streaming;         /* the backend is rendering soundData */
         sound_data_t soundData;
+        SoundPack pack;         /* samples used by soundData */
+        const char *packName;   /* pack LoadSounds() tried, or nullptr */
+        float *resampled;       /* one-shot sounds at the output rate */
+        size_t resampledSize;   /* bytes mapped for resampled */
+        int resampledLockError; /* 0 if resampled is locked in memory */
+        int resampledCount;     /* sounds in resampled */
+
+        /* game thread copies of what has been sent to the callback */
+        float volume;
+        sound_t fallSound;
+        long long tickNs;       /* the tick being run, < 0 between ticks */
+
+        /* game thread only, commands to send again once there's room */
+        resend_t resend[NUM_VOICES];
+        bool resendVolume;
+        unsigned long long dropped;
+        unsigned long long resent;
+
+        void SendCommand(command_t command, sound_t sound);
+        bool QueueCommand(command_t command, sound_t sound);
+        void UpdateResend(command_t command, sound_t sound, bool queued);
+        void ResendDropped(void);
+        void ClearDropped(void);
+        void ResampleSounds(int rate);
+        void FreeResampled(void);
 };
 
 #endif /* ndef  __SOUNDS_H */
@@ -34,6 +34,7 @@
 #include <stdlib.h>
 
 #include "tank.h"
+#include "trace.h"
 
 /* cchar_t for unicode charaters used in this file */
 static const cchar_t TANK_SHOT_CHAR = {WA_NORMAL, L"▪", 0};
@@ -87,7 +88,6 @@ void Tank::Move(void)
 
         wattroff(win, COLOR_PAIR(3));
         mvwaddstr(win, Tvu::TANK_TREAD_ROW, x, "▕OOOO▏");
-        wrefresh(win);
         return;
     }
 
@@ -127,7 +127,6 @@ void Tank::Move(void)
         x += 1;
     }
 
-    wrefresh(win);
     return;
 }
 
@@ -187,7 +186,7 @@ void Tank::MoveShot(void)
             EndShot();
 
             /* stop shot sound */
-            tankSounds.SelectSound(SOUND_OFF);
+            tankSounds.StopSound(SOUND_TANK_SHOT);
         }
     }
     else
@@ -198,8 +197,6 @@ void Tank::MoveShot(void)
         wattroff(win, COLOR_PAIR(3));
         shotPos.y--;
     }
-
-    wrefresh(win);
 }
 
 
@@ -213,18 +210,10 @@ void Tank::Shoot(void)
 {
     shotPos.x = x + 3;
     shotPos.y = Tvu::TANK_SHOT_START_ROW;
+    TraceInstant("tank fired");
 
     /* play sound */
     tankSounds.SelectSound(SOUND_TANK_SHOT);
-    tankSounds.RestartSoundStream();
-
-    sound_error_t soundError;
-    soundError = tankSounds.GetError();
-
-    if (0 != soundError)
-    {
-        tankSounds.HandleError();
-    }
 }
 
 
@@ -264,6 +253,9 @@ bool Tank::UpdateShotHit(const Tvu::Pos ufoPos)
             shotHit = true;
             justHit = true;
 
+            /* the shot sound becomes the ufo's explosion */
+            tankSounds.StopSound(SOUND_TANK_SHOT);
+
             wattron(win, COLOR_PAIR(3));       /* fire color */
             mvwaddstr(win, shotPos.y - 1, shotPos.x, "█");
             mvwaddstr(win, shotPos.y, shotPos.x - 1, "███");
@@ -276,6 +268,40 @@ bool Tank::UpdateShotHit(const Tvu::Pos ufoPos)
 }
 
 
+/* true if a ufo shot at shotPos is on part of the tank */
+bool Tank::IsHitBy(const Tvu::Pos shotPos) const
+{
+    int dx;
+
+    if (shotPos.y < Tvu::TANK_GUN_ROW)
+    {
+        /* shot is above the tank */
+        return false;
+    }
+
+    dx = shotPos.x - x;
+
+    /* check for hit by row */
+    if (Tvu::TANK_GUN_ROW == shotPos.y)
+    {
+        /* gun barrel row */
+        return (3 == dx);
+    }
+    else if (Tvu::TANK_TURRET_ROW == shotPos.y)
+    {
+        /* turret row */
+        return ((2 == dx) || (3 == dx));
+    }
+    else if (Tvu::TANK_TREAD_ROW == shotPos.y)
+    {
+        /* tread row */
+        return ((dx > 0) && (dx < 5));
+    }
+
+    return false;
+}
+
+
 bool Tank::IsOnFire(void) const
 {
     return onFire != 0;     /* onFire is a counter. 0 is not on fire */
@@ -290,19 +316,10 @@ void Tank::SetOnFire(const bool of)
         onFire = 1;
 
         tankSounds.SelectSound(SOUND_ON_FIRE);
-        tankSounds.RestartSoundStream();
     }
     else
     {
         onFire = 0;
-        tankSounds.SelectSound(SOUND_OFF);
-    }
-
-    sound_error_t soundError;
-    soundError = tankSounds.GetError();
-
-    if (0 != soundError)
-    {
-        tankSounds.HandleError();
+        tankSounds.StopSound(SOUND_ON_FIRE);
     }
 }
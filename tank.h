@@ -50,10 +50,15 @@ class Tank
         /* tank shot movement and position */
         void MoveShot(void);
         bool WasShotFired(void) const;
+        Tvu::Pos GetShotPos(void) const { return shotPos; }
+        bool IsShotHit(void) const { return shotHit; }
         void Shoot(void);
         void EndShot(void);
         bool UpdateShotHit(const Tvu::Pos ufoPos);
 
+        /* ufo shot hit test */
+        bool IsHitBy(const Tvu::Pos shotPos) const;
+
         /* flaming status */
         bool IsOnFire(void) const;
         void SetOnFire(const bool of);
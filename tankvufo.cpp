@@ -32,6 +32,10 @@
 *
 ****************************************************************************/
 #include <clocale>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <ctime>
 #include <ncurses.h>
 
 #include "tankvufo.h"
@@ -39,120 +43,825 @@
 #include "tank.h"
 #include "ufo.h"
 #include "sounds.h"
-
-TankVUfo::TankVUfo(void)
+#include "replay.h"
+#include "ansi_output.h"
+#include "motion.h"
+#include "realtime.h"
+#include "trace.h"
+
+/*
+ * soundPack is the sound pack to play, nullptr for the default.  audio is
+ * where the sound goes (the game owns it from here on), the sound is
+ * thrown away if it can't be used.
+ */
+TankVUfo::TankVUfo(const char *soundPack, vic_chip_t chip,
+    AudioBackend *audio) : arena(ArenaSize())
 {
-    /* initialize all of the sound stuff */
-    sound_error_t soundError;
-    tvuSounds = new Sounds();
-
-    soundError = tvuSounds->GetError();
-
-    if (0 != soundError)
+    v20Pad = nullptr;
+    v20Win = nullptr;
+    volPad = nullptr;
+    volWin = nullptr;
+    hudWin = nullptr;
+    memset(&simUs, 0, sizeof(simUs));
+    memset(&keyMs, 0, sizeof(keyMs));
+    flushes = 0;
+    tickFlushes = 0;
+    tickBytes = 0;
+    hudTicks = 0;
+    frames = arena.New<TripleBuffer<tick_frame_t>>();
+    published = 0;
+    shown = 0;
+    memset(&frameLatency, 0, sizeof(frameLatency));
+    tank = nullptr;
+    ufo = nullptr;
+    recorder = nullptr;
+    ansiOut = nullptr;
+    motion = nullptr;
+    tvuSounds = arena.New<Sounds>();
+    soundPackError = 0;
+
+    if (!LoadSounds(soundPack, chip))
     {
-        tvuSounds->HandleError();
+        /* no game without its sounds, the caller reports it */
+        soundPackError = errno;
+        delete audio;
+        return;
     }
-    else
-    {
-        tvuSounds->CreateSoundStream(VOLUME);
-        soundError = tvuSounds->GetError();
 
-        if (0 != soundError)
-        {
-            tvuSounds->HandleError();
-        }
-        else
-        {
-            /* ncurses initialization */
-            setlocale(LC_ALL, "");
-            initscr();
-            start_color();
-            cbreak();
-            noecho();
-            curs_set(0);
-
-            /* color the background before creating a window */
-            init_pair(1, COLOR_BLACK, COLOR_CYAN);
-            bkgd(COLOR_PAIR(1));
-        }
+    if (!StartSound(audio))
+    {
+        /* no sound device, the sounds are mixed and thrown away */
+        fprintf(stderr, "playing without sound\n");
+        StartSound(new NullBackend());
     }
+
+    /* ncurses initialization */
+    setlocale(LC_ALL, "");
+    initscr();
+    InitializeCurses();
+}
+
+
+TankVUfo::TankVUfo(SCREEN *screen) : arena(ArenaSize())
+{
+    /* sounds are tracked, but there is no sound stream to play them */
+    v20Pad = nullptr;
+    v20Win = nullptr;
+    volPad = nullptr;
+    volWin = nullptr;
+    hudWin = nullptr;
+    memset(&simUs, 0, sizeof(simUs));
+    memset(&keyMs, 0, sizeof(keyMs));
+    flushes = 0;
+    tickFlushes = 0;
+    tickBytes = 0;
+    hudTicks = 0;
+    frames = arena.New<TripleBuffer<tick_frame_t>>();
+    published = 0;
+    shown = 0;
+    memset(&frameLatency, 0, sizeof(frameLatency));
+    tank = nullptr;
+    ufo = nullptr;
+    recorder = nullptr;
+    ansiOut = nullptr;
+    motion = nullptr;
+    tvuSounds = arena.New<Sounds>();
+    soundPackError = 0;
+
+    set_term(screen);
+    InitializeCurses();
+}
+
+
+/*
+ * Room for everything the game is made of, so the game loop never has to
+ * allocate.  The windows and the output buffers are made by their own
+ * libraries.  The audio backend is made with new, by the caller or by the
+ * constructor if it falls back to the null backend, since the Sounds
+ * deletes the backend it's given.  All of them are made before the first
+ * tick.
+ */
+size_t TankVUfo::ArenaSize(void)
+{
+    return Arena::SizeFor<TripleBuffer<tick_frame_t>, Sounds, Tank, Ufo,
+        MotionOverlay, AnsiOutput>();
+}
+
+
+void TankVUfo::InitializeCurses(void)
+{
+    start_color();
+
+    /*
+     * black on white is the default color pair, so the game field can be
+     * drawn without sending attribute changes to the terminal
+     */
+    assume_default_colors(COLOR_BLACK, COLOR_WHITE);
+    cbreak();
+    noecho();
+    curs_set(0);
+
+    /* color the background before creating a window */
+    init_pair(1, COLOR_BLACK, COLOR_CYAN);
+    bkgd(COLOR_PAIR(1));
+
+    /* keys are read by the input stage, don't look for them on updates */
+    typeahead(-1);
 }
 
 
 TankVUfo::~TankVUfo(void)
 {
+    arena.Delete(motion);
+
     if (v20Win != nullptr)
     {
         delwin(v20Win);
+        delwin(v20Pad);
     }
 
     if (volWin != nullptr)
     {
         delwin(volWin);
+        delwin(volPad);
+    }
+
+    if (hudWin != nullptr)
+    {
+        delwin(hudWin);
+    }
+
+    arena.Delete(frames);
+
+    if (ansiOut != nullptr)
+    {
+        /* let the terminal catch up before ncurses restores it */
+        ansiOut->Finish(Tvu::OUTPUT_FINISH_MS);
     }
 
     endwin();
 
-    if (tank != nullptr)
+    /* the arena frees the memory */
+    arena.Delete(ansiOut);
+    arena.Delete(tank);
+    arena.Delete(ufo);
+    arena.Delete(tvuSounds);
+}
+
+
+bool TankVUfo::UseAnsiOutput(int fd)
+{
+    if (!AnsiOutput::IsSupported())
+    {
+        /* not an ANSI terminal, leave the output to ncurses */
+        return false;
+    }
+
+    ansiOut = arena.New<AnsiOutput>(fd);
+    return (nullptr != ansiOut);
+}
+
+
+static long long NowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/*
+ * Copy the pads and the state left by the tick for the render stage.
+ * Only the simulation calls this, a frame the render stage hasn't shown
+ * yet is replaced.
+ */
+void TankVUfo::PublishFrame(void)
+{
+    tick_frame_t *frame;
+
+    frame = frames->WriteSlot();
+
+    for (int y = 0; y < v20Rows; y++)
+    {
+        mvwin_wchnstr(v20Pad, y, 0, frame->v20[y], v20Cols);
+    }
+
+    for (int y = 0; y < volRows; y++)
+    {
+        mvwin_wchnstr(volPad, y, 0, frame->vol[y], volCols);
+    }
+
+    if ((nullptr != tank) && (nullptr != ufo))
+    {
+        GetFrameState(&frame->state);
+    }
+
+    frame->simUs = simUs;
+    frame->keyMs = keyMs;
+    frame->soundDrops = tvuSounds->Dropped();
+
+    frame->tick = published;
+    frame->publishNs = NowNs();
+    published++;
+    frames->Publish();
+}
+
+
+/*
+ * Put the newest published frame in the windows, returns false if it's
+ * already there.  Only the render stage calls this.
+ */
+bool TankVUfo::ShowLatestFrame(void)
+{
+    const tick_frame_t *frame;
+    bool fresh;
+    long long ns;
+
+    frame = frames->Read(&fresh);
+
+    if (!fresh)
+    {
+        return false;
+    }
+
+    if (nullptr != motion)
+    {
+        /* the overlay was drawn on the last frame */
+        motion->Remove();
+    }
+
+    for (int y = 0; y < v20Rows; y++)
+    {
+        mvwadd_wchnstr(v20Win, y, 0, frame->v20[y], v20Cols);
+    }
+
+    for (int y = 0; y < volRows; y++)
+    {
+        mvwadd_wchnstr(volWin, y, 0, frame->vol[y], volCols);
+    }
+
+    if (nullptr != motion)
+    {
+        motion->SetState(&frame->state);
+    }
+
+    if (nullptr != hudWin)
+    {
+        CountHudTick();
+        DrawHud(frame);
+    }
+
+    /* frames published while the render stage was busy are never seen */
+    frameLatency.missed += frame->tick - shown;
+    shown = frame->tick + 1;
+
+    ns = NowNs() - frame->publishNs;
+    frameLatency.steps++;
+    frameLatency.ns += ns;
+
+    if (ns > frameLatency.maxNs)
+    {
+        frameLatency.maxNs = ns;
+    }
+
+    return true;
+}
+
+
+/*
+ * send the windows to the terminal in one update, with ANSI output the
+ * update is dropped if the terminal hasn't taken the last one
+ */
+void TankVUfo::SendScreen(void)
+{
+    uint64_t start;
+
+    start = TscNow();
+    wnoutrefresh(volWin);
+    wnoutrefresh(v20Win);
+
+    if (nullptr != hudWin)
+    {
+        /* on top of anything it overlaps on a small screen */
+        wnoutrefresh(hudWin);
+    }
+
+    flushes++;
+
+    if (nullptr == ansiOut)
+    {
+        doupdate();
+    }
+    else
+    {
+        ansiOut->Update(newscr);
+    }
+
+    TraceSpan("refresh", start);
+}
+
+
+/* show the newest published frame (render stage) */
+void TankVUfo::Present(void)
+{
+    uint64_t start;
+
+    start = TscNow();
+    ShowLatestFrame();
+    SendScreen();
+
+    if (nullptr != hudWin)
+    {
+        renderTimes.Add(TscNow() - start);
+    }
+}
+
+
+/*
+ * publish and show everything drawn so far, for drawing outside of the
+ * game loop and for programs that run both stages on one thread
+ */
+void TankVUfo::Refresh(void)
+{
+    PublishFrame();
+    Present();
+}
+
+
+/*
+ * ncurses allocates the tables it optimizes updates with the first time it
+ * optimizes one (the first update after initscr() redraws everything), so
+ * do an update with nothing in it before the game loop starts.
+ */
+void TankVUfo::WarmUpOutput(void)
+{
+    if (nullptr == ansiOut)
+    {
+        doupdate();
+    }
+}
+
+
+/* time from publishing a frame to putting it on the screen */
+void TankVUfo::GetFrameLatency(Tvu::StageStats *stats) const
+{
+    *stats = frameLatency;
+}
+
+
+/*
+ * A boxed window for the tick statistics.  Returns false with errno set
+ * if it can't be made.
+ */
+bool TankVUfo::MakeHudWin(int begin_y, int begin_x)
+{
+    hudWin = newwin(Tvu::HUD_ROWS, Tvu::HUD_COLS, begin_y, begin_x);
+
+    if (nullptr == hudWin)
+    {
+        return false;
+    }
+
+    wbkgd(hudWin, COLOR_PAIR(0));
+    leaveok(hudWin, TRUE);
+    box(hudWin, 0, 0);
+    mvwaddstr(hudWin, 0, 2, " TICK STATS ");
+    mvwaddstr(hudWin, 1, 1, "          p50   p99   max");
+    return true;
+}
+
+
+/*
+ * The simulation's recent tick times (microseconds) and key to tick times
+ * (milliseconds), shown with the next frame published.
+ */
+void TankVUfo::SetSimStats(const percentiles_t *sim, const percentiles_t *keys)
+{
+    simUs = *sim;
+    keyMs = *keys;
+}
+
+
+/* the terminal updates and bytes since the last tick shown */
+void TankVUfo::CountHudTick(void)
+{
+    output_stats_t stats;
+    unsigned long sent;
+
+    if (nullptr == ansiOut)
+    {
+        /* every update goes to the terminal, how much of it is unknown */
+        sent = flushes;
+    }
+    else
+    {
+        ansiOut->GetStats(&stats);
+        sent = stats.framesSent;
+        byteCounts.Add(stats.bytesWritten - tickBytes);
+        tickBytes = stats.bytesWritten;
+    }
+
+    flushCounts.Add(sent - tickFlushes);
+    tickFlushes = sent;
+    hudTicks++;
+
+    if (0 == hudTicks % Tvu::HUD_WINDOW_TICKS)
+    {
+        renderTimes.EndWindow();
+        flushCounts.EndWindow();
+        byteCounts.EndWindow();
+    }
+}
+
+
+/*
+ * one row of the HUD, - for the values if there were none.  The row is
+ * formatted here rather than with wprintw(), ncurses formats into one
+ * buffer for every thread and the simulation draws at the same time.
+ */
+static void DrawHudRow(WINDOW *win, int y, const char *name,
+    const percentiles_t *p, const char *format)
+{
+    char row[Tvu::HUD_COLS + 1];
+    char rowFormat[32];
+
+    if (0 == p->count)
+    {
+        snprintf(row, sizeof(row), "%-7s     -     -     -", name);
+    }
+    else
+    {
+        snprintf(rowFormat, sizeof(rowFormat), "%%-7s%s%s%s", format, format,
+            format);
+        snprintf(row, sizeof(row), rowFormat, name, p->p50, p->p99, p->max);
+    }
+
+    mvwaddstr(win, y, 1, row);
+}
+
+
+void TankVUfo::DrawHud(const tick_frame_t *frame)
+{
+    percentiles_t p;
+    char row[Tvu::HUD_COLS + 1];
+
+    DrawHudRow(hudWin, 2, "sim us", &frame->simUs, "%6.0f");
+    renderTimes.GetPercentiles(&p, TscNsPerCycle() / 1000.0);
+    DrawHudRow(hudWin, 3, "draw us", &p, "%6.0f");
+    DrawHudRow(hudWin, 4, "key ms", &frame->keyMs, "%6.1f");
+    flushCounts.GetPercentiles(&p, 1.0);
+    DrawHudRow(hudWin, 5, "flushes", &p, "%6.0f");
+    byteCounts.GetPercentiles(&p, 1.0);
+    DrawHudRow(hudWin, 6, "bytes", &p, "%6.0f");
+
+    /* a count since the start, under max */
+    snprintf(row, sizeof(row), "%-19s%6llu", "sound drops",
+        frame->soundDrops);
+    mvwaddstr(hudWin, 7, 1, row);
+}
+
+
+/* descriptor to poll for POLLOUT while output is pending, -1 if none */
+int TankVUfo::GetOutputFd(void) const
+{
+    return (nullptr == ansiOut) ? -1 : ansiOut->GetFd();
+}
+
+
+bool TankVUfo::IsOutputPending(void) const
+{
+    return (nullptr != ansiOut) && ansiOut->IsPending();
+}
+
+
+void TankVUfo::DrainOutput(void)
+{
+    if (nullptr != ansiOut)
+    {
+        ansiOut->Drain();
+    }
+}
+
+
+/* the terminal's contents are unknown, repaint everything on the next update */
+void TankVUfo::InvalidateOutput(void)
+{
+    if (nullptr == ansiOut)
+    {
+        clearok(curscr, TRUE);
+    }
+    else
+    {
+        ansiOut->Invalidate();
+    }
+}
+
+
+bool TankVUfo::GetOutputStats(output_stats_t *stats) const
+{
+    if (nullptr == ansiOut)
+    {
+        /* ncurses output isn't queued */
+        return false;
+    }
+
+    ansiOut->GetStats(stats);
+    return true;
+}
+
+
+/* the sound pack, or the emulated VIC if chip isn't VIC_NONE */
+bool TankVUfo::LoadSounds(const char *soundPack, vic_chip_t chip)
+{
+    if (VIC_NONE != chip)
+    {
+        /* the emulated VIC doesn't need the sound pack */
+        tvuSounds->UseVicSynth(chip);
+        return true;
+    }
+
+    return tvuSounds->LoadSounds(soundPack);
+}
+
+
+/* the sound pack LoadSounds() tried, nullptr for none (or the VIC) */
+const char *TankVUfo::SoundPackName(void) const
+{
+    return tvuSounds->PackName();
+}
+
+
+/* takes ownership of audio, prints why and returns false if it can't play */
+bool TankVUfo::StartSound(AudioBackend *audio)
+{
+    /* one stream plays (silence if nothing else) until the game ends */
+    if (tvuSounds->CreateSoundStream(audio, VOLUME) &&
+        tvuSounds->StartSoundStream())
+    {
+        return true;
+    }
+
+    tvuSounds->HandleError();
+    return false;
+}
+
+
+const char *TankVUfo::SoundOutputName(void) const
+{
+    return tvuSounds->OutputName();
+}
+
+
+/* per voice mixing cost, stats must hold NUM_VOICES entries */
+bool TankVUfo::GetVoiceStats(voice_stats_t *stats) const
+{
+    if (!tvuSounds->HasSoundStream())
     {
-        delete tank;
+        /* nothing was mixed */
+        return false;
     }
 
-    if (ufo != nullptr)
+    tvuSounds->GetVoiceStats(stats);
+    return true;
+}
+
+
+bool TankVUfo::GetTriggerStats(trigger_stats_t *stats) const
+{
+    if (!tvuSounds->HasSoundStream())
+    {
+        /* nothing was played */
+        return false;
+    }
+
+    tvuSounds->GetTriggerStats(stats);
+    return true;
+}
+
+
+/* audio callback timing and the device's underflows and overflows */
+bool TankVUfo::GetCallbackStats(callback_stats_t *stats) const
+{
+    if (!tvuSounds->HasSoundStream())
     {
-        delete ufo;
+        /* nothing was played */
+        return false;
     }
 
-    if (tvuSounds != nullptr)
+    tvuSounds->GetCallbackStats(stats);
+    return true;
+}
+
+
+/* whether the sound pack is locked in memory, false for the emulated VIC */
+bool TankVUfo::GetSampleLock(size_t *bytes, int *error) const
+{
+    return tvuSounds->GetSampleLock(bytes, error);
+}
+
+
+/*
+ * Run the audio callback at SCHED_FIFO and the calling (game) thread at a
+ * lower SCHED_RR priority, which the threads it starts later (the input
+ * and render stages) inherit.  Returns 0 or why the game thread couldn't
+ * be raised; the callback's result is in its stats.
+ */
+int TankVUfo::UseRealtimePriority(void)
+{
+    tvuSounds->SetAudioPriority(AUDIO_PRIORITY);
+    return RaiseThreadPriority(SCHED_RR, GAME_PRIORITY);
+}
+
+
+/* draw motion between ticks on the screen, must be called after MakeV20Win */
+bool TankVUfo::UseMotionOverlay(void)
+{
+    if (nullptr == v20Win)
     {
-        delete tvuSounds;
+        return false;
     }
+
+    motion = arena.New<MotionOverlay>(v20Win);
+    return (nullptr != motion);
+}
+
+
+/*
+ * tickNs is when the tick started on the game clock (CLOCK_MONOTONIC, or
+ * simulated time for an export), the sounds it starts are scheduled from
+ * it.
+ */
+void TankVUfo::StartTick(long long tickNs)
+{
+    tvuSounds->SetTickTime(tickNs);
+}
+
+
+/* publish what this tick drew and the state it left for the overlay */
+void TankVUfo::FinishTick(void)
+{
+    tvuSounds->SetTickTime(-1);
+    PublishFrame();
+}
+
+
+/*
+ * show the newest frame and the part of the tick (0 to 1) that has gone
+ * by, if either shows
+ */
+void TankVUfo::RenderFrame(double fraction)
+{
+    uint64_t start;
+    bool changed;
+
+    start = TscNow();
+    changed = ShowLatestFrame();
+
+    if ((nullptr != motion) && motion->Update(fraction))
+    {
+        changed = true;
+    }
+
+    if (changed)
+    {
+        SendScreen();
+
+        if (nullptr != hudWin)
+        {
+            renderTimes.Add(TscNow() - start);
+        }
+    }
+}
+
+
+void TankVUfo::GetFrameState(Tvu::FrameState *state) const
+{
+    Tvu::Direction direction;
+
+    state->ufo = ufo->GetPos();
+    direction = ufo->GetDirection();
+
+    if (Tvu::DIR_RIGHT == direction)
+    {
+        state->ufoDx = 1;
+    }
+    else if (Tvu::DIR_LEFT == direction)
+    {
+        state->ufoDx = -1;
+    }
+    else
+    {
+        /* not there, falling or burning */
+        state->ufoDx = 0;
+    }
+
+    state->ufoShot = ufo->GetShotPos();
+    direction = ufo->GetShotDirection();
+
+    if (Tvu::DIR_FALLING_RIGHT == direction)
+    {
+        state->ufoShotDx = 1;
+    }
+    else if (Tvu::DIR_FALLING_LEFT == direction)
+    {
+        state->ufoShotDx = -1;
+    }
+    else
+    {
+        /* no shot or it's exploding */
+        state->ufoShot.x = -1;
+        state->ufoShotDx = 0;
+    }
+
+    state->tankShot = tank->GetShotPos();
+
+    if (tank->IsShotHit())
+    {
+        /* the shot is an explosion */
+        state->tankShot.x = -1;
+    }
+}
+
+
+/* the model as it is, cheap enough to take every tick */
+void TankVUfo::GetTickState(Tvu::TickState *state) const
+{
+    state->ufo = ufo->GetPos();
+    state->ufoShot = ufo->GetShotPos();
+    state->tankShot = tank->GetShotPos();
+    state->tankX = tank->GetPos();
+    state->ufoDirection = ufo->GetDirection();
+    state->tankOnFire = tank->IsOnFire() ? 1 : 0;
+    state->volume = (int8_t)(tvuSounds->GetVolume() * 10.0 + 0.5);
+    state->tanksKilled = tank->GetTanksKilled();
+    state->ufosKilled = ufo->GetUfosKilled();
 }
 
 
 void TankVUfo::PrintScore()
 {
-    mvwprintw(v20Win, Tvu::SCORE_ROW, 5, "%d", tank->GetTanksKilled());
-    mvwprintw(v20Win, Tvu::SCORE_ROW, 15, "%d", ufo->GetUfosKilled());
-    Refresh();
+    char score[4];
+
+    /* not mvwprintw(), the render stage may be formatting the HUD */
+    snprintf(score, sizeof(score), "%d", tank->GetTanksKilled());
+    mvwaddstr(v20Pad, Tvu::SCORE_ROW, 5, score);
+    snprintf(score, sizeof(score), "%d", ufo->GetUfosKilled());
+    mvwaddstr(v20Pad, Tvu::SCORE_ROW, 15, score);
 }
 
 
 void TankVUfo::InitializeV20Win(void)
 {
-    /* set the window color scheme */
-    init_pair(2, COLOR_BLACK, COLOR_WHITE);
-    wbkgd(v20Win, COLOR_PAIR(2));
+    /* set the window color scheme (black on white default pair) */
+    wbkgd(v20Pad, COLOR_PAIR(0));
+    wbkgd(v20Win, COLOR_PAIR(0));
+    leaveok(v20Win, TRUE);     /* don't send cursor moves, it's hidden */
 
     /* pair 3 will be for fire */
     init_pair(3, COLOR_RED, COLOR_WHITE);
 
     /* print the banner */
-    wprintw(v20Win, "** TANK VERSUS UFO. **");
-    wprintw(v20Win, "Z-LEFT,C-RIGHT,B-FIRE ");
-    wprintw(v20Win, "UFO:     TANK:");
+    wprintw(v20Pad, "** TANK VERSUS UFO. **");
+    wprintw(v20Pad, "Z-LEFT,C-RIGHT,B-FIRE ");
+    wprintw(v20Pad, "UFO:     TANK:");
 
     DrawGround();
-
-    wtimeout(v20Win, 0);           /* make wgetch non-blocking */
 }
 
 
+/*
+ * A pad for the game objects to draw on and a window that shows it, no
+ * bigger than a published frame.  Returns false with errno set if either
+ * can't be made.
+ */
 bool TankVUfo::MakeV20Win(int rows, int cols, int begin_x, int begin_y)
 {
-    bool result;
-    result = false;
+    if ((rows > Tvu::V20_ROWS) || (cols > Tvu::V20_COLS))
+    {
+        errno = EINVAL;
+        return false;
+    }
+
+    v20Pad = newpad(rows, cols);
+
+    if (nullptr == v20Pad)
+    {
+        return false;
+    }
 
     v20Win = newwin(rows, cols, begin_x, begin_y);
 
-    if (v20Win != nullptr)
+    if (nullptr == v20Win)
     {
-        result = true;
-        v20Rows = rows;
-        v20Cols = cols;
+        delwin(v20Pad);
+        v20Pad = nullptr;
+        return false;
     }
 
-    return result;
+    v20Rows = rows;
+    v20Cols = cols;
+    return true;
 }
 
 
@@ -160,43 +869,58 @@ void TankVUfo::DrawGround(void)
 {
     static cchar_t GROUND_CHAR = {WA_NORMAL, L"▔", 0};
 
-    mvwhline_set(v20Win, v20Rows - 1, 0, &GROUND_CHAR, v20Cols);
+    mvwhline_set(v20Pad, v20Rows - 1, 0, &GROUND_CHAR, v20Cols);
 }
 
 
+/* like MakeV20Win, and lists the added commands on the screen */
 bool TankVUfo::MakeVolWin(int rows, int cols, int begin_x, int begin_y)
 {
-    bool result;
-    result = false;
+    if ((rows > Tvu::VOL_ROWS) || (cols > Tvu::VOL_COLS))
+    {
+        errno = EINVAL;
+        return false;
+    }
 
-    volWin = newwin(rows, cols, begin_x, begin_y);
+    volPad = newpad(rows, cols);
 
-    if (volWin != nullptr)
+    if (nullptr == volPad)
     {
-        result = true;
-        volRows = rows;
-        volCols = cols;
+        return false;
+    }
 
-        /* list of commands not in the original game */
-        attron(A_UNDERLINE);
-        mvprintw(2, 5, "ADDED COMMANDS");
-        attroff(A_UNDERLINE);
-        mvprintw(3, 2, "Q        - QUIT GAME");
-        mvprintw(4, 2, "PLUS(+)  - VOLUME UP");
-        mvprintw(5, 2, "MINUS(-) - VOLUME DOWN");
+    volWin = newwin(rows, cols, begin_x, begin_y);
+
+    if (nullptr == volWin)
+    {
+        delwin(volPad);
+        volPad = nullptr;
+        return false;
     }
 
-    return result;
+    volRows = rows;
+    volCols = cols;
+
+    /* list of commands not in the original game */
+    attron(A_UNDERLINE);
+    mvprintw(2, 5, "ADDED COMMANDS");
+    attroff(A_UNDERLINE);
+    mvprintw(3, 2, "Q        - QUIT GAME");
+    mvprintw(4, 2, "PLUS(+)  - VOLUME UP");
+    mvprintw(5, 2, "MINUS(-) - VOLUME DOWN");
+    return true;
 }
 
 
 void TankVUfo::DrawVolumeLevelBox(void)
 {
-    wbkgd(volWin, COLOR_PAIR(2));
-    box(volWin, 0, 0);
-    mvwaddch(volWin, 1, 1, '+');
-    mvwaddch(volWin, volRows - 3, 1, '-');
-    mvwaddstr(volWin, volRows - 2, 1, " VOLUME ");
+    wbkgd(volPad, COLOR_PAIR(0));
+    wbkgd(volWin, COLOR_PAIR(0));
+    leaveok(volWin, TRUE);
+    box(volPad, 0, 0);
+    mvwaddch(volPad, 1, 1, '+');
+    mvwaddch(volPad, volRows - 3, 1, '-');
+    mvwaddstr(volPad, volRows - 2, 1, " VOLUME ");
 }
 
 
@@ -210,15 +934,107 @@ void TankVUfo::ShowVolumeLevel(const float volume)
     startY = (volRows - 2) - bars;
 
     /* erase old bar */
-    mvwvline(volWin, volRows - 2 - 10, 4, ' ', 10);
-    mvwvline(volWin, volRows - 2 - 10, 5, ' ', 10);
+    mvwvline(volPad, volRows - 2 - 10, 4, ' ', 10);
+    mvwvline(volPad, volRows - 2 - 10, 5, ' ', 10);
 
     /* draw new bar in color pair 3 color (same as fire) */
-    wattron(volWin, COLOR_PAIR(3));
-    mvwvline_set(volWin, startY, 4, &BOX_CHAR, bars);
-    mvwvline_set(volWin, startY, 5, &BOX_CHAR, bars);
-    wattron(volWin, COLOR_PAIR(3));
-    wrefresh(volWin);
+    wattron(volPad, COLOR_PAIR(3));
+    mvwvline_set(volPad, startY, 4, &BOX_CHAR, bars);
+    mvwvline_set(volPad, startY, 5, &BOX_CHAR, bars);
+    wattroff(volPad, COLOR_PAIR(3));
+}
+
+
+/* mark rows as changed, clipped to the window */
+static void TouchRows(WINDOW *win, int y, int n)
+{
+    int rows;
+
+    rows = getmaxy(win);
+
+    if (y + n > rows)
+    {
+        n = rows - y;
+    }
+
+    if (n > 0)
+    {
+        wtouchln(win, y, n, 1);
+    }
+}
+
+
+/*
+ * Resize the screen and move the windows.  The windows keep their
+ * contents, so only the parts of the screen that the windows left, the
+ * windows themselves, and any newly exposed screen are recomposited.
+ */
+void TankVUfo::Relayout(int lines, int cols, const Tvu::Layout *layout)
+{
+    int oldLines, oldCols;
+    int v20Y, v20X, volY, volX;
+    int hudY, hudX;
+
+    if ((lines == LINES) && (cols == COLS))
+    {
+        return;
+    }
+
+    oldLines = LINES;
+    oldCols = COLS;
+    getbegyx(v20Win, v20Y, v20X);
+    getbegyx(volWin, volY, volX);
+
+    /* get the windows out of the way so resizeterm doesn't shrink them */
+    mvwin(v20Win, 0, 0);
+    mvwin(volWin, 0, 0);
+
+    if (nullptr != hudWin)
+    {
+        getbegyx(hudWin, hudY, hudX);
+        mvwin(hudWin, 0, 0);
+    }
+
+    resizeterm(lines, cols);
+    mvwin(v20Win, layout->v20Y, layout->v20X);
+    mvwin(volWin, layout->volY, layout->volX);
+
+    /* stdscr where the windows were */
+    TouchRows(stdscr, v20Y, v20Rows);
+    TouchRows(stdscr, volY, volRows);
+
+    if (nullptr != hudWin)
+    {
+        mvwin(hudWin, layout->hudY, layout->hudX);
+        TouchRows(stdscr, hudY, Tvu::HUD_ROWS);
+        touchwin(hudWin);
+    }
+
+    /* the new parts of the screen */
+    if (cols > oldCols)
+    {
+        touchwin(stdscr);
+    }
+    else if (lines > oldLines)
+    {
+        TouchRows(stdscr, oldLines, lines - oldLines);
+    }
+
+    wnoutrefresh(stdscr);
+    touchwin(volWin);
+    wnoutrefresh(volWin);
+    touchwin(v20Win);
+
+    /* the terminal's contents are unknown after a resize */
+    InvalidateOutput();
+
+    if (nullptr != ansiOut)
+    {
+        /* now, even if the last update is still waiting for the terminal */
+        ansiOut->Resize(LINES, COLS);
+    }
+
+    /* the game window is sent with the next Present() */
 }
 
 
@@ -227,11 +1043,12 @@ bool TankVUfo::InitializeVehicles()
     bool result;
     result = false;
 
-    tank = new Tank(v20Win, Tvu::SCORE_ROW + 1, *tvuSounds);
+    tank = arena.New<Tank>(v20Pad, Tvu::SCORE_ROW + 1, *tvuSounds);
 
     if (nullptr != tank)
     {
-        ufo = new Ufo(v20Win, Tvu::UFO_TOP, Tvu::UFO_BOTTOM, *tvuSounds);
+        ufo = arena.New<Ufo>(v20Pad, Tvu::UFO_TOP, Tvu::UFO_BOTTOM,
+            *tvuSounds);
 
         if (nullptr != ufo)
         {
@@ -294,71 +1111,51 @@ void TankVUfo::UpdateUfoShot(void)
 }
 
 
-int TankVUfo::HandleKeyPress()
+/*
+ * Handle the keys read since the last tick, recording them if there's a
+ * recorder.  Returns -1 if one of them was quit.
+ */
+int TankVUfo::TakeKeys(const char *keys, int count)
 {
-    int ch;
-    float vol;
+    int result;
 
-    nodelay(v20Win, TRUE); /* make sure we're in no delay mode */
     tank->SetDirection(Tvu::DIR_NONE);
-    ch = 0;
+    result = 0;
 
-    while (ERR != ch)
+    for (int i = 0; i < count; i++)
     {
-        /* read the next character from the keyboard buffer */
-        ch = wgetch(v20Win);
+        if (nullptr != recorder)
+        {
+            recorder->RecordKey(keys[i]);
+        }
+
+        if (HandleKey(keys[i]) < 0)
+        {
+            /* quit, the key has already been recorded */
+            result = -1;
+            break;
+        }
+    }
+
+    if (nullptr != recorder)
+    {
+        recorder->EndTick();
+    }
+
+    return result;
+}
 
-        switch(ch)
+
+int TankVUfo::ReplayKeys(const char *keys, int count)
+{
+    tank->SetDirection(Tvu::DIR_NONE);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (HandleKey(keys[i]) < 0)
         {
-            case ERR:   /* no more keys */
-                break;
-
-            case 'Q':
-            case 'q':
-                return -1;
-
-            case 'Z':
-            case 'z':
-                if (!tank->IsOnFire())
-                {
-                    tank->SetDirection(Tvu::DIR_LEFT);
-                }
-                break;
-
-            case 'C':
-            case 'c':
-                if (!tank->IsOnFire())
-                {
-                    tank->SetDirection(Tvu::DIR_RIGHT);
-                }
-                break;
-
-            case 'B':
-            case 'b':
-                /* shoot */
-                if (!tank->WasShotFired() && !tank->IsOnFire())
-                {
-                    /* there isn't a shot, so take it */
-                    tank->Shoot();
-                }
-                break;
-
-            case '+':
-            case '=':
-                /* increase the base volume */
-                vol = tvuSounds->IncrementVolume();
-                ShowVolumeLevel(vol);
-                break;
-
-            case '-':
-            case '_':
-                /* decrease the base volume */
-                vol = tvuSounds->DecrementVolume();
-                ShowVolumeLevel(vol);
-                break;
-
-            default:
-                break;
+            /* replay ended with a quit */
+            return -1;
         }
     }
 
@@ -366,6 +1163,64 @@ int TankVUfo::HandleKeyPress()
 }
 
 
+int TankVUfo::HandleKey(int ch)
+{
+    float vol;
+
+    switch(ch)
+    {
+        case 'Q':
+        case 'q':
+            return -1;
+
+        case 'Z':
+        case 'z':
+            if (!tank->IsOnFire())
+            {
+                tank->SetDirection(Tvu::DIR_LEFT);
+            }
+            break;
+
+        case 'C':
+        case 'c':
+            if (!tank->IsOnFire())
+            {
+                tank->SetDirection(Tvu::DIR_RIGHT);
+            }
+            break;
+
+        case 'B':
+        case 'b':
+            /* shoot */
+            if (!tank->WasShotFired() && !tank->IsOnFire())
+            {
+                /* there isn't a shot, so take it */
+                tank->Shoot();
+            }
+            break;
+
+        case '+':
+        case '=':
+            /* increase the base volume */
+            vol = tvuSounds->IncrementVolume();
+            ShowVolumeLevel(vol);
+            break;
+
+        case '-':
+        case '_':
+            /* decrease the base volume */
+            vol = tvuSounds->DecrementVolume();
+            ShowVolumeLevel(vol);
+            break;
+
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+
 void TankVUfo::CheckTankShot()
 {
     bool justHit;
@@ -375,62 +1230,21 @@ void TankVUfo::CheckTankShot()
     if (true == justHit)
     {
         /* just hit ufo */
+        TraceInstant("ufo hit");
         ufo->SetFalling();
 
         /* ufo shot magically disappears when ufo is hit */
         ufo->ClearShot(true);
     }
-
-    wrefresh(v20Win);
 }
 
 
 void TankVUfo::CheckUfoShot()
 {
-    int dx;
-    bool hit;
-    Tvu::Pos shotPos;
-
-    shotPos = ufo->GetShotPos();
-
-    if (shotPos.y < Tvu::TANK_GUN_ROW)
-    {
-        /* shot is above the tank */
-        return;
-    }
-
-    dx = shotPos.x - tank->GetPos();
-    hit = false;
-
-    /* check for hit by row */
-    if (Tvu::TANK_GUN_ROW == shotPos.y)
-    {
-        /* gun barrel row */
-        if (3 == dx)
-        {
-            hit = true;
-        }
-    }
-    else if (Tvu::TANK_TURRET_ROW == shotPos.y)
-    {
-        /* turret row */
-        if ((2 == dx) || (3 == dx))
-        {
-            hit = true;
-        }
-    }
-    else if (Tvu::TANK_TREAD_ROW == shotPos.y)
-    {
-        /* tread row */
-        if ((dx > 0) && (dx < 5))
-        {
-            hit = true;
-        }
-    }
-
-    if (hit)
+    if (tank->IsHitBy(ufo->GetShotPos()))
     {
         /* record tank hit, start fire sound, stop ufo shot */
+        TraceInstant("tank on fire");
         tank->SetOnFire(true);
         ufo->ClearShot(false);
     }
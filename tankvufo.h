@@ -34,12 +34,30 @@
 #define  __TANKVUFO_H
 
 #include "tvu_defs.h"
+#include "ansi_output.h"
+#include "vic_synth.h"
+#include "triple_buffer.h"
+#include "tick_stats.h"
+#include "arena.h"
 class Sounds;
+class AudioBackend;
+class Replay;
+class MotionOverlay;
 
+/*
+ * The game objects draw each tick into pads (the simulation's copy of the
+ * game field and volume window), and FinishTick() publishes a copy of the
+ * pads through a triple buffer.  The windows on the screen belong to the
+ * render stage, which shows the newest published frame, draws the motion
+ * overlay on it and sends it to the terminal, so the two stages can run on
+ * different threads.  ncurses isn't thread safe, so the render stage never
+ * touches a pad and the simulation never touches a window or the screen.
+ */
 class TankVUfo
 {
     public:
-        TankVUfo(void);
+        TankVUfo(const char *soundPack, vic_chip_t chip, AudioBackend *audio);
+        TankVUfo(SCREEN *screen);       /* headless, caller owns the screen */
         ~TankVUfo(void);
 
         /* vic-20 window methods */
@@ -53,33 +71,121 @@ class TankVUfo
         void DrawVolumeLevelBox(void);
         void ShowVolumeLevel(const float volume);
 
+        /* tick statistics window */
+        bool MakeHudWin(int begin_y, int begin_x);
+        void SetSimStats(const percentiles_t *sim, const percentiles_t *keys);
+
         bool InitializeVehicles(void);
 
+        /* move the windows to a new screen size */
+        void Relayout(int lines, int cols, const Tvu::Layout *layout);
+
         /* move and update objects */
         void MoveTank(void);
         void MoveUfo(void);
         void UpdateTankShot(void);
         void UpdateUfoShot(void);
 
-        int HandleKeyPress(void);
-        void Refresh(void) { wrefresh(v20Win); }
+        int TakeKeys(const char *keys, int count);
+        int ReplayKeys(const char *keys, int count);
+        void SetRecorder(Replay *replay) { recorder = replay; }
+
+        /* terminal output */
+        bool UseAnsiOutput(int fd);
+        void PublishFrame(void);
+        void Present(void);
+        void Refresh(void);
+        void WarmUpOutput(void);
+        int GetOutputFd(void) const;
+        bool IsOutputPending(void) const;
+        void DrainOutput(void);
+        void InvalidateOutput(void);
+        bool GetOutputStats(output_stats_t *stats) const;
+
+        /* sound mixer */
+        bool LoadSounds(const char *soundPack, vic_chip_t chip);
+        const char *SoundPackName(void) const;
+        int SoundPackError(void) const { return soundPackError; }
+        bool StartSound(AudioBackend *audio);
+        const char *SoundOutputName(void) const;
+        bool GetVoiceStats(voice_stats_t *stats) const;
+        bool GetTriggerStats(trigger_stats_t *stats) const;
+        bool GetCallbackStats(callback_stats_t *stats) const;
+        bool GetSampleLock(size_t *bytes, int *error) const;
+        int UseRealtimePriority(void);
+
+        /* frames drawn between game ticks */
+        bool UseMotionOverlay(void);
+        void StartTick(long long tickNs);
+        void FinishTick(void);
+        void RenderFrame(double fraction);
+        void GetFrameState(Tvu::FrameState *state) const;
+        void GetFrameLatency(Tvu::StageStats *stats) const;
+        void GetTickState(Tvu::TickState *state) const;
 
         static constexpr float VOLUME = 0.5;    /* base volume for sounds */
 
     private:
-        WINDOW *v20Win;
+        /* the pads after a tick, the cells have room for a terminator */
+        typedef struct
+        {
+            cchar_t v20[Tvu::V20_ROWS][Tvu::V20_COLS + 1];
+            cchar_t vol[Tvu::VOL_ROWS][Tvu::VOL_COLS + 1];
+            Tvu::FrameState state;
+            percentiles_t simUs;    /* recent tick times for the HUD */
+            percentiles_t keyMs;    /* recent key to tick times */
+            unsigned long long soundDrops;  /* sound commands dropped */
+            unsigned long tick;     /* frames published before this one */
+            long long publishNs;    /* CLOCK_MONOTONIC */
+        } tick_frame_t;
+
+        WINDOW *v20Pad;         /* drawn by the game objects */
+        WINDOW *v20Win;         /* on the screen */
         int v20Rows;
         int v20Cols;
 
+        WINDOW *volPad;
         WINDOW *volWin;
         int volRows;
         int volCols;
 
+        WINDOW *hudWin;         /* nullptr without a HUD */
+        percentiles_t simUs;    /* for the next frame, simulation only */
+        percentiles_t keyMs;
+
+        /* measured by the render stage for the HUD */
+        LiveHistogram renderTimes;      /* TSC cycles per update */
+        LiveHistogram flushCounts;      /* terminal updates per tick */
+        LiveHistogram byteCounts;       /* bytes output per tick */
+        unsigned long flushes;          /* terminal updates so far */
+        unsigned long tickFlushes;      /* flushes when the last tick shown */
+        size_t tickBytes;               /* bytes written by then */
+        unsigned long hudTicks;
+
+        /* the objects below are made in the arena, before the first tick */
+        Arena arena;
+
+        TripleBuffer<tick_frame_t> *frames;
+        unsigned long published;        /* simulation only */
+        unsigned long shown;            /* render stage only */
+        Tvu::StageStats frameLatency;   /* publish to shown on the screen */
+
         Tank *tank;
         Ufo *ufo;
 
         Sounds *tvuSounds;
+        int soundPackError;     /* errno if the sound pack didn't load */
+        Replay *recorder;       /* records key presses when not nullptr */
+        AnsiOutput *ansiOut;    /* nullptr when ncurses does the output */
+        MotionOverlay *motion;  /* nullptr when only ticks are drawn */
 
+        static size_t ArenaSize(void);
+        void InitializeCurses(void);
+        bool ShowLatestFrame(void);
+        void SendScreen(void);
+        void CountHudTick(void);
+        void DrawHud(const tick_frame_t *frame);
+        int HandleKey(int ch);
         void CheckTankShot(void);
         void CheckUfoShot(void);
 };
@@ -0,0 +1,217 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : tick_stats.cpp
+*   Purpose : Cheap timers (the CPU's time stamp counter) and histograms for
+*             the p50, p99 and max of the game loop's timings.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstring>
+#include <ctime>
+
+#include "tick_stats.h"
+
+static long long MonotonicNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/* count cycles over 20ms of CLOCK_MONOTONIC */
+static double Calibrate(void)
+{
+    struct timespec wait = {0, 20000000L};
+    uint64_t startCycles;
+    long long startNs;
+    uint64_t cycles;
+    long long ns;
+
+    startNs = MonotonicNs();
+    startCycles = TscNow();
+    nanosleep(&wait, nullptr);
+    cycles = TscNow() - startCycles;
+    ns = MonotonicNs() - startNs;
+
+    return (0 == cycles) ? 1.0 : (double)ns / cycles;
+}
+
+
+double TscNsPerCycle(void)
+{
+    /* initialized once, by whichever thread asks first */
+    static const double nsPerCycle = Calibrate();
+
+    return nsPerCycle;
+}
+
+
+const char *TscName(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return "tsc";
+#else
+    return "clock";
+#endif
+}
+
+
+void Histogram::Add(uint64_t value)
+{
+    int index;
+
+    if (value < SUB_BUCKETS)
+    {
+        index = (int)value;
+    }
+    else
+    {
+        int power;
+
+        /* the top 4 bits of the value pick the bucket */
+        power = 63 - __builtin_clzll(value);
+        index = SUB_BUCKETS * (power - 2) +
+            (int)((value >> (power - 3)) & (SUB_BUCKETS - 1));
+    }
+
+    bucket[index]++;
+    count++;
+
+    if (value > max)
+    {
+        max = value;
+    }
+}
+
+
+void Histogram::Merge(const Histogram &other)
+{
+    for (int i = 0; i < BUCKETS; i++)
+    {
+        bucket[i] += other.bucket[i];
+    }
+
+    count += other.count;
+
+    if (other.max > max)
+    {
+        max = other.max;
+    }
+}
+
+
+void Histogram::Clear(void)
+{
+    memset(bucket, 0, sizeof(bucket));
+    count = 0;
+    max = 0;
+}
+
+
+/* the middle of the bucket holding the value at fraction of the way up */
+double Histogram::Percentile(double fraction) const
+{
+    unsigned long rank;
+    unsigned long seen;
+    int i;
+
+    rank = (unsigned long)(fraction * count + 0.5);
+
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    seen = 0;
+
+    for (i = 0; i < BUCKETS - 1; i++)
+    {
+        seen += bucket[i];
+
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+
+    if (i < SUB_BUCKETS)
+    {
+        /* small values are counted exactly */
+        return i;
+    }
+    else
+    {
+        int shift;
+        double low;
+        double middle;
+
+        shift = i / SUB_BUCKETS - 1;
+        low = (double)((uint64_t)(SUB_BUCKETS + i % SUB_BUCKETS) << shift);
+        middle = low + (double)((1ULL << shift) - 1) / 2.0;
+
+        /* the largest value is known exactly */
+        return (middle > max) ? max : middle;
+    }
+}
+
+
+void Histogram::GetPercentiles(percentiles_t *p, double scale) const
+{
+    p->count = count;
+
+    if (0 == count)
+    {
+        p->p50 = 0.0;
+        p->p99 = 0.0;
+        p->max = 0.0;
+        return;
+    }
+
+    p->p50 = Percentile(0.50) * scale;
+    p->p99 = Percentile(0.99) * scale;
+    p->max = max * scale;
+}
+
+
+void LiveHistogram::EndWindow(void)
+{
+    previous = current;
+    current.Clear();
+}
+
+
+void LiveHistogram::GetPercentiles(percentiles_t *p, double scale) const
+{
+    Histogram both;
+
+    both = previous;
+    both.Merge(current);
+    both.GetPercentiles(p, scale);
+}
@@ -0,0 +1,133 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : tick_stats.h
+*   Purpose : Cheap timers (the CPU's time stamp counter) and histograms for
+*             the p50, p99 and max of the game loop's timings.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __TICK_STATS_H
+#define  __TICK_STATS_H
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <ctime>
+#endif
+
+/* the phases of a game tick, timed separately */
+typedef enum
+{
+    PHASE_KEYS,             /* handling the keys read since the last tick */
+    PHASE_MOVE_TANK,
+    PHASE_MOVE_UFO,
+    PHASE_TANK_SHOT,
+    PHASE_UFO_SHOT,
+    PHASE_SCORE,
+    NUM_TICK_PHASES
+} tick_phase_t;
+
+/* distribution of a measurement, in its own units */
+typedef struct
+{
+    double p50;
+    double p99;
+    double max;
+    unsigned long count;    /* 0 if nothing was measured */
+} percentiles_t;
+
+/*
+ * A timestamp in TSC cycles, a few nanoseconds to read.  This assumes an
+ * invariant TSC (every x86 processor of the last 15 years or so), other
+ * machines use CLOCK_MONOTONIC and a cycle is a nanosecond.
+ */
+static inline uint64_t TscNow(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
+/* nanoseconds per TSC cycle, measured the first time it's asked for */
+double TscNsPerCycle(void);
+const char *TscName(void);
+
+/*
+ * Counts values in buckets an eighth of a power of 2 wide, so percentiles
+ * are within 12.5% for any value and adding one is a few instructions.
+ * There's nothing to allocate, a histogram can be copied and merged.
+ */
+class Histogram
+{
+    public:
+        Histogram(void) { Clear(); }
+
+        void Add(uint64_t value);
+        void Merge(const Histogram &other);
+        void Clear(void);
+
+        /* values times scale (TscNsPerCycle() for cycles to ns) */
+        void GetPercentiles(percentiles_t *p, double scale) const;
+
+    private:
+        static const int SUB_BUCKETS = 8;
+        static const int BUCKETS = SUB_BUCKETS * (64 - 2);
+
+        uint32_t bucket[BUCKETS];
+        unsigned long count;
+        uint64_t max;
+
+        double Percentile(double fraction) const;
+};
+
+/*
+ * The recent values of a measurement: the window being filled and the one
+ * before it, so what's shown always covers at least a full window.
+ */
+class LiveHistogram
+{
+    public:
+        void Add(uint64_t value) { current.Add(value); }
+
+        /* start a new window, the oldest values are forgotten */
+        void EndWindow(void);
+        void GetPercentiles(percentiles_t *p, double scale) const;
+
+    private:
+        Histogram current;
+        Histogram previous;
+};
+
+#endif /* ndef  __TICK_STATS_H */
@@ -0,0 +1,386 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : make_pack.cpp
+*   Purpose : Builds a sound pack (see soundpack.h) from WAV files
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+
+#include "../soundpack.h"
+
+/*
+ * Each WAV file becomes one sound named after the file (without the
+ * directory or the .wav).  16 bit PCM and 32 bit float WAV files are
+ * accepted; files with more than one channel are mixed down to mono.  The
+ * sample rate is kept as it is, the game converts it if it has to.
+ */
+
+static const uint16_t WAVE_FORMAT_PCM = 1;
+static const uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+static const uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+typedef struct
+{
+    char name[PACK_NAME_SIZE];
+    float *samples;
+    uint32_t length;
+    uint32_t sampleRate;
+} wav_sound_t;
+
+
+static uint16_t Get16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+
+static uint32_t Get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+/* read the whole file, nullptr with errno set on failure */
+static unsigned char *ReadFile(const char *fileName, size_t *size)
+{
+    FILE *fp;
+    long len;
+    unsigned char *data;
+
+    fp = fopen(fileName, "rb");
+
+    if (nullptr == fp)
+    {
+        return nullptr;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    rewind(fp);
+    data = (unsigned char *)malloc(len > 0 ? len : 1);
+
+    if ((nullptr == data) || (fread(data, 1, len, fp) != (size_t)len))
+    {
+        free(data);
+        fclose(fp);
+        return nullptr;
+    }
+
+    fclose(fp);
+    *size = len;
+    return data;
+}
+
+
+/* load a WAV file as mono float samples, prints why if it can't */
+static bool LoadWav(const char *fileName, wav_sound_t *sound)
+{
+    unsigned char *data;
+    size_t size, pos;
+    const unsigned char *fmt, *samples;
+    uint32_t fmtSize, dataSize;
+    uint16_t format, channels, bits;
+    const char *base;
+    size_t nameLen;
+
+    data = ReadFile(fileName, &size);
+
+    if (nullptr == data)
+    {
+        perror(fileName);
+        return false;
+    }
+
+    if ((size < 12) || (memcmp(data, "RIFF", 4) != 0) ||
+        (memcmp(data + 8, "WAVE", 4) != 0))
+    {
+        fprintf(stderr, "%s: not a WAV file\n", fileName);
+        free(data);
+        return false;
+    }
+
+    /* find the format and data chunks */
+    fmt = nullptr;
+    samples = nullptr;
+    fmtSize = 0;
+    dataSize = 0;
+
+    for (pos = 12; pos + 8 <= size; )
+    {
+        uint32_t chunkSize = Get32(data + pos + 4);
+
+        if (chunkSize > size - pos - 8)
+        {
+            /* truncated, use what's there */
+            chunkSize = size - pos - 8;
+        }
+
+        if (0 == memcmp(data + pos, "fmt ", 4))
+        {
+            fmt = data + pos + 8;
+            fmtSize = chunkSize;
+        }
+        else if (0 == memcmp(data + pos, "data", 4))
+        {
+            samples = data + pos + 8;
+            dataSize = chunkSize;
+        }
+
+        /* chunks are padded to an even size */
+        pos += 8 + chunkSize + (chunkSize & 1);
+    }
+
+    if ((nullptr == fmt) || (fmtSize < 16) || (nullptr == samples))
+    {
+        fprintf(stderr, "%s: missing format or data\n", fileName);
+        free(data);
+        return false;
+    }
+
+    format = Get16(fmt);
+    channels = Get16(fmt + 2);
+    sound->sampleRate = Get32(fmt + 4);
+    bits = Get16(fmt + 14);
+
+    if ((WAVE_FORMAT_EXTENSIBLE == format) && (fmtSize >= 26))
+    {
+        /* the real format is the start of the sub-format GUID */
+        format = Get16(fmt + 24);
+    }
+
+    if ((0 == channels) || (0 == sound->sampleRate) ||
+        !(((WAVE_FORMAT_PCM == format) && (16 == bits)) ||
+        ((WAVE_FORMAT_IEEE_FLOAT == format) && (32 == bits))))
+    {
+        fprintf(stderr, "%s: only 16 bit PCM and 32 bit float are supported\n",
+            fileName);
+        free(data);
+        return false;
+    }
+
+    sound->length = dataSize / (channels * (bits / 8));
+
+    if (0 == sound->length)
+    {
+        /* the game won't load a pack with an empty sound */
+        fprintf(stderr, "%s: no samples\n", fileName);
+        free(data);
+        return false;
+    }
+
+    sound->samples = (float *)malloc(sizeof(float) * sound->length);
+
+    if (nullptr == sound->samples)
+    {
+        perror(fileName);
+        free(data);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < sound->length; i++)
+    {
+        float sum = 0.0f;
+
+        for (uint16_t c = 0; c < channels; c++)
+        {
+            const unsigned char *p = samples + (i * channels + c) * (bits / 8);
+
+            if (16 == bits)
+            {
+                sum += (int16_t)Get16(p) / 32768.0f;
+            }
+            else
+            {
+                uint32_t raw = Get32(p);
+                float value;
+
+                memcpy(&value, &raw, sizeof(value));
+                sum += value;
+            }
+        }
+
+        sound->samples[i] = sum / channels;
+    }
+
+    free(data);
+
+    /* name is the file name without the directory or extension */
+    base = strrchr(fileName, '/');
+    base = (nullptr == base) ? fileName : base + 1;
+    nameLen = strlen(base);
+
+    if ((nameLen > 4) && (0 == strcmp(base + nameLen - 4, ".wav")))
+    {
+        nameLen -= 4;
+    }
+
+    if (nameLen >= (size_t)PACK_NAME_SIZE)
+    {
+        fprintf(stderr, "%s: name longer than %d characters\n", fileName,
+            PACK_NAME_SIZE - 1);
+        free(sound->samples);
+        sound->samples = nullptr;
+        return false;
+    }
+
+    memset(sound->name, 0, sizeof(sound->name));
+    memcpy(sound->name, base, nameLen);
+    return true;
+}
+
+
+static bool WritePack(const char *fileName, const wav_sound_t *sounds,
+    int count)
+{
+    FILE *fp;
+    pack_header_t header;
+    pack_entry_t *entries;
+    uint32_t offset;
+    static const char padding[PACK_ALIGN] = {0};
+
+    entries = (pack_entry_t *)calloc(count, sizeof(pack_entry_t));
+
+    if (nullptr == entries)
+    {
+        perror(fileName);
+        return false;
+    }
+
+    /* samples start after the index, each on an aligned offset */
+    offset = sizeof(pack_header_t) + count * sizeof(pack_entry_t);
+
+    for (int i = 0; i < count; i++)
+    {
+        offset = (offset + PACK_ALIGN - 1) & ~(PACK_ALIGN - 1);
+        memcpy(entries[i].name, sounds[i].name, PACK_NAME_SIZE);
+        entries[i].offset = offset;
+        entries[i].length = sounds[i].length;
+        entries[i].sampleRate = sounds[i].sampleRate;
+        offset += sounds[i].length * sizeof(float);
+    }
+
+    memcpy(header.magic, PACK_MAGIC, sizeof(header.magic));
+    header.version = PACK_VERSION;
+    header.count = count;
+
+    fp = fopen(fileName, "wb");
+
+    if (nullptr == fp)
+    {
+        perror(fileName);
+        free(entries);
+        return false;
+    }
+
+    fwrite(&header, sizeof(header), 1, fp);
+    fwrite(entries, sizeof(pack_entry_t), count, fp);
+
+    for (int i = 0; i < count; i++)
+    {
+        long pos = ftell(fp);
+
+        fwrite(padding, 1, entries[i].offset - pos, fp);
+        fwrite(sounds[i].samples, sizeof(float), sounds[i].length, fp);
+    }
+
+    free(entries);
+
+    if (0 != ferror(fp))
+    {
+        perror(fileName);
+        fclose(fp);
+        return false;
+    }
+
+    if (0 != fclose(fp))
+    {
+        perror(fileName);
+        return false;
+    }
+
+    return true;
+}
+
+
+int main(int argc, char *argv[])
+{
+    wav_sound_t *sounds;
+    int count;
+    bool ok;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s pack file.wav [file.wav ...]\n", argv[0]);
+        fprintf(stderr, "  each sound is named after its WAV file\n");
+        return 1;
+    }
+
+    count = argc - 2;
+    sounds = (wav_sound_t *)calloc(count, sizeof(wav_sound_t));
+
+    if (nullptr == sounds)
+    {
+        perror("allocating sounds");
+        return 1;
+    }
+
+    ok = true;
+
+    for (int i = 0; ok && (i < count); i++)
+    {
+        ok = LoadWav(argv[i + 2], &sounds[i]);
+
+        for (int j = 0; ok && (j < i); j++)
+        {
+            if (0 == strcmp(sounds[i].name, sounds[j].name))
+            {
+                fprintf(stderr, "%s: more than one sound named %s\n",
+                    argv[i + 2], sounds[i].name);
+                ok = false;
+            }
+        }
+    }
+
+    if (ok)
+    {
+        ok = WritePack(argv[1], sounds, count);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        free(sounds[i].samples);
+    }
+
+    free(sounds);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,1117 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : replay_export.cpp
+*   Purpose : Renders a recorded game session, faster than real time, to
+*             an asciinema cast or a PPM/Y4M video frame sequence
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <ncurses.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cctype>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pty.h>
+#include <sys/ioctl.h>
+
+#include "../tankvufo.h"
+#include "../replay.h"
+#include "../sounds.h"
+#include "../audio_backend.h"
+
+/*
+ * The game is run headless against a pseudo-terminal, exactly as the
+ * output benchmark does, with the replay supplying the keys.  Time is
+ * simulated: tick n happens at n * TICK_MS and the frames in between are
+ * drawn by the motion overlay at the requested frame rate, so nothing
+ * waits on a timer.  Depending on the output file's extension:
+ *      .cast - asciinema v2 cast of the bytes the ANSI output sends
+ *      .y4m  - YUV4MPEG2 (4:2:0) video drawn from the virtual screen
+ *      .ppm  - one PPM image per frame, the name has a %d or %0Nd for
+ *              the frame number (frame%05d.ppm)
+ * Video frames are drawn from the ncurses virtual screen with a built in
+ * bitmap font, so they show what the game drew, not what a terminal
+ * happened to make of it.
+ *
+ * With -a the sound is written to a WAV file as well.  Each tick gets
+ * exactly TICK_MS of sound, so the file lines up with the video and is the
+ * same every time the replay is exported.
+ */
+
+typedef enum
+{
+    FORMAT_CAST,
+    FORMAT_Y4M,
+    FORMAT_PPM
+} format_t;
+
+static const char *TERM_TYPE = "xterm-256color";
+static const int DEFAULT_COLS = 80;
+static const int DEFAULT_LINES = 24;
+static const int DEFAULT_FPS = 30;
+static const unsigned long TICK_FRAMES = SAMPLE_RATE * Tvu::TICK_MS / 1000;
+
+/* character cell size in pixels, the 5x7 font is drawn at 2x */
+static const int CELL_W = 10;
+static const int CELL_H = 20;
+static const int FONT_TOP = 3;
+
+/* xterm's 8 colors */
+static const uint8_t PALETTE[8][3] =
+{
+    {0, 0, 0}, {205, 0, 0}, {0, 205, 0}, {205, 205, 0},
+    {0, 0, 238}, {205, 0, 205}, {0, 205, 205}, {229, 229, 229}
+};
+
+/* classic 5x7 font for ' ' to '~', one byte per column, bit 0 at the top */
+static const uint8_t FONT_5X7[95][5] =
+{
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00},
+    {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14},
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00},
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00},
+    {0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08},
+    {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02},
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31},
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39},
+    {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E},
+    {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00},
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06},
+    {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E},
+    {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41},
+    {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A},
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41},
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F},
+    {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E},
+    {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31},
+    {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F},
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07},
+    {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00},
+    {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40},
+    {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20},
+    {0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18},
+    {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E},
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00},
+    {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00},
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38},
+    {0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C},
+    {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C},
+    {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C},
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C},
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00},
+    {0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00},
+    {0x08, 0x04, 0x08, 0x10, 0x08}
+};
+
+/* box drawing segments from the center of the cell */
+static const int SEG_UP = 0x01;
+static const int SEG_DOWN = 0x02;
+static const int SEG_LEFT = 0x04;
+static const int SEG_RIGHT = 0x08;
+
+/* a cell the way it was last drawn into the video frame */
+typedef struct
+{
+    wchar_t ch;             /* 0 if never drawn */
+    short fg;
+    short bg;
+    bool underline;
+} video_cell_t;
+
+/* pixel masks of the glyphs drawn so far */
+static const int MAX_GLYPHS = 256;
+
+typedef struct
+{
+    wchar_t ch;
+    uint8_t mask[CELL_W * CELL_H];
+} glyph_t;
+
+typedef struct
+{
+    format_t format;
+    const char *outName;
+    FILE *outFile;
+    int cols;
+    int lines;
+    int width;              /* video frame size in pixels */
+    int height;
+    uint8_t *rgb;           /* video frame */
+    uint8_t *yuv;
+    video_cell_t *cells;    /* what each cell of the frame shows */
+    char *data;             /* terminal output for one cast event */
+    size_t dataLen;
+    size_t dataSize;
+    unsigned long frames;   /* frames (or cast events) written */
+    const char *audioName;  /* WAV file, nullptr for no sound */
+    const char *packName;   /* sound pack, nullptr for the default */
+    vic_chip_t chip;        /* emulated VIC instead of the sound pack */
+} export_t;
+
+
+static int BoxSegments(wchar_t ch)
+{
+    switch (ch)
+    {
+        case L'─': return SEG_LEFT | SEG_RIGHT;
+        case L'│': return SEG_UP | SEG_DOWN;
+        case L'┌': return SEG_DOWN | SEG_RIGHT;
+        case L'┐': return SEG_DOWN | SEG_LEFT;
+        case L'└': return SEG_UP | SEG_RIGHT;
+        case L'┘': return SEG_UP | SEG_LEFT;
+        case L'├': return SEG_UP | SEG_DOWN | SEG_RIGHT;
+        case L'┤': return SEG_UP | SEG_DOWN | SEG_LEFT;
+        case L'┬': return SEG_DOWN | SEG_LEFT | SEG_RIGHT;
+        case L'┴': return SEG_UP | SEG_LEFT | SEG_RIGHT;
+        case L'┼': return SEG_UP | SEG_DOWN | SEG_LEFT | SEG_RIGHT;
+        default: return 0;
+    }
+}
+
+
+/*
+ * true if pixel (px, py) of a cell showing ch is in the foreground color,
+ * the block and geometric characters the game uses are drawn from their
+ * shapes, printable ASCII comes from the 5x7 font, anything else is a box
+ */
+static bool GlyphPixel(wchar_t ch, int px, int py)
+{
+    double x, y, dx, dy;
+    int seg;
+
+    x = px + 0.5;
+    y = py + 0.5;
+    dx = x - CELL_W / 2.0;
+    dy = y - CELL_H / 2.0;
+
+    if ((ch >= L' ') && (ch <= L'~'))
+    {
+        int fy;
+
+        fy = (py - FONT_TOP) / 2;
+
+        if ((py < FONT_TOP) || (fy >= 7))
+        {
+            return false;
+        }
+
+        return (FONT_5X7[ch - L' '][px / 2] >> fy) & 1;
+    }
+
+    if ((ch >= L'▁') && (ch <= L'█'))
+    {
+        /* lower 1/8 to full block */
+        return y >= CELL_H * (1.0 - (ch - L'▁' + 1) / 8.0);
+    }
+
+    if ((ch >= L'▉') && (ch <= L'▏'))
+    {
+        /* left 7/8 to 1/8 block */
+        return x < CELL_W * (L'▐' - ch) / 8.0;
+    }
+
+    seg = BoxSegments(ch);
+
+    if (0 != seg)
+    {
+        bool horizontal, vertical;
+
+        horizontal = (fabs(dy) < 1.0) &&
+            (((seg & SEG_LEFT) && (dx < 1.0)) ||
+            ((seg & SEG_RIGHT) && (dx > -1.0)));
+        vertical = (fabs(dx) < 1.0) &&
+            (((seg & SEG_UP) && (dy < 1.0)) ||
+            ((seg & SEG_DOWN) && (dy > -1.0)));
+        return horizontal || vertical;
+    }
+
+    switch (ch)
+    {
+        case L'▔':
+            return y < CELL_H / 8.0;
+
+        case L'▐':
+            return x >= CELL_W / 2.0;
+
+        case L'▕':
+            return x >= CELL_W * 7.0 / 8.0;
+
+        case L'▖':
+            return (x < CELL_W / 2.0) && (y >= CELL_H / 2.0);
+
+        case L'▗':
+            return (x >= CELL_W / 2.0) && (y >= CELL_H / 2.0);
+
+        case L'▘':
+            return (x < CELL_W / 2.0) && (y < CELL_H / 2.0);
+
+        case L'▝':
+            return (x >= CELL_W / 2.0) && (y < CELL_H / 2.0);
+
+        case L'▒':
+            return (px + py) % 2;
+
+        case L'▪':
+            return (fabs(dx) < CELL_W * 0.2) && (fabs(dy) < CELL_W * 0.2);
+
+        case L'●':
+            return dx * dx + dy * dy < (CELL_W * 0.4) * (CELL_W * 0.4);
+
+        case L'•':
+        case L'·':
+            return dx * dx + dy * dy < (CELL_W * 0.2) * (CELL_W * 0.2);
+
+        case L'◢':
+            return y / CELL_H >= 1.0 - x / CELL_W;
+
+        case L'◣':
+            return y / CELL_H >= x / CELL_W;
+
+        case L'◤':
+            return y / CELL_H <= 1.0 - x / CELL_W;
+
+        case L'◥':
+            return y / CELL_H <= x / CELL_W;
+
+        case L'╲':
+            /* distance from the top left to bottom right diagonal */
+            return fabs(CELL_H * x - CELL_W * y) /
+                hypot(CELL_W, CELL_H) < 1.0;
+
+        case L'╱':
+            return fabs(CELL_H * x + CELL_W * y - CELL_W * CELL_H) /
+                hypot(CELL_W, CELL_H) < 1.0;
+
+        default:
+            /* unknown, outline the cell */
+            return (1 == px) || (CELL_W - 2 == px) || (1 == py) ||
+                (CELL_H - 2 == py);
+    }
+}
+
+
+/* pixel mask for ch, the masks are cached since the game uses few glyphs */
+static const uint8_t *GlyphMask(wchar_t ch)
+{
+    static glyph_t glyphs[MAX_GLYPHS];
+    static int glyphCount = 0;
+    glyph_t *glyph;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].ch == ch)
+        {
+            return glyphs[i].mask;
+        }
+    }
+
+    /* reuse the last slot if the cache is full */
+    glyph = &glyphs[(glyphCount < MAX_GLYPHS) ? glyphCount++ : MAX_GLYPHS - 1];
+    glyph->ch = ch;
+
+    for (int py = 0; py < CELL_H; py++)
+    {
+        for (int px = 0; px < CELL_W; px++)
+        {
+            glyph->mask[py * CELL_W + px] = GlyphPixel(ch, px, py);
+        }
+    }
+
+    return glyph->mask;
+}
+
+
+/*
+ * BT.601 4:2:0 conversion of one cell, chroma is the average of each 2x2
+ * block (cells are an even number of pixels in both directions)
+ */
+static void CellToYuv(export_t *exp, int row, int col)
+{
+    uint8_t *yPlane, *uPlane, *vPlane;
+    int w, h;
+
+    w = exp->width;
+    h = exp->height;
+    yPlane = exp->yuv;
+    uPlane = yPlane + w * h;
+    vPlane = uPlane + (w / 2) * (h / 2);
+
+    for (int y = row * CELL_H; y < (row + 1) * CELL_H; y++)
+    {
+        for (int x = col * CELL_W; x < (col + 1) * CELL_W; x++)
+        {
+            const uint8_t *p = exp->rgb + 3 * (y * w + x);
+
+            yPlane[y * w + x] = (uint8_t)(16.5 + (65.481 * p[0] +
+                128.553 * p[1] + 24.966 * p[2]) / 255.0);
+        }
+    }
+
+    for (int y = row * CELL_H / 2; y < (row + 1) * CELL_H / 2; y++)
+    {
+        for (int x = col * CELL_W / 2; x < (col + 1) * CELL_W / 2; x++)
+        {
+            double r, g, b;
+
+            r = g = b = 0.0;
+
+            for (int i = 0; i < 4; i++)
+            {
+                const uint8_t *p;
+
+                p = exp->rgb + 3 * ((2 * y + i / 2) * w + 2 * x + i % 2);
+                r += p[0] / 4.0;
+                g += p[1] / 4.0;
+                b += p[2] / 4.0;
+            }
+
+            uPlane[y * (w / 2) + x] = (uint8_t)(128.5 + (-37.797 * r -
+                74.203 * g + 112.0 * b) / 255.0);
+            vPlane[y * (w / 2) + x] = (uint8_t)(128.5 + (112.0 * r -
+                93.786 * g - 18.214 * b) / 255.0);
+        }
+    }
+}
+
+
+/* draw the cells of the virtual screen that changed into the frame */
+static void DrawScreen(export_t *exp)
+{
+    cchar_t cell;
+    wchar_t wch[CCHARW_MAX + 1];
+    attr_t attrs;
+    short pair, fg, bg;
+
+    for (int row = 0; row < exp->lines; row++)
+    {
+        for (int col = 0; col < exp->cols; col++)
+        {
+            video_cell_t *drawn;
+            const uint8_t *mask;
+            wchar_t ch;
+            bool underline;
+
+            mvwin_wch(newscr, row, col, &cell);
+            getcchar(&cell, wch, &attrs, &pair, nullptr);
+            pair_content(pair, &fg, &bg);
+
+            /* the game assumes black on white default colors */
+            fg = ((fg < 0) || (fg > 7)) ? COLOR_BLACK : fg;
+            bg = ((bg < 0) || (bg > 7)) ? COLOR_WHITE : bg;
+
+            if (attrs & A_REVERSE)
+            {
+                short tmp = fg;
+
+                fg = bg;
+                bg = tmp;
+            }
+
+            ch = (0 == wch[0]) ? L' ' : wch[0];
+
+            if (attrs & A_ALTCHARSET)
+            {
+                ch = AnsiOutput::AcsToUnicode(ch);
+            }
+
+            underline = (0 != (attrs & A_UNDERLINE));
+            drawn = &exp->cells[row * exp->cols + col];
+
+            if ((drawn->ch == ch) && (drawn->fg == fg) && (drawn->bg == bg) &&
+                (drawn->underline == underline))
+            {
+                continue;
+            }
+
+            drawn->ch = ch;
+            drawn->fg = fg;
+            drawn->bg = bg;
+            drawn->underline = underline;
+            mask = GlyphMask(ch);
+
+            for (int py = 0; py < CELL_H; py++)
+            {
+                uint8_t *pixel;
+
+                pixel = exp->rgb +
+                    3 * ((row * CELL_H + py) * exp->width + col * CELL_W);
+
+                for (int px = 0; px < CELL_W; px++, pixel += 3)
+                {
+                    bool on;
+
+                    on = mask[py * CELL_W + px] ||
+                        (underline && (CELL_H - 2 == py));
+                    memcpy(pixel, PALETTE[on ? fg : bg], 3);
+                }
+            }
+
+            if (FORMAT_Y4M == exp->format)
+            {
+                CellToYuv(exp, row, col);
+            }
+        }
+    }
+}
+
+
+static bool WriteY4mFrame(export_t *exp)
+{
+    size_t size;
+
+    size = exp->width * exp->height * 3 / 2;
+    fputs("FRAME\n", exp->outFile);
+    return fwrite(exp->yuv, 1, size, exp->outFile) == size;
+}
+
+
+static bool WritePpmFrame(export_t *exp)
+{
+    char name[4096];
+    FILE *fp;
+    bool ok;
+
+    /* OpenOutput() checked the name has just the frame number in it */
+    snprintf(name, sizeof(name), exp->outName, exp->frames);
+    fp = fopen(name, "wb");
+
+    if (nullptr == fp)
+    {
+        perror(name);
+        return false;
+    }
+
+    fprintf(fp, "P6\n%d %d\n255\n", exp->width, exp->height);
+    ok = (fwrite(exp->rgb, 3, exp->width * exp->height, fp) ==
+        (size_t)(exp->width * exp->height));
+    ok = (0 == fclose(fp)) && ok;
+    return ok;
+}
+
+
+/* one asciicast output event, the data is JSON string escaped */
+static bool WriteCastEvent(export_t *exp, double time)
+{
+    if (0 == exp->dataLen)
+    {
+        return true;
+    }
+
+    fprintf(exp->outFile, "[%.6f, \"o\", \"", time);
+
+    for (size_t i = 0; i < exp->dataLen; i++)
+    {
+        unsigned char c = exp->data[i];
+
+        if (('"' == c) || ('\\' == c))
+        {
+            fputc('\\', exp->outFile);
+            fputc(c, exp->outFile);
+        }
+        else if ((c < ' ') || (0x7F == c))
+        {
+            fprintf(exp->outFile, "\\u%04x", c);
+        }
+        else
+        {
+            /* UTF-8 passes through */
+            fputc(c, exp->outFile);
+        }
+    }
+
+    fputs("\"]\n", exp->outFile);
+    exp->dataLen = 0;
+    exp->frames++;
+    return !ferror(exp->outFile);
+}
+
+
+/* collect everything the game has written to the terminal */
+static bool ReadPty(export_t *exp, int master, TankVUfo *tvu)
+{
+    for (;;)
+    {
+        ssize_t got;
+
+        if (exp->dataSize - exp->dataLen < 4096)
+        {
+            char *bigger;
+
+            bigger = (char *)realloc(exp->data, exp->dataSize * 2);
+
+            if (nullptr == bigger)
+            {
+                perror("growing output buffer");
+                return false;
+            }
+
+            exp->data = bigger;
+            exp->dataSize *= 2;
+        }
+
+        got = read(master, exp->data + exp->dataLen,
+            exp->dataSize - exp->dataLen);
+
+        if (got > 0)
+        {
+            exp->dataLen += got;
+        }
+        else if (tvu->IsOutputPending())
+        {
+            /* the pty was full, let the output queue continue */
+            tvu->DrainOutput();
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+
+
+/* write the frame shown at time seconds into the clip */
+static bool WriteFrame(export_t *exp, double time)
+{
+    switch (exp->format)
+    {
+        case FORMAT_CAST:
+            return WriteCastEvent(exp, time);
+
+        case FORMAT_Y4M:
+            DrawScreen(exp);
+
+            if (!WriteY4mFrame(exp))
+            {
+                return false;
+            }
+
+            exp->frames++;
+            return true;
+
+        case FORMAT_PPM:
+            DrawScreen(exp);
+
+            if (!WritePpmFrame(exp))
+            {
+                return false;
+            }
+
+            exp->frames++;
+            return true;
+    }
+
+    return false;
+}
+
+
+/*
+ * true if name is safe to give snprintf() with the frame number: one %d or
+ * %0Nd and nothing else but %% (a literal %).
+ */
+static bool IsFramePattern(const char *name)
+{
+    int numbers;
+
+    numbers = 0;
+
+    for (const char *p = strchr(name, '%'); nullptr != p;
+        p = strchr(p, '%'))
+    {
+        p++;
+
+        if ('%' == *p)
+        {
+            p++;
+            continue;
+        }
+
+        if ('0' == *p)
+        {
+            /* zero padded to a width */
+            p++;
+
+            while (isdigit((unsigned char)*p))
+            {
+                p++;
+            }
+        }
+
+        if ('d' != *p)
+        {
+            return false;
+        }
+
+        numbers++;
+    }
+
+    return (1 == numbers);
+}
+
+
+static bool OpenOutput(export_t *exp, int *fps)
+{
+    const char *ext;
+
+    ext = strrchr(exp->outName, '.');
+
+    if ((nullptr != ext) && (0 == strcmp(ext, ".cast")))
+    {
+        exp->format = FORMAT_CAST;
+    }
+    else if ((nullptr != ext) && (0 == strcmp(ext, ".y4m")))
+    {
+        exp->format = FORMAT_Y4M;
+    }
+    else if ((nullptr != ext) && (0 == strcmp(ext, ".ppm")) &&
+        IsFramePattern(exp->outName))
+    {
+        exp->format = FORMAT_PPM;
+    }
+    else
+    {
+        fprintf(stderr, "%s: output must be a .cast, .y4m or "
+            "%%d (or %%0Nd) numbered .ppm file\n", exp->outName);
+        return false;
+    }
+
+    if ((FORMAT_CAST != exp->format) && (0 == *fps))
+    {
+        /* video needs frames, one per tick */
+        *fps = 1000 / Tvu::TICK_MS;
+    }
+
+    exp->width = exp->cols * CELL_W;
+    exp->height = exp->lines * CELL_H;
+    exp->dataSize = 65536;
+    exp->data = (char *)malloc(exp->dataSize);
+
+    if (FORMAT_CAST != exp->format)
+    {
+        exp->rgb = (uint8_t *)malloc(exp->width * exp->height * 3);
+        exp->yuv = (uint8_t *)malloc(exp->width * exp->height * 3 / 2);
+        exp->cells = (video_cell_t *)calloc(exp->cols * exp->lines,
+            sizeof(video_cell_t));
+
+        if ((nullptr == exp->rgb) || (nullptr == exp->yuv) ||
+            (nullptr == exp->cells))
+        {
+            perror("allocating video frame");
+            return false;
+        }
+    }
+
+    if (nullptr == exp->data)
+    {
+        perror("allocating output buffer");
+        return false;
+    }
+
+    if (FORMAT_PPM == exp->format)
+    {
+        /* a file per frame */
+        return true;
+    }
+
+    exp->outFile = fopen(exp->outName, "wb");
+
+    if (nullptr == exp->outFile)
+    {
+        perror(exp->outName);
+        return false;
+    }
+
+    if (FORMAT_CAST == exp->format)
+    {
+        fprintf(exp->outFile, "{\"version\": 2, \"width\": %d, "
+            "\"height\": %d, \"env\": {\"TERM\": \"%s\"}}\n",
+            exp->cols, exp->lines, TERM_TYPE);
+    }
+    else
+    {
+        fprintf(exp->outFile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+            exp->width, exp->height, *fps);
+    }
+
+    return true;
+}
+
+
+/*
+ * Play the replay from the start (the game has to be simulated from the
+ * beginning to get there) and write ticks startTick to endTick.
+ */
+static bool Export(export_t *exp, Replay *replay, int fps, int startTick,
+    int endTick)
+{
+    int master, slave;
+    struct winsize size;
+    FILE *ptyFile;
+    SCREEN *screen;
+    TankVUfo *tvu;
+    WavBackend *wav;
+    int winX, winY;
+    bool ok;
+    long frame;             /* next frame, counted from the clip start */
+
+    size.ws_row = exp->lines;
+    size.ws_col = exp->cols;
+    size.ws_xpixel = 0;
+    size.ws_ypixel = 0;
+
+    if (openpty(&master, &slave, nullptr, nullptr, &size) != 0)
+    {
+        perror("opening pseudo-terminal");
+        return false;
+    }
+
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+    ptyFile = fdopen(slave, "r+");
+    screen = newterm(TERM_TYPE, ptyFile, ptyFile);
+
+    if (nullptr == screen)
+    {
+        fprintf(stderr, "%s: unknown terminal type\n", TERM_TYPE);
+        fclose(ptyFile);
+        close(master);
+        return false;
+    }
+
+    srand(replay->GetSeed());
+    tvu = new TankVUfo(screen);
+    tvu->UseAnsiOutput(slave);
+    wav = nullptr;
+
+    if (nullptr != exp->audioName)
+    {
+        /* the game owns the backend, but the sound is rendered from here */
+        wav = new WavBackend(exp->audioName);
+
+        if (!tvu->LoadSounds(exp->packName, exp->chip))
+        {
+            fprintf(stderr, "sound pack %s: %s\n", tvu->SoundPackName(),
+                strerror(errno));
+            delete wav;
+            wav = nullptr;
+        }
+
+        if ((nullptr == wav) || !tvu->StartSound(wav))
+        {
+            delete tvu;
+            delscreen(screen);
+            fclose(ptyFile);
+            close(master);
+            return false;
+        }
+    }
+
+    /* same layout as main() */
+    winX = (COLS - Tvu::V20_COLS) / 2;
+    winY = (LINES - Tvu::V20_ROWS) / 2;
+    tvu->MakeV20Win(Tvu::V20_ROWS, Tvu::V20_COLS, winY, winX);
+    winY = (LINES - Tvu::VOL_ROWS) / 2;
+    winX += Tvu::V20_COLS + Tvu::VOL_COLS;
+    tvu->MakeVolWin(Tvu::VOL_ROWS, Tvu::VOL_COLS, winY, winX);
+    wnoutrefresh(stdscr);
+    tvu->InitializeV20Win();
+    tvu->DrawVolumeLevelBox();
+    tvu->ShowVolumeLevel(TankVUfo::VOLUME);
+    tvu->InitializeVehicles();
+    tvu->PrintScore();
+
+    if (fps * Tvu::TICK_MS > 1000)
+    {
+        /* more frames than ticks, draw the motion between them */
+        tvu->UseMotionOverlay();
+    }
+
+    tvu->Refresh();
+    replay->Rewind();
+    ok = true;
+    frame = 0;
+
+    for (int tick = 0; ok && ((endTick < 0) || (tick <= endTick)); tick++)
+    {
+        const char *keys;
+        int count;
+
+        ok = ReadPty(exp, master, tvu);
+
+        if (tick == startTick)
+        {
+            /* start the clip with a full screen and a hidden cursor */
+            exp->dataLen = 0;
+            tvu->InvalidateOutput();
+            tvu->Refresh();
+            memcpy(exp->data, "\033[?25l", 6);
+            exp->dataLen = 6;
+            ok = ok && ReadPty(exp, master, tvu);
+        }
+
+        if (nullptr != wav)
+        {
+            /* the sound started by the last tick, up to the next one */
+            if (tick >= startTick)
+            {
+                ok = ok && wav->Render(TICK_FRAMES);
+            }
+            else
+            {
+                wav->Discard(TICK_FRAMES);
+            }
+        }
+
+        if (ok && (tick >= startTick))
+        {
+            double tickTime;
+
+            tickTime = (tick - startTick) * Tvu::TICK_MS / 1000.0;
+
+            if (FORMAT_CAST == exp->format)
+            {
+                /* the tick's own update */
+                ok = WriteFrame(exp, tickTime);
+            }
+
+            /* frames until the next tick */
+            while (ok && (0 != fps) && (1000.0 * frame / fps <
+                (tick - startTick + 1) * Tvu::TICK_MS))
+            {
+                double fraction;
+
+                fraction = (1000.0 * frame / fps) / Tvu::TICK_MS -
+                    (tick - startTick);
+                tvu->RenderFrame(fraction);
+                ok = ReadPty(exp, master, tvu) &&
+                    WriteFrame(exp, (double)frame / fps);
+                frame++;
+            }
+        }
+        else
+        {
+            exp->dataLen = 0;
+        }
+
+        /* next tick */
+        keys = replay->NextTick(&count);
+
+        if ((nullptr == keys) || (tvu->ReplayKeys(keys, count) < 0))
+        {
+            break;
+        }
+
+        /* its sound starts with the next tick's frames */
+        tvu->StartTick((tick + 1) * Tvu::TICK_MS * 1000000LL);
+        tvu->MoveTank();
+        tvu->MoveUfo();
+        tvu->UpdateTankShot();
+        tvu->UpdateUfoShot();
+        tvu->PrintScore();
+        tvu->FinishTick();
+        tvu->Present();
+    }
+
+    if ((nullptr != wav) && !wav->Finish())
+    {
+        fprintf(stderr, "%s: %s\n", exp->audioName, wav->ErrorText());
+        ok = false;
+    }
+
+    delete tvu;
+    delscreen(screen);
+    fclose(ptyFile);
+    close(master);
+    return ok;
+}
+
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-g colsxlines] [-f fps] [-s tick] [-e tick]"
+        " -o output\n       [-a file.wav [-p pack | -v ntsc|pal]] replay\n",
+        progName);
+    fprintf(stderr, "  -g size   terminal size (default %dx%d)\n",
+        DEFAULT_COLS, DEFAULT_LINES);
+    fprintf(stderr, "  -f fps    frames per second (default %d), 0 for "
+        "ticks only in a cast\n", DEFAULT_FPS);
+    fprintf(stderr, "  -s tick   first tick to export (default 0)\n");
+    fprintf(stderr, "  -e tick   last tick to export (default end of "
+        "replay)\n");
+    fprintf(stderr, "  -o output file.cast, file.y4m or frame%%05d.ppm\n");
+    fprintf(stderr, "  -a file   also write the sound to a WAV file\n");
+    fprintf(stderr, "  -p pack   sound pack to play (default %s next to "
+        "the game)\n", PACK_FILE_NAME);
+    fprintf(stderr, "  -v chip   generate the sounds with an emulated VIC-20"
+        " (ntsc or pal)\n");
+    fprintf(stderr, "  replay    session recorded with tankvufo -r\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    int opt;
+    int fps, startTick, endTick;
+    export_t exp;
+    Replay replay;
+    bool ok;
+
+    memset(&exp, 0, sizeof(exp));
+    exp.cols = DEFAULT_COLS;
+    exp.lines = DEFAULT_LINES;
+    fps = DEFAULT_FPS;
+    startTick = 0;
+    endTick = -1;
+    exp.chip = VIC_NONE;
+
+    while ((opt = getopt(argc, argv, "g:f:s:e:o:a:p:v:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'g':
+                if (sscanf(optarg, "%dx%d", &exp.cols, &exp.lines) != 2)
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
+
+            case 'f':
+                fps = atoi(optarg);
+                break;
+
+            case 's':
+                startTick = atoi(optarg);
+                break;
+
+            case 'e':
+                endTick = atoi(optarg);
+                break;
+
+            case 'o':
+                exp.outName = optarg;
+                break;
+
+            case 'a':
+                exp.audioName = optarg;
+                break;
+
+            case 'p':
+                exp.packName = optarg;
+                break;
+
+            case 'v':
+                if (0 == strcmp(optarg, "ntsc"))
+                {
+                    exp.chip = VIC_6560;
+                }
+                else if (0 == strcmp(optarg, "pal"))
+                {
+                    exp.chip = VIC_6561;
+                }
+                else
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((optind != argc - 1) || (nullptr == exp.outName) || (fps < 0) ||
+        (startTick < 0) || ((endTick >= 0) && (endTick < startTick)) ||
+        ((nullptr != exp.packName) && (VIC_NONE != exp.chip)))
+    {
+        ShowUsage(argv[0]);
+        return 1;
+    }
+
+    if ((exp.cols < Tvu::MIN_COLS) || (exp.lines < Tvu::MIN_LINES))
+    {
+        fprintf(stderr, "size must be at least %dx%d\n", Tvu::MIN_COLS,
+            Tvu::MIN_LINES);
+        return 1;
+    }
+
+    if (!replay.Load(argv[optind]))
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    if (!OpenOutput(&exp, &fps))
+    {
+        return 1;
+    }
+
+    /* UTF-8 output regardless of the caller's locale */
+    setlocale(LC_ALL, "C.UTF-8");
+
+    ok = Export(&exp, &replay, fps, startTick, endTick);
+
+    if ((nullptr != exp.outFile) && (0 != fclose(exp.outFile)))
+    {
+        perror(exp.outName);
+        ok = false;
+    }
+
+    free(exp.data);
+    free(exp.rgb);
+    free(exp.yuv);
+    free(exp.cells);
+
+    if (!ok)
+    {
+        return 1;
+    }
+
+    fprintf(stderr, "%lu %s written\n", exp.frames,
+        (FORMAT_CAST == exp.format) ? "events" : "frames");
+    return 0;
+}
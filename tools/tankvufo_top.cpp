@@ -0,0 +1,321 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : tankvufo_top.cpp
+*   Purpose : Shows the live metrics of every running game, like top.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+#include <csignal>
+#include <unistd.h>
+#include <dirent.h>
+
+#include "../metrics.h"
+
+/* games watched at once */
+static const int MAX_GAMES = 64;
+
+/* a game stalls when it hasn't ticked in this long */
+static const long long STALL_NS = 1000000000LL;
+
+typedef struct
+{
+    pid_t pid;
+    const metrics_page_t *page;
+    bool seen;                  /* in /dev/shm this time around */
+    bool havePrevious;
+    game_metrics_t game;        /* at the last update */
+    render_metrics_t render;
+} game_t;
+
+static void ShowUsage(const char *progName)
+{
+    fprintf(stderr, "Usage: %s [-i seconds] [-n count]\n", progName);
+    fprintf(stderr, "  -i seconds  time between updates (default 1)\n");
+    fprintf(stderr, "  -n count    updates to show before exiting (default"
+        " until interrupted)\n");
+}
+
+
+static long long NowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/* map the pages of games that have started since the last scan */
+static void ScanGames(game_t *games, int *count)
+{
+    DIR *dir;
+    struct dirent *entry;
+    size_t prefixLength;
+
+    for (int i = 0; i < *count; i++)
+    {
+        games[i].seen = false;
+    }
+
+    dir = opendir("/dev/shm");
+
+    if (nullptr == dir)
+    {
+        return;
+    }
+
+    prefixLength = strlen(METRICS_PREFIX);
+
+    while (nullptr != (entry = readdir(dir)))
+    {
+        const metrics_page_t *page;
+        pid_t pid;
+        int i;
+
+        if (0 != strncmp(entry->d_name, METRICS_PREFIX, prefixLength))
+        {
+            continue;
+        }
+
+        pid = atoi(entry->d_name + prefixLength);
+
+        for (i = 0; i < *count; i++)
+        {
+            if (games[i].pid == pid)
+            {
+                break;
+            }
+        }
+
+        if (i < *count)
+        {
+            games[i].seen = true;
+            continue;
+        }
+
+        if (*count == MAX_GAMES)
+        {
+            continue;
+        }
+
+        /* one that's still being made is picked up next time */
+        page = MetricsOpen(pid);
+
+        if (nullptr == page)
+        {
+            continue;
+        }
+
+        games[*count].pid = pid;
+        games[*count].page = page;
+        games[*count].seen = true;
+        games[*count].havePrevious = false;
+        (*count)++;
+    }
+
+    closedir(dir);
+
+    /* forget the games that have exited */
+    for (int i = 0; i < *count; )
+    {
+        if (games[i].seen)
+        {
+            i++;
+            continue;
+        }
+
+        MetricsClose(games[i].page);
+        games[i] = games[*count - 1];
+        (*count)--;
+    }
+}
+
+
+/* rates are over the time since the last update, the rest are totals */
+static void ShowGame(game_t *game, double seconds, long long nowNs)
+{
+    game_metrics_t g;
+    render_metrics_t r;
+    double tickUs;
+    double latencyMs;
+    double fps;
+    double bytesPerSecond;
+    const char *state;
+
+    if (!game->page->game.Read(&g) || !game->page->render.Read(&r))
+    {
+        printf("%7d  (busy)\n", (int)game->pid);
+        return;
+    }
+
+    tickUs = 0.0;
+    latencyMs = 0.0;
+    fps = 0.0;
+    bytesPerSecond = 0.0;
+
+    if (game->havePrevious)
+    {
+        if (g.ticks > game->game.ticks)
+        {
+            tickUs = (g.tickNs - game->game.tickNs) / 1e3 /
+                (g.ticks - game->game.ticks);
+        }
+
+        if (r.frames > game->render.frames)
+        {
+            latencyMs = (r.latencyNs - game->render.latencyNs) / 1e6 /
+                (r.frames - game->render.frames);
+        }
+
+        fps = (r.updates - game->render.updates) / seconds;
+        bytesPerSecond = (r.bytes - game->render.bytes) / seconds;
+    }
+
+    if ((0 != kill(game->pid, 0)) && (ESRCH == errno))
+    {
+        /* it crashed and left the page behind */
+        state = "gone";
+    }
+    else if ((g.ticks > 0) && (nowNs - g.lastTickNs > STALL_NS))
+    {
+        state = "stalled";
+    }
+    else
+    {
+        state = "ok";
+    }
+
+    printf("%7d %6ld %8llu %6llu %7.1f %7.1f %5llu %3u-%-3u %3u %6.1f %8.0f"
+        " %6.2f %7.2f  %s\n",
+        (int)game->pid, (long)(time(nullptr) - game->page->startTime),
+        (unsigned long long)g.ticks, (unsigned long long)g.overruns,
+        tickUs, g.tickMaxNs / 1e3, (unsigned long long)g.xruns,
+        g.ufosKilled, g.tanksKilled, g.volume, fps, bytesPerSecond,
+        latencyMs, r.latencyMaxNs / 1e6, state);
+
+    game->game = g;
+    game->render = r;
+    game->havePrevious = true;
+}
+
+
+int main(int argc, char *argv[])
+{
+    game_t games[MAX_GAMES];
+    int gameCount;
+    double interval;
+    long updates;
+    long long lastNs;
+    bool clear;
+    int opt;
+
+    interval = 1.0;
+    updates = -1;
+
+    while ((opt = getopt(argc, argv, "i:n:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'i':
+                interval = atof(optarg);
+
+                if (interval <= 0.0)
+                {
+                    ShowUsage(argv[0]);
+                    return 1;
+                }
+                break;
+
+            case 'n':
+                updates = atol(optarg);
+                break;
+
+            default:
+                ShowUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    /* a terminal gets a screen that updates in place, anything else a log */
+    clear = isatty(STDOUT_FILENO);
+    gameCount = 0;
+    lastNs = NowNs();
+
+    for (;;)
+    {
+        struct timespec wait;
+        long long nowNs;
+
+        ScanGames(games, &gameCount);
+        nowNs = NowNs();
+
+        if (clear)
+        {
+            printf("\033[H\033[J");
+        }
+
+        printf("%d games, TICK_US, FPS, B/s and LAT_MS are over the last %.1f"
+            " s, the rest are totals\n", gameCount, (nowNs - lastNs) / 1e9);
+        printf("    PID UPTIME    TICKS   LATE TICK_US  MAX_US XRUNS   SCORE"
+            " VOL    FPS      B/s LAT_MS  MAX_MS  STATE\n");
+
+        for (int i = 0; i < gameCount; i++)
+        {
+            ShowGame(&games[i], (nowNs - lastNs) / 1e9, nowNs);
+        }
+
+        fflush(stdout);
+        lastNs = nowNs;
+
+        if (updates > 0)
+        {
+            updates--;
+
+            if (0 == updates)
+            {
+                break;
+            }
+        }
+
+        wait.tv_sec = (time_t)interval;
+        wait.tv_nsec = (long)((interval - wait.tv_sec) * 1e9);
+        nanosleep(&wait, nullptr);
+    }
+
+    for (int i = 0; i < gameCount; i++)
+    {
+        MetricsClose(games[i].page);
+    }
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : trace.cpp
+*   Purpose : Low overhead tracing of the game, render and audio threads,
+*             written as Chrome trace JSON (chrome://tracing or Perfetto).
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include <cstdio>
+#include <cerrno>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "trace.h"
+
+typedef struct
+{
+    const char *name;
+    uint64_t start;         /* TSC cycles */
+    uint64_t end;           /* 0 for an instant */
+} trace_event_t;
+
+typedef struct
+{
+    trace_event_t *event;   /* nullptr if the pool ran out */
+    unsigned long count;    /* recorded, including those overwritten */
+    const char *name;
+    long tid;
+} trace_thread_t;
+
+std::atomic<bool> traceOn(false);
+
+static FILE *traceFp = nullptr;
+static uint64_t startCycles;
+static trace_thread_t thread[TRACE_THREADS];
+static std::atomic<int> threadCount(0);
+static trace_thread_t noThread = {nullptr, 0, nullptr, 0};
+
+/* the calling thread's buffer, taken from the pool by its first event */
+static thread_local trace_thread_t *self = nullptr;
+
+bool TraceStart(const char *fileName)
+{
+    traceFp = fopen(fileName, "w");
+
+    if (nullptr == traceFp)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < TRACE_THREADS; i++)
+    {
+        thread[i].event = new trace_event_t[TRACE_EVENTS];
+        thread[i].count = 0;
+        thread[i].name = nullptr;
+        thread[i].tid = 0;
+    }
+
+    startCycles = TscNow();
+    traceOn.store(true);
+    return true;
+}
+
+
+static trace_thread_t *Self(void)
+{
+    if (nullptr == self)
+    {
+        int i;
+
+        i = threadCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (i < TRACE_THREADS)
+        {
+            /* once per thread */
+            thread[i].tid = syscall(SYS_gettid);
+            self = &thread[i];
+        }
+        else
+        {
+            self = &noThread;
+        }
+    }
+
+    return self;
+}
+
+
+void TraceNameThread(const char *name)
+{
+    if (traceOn.load(std::memory_order_relaxed))
+    {
+        Self()->name = name;
+    }
+}
+
+
+void TraceRecord(const char *name, uint64_t start, uint64_t end)
+{
+    trace_thread_t *t;
+    trace_event_t *e;
+
+    t = Self();
+
+    if (nullptr == t->event)
+    {
+        return;
+    }
+
+    e = &t->event[t->count & (TRACE_EVENTS - 1)];
+    e->name = name;
+    e->start = start;
+    e->end = end;
+    t->count++;
+}
+
+
+/* microseconds since TraceStart() */
+static double TraceUs(uint64_t cycles, double usPerCycle)
+{
+    return (double)(int64_t)(cycles - startCycles) * usPerCycle;
+}
+
+
+static void WriteThread(const trace_thread_t *t, int pid, double usPerCycle)
+{
+    unsigned long first;
+
+    fprintf(traceFp, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+        "\"tid\":%ld,\"args\":{\"name\":\"%s\"}}", pid, t->tid,
+        (nullptr == t->name) ? "thread" : t->name);
+
+    /* the oldest event still in the buffer */
+    first = (t->count > TRACE_EVENTS) ? t->count - TRACE_EVENTS : 0;
+
+    for (unsigned long i = first; i < t->count; i++)
+    {
+        const trace_event_t *e = &t->event[i & (TRACE_EVENTS - 1)];
+
+        if (0 == e->end)
+        {
+            fprintf(traceFp, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"g\","
+                "\"ts\":%.3f,\"pid\":%d,\"tid\":%ld}", e->name,
+                TraceUs(e->start, usPerCycle), pid, t->tid);
+        }
+        else
+        {
+            fprintf(traceFp, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                "\"dur\":%.3f,\"pid\":%d,\"tid\":%ld}", e->name,
+                TraceUs(e->start, usPerCycle),
+                (e->end - e->start) * usPerCycle, pid, t->tid);
+        }
+    }
+}
+
+
+bool TraceFinish(void)
+{
+    double usPerCycle;
+    int threads;
+    int pid;
+    bool ok;
+
+    if (nullptr == traceFp)
+    {
+        return true;
+    }
+
+    traceOn.store(false);
+    usPerCycle = TscNsPerCycle() / 1000.0;
+    pid = getpid();
+    threads = threadCount.load();
+
+    if (threads > TRACE_THREADS)
+    {
+        threads = TRACE_THREADS;
+    }
+
+    fprintf(traceFp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+        "\"args\":{\"name\":\"tankvufo\"}}", pid);
+
+    for (int i = 0; i < threads; i++)
+    {
+        WriteThread(&thread[i], pid, usPerCycle);
+    }
+
+    fprintf(traceFp, "\n]}\n");
+    ok = true;
+
+    if (0 != ferror(traceFp))
+    {
+        errno = EIO;
+        ok = false;
+    }
+
+    if (0 != fclose(traceFp))
+    {
+        ok = false;
+    }
+
+    traceFp = nullptr;
+
+    for (int i = 0; i < TRACE_THREADS; i++)
+    {
+        delete[] thread[i].event;
+        thread[i].event = nullptr;
+    }
+
+    return ok;
+}
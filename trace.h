@@ -0,0 +1,90 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : trace.h
+*   Purpose : Low overhead tracing of the game, render and audio threads,
+*             written as Chrome trace JSON (chrome://tracing or Perfetto).
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __TRACE_H
+#define  __TRACE_H
+
+#include <cstdint>
+#include <atomic>
+
+#include "tick_stats.h"
+
+/* events kept per thread, older ones are overwritten */
+static const unsigned int TRACE_EVENTS = 32768;    /* must be a power of 2 */
+static const int TRACE_THREADS = 8;
+
+extern std::atomic<bool> traceOn;
+
+/*
+ * Each thread records into a buffer of its own, taken from a pool that's
+ * allocated by TraceStart(), so recording an event never locks, allocates
+ * or makes a system call and is safe in the audio callback.  Names must be
+ * string literals (only the pointer is kept).  Nothing is recorded until
+ * TraceStart() or after TraceFinish().
+ */
+
+/* create the file and the buffers, false with errno set on failure */
+bool TraceStart(const char *fileName);
+
+/*
+ * Write the events to the file and free the buffers.  Every thread that
+ * traced must be done.  Returns false with errno set if the file can't be
+ * written.
+ */
+bool TraceFinish(void);
+
+/* the name shown for the calling thread */
+void TraceNameThread(const char *name);
+
+/* end is 0 for an instant */
+void TraceRecord(const char *name, uint64_t start, uint64_t end);
+
+/* a span that started at start (TscNow()) and ends now */
+static inline void TraceSpan(const char *name, uint64_t start)
+{
+    if (traceOn.load(std::memory_order_relaxed))
+    {
+        TraceRecord(name, start, TscNow());
+    }
+}
+
+/* something that happened now, shown across every thread */
+static inline void TraceInstant(const char *name)
+{
+    if (traceOn.load(std::memory_order_relaxed))
+    {
+        TraceRecord(name, TscNow(), 0);
+    }
+}
+
+#endif /* ndef  __TRACE_H */
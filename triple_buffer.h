@@ -0,0 +1,96 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : triple_buffer.h
+*   Purpose : Lock-free triple buffer, hands the newest of a series of
+*             values from one thread to another without either waiting.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __TRIPLE_BUFFER_H
+#define  __TRIPLE_BUFFER_H
+
+#include <atomic>
+
+/*
+ * One thread writes values into the back slot and publishes them, another
+ * reads the newest value published.  Publishing swaps the back slot with
+ * the middle one, reading swaps the middle slot with the front one if
+ * something new was published, so the writer never waits for the reader,
+ * the reader never sees a value being written, and values the reader was
+ * too slow for are simply replaced.
+ *
+ * The slot a reader gets stays the same until its next Read(), so a large
+ * T can be used in place.  Only one thread may write and one may read.
+ */
+template <typename T>
+class TripleBuffer
+{
+    public:
+        TripleBuffer(void) : slot(), back(0), middle(1), front(2) {}
+
+        /* the slot to fill before Publish(), writer only */
+        T *WriteSlot(void) { return &slot[back]; }
+
+        /* make the write slot the newest value and get a new write slot */
+        void Publish(void)
+        {
+            back = middle.exchange(back | FRESH, std::memory_order_acq_rel) &
+                INDEX;
+        }
+
+        /*
+         * The newest value published, reader only.  fresh is false if it's
+         * the value returned by the last Read() (or if nothing has been
+         * published yet, then the value is T's default).
+         */
+        const T *Read(bool *fresh)
+        {
+            *fresh = (0 != (middle.load(std::memory_order_relaxed) & FRESH));
+
+            if (*fresh)
+            {
+                front = middle.exchange(front, std::memory_order_acq_rel) &
+                    INDEX;
+            }
+
+            return &slot[front];
+        }
+
+    private:
+        static const unsigned int INDEX = 0x03;   /* slot number */
+        static const unsigned int FRESH = 0x04;   /* middle not read yet */
+
+        T slot[3];
+
+        /* the writer's and reader's slots are kept apart from each other */
+        alignas(64) unsigned int back;      /* writer only */
+        alignas(64) std::atomic<unsigned int> middle;
+        alignas(64) unsigned int front;     /* reader only */
+};
+
+#endif /* ndef  __TRIPLE_BUFFER_H */
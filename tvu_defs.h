@@ -37,6 +37,9 @@
 class Tank;
 class Ufo;
 typedef struct sound_data_t sound_data_t;
+typedef struct voice_stats_t voice_stats_t;
+typedef struct trigger_stats_t trigger_stats_t;
+typedef struct callback_stats_t callback_stats_t;
 
 namespace Tvu
 {
@@ -57,6 +60,39 @@ namespace Tvu
         int8_t y;
     } Pos;
 
+    /* model state after a game tick, used to draw between ticks */
+    typedef struct
+    {
+        Pos ufo;                /* leftmost ufo cell */
+        int ufoDx;              /* -1 or 1 when flying level, otherwise 0 */
+        Pos ufoShot;            /* x < 0 if there's no shot falling */
+        int ufoShotDx;          /* -1 or 1 columns per row */
+        Pos tankShot;           /* x < 0 if there's no shot rising */
+    } FrameState;
+
+    /* compact model state after a game tick, kept by the flight recorder */
+    typedef struct
+    {
+        Pos ufo;
+        Pos ufoShot;
+        Pos tankShot;
+        int8_t tankX;           /* leftmost tank cell */
+        int8_t ufoDirection;    /* Direction */
+        int8_t tankOnFire;      /* 0 or 1 */
+        int8_t volume;          /* tenths */
+        uint8_t tanksKilled;    /* ufo's score */
+        uint8_t ufosKilled;     /* tank's score */
+    } TickState;
+
+    /* how long one stage of the game loop took over its steps */
+    typedef struct
+    {
+        unsigned long steps;    /* keys, ticks or frames handled */
+        long long ns;           /* total time */
+        long long maxNs;        /* longest step */
+        unsigned long missed;   /* deadlines (or keys, frames) missed */
+    } StageStats;
+
     /* vic-20 screen dimensions */
     constexpr int V20_COLS = 22;
     constexpr int V20_ROWS = 23;
@@ -77,6 +113,38 @@ namespace Tvu
     /* volume control window dimensions and positions */
     constexpr int VOL_COLS = 10;
     constexpr int VOL_ROWS = 13;
+
+    /* tick statistics window, shown below the volume window with -H */
+    constexpr int HUD_COLS = 27;
+    constexpr int HUD_ROWS = 9;
+
+    /* ticks per window of HUD statistics, the HUD shows the last two */
+    constexpr int HUD_WINDOW_TICKS = 25;
+
+    /* screen positions of the game windows */
+    typedef struct
+    {
+        int v20Y;
+        int v20X;
+        int volY;
+        int volX;
+        int hudY;
+        int hudX;
+    } Layout;
+
+    /*
+     * smallest screen the windows fit on, the game field is centered and
+     * the volume window is VOL_COLS to the right of it
+     */
+    constexpr int MIN_LINES = V20_ROWS;
+    constexpr int MIN_COLS = V20_COLS + 4 * VOL_COLS - 1;
+
+    /* game tick and default rate of the frames drawn between ticks */
+    constexpr int TICK_MS = 200;
+    constexpr int RENDER_HZ = 60;
+
+    /* longest wait for queued terminal output when the game ends */
+    constexpr int OUTPUT_FINISH_MS = 500;
 }
 
 #endif /* ndef  __TVU_DEFS_H */
@@ -32,9 +32,9 @@
 ****************************************************************************/
 #include <ncurses.h>
 #include <stdlib.h>
-#include <time.h>
 
 #include "ufo.h"
+#include "trace.h"
 
 /* cchar_t for unicode charaters used in this file */
 static const cchar_t GROUND_CHAR = {WA_NORMAL, L"▔", 0};
@@ -58,7 +58,7 @@ Ufo::Ufo(WINDOW *window, int upperLim, int lowerLim, Sounds &ufo_sounds) :
     win = window;
     getmaxyx(window, rows, cols);
 
-    srand((unsigned int)time(NULL));    /* seed the random number generator */
+    /* the random number generator is seeded by main() so replays repeat */
 }
 
 
@@ -182,6 +182,7 @@ void Ufo::Move(void)
                 direction = Tvu::DIR_LANDED;
                 ufoHitGround = 0;
                 ufoSounds.SelectSound(SOUND_ON_FIRE);
+                ufoSounds.StopSound(SOUND_LOW_FREQ);
             }
             else
             {
@@ -214,6 +215,7 @@ void Ufo::Move(void)
                 direction = Tvu::DIR_LANDED;
                 ufoHitGround = 0;
                 ufoSounds.SelectSound(SOUND_ON_FIRE);
+                ufoSounds.StopSound(SOUND_LOW_FREQ);
             }
             else
             {
@@ -233,7 +235,7 @@ void Ufo::Move(void)
                 mvwhline_set(win, rows - 1, 0, &GROUND_CHAR, cols);
 
                 /* stop the fire sound */
-                ufoSounds.SelectSound(SOUND_OFF);
+                ufoSounds.StopSound(SOUND_ON_FIRE);
 
                 numberDied += 1;      /* credit tank with kill */
             }
@@ -258,8 +260,6 @@ void Ufo::Move(void)
         default:
             break;      /* this shouldn't happen */
     }
-
-    wrefresh(win);
 }
 
 
@@ -275,7 +275,7 @@ uint8_t Ufo::GetUfosKilled(void) const
 }
 
 
-sound_error_t Ufo::SetFalling(void)
+void Ufo::SetFalling(void)
 {
     if (Tvu::DIR_LEFT == direction)
     {
@@ -288,17 +288,6 @@ sound_error_t Ufo::SetFalling(void)
 
     /* start the ufo falling sound */
     ufoSounds.NextUfoSound();
-    ufoSounds.RestartSoundStream();
-
-    sound_error_t soundError;
-    soundError = ufoSounds.GetError();
-
-    if (0 != soundError)
-    {
-        ufoSounds.HandleError();
-    }
-
-    return soundError;
 }
 
 
@@ -351,6 +340,7 @@ void Ufo::UfoShotDecision(void)
         }
 
         shotPos.y = pos.y;           /* UFO row */
+        TraceInstant("ufo fired");
     }
 }
 
@@ -378,7 +368,6 @@ void Ufo::MoveShot(void)
         /* done with shot */
         shotDirection = Tvu::DIR_NONE;
         shotHitGround = 1;
-        wrefresh(win);
         return;
     }
 
@@ -398,7 +387,6 @@ void Ufo::MoveShot(void)
 
     /* draw the new shot */
     mvwadd_wch(win, shotPos.y, shotPos.x, &UFO_SHOT_CHAR);
-    wrefresh(win);
 }
 
 
@@ -489,6 +477,5 @@ int Ufo::UpdateShotPhase(void)
             break;
     }
 
-    wrefresh(win);
     return clean_up;
 }
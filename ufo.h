@@ -44,14 +44,16 @@ class Ufo
         /* ufo shot movement and information */
         void Move(void);
         Tvu::Pos GetPos(void) const;
+        Tvu::Direction GetDirection(void) const { return direction; }
         uint8_t GetUfosKilled(void) const;
 
         /* start falling direction and sound */
-        sound_error_t SetFalling(void);
+        void SetFalling(void);
 
         /* ufo shot movement and information */
         void MoveShot(void);
         Tvu::Pos GetShotPos(void) const;
+        Tvu::Direction GetShotDirection(void) const { return shotDirection; }
         void ClearShot(bool erase);
         bool IsShotFalling(void) const;
         bool IsShotExploding(void) const;
@@ -0,0 +1,226 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : vic_synth.cpp
+*   Purpose : Emulation of the VIC-20's sound chip (the 6560 NTSC and 6561
+*             PAL VIC).  Sound effects are generated from a few bytes of
+*             register settings instead of being played from samples.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#include "vic_synth.h"
+
+/* sound clock of each chip, the bass voice divides it by 256 */
+static const double CLOCK_HZ[] =
+{
+    0.0,            /* VIC_NONE */
+    1022727.0,      /* VIC_6560 */
+    1108405.0       /* VIC_6561 */
+};
+
+static const uint32_t LFSR_SEED = 0xACE1;
+static const uint32_t LFSR_TAPS = 0xB400;   /* x^16 + x^14 + x^13 + x^11 + 1 */
+static const int MAX_VOLUME = 15 * 16;      /* volume is kept in 1/16ths */
+
+/* the phase increment for the voice register's frequency */
+static void SetIncrement(vic_state_t *state)
+{
+    double hz, increment, limit;
+
+    /* each voice is an octave above the one before it */
+    hz = CLOCK_HZ[state->chip] /
+        ((256 >> state->patch->voice) * (128 - (state->reg & 0x7F)));
+    increment = hz / state->sampleRate * 4294967296.0;
+
+    /*
+     * The PAL noise voice runs at up to 34.6 kHz, faster than a 22.05 or
+     * 32 kHz device.  A square wave is held at half the output rate rather
+     * than aliased, and the noise is clocked at most once a frame.
+     */
+    limit = (VIC_NOISE == state->patch->voice) ? 4294967295.0 : 2147483648.0;
+
+    if (increment > limit)
+    {
+        increment = limit;
+    }
+
+    state->increment = (uint32_t)increment;
+}
+
+
+void VicStart(vic_state_t *state, const vic_patch_t *patch, vic_chip_t chip,
+    int sampleRate, bool keepPhase)
+{
+    if (!keepPhase)
+    {
+        state->phase = 0;
+        state->lfsr = LFSR_SEED;
+        state->noise = 1.0f;
+    }
+
+    state->patch = patch;
+    state->chip = chip;
+    state->sampleRate = sampleRate;
+    state->reg = patch->reg;
+    state->volume = patch->volume * 16;
+    state->stepsLeft = patch->steps;
+    state->stepFrames = (patch->stepMs * sampleRate) / 1000;
+
+    if (state->stepFrames < 1)
+    {
+        state->stepFrames = 1;
+    }
+
+    state->frameCount = state->stepFrames;
+    SetIncrement(state);
+}
+
+
+/* the next step of the patch, the way a program would poke it */
+static void Step(vic_state_t *state)
+{
+    state->reg += state->patch->regStep;
+
+    if (state->reg < 128)
+    {
+        state->reg = 128;
+    }
+    else if (state->reg > 255)
+    {
+        state->reg = 255;
+    }
+
+    state->volume += state->patch->fade;
+
+    if (state->volume < 0)
+    {
+        state->volume = 0;
+    }
+    else if (state->volume > MAX_VOLUME)
+    {
+        state->volume = MAX_VOLUME;
+    }
+
+    state->frameCount = state->stepFrames;
+    SetIncrement(state);
+}
+
+
+static void RenderSquare(vic_state_t *state, float level, float *mix,
+    unsigned long frames)
+{
+    uint32_t phase = state->phase;
+    const uint32_t increment = state->increment;
+
+    for (unsigned long i = 0; i < frames; i++)
+    {
+        /* high for the first half of the cycle */
+        mix[i] += ((int32_t)phase >= 0) ? level : -level;
+        phase += increment;
+    }
+
+    state->phase = phase;
+}
+
+
+static void RenderNoise(vic_state_t *state, float level, float *mix,
+    unsigned long frames)
+{
+    uint32_t phase = state->phase;
+    uint32_t lfsr = state->lfsr;
+    float noise = state->noise;
+    const uint32_t increment = state->increment;
+
+    for (unsigned long i = 0; i < frames; i++)
+    {
+        uint32_t last = phase;
+
+        phase += increment;
+
+        if (phase < last)
+        {
+            /* the phase wrapped, clock the shift register */
+            uint32_t bit = lfsr & 1;
+
+            lfsr = (lfsr >> 1) ^ (LFSR_TAPS & (0 - bit));
+            noise = bit ? 1.0f : -1.0f;
+        }
+
+        mix[i] += level * noise;
+    }
+
+    state->phase = phase;
+    state->lfsr = lfsr;
+    state->noise = noise;
+}
+
+
+bool VicRender(vic_state_t *state, float gain, float *mix,
+    unsigned long frames)
+{
+    while (frames > 0)
+    {
+        unsigned long run;
+        float level;
+
+        run = state->frameCount;
+
+        if (run > frames)
+        {
+            run = frames;
+        }
+
+        /* the chip only sees the 4 bit volume register */
+        level = gain * (state->volume >> 4) / 15.0f;
+
+        if (VIC_NOISE == state->patch->voice)
+        {
+            RenderNoise(state, level, mix, run);
+        }
+        else
+        {
+            RenderSquare(state, level, mix, run);
+        }
+
+        mix += run;
+        frames -= run;
+        state->frameCount -= run;
+
+        if (0 == state->frameCount)
+        {
+            if ((state->stepsLeft > 0) && (0 == --state->stepsLeft))
+            {
+                /* done with this effect */
+                return false;
+            }
+
+            Step(state);
+        }
+    }
+
+    return true;
+}
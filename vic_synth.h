@@ -0,0 +1,106 @@
+/***************************************************************************
+*                              Tank Versus UFO
+*
+*   File    : vic_synth.h
+*   Purpose : Emulation of the VIC-20's sound chip (the 6560 NTSC and 6561
+*             PAL VIC).  Sound effects are generated from a few bytes of
+*             register settings instead of being played from samples.
+*   Author  : Michael Dipperstein
+*   Date    : October 18, 2026
+*
+****************************************************************************
+*
+* Tank Versus UFO: A tribute to the Tank-V-UFO, a Commodore VIC-20 Game
+*                  by Duane Later
+*
+* Copyright (C) 2026 by
+*       Michael Dipperstein (mdipperstein@gmail.com)
+*
+* This file is part of Tank Versus UFO.
+*
+* Tank Versus UFO is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by the
+* Free Software Foundation; either version 3 of the License, or (at your
+* option) any later version.
+*
+* Tank Versus UFO is distributed in the hope that it will be fun, but
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+* or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* for more details.
+*
+* You should have received a copy of the GNU General Public License along
+* with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+****************************************************************************/
+#ifndef  __VIC_SYNTH_H
+#define  __VIC_SYNTH_H
+
+#include <cstdint>
+
+/*
+ * The VIC has three square wave voices an octave apart (registers 36874 to
+ * 36876), a noise voice (36877) and a 4 bit volume (low nibble of 36878).
+ * A voice is on when bit 7 of its register is set and the other 7 bits
+ * (x) set its frequency to base / (128 - x), where base depends on the
+ * voice and on the chip's clock.  The noise voice clocks a shift register
+ * at its frequency instead of toggling.
+ *
+ * A patch is what a BASIC or machine language program would do to play an
+ * effect: poke a voice register and the volume, then step both every few
+ * milliseconds.
+ */
+
+/* which VIC is emulated, VIC_NONE plays the sound pack instead */
+typedef enum
+{
+    VIC_NONE,
+    VIC_6560,           /* NTSC */
+    VIC_6561            /* PAL */
+} vic_chip_t;
+
+typedef enum
+{
+    VIC_BASS,
+    VIC_ALTO,
+    VIC_SOPRANO,
+    VIC_NOISE,
+    NUM_VIC_VOICES
+} vic_voice_t;
+
+typedef struct
+{
+    uint8_t voice;      /* vic_voice_t */
+    uint8_t reg;        /* first voice register value, 128 - 255 */
+    int8_t regStep;     /* added to the voice register every step */
+    uint8_t volume;     /* first volume, 0 - 15 */
+    int8_t fade;        /* added to the volume every step, in 1/16ths */
+    uint8_t steps;      /* steps until the effect ends, 0 for never */
+    uint8_t stepMs;     /* milliseconds per step */
+} vic_patch_t;
+
+/* a voice playing a patch, owned by the audio callback */
+typedef struct
+{
+    const vic_patch_t *patch;
+    vic_chip_t chip;
+    int sampleRate;
+    uint32_t phase;         /* 32 bit phase accumulator */
+    uint32_t increment;     /* phase added per output sample */
+    uint32_t lfsr;          /* noise shift register */
+    int reg;                /* voice register */
+    int volume;             /* volume in 1/16ths of a step */
+    int stepsLeft;          /* 0 if the patch never ends */
+    int stepFrames;         /* frames per step */
+    int frameCount;         /* frames left in this step */
+    float noise;            /* noise output, held between shifts */
+} vic_state_t;
+
+/* start a patch, keepPhase continues the waveform (for pitch changes) */
+void VicStart(vic_state_t *state, const vic_patch_t *patch, vic_chip_t chip,
+    int sampleRate, bool keepPhase);
+
+/* add frames of the patch times gain to mix, false once it has ended */
+bool VicRender(vic_state_t *state, float gain, float *mix,
+    unsigned long frames);
+
+#endif /* ndef  __VIC_SYNTH_H */